@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+'''
+Convert a binary tracer log into the text format used by the debug log.
+
+How to run:
+1) generate a binary log
+GST_TRACERS="stats;rusage;latency" GST_TRACER_BINARY_LOG=trace.bin <application>
+
+2) convert it
+python3 gsttr-bin2txt.py trace.bin >trace.log
+
+The output can be fed into the other tracer tools (gsttr-stats.py, ...)
+like a regular text log.
+'''
+
+import argparse
+import struct
+import sys
+
+MAGIC = b'GSTTRACE'
+VERSION = 1
+BOM = 0x01020304
+
+RECORD_SCHEMA = 0x01
+RECORD_EVENT = 0x02
+
+# field type -> (struct format char, text type name)
+FIELD_TYPES = {
+    'int': ('i', 'gint'),
+    'uint': ('I', 'guint'),
+    'int64': ('q', 'gint64'),
+    'uint64': ('Q', 'guint64'),
+    'double': ('d', 'gdouble'),
+    'boolean': ('B', 'boolean'),
+    'pointer': ('Q', 'guint64'),
+    'string': (None, 'string'),
+}
+
+
+def format_time(ns):
+    (s, ns) = divmod(ns, 1000000000)
+    (m, s) = divmod(s, 60)
+    (h, m) = divmod(m, 60)
+    return '%d:%02d:%02d.%09d' % (h, m, s, ns)
+
+
+def format_value(type_name, value):
+    if type_name == 'string':
+        value = value.replace('\\', '\\\\').replace('"', '\\"')
+        return '(string)"%s"' % value
+    if type_name == 'boolean':
+        return '(boolean)%s' % ('true' if value else 'false')
+    return '(%s)%s' % (FIELD_TYPES[type_name][1], value)
+
+
+class Schema(object):
+    def __init__(self, spec):
+        parts = spec.split(' ')
+        self.name = parts[0]
+        self.fields = [tuple(p.split('=', 1)) for p in parts[1:]]
+
+
+def read_exactly(f, size):
+    data = f.read(size)
+    if len(data) != size:
+        raise EOFError()
+    return data
+
+
+def convert(infile, out):
+    header = read_exactly(infile, 16)
+    if header[0:8] != MAGIC:
+        raise ValueError('not a binary tracer log')
+    for endian in ('<', '>'):
+        (version, bom) = struct.unpack(endian + 'II', header[8:16])
+        if bom == BOM:
+            break
+    else:
+        raise ValueError('bad byte-order marker')
+    if version != VERSION:
+        raise ValueError('unsupported version %d' % version)
+
+    schemas = {}
+    while True:
+        tag = infile.read(1)
+        if not tag:
+            break
+        if tag[0] == RECORD_SCHEMA:
+            (sid, length) = struct.unpack(endian + 'II', read_exactly(infile, 8))
+            spec = read_exactly(infile, length).decode('utf-8')
+            schemas[sid] = Schema(spec)
+        elif tag[0] == RECORD_EVENT:
+            (sid, ts) = struct.unpack(endian + 'IQ', read_exactly(infile, 12))
+            schema = schemas[sid]
+            values = []
+            for (name, type_name) in schema.fields:
+                fmt = FIELD_TYPES[type_name][0]
+                if fmt is None:
+                    (length,) = struct.unpack(
+                        endian + 'H', read_exactly(infile, 2))
+                    value = read_exactly(infile, length).decode(
+                        'utf-8', errors='replace')
+                else:
+                    (value,) = struct.unpack(
+                        endian + fmt, read_exactly(infile, struct.calcsize(fmt)))
+                values.append('%s=%s' % (name, format_value(type_name, value)))
+            out.write('%s     0 0x0 TRACE GST_TRACER :0:: %s, %s;\n' % (
+                format_time(ts), schema.name, ', '.join(values)))
+        else:
+            raise ValueError('bad record tag 0x%02x' % tag[0])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument('file', nargs=1, help='binary log file')
+    args = parser.parse_args()
+
+    with open(args.file[0], 'rb') as infile:
+        try:
+            convert(infile, sys.stdout)
+        except EOFError:
+            sys.stderr.write('warning: truncated log\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -50,6 +50,11 @@
 #include <errno.h>
 #include <math.h>
 
+#ifdef G_OS_UNIX
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
 #include <gst/check/gsttestclock.h>
 #include "gst-validate-internal.h"
 #include "gst-validate-scenario.h"
@@ -267,6 +272,11 @@ struct _GstValidateScenarioPrivate
   gint dropped;
   gint max_dropped;
 
+  /* CPU time and wall clock baselines from when the scenario was created,
+   * used by the check-cpu-usage action */
+  GstClockTime start_cpu_time;
+  gint64 start_monotonic_time;
+
   /* 'switch-track action' currently waiting for
    * GST_MESSAGE_STREAMS_SELECTED to be completed. */
   GstValidateAction *pending_switch_track;
@@ -3382,6 +3392,179 @@ _execute_check_position (GstValidateScenario * scenario,
 
 }
 
+/* Returns the CPU time consumed by the process in nanoseconds, or
+ * GST_CLOCK_TIME_NONE when not supported on this platform */
+static GstClockTime
+_get_process_cpu_time (void)
+{
+#ifdef G_OS_UNIX
+  struct rusage usage;
+
+  if (getrusage (RUSAGE_SELF, &usage) != 0)
+    return GST_CLOCK_TIME_NONE;
+
+  return (GstClockTime) (usage.ru_utime.tv_sec +
+      usage.ru_stime.tv_sec) * GST_SECOND +
+      (GstClockTime) (usage.ru_utime.tv_usec +
+      usage.ru_stime.tv_usec) * GST_USECOND;
+#else
+  return GST_CLOCK_TIME_NONE;
+#endif
+}
+
+/* Returns the peak resident set size of the process in bytes, or 0 when
+ * not supported on this platform */
+static guint64
+_get_process_max_rss (void)
+{
+#ifdef G_OS_UNIX
+  struct rusage usage;
+
+  if (getrusage (RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+#ifdef __APPLE__
+  /* ru_maxrss is in bytes on macOS */
+  return (guint64) usage.ru_maxrss;
+#else
+  return (guint64) usage.ru_maxrss * 1024;
+#endif
+#else
+  return 0;
+#endif
+}
+
+/* Numbers in scenario files parse as int, int64 or double depending on
+ * how they were written, coerce whatever we got */
+static gboolean
+_get_structure_uint64 (const GstStructure * structure, const gchar * field,
+    guint64 * value)
+{
+  const GValue *gvalue = gst_structure_get_value (structure, field);
+
+  if (gvalue == NULL)
+    return FALSE;
+
+  switch (G_VALUE_TYPE (gvalue)) {
+    case G_TYPE_UINT64:
+      *value = g_value_get_uint64 (gvalue);
+      return TRUE;
+    case G_TYPE_INT64:
+      *value = g_value_get_int64 (gvalue);
+      return TRUE;
+    case G_TYPE_INT:
+      *value = g_value_get_int (gvalue);
+      return TRUE;
+    case G_TYPE_UINT:
+      *value = g_value_get_uint (gvalue);
+      return TRUE;
+    case G_TYPE_DOUBLE:
+      *value = g_value_get_double (gvalue);
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+static gboolean
+_get_structure_double (const GstStructure * structure, const gchar * field,
+    gdouble * value)
+{
+  const GValue *gvalue = gst_structure_get_value (structure, field);
+
+  if (gvalue == NULL)
+    return FALSE;
+
+  switch (G_VALUE_TYPE (gvalue)) {
+    case G_TYPE_DOUBLE:
+      *value = g_value_get_double (gvalue);
+      return TRUE;
+    case G_TYPE_INT:
+      *value = g_value_get_int (gvalue);
+      return TRUE;
+    case G_TYPE_UINT:
+      *value = g_value_get_uint (gvalue);
+      return TRUE;
+    case G_TYPE_INT64:
+      *value = g_value_get_int64 (gvalue);
+      return TRUE;
+    case G_TYPE_UINT64:
+      *value = g_value_get_uint64 (gvalue);
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+static GstValidateExecuteActionReturn
+_execute_check_cpu_usage (GstValidateScenario * scenario,
+    GstValidateAction * action)
+{
+  GstValidateScenarioPrivate *priv = scenario->priv;
+  GstValidateExecuteActionReturn res = GST_VALIDATE_EXECUTE_ACTION_OK;
+  GstClockTime cpu_time;
+  gdouble max_usage, usage;
+  gint64 elapsed;
+
+  REPORT_UNLESS (_get_structure_double (action->structure,
+          "max-usage-percent", &max_usage), done,
+      "Could not get `max-usage-percent` in %" GST_PTR_FORMAT,
+      action->structure);
+
+  cpu_time = _get_process_cpu_time ();
+  REPORT_UNLESS (GST_CLOCK_TIME_IS_VALID (cpu_time)
+      && GST_CLOCK_TIME_IS_VALID (priv->start_cpu_time), done,
+      "CPU usage measurement is not supported on this platform");
+
+  elapsed = g_get_monotonic_time () - priv->start_monotonic_time;
+  REPORT_UNLESS (elapsed > 0, done,
+      "No wall clock time elapsed since the scenario started");
+
+  /* elapsed is in microseconds, cpu time in nanoseconds. The usage can
+   * exceed 100% when several streaming threads are busy */
+  usage = 100.0 * (gdouble) (cpu_time - priv->start_cpu_time) /
+      ((gdouble) elapsed * 1000.0);
+
+  gst_validate_printf (action,
+      "CPU usage since the scenario started: %.2f%% (budget %.2f%%)\n",
+      usage, max_usage);
+
+  REPORT_UNLESS (usage <= max_usage, done,
+      "Process CPU usage %.2f%% is higher than the maximum allowed %.2f%%",
+      usage, max_usage);
+
+done:
+  return res;
+}
+
+static GstValidateExecuteActionReturn
+_execute_check_max_rss (GstValidateScenario * scenario,
+    GstValidateAction * action)
+{
+  GstValidateExecuteActionReturn res = GST_VALIDATE_EXECUTE_ACTION_OK;
+  guint64 max_allowed, max_rss;
+
+  REPORT_UNLESS (_get_structure_uint64 (action->structure, "max-bytes",
+          &max_allowed), done,
+      "Could not get `max-bytes` in %" GST_PTR_FORMAT, action->structure);
+
+  max_rss = _get_process_max_rss ();
+  REPORT_UNLESS (max_rss > 0, done,
+      "Resident set size measurement is not supported on this platform");
+
+  gst_validate_printf (action,
+      "Peak resident set size: %" G_GUINT64_FORMAT " bytes (budget %"
+      G_GUINT64_FORMAT ")\n", max_rss, max_allowed);
+
+  REPORT_UNLESS (max_rss <= max_allowed, done,
+      "Process peak resident set size %" G_GUINT64_FORMAT
+      " bytes is higher than the maximum allowed %" G_GUINT64_FORMAT
+      " bytes", max_rss, max_allowed);
+
+done:
+  return res;
+}
+
 static GstValidateExecuteActionReturn
 _execute_set_or_check_property (GstValidateScenario * scenario,
     GstValidateAction * action)
@@ -5078,6 +5261,8 @@ gst_validate_scenario_init (GstValidateScenario * scenario)
   priv->max_latency = GST_CLOCK_TIME_NONE;
   priv->max_dropped = -1;
   priv->clock = NULL;
+  priv->start_cpu_time = _get_process_cpu_time ();
+  priv->start_monotonic_time = g_get_monotonic_time ();
 
   g_mutex_init (&priv->lock);
 
@@ -7616,6 +7801,34 @@ register_action_types (void)
       /* FIXME: Make MT safe so it can be marked as GST_VALIDATE_ACTION_TYPE_CHECK */
       GST_VALIDATE_ACTION_TYPE_NONE);
 
+  REGISTER_ACTION_TYPE("check-cpu-usage", _execute_check_cpu_usage,
+      ((GstValidateActionParameter[]) {
+          { .name = "max-usage-percent",
+              .description = "The maximum process CPU usage in percent of one core,\n"
+                "averaged between the creation of the scenario and the execution\n"
+                "of the action. Can exceed 100 when several streaming threads are busy",
+              .mandatory = TRUE,
+              .types = "double",
+              NULL },
+        {NULL}
+      }),
+      "Check that the CPU usage of the process stays below a budget, to catch\n"
+      "performance regressions from scenarios run in CI.\n",
+      GST_VALIDATE_ACTION_TYPE_NONE | GST_VALIDATE_ACTION_TYPE_CHECK);
+
+  REGISTER_ACTION_TYPE("check-max-rss", _execute_check_max_rss,
+      ((GstValidateActionParameter[]) {
+          { .name = "max-bytes",
+              .description = "The maximum peak resident set size of the process in bytes",
+              .mandatory = TRUE,
+              .types = "uint64",
+              NULL },
+        {NULL}
+      }),
+      "Check that the peak resident set size of the process stays below a budget,\n"
+      "to catch memory usage regressions from scenarios run in CI.\n",
+      GST_VALIDATE_ACTION_TYPE_NONE | GST_VALIDATE_ACTION_TYPE_CHECK);
+
   REGISTER_ACTION_TYPE("check-current-pad-caps", _execute_check_pad_caps,
       ((GstValidateActionParameter[]) {
         {
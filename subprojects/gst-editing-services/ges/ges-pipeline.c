@@ -87,6 +87,11 @@ struct _GESPipelinePrivate
 
   GstEncodingProfile *profile;
 
+  /* Range of the timeline to render, GST_CLOCK_TIME_NONE to render all */
+  GstClockTime render_range_start;
+  GstClockTime render_range_end;
+  gboolean render_range_seek_pending;
+
   GThread *valid_thread;
 };
 
@@ -106,6 +111,7 @@ static GParamSpec *properties[PROP_LAST];
 
 static GstStateChangeReturn ges_pipeline_change_state (GstElement *
     element, GstStateChange transition);
+static void ges_pipeline_handle_message (GstBin * bin, GstMessage * message);
 
 static OutputChain *get_output_chain_for_track (GESPipeline * self,
     GESTrack * track);
@@ -383,6 +389,9 @@ ges_pipeline_class_init (GESPipelineClass * klass)
 
   element_class->change_state = GST_DEBUG_FUNCPTR (ges_pipeline_change_state);
 
+  GST_BIN_CLASS (klass)->handle_message =
+      GST_DEBUG_FUNCPTR (ges_pipeline_handle_message);
+
   /* TODO : Add state_change handlers
    * Don't change state if we don't have a timeline */
 }
@@ -393,6 +402,8 @@ ges_pipeline_init (GESPipeline * self)
   GST_INFO_OBJECT (self, "Creating new 'playsink'");
   self->priv = ges_pipeline_get_instance_private (self);
   self->priv->valid_thread = g_thread_self ();
+  self->priv->render_range_start = GST_CLOCK_TIME_NONE;
+  self->priv->render_range_end = GST_CLOCK_TIME_NONE;
 
   self->priv->playsink =
       gst_element_factory_make ("playsink", "internal-sinks");
@@ -607,6 +618,9 @@ ges_pipeline_change_state (GstElement * element, GstStateChange transition)
           ret = GST_STATE_CHANGE_FAILURE;
           goto done;
         }
+        /* The render range seek can only be sent once prerolled */
+        if (GST_CLOCK_TIME_IS_VALID (self->priv->render_range_start))
+          self->priv->render_range_seek_pending = TRUE;
       }
       _link_tracks (self);
       break;
@@ -645,6 +659,7 @@ ges_pipeline_change_state (GstElement * element, GstStateChange transition)
     case GST_STATE_CHANGE_PAUSED_TO_READY:
     case GST_STATE_CHANGE_READY_TO_NULL:
     case GST_STATE_CHANGE_NULL_TO_NULL:
+      self->priv->render_range_seek_pending = FALSE;
       _unlink_tracks (self);
       break;
     default:
@@ -655,6 +670,42 @@ done:
   return ret;
 }
 
+static void
+_seek_render_range (GESPipeline * self)
+{
+  GstClockTime start = self->priv->render_range_start;
+  GstClockTime end = self->priv->render_range_end;
+
+  GST_INFO_OBJECT (self, "Seeking to render range %" GST_TIME_FORMAT
+      " - %" GST_TIME_FORMAT, GST_TIME_ARGS (start), GST_TIME_ARGS (end));
+
+  if (!gst_element_seek (GST_ELEMENT_CAST (self), 1.0, GST_FORMAT_TIME,
+          GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE,
+          GST_SEEK_TYPE_SET, start,
+          GST_CLOCK_TIME_IS_VALID (end) ? GST_SEEK_TYPE_SET :
+          GST_SEEK_TYPE_NONE, end))
+    GST_ELEMENT_WARNING (self, RESOURCE, SEEK,
+        ("Failed to seek to the requested render range"),
+        ("Rendering the full timeline instead"));
+}
+
+static void
+ges_pipeline_handle_message (GstBin * bin, GstMessage * message)
+{
+  GESPipeline *self = GES_PIPELINE (bin);
+
+  /* The render range seek has to wait for preroll to complete, and can't
+   * be performed from the thread posting the message */
+  if (GST_MESSAGE_TYPE (message) == GST_MESSAGE_ASYNC_DONE &&
+      self->priv->render_range_seek_pending) {
+    self->priv->render_range_seek_pending = FALSE;
+    gst_element_call_async (GST_ELEMENT_CAST (self),
+        (GstElementCallAsyncFunc) _seek_render_range, NULL, NULL);
+  }
+
+  GST_BIN_CLASS (ges_pipeline_parent_class)->handle_message (bin, message);
+}
+
 static OutputChain *
 new_output_chain_for_track (GESPipeline * self, GESTrack * track)
 {
@@ -1151,6 +1202,46 @@ ges_pipeline_set_render_settings (GESPipeline * pipeline,
   return TRUE;
 }
 
+/**
+ * ges_pipeline_set_render_range:
+ * @pipeline: A #GESPipeline
+ * @start: The position in the timeline to render from
+ * @end: The position in the timeline to render up to, or
+ * #GST_CLOCK_TIME_NONE to render until the end
+ *
+ * Restricts rendering to the given range of the #GESPipeline:timeline
+ * instead of rendering it from start to finish. This allows splitting a
+ * timeline into time ranges and rendering the ranges on several
+ * processes or machines in parallel, with the resulting files
+ * concatenated afterwards.
+ *
+ * This method must be called before the pipeline starts rendering. The
+ * range is applied with an accurate seek once the pipeline has
+ * prerolled. Pass #GST_CLOCK_TIME_NONE as @start to render the full
+ * timeline again.
+ *
+ * Returns: %TRUE if the render range was successfully set on @pipeline.
+ *
+ * Since: 1.24
+ */
+gboolean
+ges_pipeline_set_render_range (GESPipeline * pipeline, GstClockTime start,
+    GstClockTime end)
+{
+  g_return_val_if_fail (GES_IS_PIPELINE (pipeline), FALSE);
+  g_return_val_if_fail (!GST_CLOCK_TIME_IS_VALID (end) ||
+      (GST_CLOCK_TIME_IS_VALID (start) && start < end), FALSE);
+  CHECK_THREAD (pipeline);
+
+  GST_DEBUG_OBJECT (pipeline, "render range: %" GST_TIME_FORMAT " - %"
+      GST_TIME_FORMAT, GST_TIME_ARGS (start), GST_TIME_ARGS (end));
+
+  pipeline->priv->render_range_start = start;
+  pipeline->priv->render_range_end = end;
+
+  return TRUE;
+}
+
 /**
  * ges_pipeline_get_mode:
  * @pipeline: A #GESPipeline
@@ -70,6 +70,10 @@ gboolean ges_pipeline_set_render_settings (GESPipeline *pipeline,
 						    const gchar * output_uri,
 						    GstEncodingProfile *profile);
 GES_API
+gboolean ges_pipeline_set_render_range (GESPipeline *pipeline,
+						    GstClockTime start,
+						    GstClockTime end);
+GES_API
 gboolean ges_pipeline_set_mode (GESPipeline *pipeline,
 					 GESPipelineFlags mode);
 
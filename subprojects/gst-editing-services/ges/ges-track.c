@@ -191,6 +191,31 @@ gap_new (GESTrack * track, GstClockTime start, GstClockTime duration)
   return new_gap;
 }
 
+/* Look for a gap with the same start and duration in @old_gaps and reuse
+ * it, so unchanged gaps don't get removed from and re-added to the
+ * composition on every commit. Creates a new gap when none matches */
+static Gap *
+gap_reuse_or_new (GESTrack * track, GList ** old_gaps, GstClockTime start,
+    GstClockTime duration)
+{
+  GList *l;
+
+  for (l = *old_gaps; l; l = l->next) {
+    Gap *gap = l->data;
+
+    if (gap->start == start && gap->duration == duration) {
+      GST_LOG_OBJECT (track,
+          "Reusing gap with start %" GST_TIME_FORMAT " duration %"
+          GST_TIME_FORMAT, GST_TIME_ARGS (start), GST_TIME_ARGS (duration));
+      *old_gaps = g_list_delete_link (*old_gaps, l);
+
+      return gap;
+    }
+  }
+
+  return gap_new (track, start, duration);
+}
+
 static void
 free_gap (Gap * gap)
 {
@@ -249,7 +274,7 @@ update_gaps (GESTrack * track)
 
     if (start > duration) {
       /* 2- Fill gap */
-      gap = gap_new (track, duration, start - duration);
+      gap = gap_reuse_or_new (track, &gaps, duration, start - duration);
 
       if (G_LIKELY (gap != NULL))
         priv->gaps = g_list_prepend (priv->gaps, gap);
@@ -263,7 +288,8 @@ update_gaps (GESTrack * track)
     g_object_get (priv->timeline, "duration", &timeline_duration, NULL);
 
     if (duration < timeline_duration) {
-      gap = gap_new (track, duration, timeline_duration - duration);
+      gap = gap_reuse_or_new (track, &gaps, duration,
+          timeline_duration - duration);
 
       if (G_LIKELY (gap != NULL)) {
         priv->gaps = g_list_prepend (priv->gaps, gap);
@@ -278,7 +304,7 @@ update_gaps (GESTrack * track)
 
   if (!track->priv->last_gap_disabled) {
     GST_DEBUG_OBJECT (track, "Adding a one second gap at the end");
-    gap = gap_new (track, timeline_duration, 1);
+    gap = gap_reuse_or_new (track, &gaps, timeline_duration, 1);
     priv->gaps = g_list_prepend (priv->gaps, gap);
   }
 
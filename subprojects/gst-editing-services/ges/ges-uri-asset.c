@@ -108,6 +108,10 @@ struct _GESUriClipAssetPrivate
   gboolean is_nested_timeline;
 
   GList *asset_trackfilesources;
+
+  /* Playbin kept prerolled between thumbnail requests, so scrubbing
+   * doesn't rebuild a decoding pipeline for every position */
+  GstElement *thumbnail_pipeline;
 };
 
 typedef struct
@@ -294,6 +298,11 @@ ges_uri_clip_asset_dispose (GObject * object)
 
   gst_clear_object (&prif->info);
 
+  if (prif->thumbnail_pipeline) {
+    gst_element_set_state (prif->thumbnail_pipeline, GST_STATE_NULL);
+    gst_clear_object (&prif->thumbnail_pipeline);
+  }
+
   G_OBJECT_CLASS (ges_uri_clip_asset_parent_class)->dispose (object);
 }
 
@@ -775,6 +784,106 @@ ges_uri_clip_asset_get_stream_assets (GESUriClipAsset * self)
   return self->priv->asset_trackfilesources;
 }
 
+/* Get the thumbnail pipeline in PAUSED, creating it on the first call */
+static GstElement *
+_get_thumbnail_pipeline (GESUriClipAsset * self, GError ** error)
+{
+  GESUriClipAssetPrivate *priv = self->priv;
+
+  if (priv->thumbnail_pipeline == NULL) {
+    GstElement *pipeline, *sink;
+
+    pipeline = gst_element_factory_make ("playbin", NULL);
+    if (pipeline == NULL) {
+      g_set_error (error, GES_ERROR, GES_ERROR_ASSET_LOADING,
+          "Could not create a playbin to extract thumbnails");
+      return NULL;
+    }
+
+    sink = gst_element_factory_make ("fakesink", NULL);
+    g_object_set (pipeline, "uri", ges_asset_get_id (GES_ASSET (self)),
+        /* video only */
+        "flags", 1, "video-sink", sink, NULL);
+
+    priv->thumbnail_pipeline = pipeline;
+  }
+
+  if (gst_element_set_state (priv->thumbnail_pipeline,
+          GST_STATE_PAUSED) == GST_STATE_CHANGE_FAILURE ||
+      gst_element_get_state (priv->thumbnail_pipeline, NULL, NULL,
+          GST_CLOCK_TIME_NONE) == GST_STATE_CHANGE_FAILURE) {
+    g_set_error (error, GES_ERROR, GES_ERROR_ASSET_LOADING,
+        "Could not preroll %s to extract thumbnails",
+        ges_asset_get_id (GES_ASSET (self)));
+    gst_element_set_state (priv->thumbnail_pipeline, GST_STATE_NULL);
+    gst_clear_object (&priv->thumbnail_pipeline);
+    return NULL;
+  }
+
+  return priv->thumbnail_pipeline;
+}
+
+/**
+ * ges_uri_clip_asset_extract_thumbnail:
+ * @self: A #GESUriClipAsset
+ * @position: The position in the media to get a thumbnail of
+ * @caps: (transfer none) (nullable): Some caps to convert the thumbnail
+ * to, or %NULL to get a thumbnail in the native format
+ * @error: An error to be set if extracting fails, or %NULL to ignore
+ *
+ * Extracts a video thumbnail of the media at the given position.
+ *
+ * The decoding pipeline used for the extraction is kept prerolled on
+ * @self until it is disposed, so requesting a series of thumbnails,
+ * e.g. while scrubbing, only pays the pipeline setup cost once.
+ *
+ * Returns: (transfer full) (nullable): A sample containing the
+ * thumbnail, or %NULL if one could not be extracted.
+ *
+ * Since: 1.24
+ */
+GstSample *
+ges_uri_clip_asset_extract_thumbnail (GESUriClipAsset * self,
+    GstClockTime position, GstCaps * caps, GError ** error)
+{
+  GstElement *pipeline;
+  GstSample *sample = NULL;
+
+  g_return_val_if_fail (GES_IS_URI_CLIP_ASSET (self), NULL);
+  g_return_val_if_fail (GST_CLOCK_TIME_IS_VALID (position), NULL);
+  g_return_val_if_fail (caps == NULL || GST_IS_CAPS (caps), NULL);
+  g_return_val_if_fail (error == NULL || *error == NULL, NULL);
+
+  if (!(pipeline = _get_thumbnail_pipeline (self, error)))
+    return NULL;
+
+  if (!gst_element_seek_simple (pipeline, GST_FORMAT_TIME,
+          GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE, position)) {
+    g_set_error (error, GES_ERROR, GES_ERROR_ASSET_LOADING,
+        "Could not seek to %" GST_TIME_FORMAT " in %s",
+        GST_TIME_ARGS (position), ges_asset_get_id (GES_ASSET (self)));
+    return NULL;
+  }
+
+  /* Wait for the new position to preroll, then convert the prerolled
+   * frame */
+  if (gst_element_get_state (pipeline, NULL, NULL,
+          GST_CLOCK_TIME_NONE) == GST_STATE_CHANGE_FAILURE) {
+    g_set_error (error, GES_ERROR, GES_ERROR_ASSET_LOADING,
+        "Could not preroll %s at %" GST_TIME_FORMAT,
+        ges_asset_get_id (GES_ASSET (self)), GST_TIME_ARGS (position));
+    return NULL;
+  }
+
+  g_signal_emit_by_name (pipeline, "convert-sample", caps, &sample);
+  if (sample == NULL)
+    g_set_error (error, GES_ERROR, GES_ERROR_ASSET_LOADING,
+        "Could not convert the frame at %" GST_TIME_FORMAT " of %s",
+        GST_TIME_ARGS (position), ges_asset_get_id (GES_ASSET (self)));
+
+  return sample;
+}
+
 /*****************************************************************
  *            GESUriSourceAsset implementation             *
  *****************************************************************/
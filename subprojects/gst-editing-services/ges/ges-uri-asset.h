@@ -81,6 +81,11 @@ void ges_uri_clip_asset_class_set_timeout           (GESUriClipAssetClass *klass
                                                      GstClockTime timeout);
 GES_API
 const GList * ges_uri_clip_asset_get_stream_assets  (GESUriClipAsset *self);
+GES_API
+GstSample * ges_uri_clip_asset_extract_thumbnail    (GESUriClipAsset *self,
+                                                     GstClockTime position,
+                                                     GstCaps *caps,
+                                                     GError **error);
 
 #define GES_TYPE_URI_SOURCE_ASSET ges_uri_source_asset_get_type()
 GES_DECLARE_TYPE(UriSourceAsset, uri_source_asset, URI_SOURCE_ASSET);
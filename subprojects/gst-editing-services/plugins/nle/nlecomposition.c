@@ -271,7 +271,7 @@ static gboolean _nle_composition_add_object (NleComposition * comp,
 static gboolean _nle_composition_remove_object (NleComposition * comp,
     NleObject * object);
 static void _deactivate_stack (NleComposition * comp,
-    NleUpdateStackReason reason);
+    NleUpdateStackReason reason, GNode * new_stack);
 static void _set_real_eos_seqnum_from_seek (NleComposition * comp,
     GstEvent * event);
 static void _emit_commited_signal_func (NleComposition * comp, gpointer udata);
@@ -666,7 +666,7 @@ _process_pending_entries (NleComposition * comp, NleUpdateStackReason reason)
           deactivated_stack == FALSE) {
         deactivated_stack = TRUE;
 
-        _deactivate_stack (comp, reason);
+        _deactivate_stack (comp, reason, NULL);
       }
 
       _nle_composition_remove_object (comp, object);
@@ -1307,6 +1307,63 @@ _remove_child (GValue * item, GValue * ret G_GNUC_UNUSED, GstBin * bin)
   return TRUE;
 }
 
+typedef struct
+{
+  GstBin *bin;
+  GNode *new_stack;
+} EmptyBinData;
+
+static gboolean
+_remove_or_unlink_child (GValue * item, GValue * ret G_GNUC_UNUSED,
+    EmptyBinData * data)
+{
+  GstElement *child = g_value_get_object (item);
+  GstPad *srcpad, *peer;
+
+  if (data->new_stack == NULL || !g_node_find (data->new_stack, G_PRE_ORDER,
+          G_TRAVERSE_ALL, child)) {
+    if (NLE_IS_OPERATION (child))
+      nle_operation_hard_cleanup (NLE_OPERATION (child));
+
+    gst_bin_remove (data->bin, child);
+
+    return TRUE;
+  }
+
+  /* The object is part of the new stack too: keep it in the bin so it
+   * doesn't go through a full teardown, and only unlink it so the new
+   * topology can be relinked */
+  GST_LOG_OBJECT (data->bin, "Keeping %s for the new stack",
+      GST_ELEMENT_NAME (child));
+
+  srcpad = NLE_OBJECT_SRC (child);
+  if ((peer = gst_pad_get_peer (srcpad))) {
+    gst_pad_unlink (srcpad, peer);
+    gst_object_unref (peer);
+  }
+
+  return TRUE;
+}
+
+/* Remove all children from the bin, except those that are also part of
+ * @new_stack, which are kept (but unlinked) for reuse in the new stack */
+static void
+_empty_bin_except (GstBin * bin, GNode * new_stack)
+{
+  GstIterator *children;
+  EmptyBinData data = { bin, new_stack };
+
+  children = gst_bin_iterate_elements (bin);
+
+  while (G_UNLIKELY (gst_iterator_fold (children,
+              (GstIteratorFoldFunction) _remove_or_unlink_child, NULL,
+              &data) == GST_ITERATOR_RESYNC)) {
+    gst_iterator_resync (children);
+  }
+
+  gst_iterator_free (children);
+}
+
 static void
 _empty_bin (GstBin * bin)
 {
@@ -2676,7 +2733,7 @@ nle_composition_change_state (GstElement * element, GstStateChange transition)
 
       _remove_update_actions (comp);
       _remove_seek_actions (comp);
-      _deactivate_stack (comp, TRUE);
+      _deactivate_stack (comp, TRUE, NULL);
       comp->priv->tearing_down_stack = TRUE;
       break;
     case GST_STATE_CHANGE_READY_TO_NULL:
@@ -2962,7 +3019,11 @@ _relink_single_node (NleComposition * comp, GNode * node,
 
   srcpad = NLE_OBJECT_SRC (newobj);
 
-  gst_bin_add (GST_BIN (comp->priv->current_bin), GST_ELEMENT (newobj));
+  /* The object may have been kept in the bin when the previous stack was
+   * deactivated, in which case it only needs relinking */
+  if (GST_OBJECT_PARENT (newobj) !=
+      GST_OBJECT_CAST (comp->priv->current_bin))
+    gst_bin_add (GST_BIN (comp->priv->current_bin), GST_ELEMENT (newobj));
   gst_element_sync_state_with_parent (GST_ELEMENT_CAST (newobj));
 
   /* link to parent if needed.  */
@@ -3000,7 +3061,8 @@ _relink_single_node (NleComposition * comp, GNode * node,
  */
 
 static void
-_deactivate_stack (NleComposition * comp, NleUpdateStackReason reason)
+_deactivate_stack (NleComposition * comp, NleUpdateStackReason reason,
+    GNode * new_stack)
 {
   GstPad *ptarget;
 
@@ -3009,7 +3071,7 @@ _deactivate_stack (NleComposition * comp, NleUpdateStackReason reason)
   _set_current_bin_to_ready (comp, reason);
 
   ptarget = gst_ghost_pad_get_target (GST_GHOST_PAD (NLE_OBJECT_SRC (comp)));
-  _empty_bin (GST_BIN_CAST (comp->priv->current_bin));
+  _empty_bin_except (GST_BIN_CAST (comp->priv->current_bin), new_stack);
 
   if (comp->priv->ghosteventprobe) {
     GST_INFO_OBJECT (comp, "Removing old ghost pad probe");
@@ -3382,7 +3444,7 @@ update_pipeline (NleComposition * comp, GstClockTime currenttime, gint32 seqnum,
   /* If stacks are different, unlink/relink objects */
   if (tear_down) {
     _dump_stack (comp, update_reason, stack);
-    _deactivate_stack (comp, update_reason);
+    _deactivate_stack (comp, update_reason, stack);
     _relink_new_stack (comp, stack, gst_event_ref (toplevel_seek));
   }
 
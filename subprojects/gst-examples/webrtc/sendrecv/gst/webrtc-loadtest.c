@@ -0,0 +1,1191 @@
+/*
+ * WebRTC load-test harness, grown out of webrtc-sendrecv.c.
+ *
+ * Runs N concurrent peer connections from one process against the same
+ * signalling server as the sendrecv demo. Each peer sends synthetic
+ * audio/video with a configurable codec and receives the remote streams
+ * into fakesinks (no decoding, the point is to load webrtcbin and the
+ * network stack, not the decoders). Per-peer connection time, round-trip
+ * time and packet-loss numbers are polled from the get-stats signal and
+ * dumped as JSON on exit.
+ *
+ * Typical use, pairing two instances through the signalling server:
+ *
+ *   webrtc-loadtest --our-id load -n 16        (headless answerer)
+ *   webrtc-loadtest --peer-id load -n 16 --duration 60 --stats-file out.json
+ *
+ * With -n N the given id is used as a base and peer i registers/calls
+ * "<id>-<i>", so the caller instance finds the answerer instance.
+ *
+ * Build by running: `make webrtc-loadtest`, or build the gstreamer monorepo.
+ */
+#include <gst/gst.h>
+#include <gst/sdp/sdp.h>
+#include <gst/rtp/rtp.h>
+
+#include <gst/webrtc/webrtc.h>
+
+/* For signalling */
+#include <libsoup/soup.h>
+#include <json-glib/json-glib.h>
+
+#include <string.h>
+
+#ifdef G_OS_UNIX
+#include <glib-unix.h>
+#endif
+
+enum AppState
+{
+  APP_STATE_UNKNOWN = 0,
+  APP_STATE_ERROR = 1,          /* generic error */
+  SERVER_CONNECTING = 1000,
+  SERVER_CONNECTION_ERROR,
+  SERVER_CONNECTED,             /* Ready to register */
+  SERVER_REGISTERING = 2000,
+  SERVER_REGISTRATION_ERROR,
+  SERVER_REGISTERED,            /* Ready to call a peer */
+  SERVER_CLOSED,                /* server connection closed by us or the server */
+  PEER_CONNECTING = 3000,
+  PEER_CONNECTION_ERROR,
+  PEER_CONNECTED,
+  PEER_CALL_NEGOTIATING = 4000,
+  PEER_CALL_STARTED,
+  PEER_CALL_STOPPED,
+  PEER_CALL_ERROR,
+};
+
+typedef struct
+{
+  guint index;
+  gchar *our_id;
+  gchar *remote_id;             /* NULL in answerer mode */
+
+  SoupWebsocketConnection *ws_conn;
+  GstElement *pipe;
+  GstElement *webrtc;
+  enum AppState state;
+  gboolean done;                /* failed or shut down, don't touch it again */
+
+  /* stats, updated from the get-stats reply */
+  gint64 signalling_start;      /* monotonic us, websocket connect started */
+  gint64 call_start;            /* monotonic us, negotiation started */
+  gint64 connected_time;        /* monotonic us, connection-state connected */
+  gdouble rtt_ms;               /* most recent round-trip-time estimate */
+  guint64 packets_sent;
+  guint64 packets_received;
+  guint64 packets_lost;
+} Peer;
+
+#define GST_CAT_DEFAULT webrtc_loadtest_debug
+GST_DEBUG_CATEGORY_STATIC (GST_CAT_DEFAULT);
+
+static GMainLoop *loop;
+static GPtrArray *peers;
+static guint peers_done = 0;
+
+static guint num_peers = 1;
+static gchar *peer_id = NULL;
+static gchar *our_id = NULL;
+static const gchar *server_url = "wss://webrtc.nirbheek.in:8443";
+static gboolean disable_ssl = FALSE;
+static gchar *video_codec = NULL;
+static guint video_width = 320;
+static guint video_height = 240;
+static guint duration = 0;
+static guint stats_interval = 2;
+static gchar *stats_file = NULL;
+
+static GOptionEntry entries[] = {
+  {"peer-id", 0, 0, G_OPTION_ARG_STRING, &peer_id,
+      "Base ID of the peers to call (caller mode)", "ID"},
+  {"our-id", 0, 0, G_OPTION_ARG_STRING, &our_id,
+      "Base ID to register and answer calls on (answerer mode)", "ID"},
+  {"peers", 'n', 0, G_OPTION_ARG_INT, &num_peers,
+      "Number of concurrent peer connections (default: 1)", "N"},
+  {"server", 0, 0, G_OPTION_ARG_STRING, &server_url,
+      "Signalling server to connect to", "URL"},
+  {"disable-ssl", 0, 0, G_OPTION_ARG_NONE, &disable_ssl, "Disable ssl", NULL},
+  {"video-codec", 0, 0, G_OPTION_ARG_STRING, &video_codec,
+      "Video codec to send, vp8 or h264 (default: vp8)", "CODEC"},
+  {"video-width", 0, 0, G_OPTION_ARG_INT, &video_width,
+      "Width of the synthetic video source (default: 320)", "PX"},
+  {"video-height", 0, 0, G_OPTION_ARG_INT, &video_height,
+      "Height of the synthetic video source (default: 240)", "PX"},
+  {"duration", 0, 0, G_OPTION_ARG_INT, &duration,
+      "Stop and dump statistics after this many seconds (default: run until "
+        "interrupted)", "SECONDS"},
+  {"stats-interval", 0, 0, G_OPTION_ARG_INT, &stats_interval,
+      "Interval between get-stats polls in seconds (default: 2)", "SECONDS"},
+  {"stats-file", 0, 0, G_OPTION_ARG_STRING, &stats_file,
+      "Write the JSON statistics to this file instead of stdout", "FILE"},
+  {NULL},
+};
+
+static void dump_stats_and_quit (void);
+
+static void
+peer_done (Peer * peer, const gchar * msg, enum AppState state)
+{
+  if (msg)
+    gst_printerr ("peer %u: %s\n", peer->index, msg);
+  if (state > 0)
+    peer->state = state;
+
+  if (peer->done)
+    return;
+  peer->done = TRUE;
+
+  if (peer->ws_conn) {
+    if (soup_websocket_connection_get_state (peer->ws_conn) ==
+        SOUP_WEBSOCKET_STATE_OPEN)
+      soup_websocket_connection_close (peer->ws_conn, 1000, "");
+    g_clear_object (&peer->ws_conn);
+  }
+
+  peers_done++;
+  if (peers_done == peers->len) {
+    gst_printerr ("All peers finished, stopping\n");
+    dump_stats_and_quit ();
+  }
+}
+
+static gchar *
+get_string_from_json_object (JsonObject * object)
+{
+  JsonNode *root;
+  JsonGenerator *generator;
+  gchar *text;
+
+  /* Make it the root node */
+  root = json_node_init_object (json_node_alloc (), object);
+  generator = json_generator_new ();
+  json_generator_set_root (generator, root);
+  text = json_generator_to_data (generator, NULL);
+
+  /* Release everything */
+  g_object_unref (generator);
+  json_node_free (root);
+  return text;
+}
+
+static void
+on_incoming_stream (GstElement * webrtc, GstPad * pad, Peer * peer)
+{
+  GstElement *q, *sink;
+  GstPad *qpad;
+  GstPadLinkReturn ret;
+
+  if (GST_PAD_DIRECTION (pad) != GST_PAD_SRC)
+    return;
+
+  /* swallow the depayloaded RTP without decoding; the jitterbuffer still
+   * produces the receive statistics we are after and the CPU stays
+   * available for more peers */
+  q = gst_element_factory_make ("queue", NULL);
+  g_assert_nonnull (q);
+  sink = gst_element_factory_make ("fakesink", NULL);
+  g_assert_nonnull (sink);
+  g_object_set (sink, "sync", FALSE, NULL);
+
+  gst_bin_add_many (GST_BIN (peer->pipe), q, sink, NULL);
+  gst_element_sync_state_with_parent (q);
+  gst_element_sync_state_with_parent (sink);
+  gst_element_link (q, sink);
+
+  qpad = gst_element_get_static_pad (q, "sink");
+  ret = gst_pad_link (pad, qpad);
+  g_assert_cmphex (ret, ==, GST_PAD_LINK_OK);
+  gst_object_unref (qpad);
+}
+
+static void
+send_ice_candidate_message (GstElement * webrtc G_GNUC_UNUSED, guint mlineindex,
+    gchar * candidate, Peer * peer)
+{
+  gchar *text;
+  JsonObject *ice, *msg;
+
+  if (peer->state < PEER_CALL_NEGOTIATING) {
+    peer_done (peer, "Can't send ICE, not in call", APP_STATE_ERROR);
+    return;
+  }
+
+  ice = json_object_new ();
+  json_object_set_string_member (ice, "candidate", candidate);
+  json_object_set_int_member (ice, "sdpMLineIndex", mlineindex);
+  msg = json_object_new ();
+  json_object_set_object_member (msg, "ice", ice);
+  text = get_string_from_json_object (msg);
+  json_object_unref (msg);
+
+  soup_websocket_connection_send_text (peer->ws_conn, text);
+  g_free (text);
+}
+
+static void
+send_sdp_to_peer (Peer * peer, GstWebRTCSessionDescription * desc)
+{
+  gchar *text;
+  JsonObject *msg, *sdp;
+
+  if (peer->state < PEER_CALL_NEGOTIATING) {
+    peer_done (peer, "Can't send SDP to peer, not in call", APP_STATE_ERROR);
+    return;
+  }
+
+  text = gst_sdp_message_as_text (desc->sdp);
+  sdp = json_object_new ();
+
+  if (desc->type == GST_WEBRTC_SDP_TYPE_OFFER) {
+    json_object_set_string_member (sdp, "type", "offer");
+  } else if (desc->type == GST_WEBRTC_SDP_TYPE_ANSWER) {
+    json_object_set_string_member (sdp, "type", "answer");
+  } else {
+    g_assert_not_reached ();
+  }
+
+  json_object_set_string_member (sdp, "sdp", text);
+  g_free (text);
+
+  msg = json_object_new ();
+  json_object_set_object_member (msg, "sdp", sdp);
+  text = get_string_from_json_object (msg);
+  json_object_unref (msg);
+
+  soup_websocket_connection_send_text (peer->ws_conn, text);
+  g_free (text);
+}
+
+/* Offer created by our pipeline, to be sent to the peer */
+static void
+on_offer_created (GstPromise * promise, Peer * peer)
+{
+  GstWebRTCSessionDescription *offer = NULL;
+  const GstStructure *reply;
+
+  g_assert_cmphex (peer->state, ==, PEER_CALL_NEGOTIATING);
+
+  g_assert_cmphex (gst_promise_wait (promise), ==, GST_PROMISE_RESULT_REPLIED);
+  reply = gst_promise_get_reply (promise);
+  gst_structure_get (reply, "offer",
+      GST_TYPE_WEBRTC_SESSION_DESCRIPTION, &offer, NULL);
+  gst_promise_unref (promise);
+
+  promise = gst_promise_new ();
+  g_signal_emit_by_name (peer->webrtc, "set-local-description", offer, promise);
+  gst_promise_interrupt (promise);
+  gst_promise_unref (promise);
+
+  /* Send offer to peer */
+  send_sdp_to_peer (peer, offer);
+  gst_webrtc_session_description_free (offer);
+}
+
+static void
+on_negotiation_needed (GstElement * element, Peer * peer)
+{
+  /* only the caller side creates the offer */
+  if (!peer->remote_id)
+    return;
+
+  peer->state = PEER_CALL_NEGOTIATING;
+  peer->call_start = g_get_monotonic_time ();
+
+  {
+    GstPromise *promise = gst_promise_new_with_change_func (
+        (GstPromiseChangeFunc) on_offer_created, peer, NULL);
+    g_signal_emit_by_name (peer->webrtc, "create-offer", NULL, promise);
+  }
+}
+
+static void
+on_connection_state_notify (GstElement * webrtcbin, GParamSpec * pspec,
+    Peer * peer)
+{
+  GstWebRTCPeerConnectionState state;
+
+  g_object_get (webrtcbin, "connection-state", &state, NULL);
+  switch (state) {
+    case GST_WEBRTC_PEER_CONNECTION_STATE_CONNECTED:
+      if (peer->connected_time == 0) {
+        peer->connected_time = g_get_monotonic_time ();
+        gst_print ("peer %u: connected after %.1f ms\n", peer->index,
+            (peer->connected_time - peer->call_start) / 1000.0);
+      }
+      break;
+    case GST_WEBRTC_PEER_CONNECTION_STATE_FAILED:
+      peer_done (peer, "connection failed", PEER_CALL_ERROR);
+      break;
+    default:
+      break;
+  }
+}
+
+/* Sum up the counters of all streams of this peer; one snapshot replaces
+ * the previous one, the counters reported by webrtcbin are cumulative */
+typedef struct
+{
+  guint64 packets_sent;
+  guint64 packets_received;
+  guint64 packets_lost;
+  gdouble rtt;
+  gboolean have_rtt;
+} StatsSnapshot;
+
+static gboolean
+accumulate_stat (GQuark field_id, const GValue * value, gpointer user_data)
+{
+  StatsSnapshot *snapshot = user_data;
+  const GstStructure *s;
+  GstWebRTCStatsType type;
+  guint64 u64;
+  gint64 i64;
+  gdouble d;
+
+  if (!GST_VALUE_HOLDS_STRUCTURE (value))
+    return TRUE;
+
+  s = gst_value_get_structure (value);
+  if (!gst_structure_get (s, "type", GST_TYPE_WEBRTC_STATS_TYPE, &type, NULL))
+    return TRUE;
+
+  switch (type) {
+    case GST_WEBRTC_STATS_OUTBOUND_RTP:
+      if (gst_structure_get_uint64 (s, "packets-sent", &u64))
+        snapshot->packets_sent += u64;
+      break;
+    case GST_WEBRTC_STATS_INBOUND_RTP:
+      if (gst_structure_get_uint64 (s, "packets-received", &u64))
+        snapshot->packets_received += u64;
+      if (gst_structure_get_int64 (s, "packets-lost", &i64) && i64 > 0)
+        snapshot->packets_lost += i64;
+      break;
+    case GST_WEBRTC_STATS_REMOTE_INBOUND_RTP:
+      if (gst_structure_get_double (s, "round-trip-time", &d)) {
+        snapshot->rtt = MAX (snapshot->rtt, d);
+        snapshot->have_rtt = TRUE;
+      }
+      if (gst_structure_get_int64 (s, "packets-lost", &i64) && i64 > 0)
+        snapshot->packets_lost += i64;
+      break;
+    default:
+      break;
+  }
+
+  return TRUE;
+}
+
+static void
+on_stats_reply (GstPromise * promise, Peer * peer)
+{
+  const GstStructure *stats;
+  StatsSnapshot snapshot = { 0, };
+
+  if (gst_promise_wait (promise) != GST_PROMISE_RESULT_REPLIED) {
+    gst_promise_unref (promise);
+    return;
+  }
+
+  stats = gst_promise_get_reply (promise);
+  gst_structure_foreach (stats, accumulate_stat, &snapshot);
+  gst_promise_unref (promise);
+
+  peer->packets_sent = snapshot.packets_sent;
+  peer->packets_received = snapshot.packets_received;
+  peer->packets_lost = snapshot.packets_lost;
+  if (snapshot.have_rtt)
+    peer->rtt_ms = snapshot.rtt * 1000.0;
+}
+
+static gboolean
+poll_stats (gpointer user_data)
+{
+  guint i;
+
+  for (i = 0; i < peers->len; i++) {
+    Peer *peer = g_ptr_array_index (peers, i);
+    GstPromise *promise;
+
+    if (peer->done || !peer->webrtc)
+      continue;
+
+    promise = gst_promise_new_with_change_func (
+        (GstPromiseChangeFunc) on_stats_reply, peer, NULL);
+    g_signal_emit_by_name (peer->webrtc, "get-stats", NULL, promise);
+    gst_promise_unref (promise);
+  }
+
+  return G_SOURCE_CONTINUE;
+}
+
+static gboolean
+bus_watch_cb (GstBus * bus, GstMessage * message, Peer * peer)
+{
+  switch (GST_MESSAGE_TYPE (message)) {
+    case GST_MESSAGE_ERROR:
+    {
+      GError *error = NULL;
+      gchar *debug = NULL;
+
+      gst_message_parse_error (message, &error, &debug);
+      g_warning ("peer %u: error on bus: %s (debug: %s)", peer->index,
+          error->message, debug);
+      peer_done (peer, "Error on bus", APP_STATE_ERROR);
+      g_error_free (error);
+      g_free (debug);
+      break;
+    }
+    case GST_MESSAGE_LATENCY:
+      gst_bin_recalculate_latency (GST_BIN (peer->pipe));
+      break;
+    default:
+      break;
+  }
+
+  return G_SOURCE_CONTINUE;
+}
+
+#define STUN_SERVER "stun://stun.l.google.com:19302"
+#define RTP_TWCC_URI "http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01"
+#define RTP_OPUS_DEFAULT_PT 97
+#define RTP_VIDEO_DEFAULT_PT 96
+
+static gchar *
+make_video_desc (guint pt)
+{
+  const gchar *encoder, *payloader;
+
+  if (g_strcmp0 (video_codec, "h264") == 0) {
+    encoder = "x264enc tune=zerolatency speed-preset=ultrafast "
+        "key-int-max=2000";
+    payloader = "rtph264pay name=videopay aggregate-mode=zero-latency "
+        "config-interval=-1";
+  } else {
+    /* increase the default keyframe distance like the sendrecv demo,
+     * recovery from loss is via PLI */
+    encoder = "vp8enc deadline=1 keyframe-max-dist=2000";
+    payloader = "rtpvp8pay name=videopay picture-id-mode=15-bit";
+  }
+
+  return g_strdup_printf ("videotestsrc is-live=true pattern=ball "
+      "! video/x-raw,width=%u,height=%u ! videoconvert ! queue "
+      "! %s ! %s pt=%u ! queue", video_width, video_height, encoder,
+      payloader, pt);
+}
+
+static gboolean
+start_pipeline (Peer * peer, gboolean create_offer, guint opus_pt,
+    guint video_pt)
+{
+  GstBus *bus;
+  char *name, *audio_desc, *video_desc;
+  GstElement *audio_bin, *video_bin;
+  GstStateChangeReturn ret;
+  GError *audio_error = NULL;
+  GError *video_error = NULL;
+
+  name = g_strdup_printf ("webrtc-loadtest-%u", peer->index);
+  peer->pipe = gst_pipeline_new (name);
+  g_free (name);
+
+  audio_desc =
+      g_strdup_printf
+      ("audiotestsrc is-live=true wave=red-noise ! audioconvert ! audioresample"
+      "! queue ! opusenc ! rtpopuspay name=audiopay pt=%u "
+      "! application/x-rtp, encoding-name=OPUS ! queue", opus_pt);
+  audio_bin = gst_parse_bin_from_description (audio_desc, TRUE, &audio_error);
+  g_free (audio_desc);
+  if (audio_error) {
+    gst_printerr ("Failed to parse audio_bin: %s\n", audio_error->message);
+    g_error_free (audio_error);
+    goto err;
+  }
+
+  video_desc = make_video_desc (video_pt);
+  video_bin = gst_parse_bin_from_description (video_desc, TRUE, &video_error);
+  g_free (video_desc);
+  if (video_error) {
+    gst_printerr ("Failed to parse video_bin: %s\n", video_error->message);
+    g_error_free (video_error);
+    goto err;
+  }
+
+  peer->webrtc = gst_element_factory_make_full ("webrtcbin",
+      "name", "sendrecv", "stun-server", STUN_SERVER, NULL);
+  g_assert_nonnull (peer->webrtc);
+  gst_util_set_object_arg (G_OBJECT (peer->webrtc), "bundle-policy",
+      "max-bundle");
+
+  /* Takes ownership of each: */
+  gst_bin_add_many (GST_BIN (peer->pipe), audio_bin, video_bin, peer->webrtc,
+      NULL);
+
+  if (!gst_element_link (audio_bin, peer->webrtc)) {
+    gst_printerr ("Failed to link audio_bin \n");
+  }
+  if (!gst_element_link (video_bin, peer->webrtc)) {
+    gst_printerr ("Failed to link video_bin \n");
+  }
+
+  if (create_offer) {
+    GstElement *videopay, *audiopay;
+    GstRTPHeaderExtension *video_twcc, *audio_twcc;
+
+    videopay = gst_bin_get_by_name (GST_BIN (peer->pipe), "videopay");
+    g_assert_nonnull (videopay);
+    video_twcc = gst_rtp_header_extension_create_from_uri (RTP_TWCC_URI);
+    g_assert_nonnull (video_twcc);
+    gst_rtp_header_extension_set_id (video_twcc, 1);
+    g_signal_emit_by_name (videopay, "add-extension", video_twcc);
+    g_clear_object (&video_twcc);
+    g_clear_object (&videopay);
+
+    audiopay = gst_bin_get_by_name (GST_BIN (peer->pipe), "audiopay");
+    g_assert_nonnull (audiopay);
+    audio_twcc = gst_rtp_header_extension_create_from_uri (RTP_TWCC_URI);
+    g_assert_nonnull (audio_twcc);
+    gst_rtp_header_extension_set_id (audio_twcc, 1);
+    g_signal_emit_by_name (audiopay, "add-extension", audio_twcc);
+    g_clear_object (&audio_twcc);
+    g_clear_object (&audiopay);
+  }
+
+  g_signal_connect (peer->webrtc, "on-negotiation-needed",
+      G_CALLBACK (on_negotiation_needed), peer);
+  g_signal_connect (peer->webrtc, "on-ice-candidate",
+      G_CALLBACK (send_ice_candidate_message), peer);
+  g_signal_connect (peer->webrtc, "notify::connection-state",
+      G_CALLBACK (on_connection_state_notify), peer);
+  /* Incoming streams will be exposed via this signal */
+  g_signal_connect (peer->webrtc, "pad-added",
+      G_CALLBACK (on_incoming_stream), peer);
+
+  bus = gst_pipeline_get_bus (GST_PIPELINE (peer->pipe));
+  gst_bus_add_watch (bus, (GstBusFunc) bus_watch_cb, peer);
+  gst_object_unref (bus);
+
+  GST_INFO ("peer %u: starting pipeline", peer->index);
+  ret = gst_element_set_state (GST_ELEMENT (peer->pipe), GST_STATE_PLAYING);
+  if (ret == GST_STATE_CHANGE_FAILURE)
+    goto err;
+
+  return TRUE;
+
+err:
+  if (peer->pipe)
+    g_clear_object (&peer->pipe);
+  peer->webrtc = NULL;
+  return FALSE;
+}
+
+static gboolean
+setup_call (Peer * peer)
+{
+  gchar *msg;
+
+  if (soup_websocket_connection_get_state (peer->ws_conn) !=
+      SOUP_WEBSOCKET_STATE_OPEN)
+    return FALSE;
+
+  GST_INFO ("peer %u: setting up call with %s", peer->index, peer->remote_id);
+  peer->state = PEER_CONNECTING;
+  msg = g_strdup_printf ("SESSION %s", peer->remote_id);
+  soup_websocket_connection_send_text (peer->ws_conn, msg);
+  g_free (msg);
+  return TRUE;
+}
+
+static gboolean
+register_with_server (Peer * peer)
+{
+  gchar *hello;
+
+  if (soup_websocket_connection_get_state (peer->ws_conn) !=
+      SOUP_WEBSOCKET_STATE_OPEN)
+    return FALSE;
+
+  GST_INFO ("peer %u: registering id %s with server", peer->index,
+      peer->our_id);
+  peer->state = SERVER_REGISTERING;
+
+  /* Reply will be received by on_server_message() */
+  hello = g_strdup_printf ("HELLO %s", peer->our_id);
+  soup_websocket_connection_send_text (peer->ws_conn, hello);
+  g_free (hello);
+
+  return TRUE;
+}
+
+static void
+on_server_closed (SoupWebsocketConnection * conn G_GNUC_UNUSED, Peer * peer)
+{
+  peer_done (peer, "Server connection closed", SERVER_CLOSED);
+}
+
+/* Answer created by our pipeline, to be sent to the peer */
+static void
+on_answer_created (GstPromise * promise, Peer * peer)
+{
+  GstWebRTCSessionDescription *answer = NULL;
+  const GstStructure *reply;
+
+  g_assert_cmphex (peer->state, ==, PEER_CALL_NEGOTIATING);
+
+  g_assert_cmphex (gst_promise_wait (promise), ==, GST_PROMISE_RESULT_REPLIED);
+  reply = gst_promise_get_reply (promise);
+  gst_structure_get (reply, "answer",
+      GST_TYPE_WEBRTC_SESSION_DESCRIPTION, &answer, NULL);
+  gst_promise_unref (promise);
+
+  promise = gst_promise_new ();
+  g_signal_emit_by_name (peer->webrtc, "set-local-description", answer,
+      promise);
+  gst_promise_interrupt (promise);
+  gst_promise_unref (promise);
+
+  /* Send answer to peer */
+  send_sdp_to_peer (peer, answer);
+  gst_webrtc_session_description_free (answer);
+}
+
+static void
+on_offer_set (GstPromise * promise, Peer * peer)
+{
+  gst_promise_unref (promise);
+  promise = gst_promise_new_with_change_func (
+      (GstPromiseChangeFunc) on_answer_created, peer, NULL);
+  g_signal_emit_by_name (peer->webrtc, "create-answer", NULL, promise);
+}
+
+static void
+on_offer_received (Peer * peer, GstSDPMessage * sdp)
+{
+  GstWebRTCSessionDescription *offer = NULL;
+  GstPromise *promise;
+
+  /* If we got an offer and we have no webrtcbin yet, parse the SDP for the
+   * payload types, then start the pipeline */
+  if (!peer->webrtc) {
+    guint medias_len, formats_len;
+    guint opus_pt = 0, video_pt = 0;
+    const gchar *video_encoding =
+        (g_strcmp0 (video_codec, "h264") == 0) ? "H264" : "VP8";
+
+    medias_len = gst_sdp_message_medias_len (sdp);
+    for (int i = 0; i < medias_len; i++) {
+      const GstSDPMedia *media = gst_sdp_message_get_media (sdp, i);
+      formats_len = gst_sdp_media_formats_len (media);
+      for (int j = 0; j < formats_len; j++) {
+        guint pt;
+        GstCaps *caps;
+        GstStructure *s;
+        const char *fmt, *encoding_name;
+
+        fmt = gst_sdp_media_get_format (media, j);
+        if (g_strcmp0 (fmt, "webrtc-datachannel") == 0)
+          continue;
+        pt = atoi (fmt);
+        caps = gst_sdp_media_get_caps_from_media (media, pt);
+        s = gst_caps_get_structure (caps, 0);
+        encoding_name = gst_structure_get_string (s, "encoding-name");
+        if (video_pt == 0 && g_strcmp0 (encoding_name, video_encoding) == 0)
+          video_pt = pt;
+        if (opus_pt == 0 && g_strcmp0 (encoding_name, "OPUS") == 0)
+          opus_pt = pt;
+        gst_caps_unref (caps);
+      }
+    }
+
+    if (opus_pt == 0 || video_pt == 0) {
+      peer_done (peer, "Offer contains no matching payload types",
+          PEER_CALL_ERROR);
+      return;
+    }
+
+    peer->state = PEER_CALL_NEGOTIATING;
+    peer->call_start = g_get_monotonic_time ();
+
+    if (!start_pipeline (peer, FALSE, opus_pt, video_pt)) {
+      peer_done (peer, "ERROR: failed to start pipeline", PEER_CALL_ERROR);
+      return;
+    }
+  }
+
+  offer = gst_webrtc_session_description_new (GST_WEBRTC_SDP_TYPE_OFFER, sdp);
+  g_assert_nonnull (offer);
+
+  /* Set remote description on our pipeline */
+  promise = gst_promise_new_with_change_func (
+      (GstPromiseChangeFunc) on_offer_set, peer, NULL);
+  g_signal_emit_by_name (peer->webrtc, "set-remote-description", offer,
+      promise);
+  gst_webrtc_session_description_free (offer);
+}
+
+/* One mega message handler for our asynchronous calling mechanism */
+static void
+on_server_message (SoupWebsocketConnection * conn, SoupWebsocketDataType type,
+    GBytes * message, Peer * peer)
+{
+  gchar *text;
+
+  switch (type) {
+    case SOUP_WEBSOCKET_DATA_BINARY:
+      gst_printerr ("Received unknown binary message, ignoring\n");
+      return;
+    case SOUP_WEBSOCKET_DATA_TEXT:{
+      gsize size;
+      const gchar *data = g_bytes_get_data (message, &size);
+      /* Convert to NULL-terminated string */
+      text = g_strndup (data, size);
+      break;
+    }
+    default:
+      g_assert_not_reached ();
+  }
+
+  if (g_strcmp0 (text, "HELLO") == 0) {
+    /* Server has accepted our registration, we are ready to send commands */
+    if (peer->state != SERVER_REGISTERING) {
+      peer_done (peer, "ERROR: Received HELLO when not registering",
+          APP_STATE_ERROR);
+      goto out;
+    }
+    peer->state = SERVER_REGISTERED;
+    if (peer->remote_id) {
+      /* Ask signalling server to connect us with a specific peer */
+      if (!setup_call (peer)) {
+        peer_done (peer, "ERROR: Failed to setup call", PEER_CALL_ERROR);
+        goto out;
+      }
+    } else {
+      GST_INFO ("peer %u: waiting for connection (our-id: %s)", peer->index,
+          peer->our_id);
+    }
+  } else if (g_strcmp0 (text, "SESSION_OK") == 0) {
+    /* The call initiated by us has been setup by the server; now we can start
+     * negotiation */
+    if (peer->state != PEER_CONNECTING) {
+      peer_done (peer, "ERROR: Received SESSION_OK when not calling",
+          PEER_CONNECTION_ERROR);
+      goto out;
+    }
+
+    peer->state = PEER_CONNECTED;
+    /* Start negotiation (exchange SDP and ICE candidates) */
+    if (!start_pipeline (peer, TRUE, RTP_OPUS_DEFAULT_PT,
+            RTP_VIDEO_DEFAULT_PT))
+      peer_done (peer, "ERROR: failed to start pipeline", PEER_CALL_ERROR);
+  } else if (g_str_has_prefix (text, "ERROR")) {
+    /* Handle errors */
+    enum AppState state;
+
+    switch (peer->state) {
+      case SERVER_CONNECTING:
+        state = SERVER_CONNECTION_ERROR;
+        break;
+      case SERVER_REGISTERING:
+        state = SERVER_REGISTRATION_ERROR;
+        break;
+      case PEER_CONNECTING:
+        state = PEER_CONNECTION_ERROR;
+        break;
+      case PEER_CONNECTED:
+      case PEER_CALL_NEGOTIATING:
+        state = PEER_CALL_ERROR;
+        break;
+      default:
+        state = APP_STATE_ERROR;
+    }
+    peer_done (peer, text, state);
+  } else {
+    /* Look for JSON messages containing SDP and ICE candidates */
+    JsonNode *root;
+    JsonObject *object, *child;
+    JsonParser *parser = json_parser_new ();
+    if (!json_parser_load_from_data (parser, text, -1, NULL)) {
+      gst_printerr ("Unknown message '%s', ignoring\n", text);
+      g_object_unref (parser);
+      goto out;
+    }
+
+    root = json_parser_get_root (parser);
+    if (!JSON_NODE_HOLDS_OBJECT (root)) {
+      gst_printerr ("Unknown json message '%s', ignoring\n", text);
+      g_object_unref (parser);
+      goto out;
+    }
+
+    object = json_node_get_object (root);
+    /* Check type of JSON message */
+    if (json_object_has_member (object, "sdp")) {
+      int ret;
+      GstSDPMessage *sdp;
+      const gchar *sdp_text, *sdptype;
+      GstWebRTCSessionDescription *answer;
+
+      child = json_object_get_object_member (object, "sdp");
+
+      if (!json_object_has_member (child, "type")) {
+        peer_done (peer, "ERROR: received SDP without 'type'",
+            PEER_CALL_ERROR);
+        g_object_unref (parser);
+        goto out;
+      }
+
+      sdptype = json_object_get_string_member (child, "type");
+      sdp_text = json_object_get_string_member (child, "sdp");
+      ret = gst_sdp_message_new (&sdp);
+      g_assert_cmphex (ret, ==, GST_SDP_OK);
+      ret = gst_sdp_message_parse_buffer ((guint8 *) sdp_text,
+          strlen (sdp_text), sdp);
+      g_assert_cmphex (ret, ==, GST_SDP_OK);
+
+      if (g_str_equal (sdptype, "answer")) {
+        peer->state = PEER_CALL_STARTED;
+        answer = gst_webrtc_session_description_new (GST_WEBRTC_SDP_TYPE_ANSWER,
+            sdp);
+        g_assert_nonnull (answer);
+
+        /* Set remote description on our pipeline */
+        {
+          GstPromise *promise = gst_promise_new ();
+          g_signal_emit_by_name (peer->webrtc, "set-remote-description",
+              answer, promise);
+          gst_promise_interrupt (promise);
+          gst_promise_unref (promise);
+        }
+        gst_webrtc_session_description_free (answer);
+      } else {
+        peer->state = PEER_CALL_NEGOTIATING;
+        on_offer_received (peer, sdp);
+      }
+    } else if (json_object_has_member (object, "ice")) {
+      const gchar *candidate;
+      gint sdpmlineindex;
+
+      child = json_object_get_object_member (object, "ice");
+      candidate = json_object_get_string_member (child, "candidate");
+      sdpmlineindex = json_object_get_int_member (child, "sdpMLineIndex");
+
+      /* Add ice candidate sent by remote peer */
+      g_signal_emit_by_name (peer->webrtc, "add-ice-candidate", sdpmlineindex,
+          candidate);
+    } else {
+      gst_printerr ("Ignoring unknown JSON message:\n%s\n", text);
+    }
+    g_object_unref (parser);
+  }
+
+out:
+  g_free (text);
+}
+
+static void
+on_server_connected (SoupSession * session, GAsyncResult * res, Peer * peer)
+{
+  GError *error = NULL;
+
+  peer->ws_conn =
+      soup_session_websocket_connect_finish (session, res, &error);
+  if (error) {
+    peer_done (peer, error->message, SERVER_CONNECTION_ERROR);
+    g_error_free (error);
+    return;
+  }
+
+  g_assert_nonnull (peer->ws_conn);
+
+  peer->state = SERVER_CONNECTED;
+
+  g_signal_connect (peer->ws_conn, "closed", G_CALLBACK (on_server_closed),
+      peer);
+  g_signal_connect (peer->ws_conn, "message", G_CALLBACK (on_server_message),
+      peer);
+
+  /* Register with the server so it knows about us and can accept commands */
+  register_with_server (peer);
+}
+
+/*
+ * Connect all peers to the signalling server. This is the entrypoint for
+ * everything else.
+ */
+static void
+connect_to_websocket_server_async (SoupSession * session)
+{
+  guint i;
+
+  for (i = 0; i < peers->len; i++) {
+    Peer *peer = g_ptr_array_index (peers, i);
+    SoupMessage *message;
+
+    message = soup_message_new (SOUP_METHOD_GET, server_url);
+    peer->state = SERVER_CONNECTING;
+    peer->signalling_start = g_get_monotonic_time ();
+    soup_session_websocket_connect_async (session, message, NULL, NULL, NULL,
+        (GAsyncReadyCallback) on_server_connected, peer);
+    g_object_unref (message);
+  }
+}
+
+static void
+dump_stats_and_quit (void)
+{
+  static gboolean dumped = FALSE;
+  JsonObject *root, *summary;
+  JsonArray *array;
+  gchar *text;
+  guint i, connected = 0;
+  gdouble connect_sum = 0, connect_max = 0, rtt_sum = 0;
+  guint rtt_count = 0;
+
+  /* can be reached both from the duration timeout and from the last peer
+   * shutting down */
+  if (dumped)
+    return;
+  dumped = TRUE;
+
+  root = json_object_new ();
+  array = json_array_new ();
+
+  for (i = 0; i < peers->len; i++) {
+    Peer *peer = g_ptr_array_index (peers, i);
+    JsonObject *obj = json_object_new ();
+    gdouble connect_ms = 0;
+
+    json_object_set_int_member (obj, "index", peer->index);
+    json_object_set_string_member (obj, "our-id", peer->our_id);
+    if (peer->remote_id)
+      json_object_set_string_member (obj, "peer-id", peer->remote_id);
+    json_object_set_boolean_member (obj, "connected",
+        peer->connected_time != 0);
+
+    if (peer->connected_time != 0) {
+      connect_ms = (peer->connected_time - peer->call_start) / 1000.0;
+      connected++;
+      connect_sum += connect_ms;
+      connect_max = MAX (connect_max, connect_ms);
+      json_object_set_double_member (obj, "connect-time-ms", connect_ms);
+    }
+    if (peer->rtt_ms > 0) {
+      json_object_set_double_member (obj, "rtt-ms", peer->rtt_ms);
+      rtt_sum += peer->rtt_ms;
+      rtt_count++;
+    }
+    json_object_set_int_member (obj, "packets-sent", peer->packets_sent);
+    json_object_set_int_member (obj, "packets-received",
+        peer->packets_received);
+    json_object_set_int_member (obj, "packets-lost", peer->packets_lost);
+    if (peer->packets_received + peer->packets_lost > 0)
+      json_object_set_double_member (obj, "loss-percent",
+          100.0 * peer->packets_lost /
+          (peer->packets_received + peer->packets_lost));
+
+    json_array_add_object_element (array, obj);
+  }
+
+  json_object_set_array_member (root, "peers", array);
+
+  summary = json_object_new ();
+  json_object_set_int_member (summary, "peer-count", peers->len);
+  json_object_set_int_member (summary, "connected", connected);
+  if (connected > 0) {
+    json_object_set_double_member (summary, "avg-connect-time-ms",
+        connect_sum / connected);
+    json_object_set_double_member (summary, "max-connect-time-ms",
+        connect_max);
+  }
+  if (rtt_count > 0)
+    json_object_set_double_member (summary, "avg-rtt-ms",
+        rtt_sum / rtt_count);
+  json_object_set_object_member (root, "summary", summary);
+
+  text = get_string_from_json_object (root);
+  json_object_unref (root);
+
+  if (stats_file) {
+    GError *error = NULL;
+
+    if (!g_file_set_contents (stats_file, text, -1, &error)) {
+      gst_printerr ("Failed to write %s: %s\n", stats_file, error->message);
+      g_error_free (error);
+    }
+  } else {
+    gst_print ("%s\n", text);
+  }
+  g_free (text);
+
+  if (loop)
+    g_main_loop_quit (loop);
+}
+
+static gboolean
+on_duration_expired (gpointer user_data)
+{
+  gst_printerr ("Test duration reached, stopping\n");
+  dump_stats_and_quit ();
+  return G_SOURCE_REMOVE;
+}
+
+#ifdef G_OS_UNIX
+static gboolean
+on_sigint (gpointer user_data)
+{
+  gst_printerr ("Interrupted, stopping\n");
+  dump_stats_and_quit ();
+  return G_SOURCE_REMOVE;
+}
+#endif
+
+static void
+peer_free (Peer * peer)
+{
+  if (peer->pipe) {
+    GstBus *bus;
+
+    gst_element_set_state (GST_ELEMENT (peer->pipe), GST_STATE_NULL);
+
+    bus = gst_pipeline_get_bus (GST_PIPELINE (peer->pipe));
+    gst_bus_remove_watch (bus);
+    gst_object_unref (bus);
+
+    gst_object_unref (peer->pipe);
+  }
+  g_clear_object (&peer->ws_conn);
+  g_free (peer->our_id);
+  g_free (peer->remote_id);
+  g_free (peer);
+}
+
+static gboolean
+check_plugins (void)
+{
+  int i;
+  gboolean ret;
+  GstPlugin *plugin;
+  GstRegistry *registry;
+  const gchar *needed[] = { "opus", "vpx", "nice", "webrtc", "dtls", "srtp",
+    "rtpmanager", "videotestsrc", "audiotestsrc", NULL
+  };
+
+  registry = gst_registry_get ();
+  ret = TRUE;
+  for (i = 0; i < g_strv_length ((gchar **) needed); i++) {
+    plugin = gst_registry_find_plugin (registry, needed[i]);
+    if (!plugin) {
+      gst_print ("Required gstreamer plugin '%s' not found\n", needed[i]);
+      ret = FALSE;
+      continue;
+    }
+    gst_object_unref (plugin);
+  }
+  return ret;
+}
+
+int
+main (int argc, char *argv[])
+{
+  GOptionContext *context;
+  SoupSession *session;
+  GError *error = NULL;
+  int ret_code = -1;
+  guint i;
+
+  context = g_option_context_new ("- gstreamer webrtc load-test harness");
+  g_option_context_add_main_entries (context, entries, NULL);
+  g_option_context_add_group (context, gst_init_get_option_group ());
+  if (!g_option_context_parse (context, &argc, &argv, &error)) {
+    gst_printerr ("Error initializing: %s\n", error->message);
+    return -1;
+  }
+
+  GST_DEBUG_CATEGORY_INIT (GST_CAT_DEFAULT, "webrtc-loadtest", 0,
+      "WebRTC load-test harness");
+
+  if (!check_plugins ()) {
+    goto out;
+  }
+
+  if (!peer_id && !our_id) {
+    gst_printerr ("--peer-id or --our-id is a required argument\n");
+    goto out;
+  }
+
+  if (peer_id && our_id) {
+    gst_printerr ("specify only --peer-id or --our-id\n");
+    goto out;
+  }
+
+  if (video_codec && g_strcmp0 (video_codec, "vp8") != 0 &&
+      g_strcmp0 (video_codec, "h264") != 0) {
+    gst_printerr ("unknown video codec '%s', use vp8 or h264\n", video_codec);
+    goto out;
+  }
+
+  if (num_peers < 1) {
+    gst_printerr ("--peers must be at least 1\n");
+    goto out;
+  }
+
+  ret_code = 0;
+
+  /* Disable ssl when running a localhost server, because
+   * it's probably a test server with a self-signed certificate */
+  {
+    GstUri *uri = gst_uri_from_string (server_url);
+    if (g_strcmp0 ("localhost", gst_uri_get_host (uri)) == 0 ||
+        g_strcmp0 ("127.0.0.1", gst_uri_get_host (uri)) == 0)
+      disable_ssl = TRUE;
+    gst_uri_unref (uri);
+  }
+
+  peers = g_ptr_array_new_with_free_func ((GDestroyNotify) peer_free);
+  for (i = 0; i < num_peers; i++) {
+    Peer *peer = g_new0 (Peer, 1);
+
+    peer->index = i;
+    if (our_id) {
+      /* answerer mode: register under a predictable per-peer id */
+      peer->our_id = num_peers == 1 ? g_strdup (our_id) :
+          g_strdup_printf ("%s-%u", our_id, i);
+    } else {
+      /* caller mode: random local id, call the per-peer remote id */
+      peer->our_id = g_strdup_printf ("loadtest-%u-%u", i,
+          g_random_int_range (10, 10000));
+      peer->remote_id = num_peers == 1 ? g_strdup (peer_id) :
+          g_strdup_printf ("%s-%u", peer_id, i);
+    }
+    g_ptr_array_add (peers, peer);
+  }
+
+  loop = g_main_loop_new (NULL, FALSE);
+
+  session =
+      soup_session_new_with_options (SOUP_SESSION_SSL_STRICT, !disable_ssl,
+      SOUP_SESSION_SSL_USE_SYSTEM_CA_FILE, TRUE, NULL);
+
+  connect_to_websocket_server_async (session);
+
+  g_timeout_add_seconds (stats_interval, poll_stats, NULL);
+  if (duration > 0)
+    g_timeout_add_seconds (duration, on_duration_expired, NULL);
+#ifdef G_OS_UNIX
+  g_unix_signal_add (SIGINT, on_sigint, NULL);
+#endif
+
+  g_main_loop_run (loop);
+  g_clear_pointer (&loop, g_main_loop_unref);
+
+  g_ptr_array_unref (peers);
+  g_object_unref (session);
+
+out:
+  g_free (peer_id);
+  g_free (our_id);
+  g_free (video_codec);
+  g_free (stats_file);
+
+  return ret_code;
+}
@@ -40,13 +40,17 @@ struct _GstProtocolInfo
   guint64 offset;
   gboolean eos;
   gint set_streamheader;
+
+  /* pool for outgoing buffers, sized to the AVIO buffer */
+  GstBufferPool *pool;
+  gint pool_size;
 };
 
 static int
 gst_ffmpegdata_peek (void *priv_data, unsigned char *buf, int size)
 {
   GstProtocolInfo *info;
-  GstBuffer *inbuf = NULL;
+  GstBuffer *inbuf;
   GstFlowReturn ret;
   int total = 0;
 
@@ -55,13 +59,17 @@ gst_ffmpegdata_peek (void *priv_data, unsigned char *buf, int size)
   GST_DEBUG ("Pulling %d bytes at position %" G_GUINT64_FORMAT, size,
       info->offset);
 
+  /* wrap the AVIO buffer so that upstream can fill it in place, instead of
+   * allocating an intermediate buffer that we would copy out of and throw
+   * away again */
+  inbuf = gst_buffer_new_wrapped_full (0, buf, size, 0, size, NULL, NULL);
+
   ret = gst_pad_pull_range (info->pad, info->offset, (guint) size, &inbuf);
 
   switch (ret) {
     case GST_FLOW_OK:
+      /* the data was filled into the wrapped memory directly */
       total = (gint) gst_buffer_get_size (inbuf);
-      gst_buffer_extract (inbuf, 0, buf, total);
-      gst_buffer_unref (inbuf);
       break;
     case GST_FLOW_EOS:
       total = 0;
@@ -74,6 +82,7 @@ gst_ffmpegdata_peek (void *priv_data, unsigned char *buf, int size)
       total = -2;
       break;
   }
+  gst_buffer_unref (inbuf);
 
   GST_DEBUG ("Got %d (%s) return result %d", ret, gst_flow_get_name (ret),
       total);
@@ -111,9 +120,17 @@ gst_ffmpegdata_write (void *priv_data, uint8_t * buf, int size)
   info = (GstProtocolInfo *) priv_data;
 
   /* create buffer and push data further */
-  outbuf = gst_buffer_new_and_alloc (size);
-
-  gst_buffer_fill (outbuf, 0, buf, size);
+  if (info->pool != NULL && size <= info->pool_size &&
+      gst_buffer_pool_acquire_buffer (info->pool, &outbuf,
+          NULL) == GST_FLOW_OK) {
+    gst_buffer_fill (outbuf, 0, buf, size);
+    gst_buffer_set_size (outbuf, size);
+  } else {
+    /* writes larger than the AVIO buffer bypass it, allocate those
+     * separately */
+    outbuf = gst_buffer_new_and_alloc (size);
+    gst_buffer_fill (outbuf, 0, buf, size);
+  }
 
   if (gst_pad_push (info->pad, outbuf) != GST_FLOW_OK)
     return 0;
@@ -220,6 +237,10 @@ gst_ffmpegdata_close (AVIOContext * h)
   }
 
   /* clean up data */
+  if (info->pool != NULL) {
+    gst_buffer_pool_set_active (info->pool, FALSE);
+    gst_object_unref (info->pool);
+  }
   g_free (info);
   h->opaque = NULL;
 
@@ -233,7 +254,7 @@ int
 gst_ffmpegdata_open (GstPad * pad, int flags, AVIOContext ** context)
 {
   GstProtocolInfo *info;
-  static const int buffer_size = 4096;
+  static const int buffer_size = 32 * 1024;
   unsigned char *buffer = NULL;
 
   info = g_new0 (GstProtocolInfo, 1);
@@ -260,9 +281,28 @@ gst_ffmpegdata_open (GstPad * pad, int flags, AVIOContext ** context)
   info->pad = pad;
   info->offset = 0;
 
+  if ((flags & AVIO_FLAG_WRITE)) {
+    GstStructure *config;
+
+    /* recycle output buffers instead of allocating one per write, most
+     * writes flush the full AVIO buffer */
+    info->pool = gst_buffer_pool_new ();
+    info->pool_size = buffer_size;
+    config = gst_buffer_pool_get_config (info->pool);
+    gst_buffer_pool_config_set_params (config, NULL, buffer_size, 0, 0);
+    if (!gst_buffer_pool_set_config (info->pool, config) ||
+        !gst_buffer_pool_set_active (info->pool, TRUE)) {
+      GST_WARNING ("Failed to activate buffer pool");
+      gst_object_unref (info->pool);
+      info->pool = NULL;
+    }
+  }
+
   buffer = av_malloc (buffer_size);
   if (buffer == NULL) {
     GST_WARNING ("Failed to allocate buffer");
+    if (info->pool != NULL)
+      gst_object_unref (info->pool);
     g_free (info);
     return -ENOMEM;
   }
@@ -272,6 +312,8 @@ gst_ffmpegdata_open (GstPad * pad, int flags, AVIOContext ** context)
       gst_ffmpegdata_read, gst_ffmpegdata_write, gst_ffmpegdata_seek);
   if (*context == NULL) {
     GST_WARNING ("Failed to allocate memory");
+    if (info->pool != NULL)
+      gst_object_unref (info->pool);
     g_free (info);
     av_free (buffer);
     return -ENOMEM;
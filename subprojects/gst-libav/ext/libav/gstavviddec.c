@@ -1852,10 +1852,23 @@ gst_ffmpegviddec_video_frame (GstFFMpegVidDec * ffmpegdec,
   if (G_UNLIKELY (out_frame->output_buffer == NULL)) {
     *ret = get_output_buffer (ffmpegdec, out_frame);
   } else if (G_UNLIKELY (out_frame->output_buffer->pool != pool)) {
-    GstBuffer *tmp = out_frame->output_buffer;
-    out_frame->output_buffer = NULL;
-    *ret = get_output_buffer (ffmpegdec, out_frame);
-    gst_buffer_unref (tmp);
+    GstVideoMeta *vmeta = gst_buffer_get_video_meta (out_frame->output_buffer);
+    GstVideoInfo *out_info = &ffmpegdec->output_state->info;
+
+    if (ffmpegdec->downstream_supports_videometa && vmeta
+        && (gint) vmeta->width == GST_VIDEO_INFO_WIDTH (out_info)
+        && (gint) vmeta->height == GST_VIDEO_INFO_HEIGHT (out_info)) {
+      /* The buffer was direct-rendered into the internal pool, but its
+       * video meta describes the actual strides and padding, so it can
+       * be pushed as is when downstream supports the meta */
+      GST_LOG_OBJECT (ffmpegdec,
+          "pushing internal pool buffer without copy");
+    } else {
+      GstBuffer *tmp = out_frame->output_buffer;
+      out_frame->output_buffer = NULL;
+      *ret = get_output_buffer (ffmpegdec, out_frame);
+      gst_buffer_unref (tmp);
+    }
   }
 #ifndef G_DISABLE_ASSERT
   else {
@@ -2313,6 +2326,7 @@ gst_ffmpegviddec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
 
   have_videometa =
       gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
+  ffmpegdec->downstream_supports_videometa = have_videometa;
 
   if (have_videometa)
     gst_buffer_pool_config_add_option (config,
@@ -94,6 +94,10 @@ struct _GstFFMpegVidDec
   gint pool_height;
   enum AVPixelFormat pool_format;
   GstVideoInfo pool_info;
+
+  /* TRUE if downstream supports GstVideoMeta, so buffers from the
+   * internal pool can be pushed without copying */
+  gboolean downstream_supports_videometa;
 };
 
 typedef struct _GstFFMpegVidDecClass GstFFMpegVidDecClass;
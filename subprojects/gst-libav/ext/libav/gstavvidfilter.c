@@ -0,0 +1,614 @@
+/* GStreamer
+ * Copyright (C) <1999> Erik Walthinsen <omega@cse.ogi.edu>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:element-avvideofilter
+ * @title: avvideofilter
+ *
+ * Runs a libavfilter filter graph description on raw video, so that
+ * libav's filters can be used in a GStreamer pipeline without piping
+ * the data through an external process. Input buffers are wrapped into
+ * AVFrames and filtered frames are wrapped back into buffers without
+ * copying the video data.
+ *
+ * ## Example launch line
+ * |[
+ * gst-launch-1.0 videotestsrc ! avvideofilter filter-desc="scale=1280:720" ! videoconvert ! autovideosink
+ * ]|
+ *
+ * Since: 1.24
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <libavcodec/avcodec.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/opt.h>
+#include <libavfilter/avfilter.h>
+#include <libavfilter/buffersrc.h>
+#include <libavfilter/buffersink.h>
+
+#include <gst/gst.h>
+#include <gst/video/video.h>
+
+#include "gstav.h"
+#include "gstavcodecmap.h"
+#include "gstavutils.h"
+
+/* Properties */
+
+#define DEFAULT_FILTER_DESC     "null"
+
+enum
+{
+  PROP_0,
+  PROP_FILTER_DESC,
+  PROP_LAST
+};
+
+typedef struct _GstFFMpegVidFilter
+{
+  GstElement element;
+
+  GstPad *sinkpad, *srcpad;
+
+  gchar *filter_desc;
+
+  GstVideoInfo in_info;
+  GstVideoInfo out_info;
+
+  AVFilterContext *buffersink_ctx;
+  AVFilterContext *buffersrc_ctx;
+  AVFilterGraph *filter_graph;
+} GstFFMpegVidFilter;
+
+typedef struct _GstFFMpegVidFilterClass
+{
+  GstElementClass parent_class;
+} GstFFMpegVidFilterClass;
+
+#define GST_TYPE_FFMPEGVIDFILTER \
+  (gst_ffmpegvidfilter_get_type())
+#define GST_FFMPEGVIDFILTER(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_FFMPEGVIDFILTER,GstFFMpegVidFilter))
+#define GST_FFMPEGVIDFILTER_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_FFMPEGVIDFILTER,GstFFMpegVidFilter))
+#define GST_IS_FFMPEGVIDFILTER(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_FFMPEGVIDFILTER))
+#define GST_IS_FFMPEGVIDFILTER_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_FFMPEGVIDFILTER))
+
+GType gst_ffmpegvidfilter_get_type (void);
+
+static void gst_ffmpegvidfilter_set_property (GObject * self, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_ffmpegvidfilter_get_property (GObject * self, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+
+/* timestamps are passed through the graph in nanoseconds */
+static const AVRational gst_time_base = { 1, GST_SECOND };
+
+static GstStaticPadTemplate src_factory = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (GST_VIDEO_FORMATS_ALL))
+    );
+
+static GstStaticPadTemplate sink_factory = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (GST_VIDEO_FORMATS_ALL))
+    );
+
+G_DEFINE_TYPE (GstFFMpegVidFilter, gst_ffmpegvidfilter, GST_TYPE_ELEMENT);
+
+static GstFlowReturn gst_ffmpegvidfilter_chain (GstPad * pad,
+    GstObject * parent, GstBuffer * inbuf);
+
+static void gst_ffmpegvidfilter_finalize (GObject * obj);
+
+static void
+gst_ffmpegvidfilter_class_init (GstFFMpegVidFilterClass * klass)
+{
+  GObjectClass *gobject_class = (GObjectClass *) klass;
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+
+  gobject_class->set_property = gst_ffmpegvidfilter_set_property;
+  gobject_class->get_property = gst_ffmpegvidfilter_get_property;
+  gobject_class->finalize = gst_ffmpegvidfilter_finalize;
+
+  /**
+   * GstFFMpegVidFilter:filter-desc
+   *
+   * libavfilter graph description to run on the video frames, with the
+   * same syntax as ffmpeg's -vf option.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_FILTER_DESC,
+      g_param_spec_string ("filter-desc", "Filter description",
+          "libavfilter graph description to apply",
+          DEFAULT_FILTER_DESC, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+      );
+
+  gst_element_class_add_static_pad_template (element_class, &src_factory);
+  gst_element_class_add_static_pad_template (element_class, &sink_factory);
+
+  gst_element_class_set_static_metadata (element_class,
+      "libav Video filter element", "Filter/Effect/Video",
+      "Run a libavfilter filter graph on video",
+      "GStreamer maintainers <gstreamer-devel@lists.freedesktop.org>");
+}
+
+static void
+delete_filter_graph (GstFFMpegVidFilter * filter)
+{
+  if (filter->filter_graph) {
+    avfilter_graph_free (&filter->filter_graph);
+    filter->buffersrc_ctx = NULL;
+    filter->buffersink_ctx = NULL;
+  }
+}
+
+static int
+init_filter_graph (GstFFMpegVidFilter * filter, GstVideoInfo * info)
+{
+  AVFilterInOut *inputs = NULL, *outputs = NULL;
+  enum AVPixelFormat pixfmt;
+  gchar *filter_desc;
+  char args[512];
+  int res;
+
+  pixfmt = gst_ffmpeg_videoformat_to_pixfmt (GST_VIDEO_INFO_FORMAT (info));
+  if (pixfmt == AV_PIX_FMT_NONE)
+    return AVERROR (EINVAL);
+
+  delete_filter_graph (filter);
+  filter->filter_graph = avfilter_graph_alloc ();
+  if (filter->filter_graph == NULL)
+    return AVERROR (ENOMEM);
+
+  snprintf (args, sizeof (args),
+      "video_size=%dx%d:pix_fmt=%d:time_base=%d/%d:pixel_aspect=%d/%d"
+      ":frame_rate=%d/%d",
+      GST_VIDEO_INFO_WIDTH (info), GST_VIDEO_INFO_HEIGHT (info), pixfmt,
+      gst_time_base.num, gst_time_base.den,
+      GST_VIDEO_INFO_PAR_N (info), GST_VIDEO_INFO_PAR_D (info),
+      GST_VIDEO_INFO_FPS_N (info), GST_VIDEO_INFO_FPS_D (info));
+
+  res = avfilter_graph_create_filter (&filter->buffersrc_ctx,
+      avfilter_get_by_name ("buffer"), "in", args, NULL, filter->filter_graph);
+  if (res < 0)
+    goto done;
+
+  res = avfilter_graph_create_filter (&filter->buffersink_ctx,
+      avfilter_get_by_name ("buffersink"), "out", NULL, NULL,
+      filter->filter_graph);
+  if (res < 0)
+    goto done;
+
+  outputs = avfilter_inout_alloc ();
+  inputs = avfilter_inout_alloc ();
+  if (outputs == NULL || inputs == NULL) {
+    res = AVERROR (ENOMEM);
+    goto done;
+  }
+
+  outputs->name = av_strdup ("in");
+  outputs->filter_ctx = filter->buffersrc_ctx;
+  outputs->pad_idx = 0;
+  outputs->next = NULL;
+
+  inputs->name = av_strdup ("out");
+  inputs->filter_ctx = filter->buffersink_ctx;
+  inputs->pad_idx = 0;
+  inputs->next = NULL;
+
+  GST_OBJECT_LOCK (filter);
+  filter_desc = g_strdup (filter->filter_desc);
+  GST_OBJECT_UNLOCK (filter);
+
+  res = avfilter_graph_parse_ptr (filter->filter_graph, filter_desc,
+      &inputs, &outputs, NULL);
+  g_free (filter_desc);
+  if (res < 0)
+    goto done;
+
+  res = avfilter_graph_config (filter->filter_graph, NULL);
+
+done:
+  avfilter_inout_free (&inputs);
+  avfilter_inout_free (&outputs);
+  if (res < 0)
+    delete_filter_graph (filter);
+
+  return res;
+}
+
+static gboolean
+gst_ffmpegvidfilter_sink_setcaps (GstPad * pad, GstCaps * caps)
+{
+  GstFFMpegVidFilter *filter = GST_FFMPEGVIDFILTER (GST_PAD_PARENT (pad));
+  GstVideoFormat out_format;
+  GstVideoInfo in_info, out_info;
+  AVRational sar;
+  GstCaps *src_caps;
+  gboolean ret;
+  int res;
+
+  if (!gst_video_info_from_caps (&in_info, caps))
+    return FALSE;
+
+  res = init_filter_graph (filter, &in_info);
+  if (res < 0)
+    goto init_failed;
+
+  /* the negotiated graph output determines the source caps */
+  out_format =
+      gst_ffmpeg_pixfmt_to_videoformat (av_buffersink_get_format
+      (filter->buffersink_ctx));
+  if (out_format == GST_VIDEO_FORMAT_UNKNOWN)
+    goto unknown_format;
+
+  gst_video_info_set_format (&out_info, out_format,
+      av_buffersink_get_w (filter->buffersink_ctx),
+      av_buffersink_get_h (filter->buffersink_ctx));
+
+  sar = av_buffersink_get_sample_aspect_ratio (filter->buffersink_ctx);
+  if (sar.num > 0 && sar.den > 0) {
+    out_info.par_n = sar.num;
+    out_info.par_d = sar.den;
+  } else {
+    out_info.par_n = GST_VIDEO_INFO_PAR_N (&in_info);
+    out_info.par_d = GST_VIDEO_INFO_PAR_D (&in_info);
+  }
+  out_info.fps_n = GST_VIDEO_INFO_FPS_N (&in_info);
+  out_info.fps_d = GST_VIDEO_INFO_FPS_D (&in_info);
+
+  filter->in_info = in_info;
+  filter->out_info = out_info;
+
+  src_caps = gst_video_info_to_caps (&out_info);
+  ret = gst_pad_set_caps (filter->srcpad, src_caps);
+  gst_caps_unref (src_caps);
+
+  return ret;
+
+  /* ERRORS */
+init_failed:
+  {
+    GST_ELEMENT_ERROR (filter, LIBRARY, INIT, (NULL),
+        ("Failed to initialize filter graph '%s': %s", filter->filter_desc,
+            av_err2str (res)));
+    return FALSE;
+  }
+unknown_format:
+  {
+    GST_ELEMENT_ERROR (filter, CORE, NEGOTIATION, (NULL),
+        ("Filter graph '%s' produces a pixel format that has no GStreamer "
+            "mapping, add a format filter to the description",
+            filter->filter_desc));
+    return FALSE;
+  }
+}
+
+/* Frees the mapped frame wrapped into an AVFrame when the last
+ * reference inside the filter graph goes away */
+static void
+gst_ffmpegvidfilter_free_in_frame (void *opaque, uint8_t * data)
+{
+  GstVideoFrame *vframe = opaque;
+  GstBuffer *buffer = vframe->buffer;
+
+  gst_video_frame_unmap (vframe);
+  gst_buffer_unref (buffer);
+  g_free (vframe);
+}
+
+/* Wrap @inbuf into a refcounted AVFrame without copying the video data.
+ * Takes ownership of @inbuf on success */
+static AVFrame *
+gst_ffmpegvidfilter_wrap_buffer (GstFFMpegVidFilter * filter,
+    GstBuffer * inbuf)
+{
+  GstVideoFrame *vframe;
+  AVFrame *frame;
+  guint i;
+
+  vframe = g_new0 (GstVideoFrame, 1);
+  if (!gst_video_frame_map (vframe, &filter->in_info, inbuf, GST_MAP_READ)) {
+    g_free (vframe);
+    return NULL;
+  }
+
+  frame = av_frame_alloc ();
+  frame->width = GST_VIDEO_FRAME_WIDTH (vframe);
+  frame->height = GST_VIDEO_FRAME_HEIGHT (vframe);
+  frame->format =
+      gst_ffmpeg_videoformat_to_pixfmt (GST_VIDEO_FRAME_FORMAT (vframe));
+  frame->sample_aspect_ratio.num = filter->in_info.par_n;
+  frame->sample_aspect_ratio.den = filter->in_info.par_d;
+  if (GST_BUFFER_PTS_IS_VALID (inbuf))
+    frame->pts = GST_BUFFER_PTS (inbuf);
+  else
+    frame->pts = AV_NOPTS_VALUE;
+
+  for (i = 0; i < GST_VIDEO_FRAME_N_PLANES (vframe); i++) {
+    frame->data[i] = GST_VIDEO_FRAME_PLANE_DATA (vframe, i);
+    frame->linesize[i] = GST_VIDEO_FRAME_PLANE_STRIDE (vframe, i);
+  }
+
+  frame->buf[0] = av_buffer_create (GST_VIDEO_FRAME_PLANE_DATA (vframe, 0),
+      GST_VIDEO_FRAME_SIZE (vframe), gst_ffmpegvidfilter_free_in_frame,
+      vframe, AV_BUFFER_FLAG_READONLY);
+  if (frame->buf[0] == NULL) {
+    gst_video_frame_unmap (vframe);
+    g_free (vframe);
+    av_frame_free (&frame);
+    return NULL;
+  }
+
+  return frame;
+}
+
+static void
+gst_ffmpegvidfilter_free_out_frame (gpointer data)
+{
+  AVFrame *frame = data;
+
+  av_frame_free (&frame);
+}
+
+/* Wrap the planes of @frame into a GstBuffer without copying, adding a
+ * video meta describing the libav strides. Consumes @frame */
+static GstBuffer *
+gst_ffmpegvidfilter_wrap_frame (GstFFMpegVidFilter * filter, AVFrame * frame)
+{
+  const GstVideoFormatInfo *finfo = filter->out_info.finfo;
+  gsize offset[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint stride[GST_VIDEO_MAX_PLANES] = { 0, };
+  GstBuffer *buffer;
+  gsize acc = 0;
+  guint i;
+
+  buffer = gst_buffer_new ();
+
+  for (i = 0; i < GST_VIDEO_INFO_N_PLANES (&filter->out_info); i++) {
+    AVFrame *plane_ref = av_frame_clone (frame);
+    gsize plane_size;
+
+    if (plane_ref == NULL) {
+      gst_buffer_unref (buffer);
+      av_frame_free (&frame);
+      return NULL;
+    }
+
+    plane_size = (gsize) frame->linesize[i] *
+        GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, i, frame->height);
+
+    /* each memory keeps its own reference on the frame so the plane
+     * data stays alive for as long as any of them is in use */
+    gst_buffer_append_memory (buffer,
+        gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, frame->data[i],
+            plane_size, 0, plane_size, plane_ref,
+            gst_ffmpegvidfilter_free_out_frame));
+
+    offset[i] = acc;
+    stride[i] = frame->linesize[i];
+    acc += plane_size;
+  }
+
+  gst_buffer_add_video_meta_full (buffer, GST_VIDEO_FRAME_FLAG_NONE,
+      GST_VIDEO_INFO_FORMAT (&filter->out_info), frame->width, frame->height,
+      GST_VIDEO_INFO_N_PLANES (&filter->out_info), offset, stride);
+
+  if (frame->pts != AV_NOPTS_VALUE)
+    GST_BUFFER_PTS (buffer) =
+        av_rescale_q (frame->pts, av_buffersink_get_time_base
+        (filter->buffersink_ctx), gst_time_base);
+
+  av_frame_free (&frame);
+
+  return buffer;
+}
+
+/* Pull all frames the graph has ready and push them downstream */
+static GstFlowReturn
+gst_ffmpegvidfilter_drain (GstFFMpegVidFilter * filter,
+    GstClockTime duration)
+{
+  GstFlowReturn result = GST_FLOW_OK;
+  int res;
+
+  for (;;) {
+    GstBuffer *outbuf;
+    AVFrame *frame = av_frame_alloc ();
+
+    res = av_buffersink_get_frame (filter->buffersink_ctx, frame);
+    if (res < 0) {
+      av_frame_free (&frame);
+      if (res == AVERROR (EAGAIN) || res == AVERROR_EOF)
+        break;
+      GST_ELEMENT_ERROR (filter, STREAM, FAILED, (NULL),
+          ("Failed to pull frame from filter graph: %s",
+              av_err2str (res)));
+      return GST_FLOW_ERROR;
+    }
+
+    outbuf = gst_ffmpegvidfilter_wrap_frame (filter, frame);
+    if (outbuf == NULL)
+      return GST_FLOW_ERROR;
+
+    GST_BUFFER_DURATION (outbuf) = duration;
+
+    result = gst_pad_push (filter->srcpad, outbuf);
+    if (result != GST_FLOW_OK)
+      break;
+  }
+
+  return result;
+}
+
+static gboolean
+gst_ffmpegvidfilter_sink_event (GstPad * pad, GstObject * parent,
+    GstEvent * event)
+{
+  GstFFMpegVidFilter *filter = GST_FFMPEGVIDFILTER (parent);
+  gboolean ret = FALSE;
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_CAPS:
+    {
+      GstCaps *caps;
+
+      gst_event_parse_caps (event, &caps);
+      ret = gst_ffmpegvidfilter_sink_setcaps (pad, caps);
+      gst_event_unref (event);
+      break;
+    }
+    case GST_EVENT_EOS:
+      /* flush delayed frames out of the graph before going EOS */
+      if (filter->buffersrc_ctx != NULL &&
+          av_buffersrc_add_frame (filter->buffersrc_ctx, NULL) >= 0)
+        gst_ffmpegvidfilter_drain (filter, GST_CLOCK_TIME_NONE);
+      ret = gst_pad_push_event (filter->srcpad, event);
+      break;
+    default:
+      ret = gst_pad_push_event (filter->srcpad, event);
+      break;
+  }
+
+  return ret;
+}
+
+static GstFlowReturn
+gst_ffmpegvidfilter_chain (GstPad * pad, GstObject * parent, GstBuffer * inbuf)
+{
+  GstFFMpegVidFilter *filter = GST_FFMPEGVIDFILTER (parent);
+  GstClockTime duration = GST_BUFFER_DURATION (inbuf);
+  AVFrame *frame;
+  int res;
+
+  if (filter->filter_graph == NULL)
+    goto not_negotiated;
+
+  frame = gst_ffmpegvidfilter_wrap_buffer (filter, inbuf);
+  if (frame == NULL)
+    goto map_failed;
+
+  /* the graph takes its own reference on the frame data */
+  res = av_buffersrc_add_frame (filter->buffersrc_ctx, frame);
+  av_frame_free (&frame);
+  if (res < 0)
+    goto add_failed;
+
+  return gst_ffmpegvidfilter_drain (filter, duration);
+
+  /* ERRORS */
+not_negotiated:
+  {
+    gst_buffer_unref (inbuf);
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
+map_failed:
+  {
+    GST_ELEMENT_ERROR (filter, STREAM, FAILED, (NULL),
+        ("Failed to map input buffer"));
+    gst_buffer_unref (inbuf);
+    return GST_FLOW_ERROR;
+  }
+add_failed:
+  {
+    GST_ELEMENT_ERROR (filter, STREAM, FAILED, (NULL),
+        ("Failed to feed frame to filter graph: %s",
+            av_err2str (res)));
+    return GST_FLOW_ERROR;
+  }
+}
+
+static void
+gst_ffmpegvidfilter_init (GstFFMpegVidFilter * filter)
+{
+  filter->sinkpad = gst_pad_new_from_static_template (&sink_factory, "sink");
+  gst_pad_set_event_function (filter->sinkpad, gst_ffmpegvidfilter_sink_event);
+  gst_pad_set_chain_function (filter->sinkpad, gst_ffmpegvidfilter_chain);
+  gst_element_add_pad (GST_ELEMENT (filter), filter->sinkpad);
+
+  filter->srcpad = gst_pad_new_from_static_template (&src_factory, "src");
+  gst_element_add_pad (GST_ELEMENT (filter), filter->srcpad);
+
+  filter->filter_desc = g_strdup (DEFAULT_FILTER_DESC);
+}
+
+static void
+gst_ffmpegvidfilter_finalize (GObject * obj)
+{
+  GstFFMpegVidFilter *filter = GST_FFMPEGVIDFILTER (obj);
+
+  delete_filter_graph (filter);
+  g_free (filter->filter_desc);
+
+  G_OBJECT_CLASS (gst_ffmpegvidfilter_parent_class)->finalize (obj);
+}
+
+static void
+gst_ffmpegvidfilter_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstFFMpegVidFilter *self = GST_FFMPEGVIDFILTER (object);
+
+  switch (prop_id) {
+    case PROP_FILTER_DESC:
+      GST_OBJECT_LOCK (self);
+      g_free (self->filter_desc);
+      self->filter_desc = g_value_dup_string (value);
+      if (self->filter_desc == NULL)
+        self->filter_desc = g_strdup (DEFAULT_FILTER_DESC);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
+  }
+}
+
+static void
+gst_ffmpegvidfilter_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstFFMpegVidFilter *self = GST_FFMPEGVIDFILTER (object);
+
+  switch (prop_id) {
+    case PROP_FILTER_DESC:
+      GST_OBJECT_LOCK (self);
+      g_value_set_string (value, self->filter_desc);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
+  }
+}
+
+gboolean
+gst_ffmpegvidfilter_register (GstPlugin * plugin)
+{
+  return gst_element_register (plugin, "avvideofilter",
+      GST_RANK_NONE, GST_TYPE_FFMPEGVIDFILTER);
+}
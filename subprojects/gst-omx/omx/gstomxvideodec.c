@@ -305,7 +305,7 @@ gst_omx_video_dec_open (GstVideoDecoder * decoder)
   self->dec_in_port = gst_omx_component_add_port (self->dec, in_port_index);
   self->dec_out_port = gst_omx_component_add_port (self->dec, out_port_index);
 
-#ifdef USE_OMX_TARGET_ZYNQ_USCALE_PLUS
+#if defined (USE_OMX_TARGET_ZYNQ_USCALE_PLUS) || defined (USE_OMX_TARGET_ALLWINNER)
   GST_DEBUG_OBJECT (self, "Configure decoder output to export dmabuf");
   self->dmabuf = gst_omx_port_set_dmabuf (self->dec_out_port, TRUE);
 #endif
@@ -1720,6 +1720,41 @@ set_outbuffer_interlace_flags (GstOMXBuffer * buf, GstBuffer * outbuf)
 }
 #endif // USE_OMX_TARGET_ZYNQ_USCALE_PLUS
 
+/* Check whether the buffers allocated on @port can still be used with the
+ * changed port settings. If they can, a settings change (say a mid-stream
+ * resolution change) does not need the full port disable/reallocate/enable
+ * cycle and the pipeline keeps running; we just update the caps and
+ * acknowledge the new settings. */
+static gboolean
+gst_omx_video_dec_output_buffers_reusable (GstOMXVideoDec * self,
+    GstOMXPort * port)
+{
+  OMX_PARAM_PORTDEFINITIONTYPE port_def;
+  GstOMXBuffer *buf;
+
+  if (!port->buffers || port->buffers->len == 0)
+    return FALSE;
+
+  /* buffers handed downstream through the pool are tied to the old caps;
+   * the same goes for EGLImages */
+  if (port->using_pool || self->eglimage)
+    return FALSE;
+
+  gst_omx_port_get_port_definition (port, &port_def);
+  if (port_def.nBufferCountActual > port->buffers->len)
+    return FALSE;
+
+  buf = g_ptr_array_index (port->buffers, 0);
+  if (port_def.nBufferSize > buf->omx_buf->nAllocLen)
+    return FALSE;
+
+  GST_DEBUG_OBJECT (self,
+      "New port settings fit the %u allocated buffers of %u bytes",
+      port->buffers->len, (guint) buf->omx_buf->nAllocLen);
+
+  return TRUE;
+}
+
 static void
 gst_omx_video_dec_loop (GstOMXVideoDec * self)
 {
@@ -1750,11 +1785,16 @@ gst_omx_video_dec_loop (GstOMXVideoDec * self)
     GstVideoCodecState *state;
     OMX_PARAM_PORTDEFINITIONTYPE port_def;
     GstVideoFormat format;
+    gboolean reuse_buffers = FALSE;
 
     GST_DEBUG_OBJECT (self, "Port settings have changed, updating caps");
 
-    /* Reallocate all buffers */
     if (acq_return == GST_OMX_ACQUIRE_BUFFER_RECONFIGURE
+        && gst_omx_port_is_enabled (port))
+      reuse_buffers = gst_omx_video_dec_output_buffers_reusable (self, port);
+
+    /* Reallocate all buffers */
+    if (acq_return == GST_OMX_ACQUIRE_BUFFER_RECONFIGURE && !reuse_buffers
         && gst_omx_port_is_enabled (port)) {
       err = gst_omx_port_set_enabled (port, FALSE);
       if (err != OMX_ErrorNone)
@@ -1772,7 +1812,7 @@ gst_omx_video_dec_loop (GstOMXVideoDec * self)
         goto reconfigure_error;
     }
 
-    if (acq_return == GST_OMX_ACQUIRE_BUFFER_RECONFIGURE) {
+    if (acq_return == GST_OMX_ACQUIRE_BUFFER_RECONFIGURE && !reuse_buffers) {
       /* We have the possibility to reconfigure everything now */
       err = gst_omx_video_dec_reconfigure_output_port (self);
       if (err != OMX_ErrorNone)
@@ -1825,6 +1865,14 @@ gst_omx_video_dec_loop (GstOMXVideoDec * self)
       gst_video_codec_state_unref (state);
 
       GST_VIDEO_DECODER_STREAM_UNLOCK (self);
+
+      if (reuse_buffers) {
+        /* Acknowledge the settings change; the allocated buffers stay as
+         * they are and the decoder keeps running */
+        err = gst_omx_port_mark_reconfigured (port);
+        if (err != OMX_ErrorNone)
+          goto reconfigure_error;
+      }
     }
 
     /* Now get a buffer */
@@ -166,7 +166,9 @@ gst_cea708dec_create (PangoContext * pango_context)
 
   /* Initialize 708 variables */
   for (i = 0; i < MAX_708_WINDOWS; i++) {
-    decoder->cc_windows[i] = g_malloc (sizeof (cea708Window));
+    /* zero-filled so that gst_cea708dec_init_window() can release any
+     * previously rendered state without checking for a fresh window */
+    decoder->cc_windows[i] = g_malloc0 (sizeof (cea708Window));
     gst_cea708dec_init_window (decoder, i);
   }
   decoder->desired_service = 1;
@@ -1316,6 +1318,9 @@ gst_cea708dec_scroll_window_up (Cea708Dec * decoder, guint window_id)
 static void
 gst_cea708dec_clear_window (Cea708Dec * decoder, cea708Window * window)
 {
+  if (window->layout)
+    g_object_unref (window->layout);
+  g_free (window->cached_markup);
   g_free (window->text_image);
   memset (window, 0, sizeof (cea708Window));
 }
@@ -1383,13 +1388,18 @@ gst_cea708dec_init_window (Cea708Dec * decoder, guint window_id)
 
   window->v_offset = 0;
   window->h_offset = 0;
+  if (window->layout)
+    g_object_unref (window->layout);
   window->layout = NULL;
   window->shadow_offset = 0;
   window->outline_offset = 0;
   window->image_width = 0;
   window->image_height = 0;
+  g_free (window->text_image);
   window->text_image = NULL;
-
+  g_free (window->cached_markup);
+  window->cached_markup = NULL;
+  window->image_dirty = FALSE;
 }
 
 static void
@@ -1620,6 +1630,21 @@ gst_cea708dec_render_text (Cea708Dec * decoder, GSList ** text_list,
     g_slist_foreach (*text_list, get_cea708dec_bufcat, out_str);
     GST_LOG ("rendering '%s'", out_str);
     g_slist_free (*text_list);
+    *text_list = NULL;
+
+    /* Many streams retransmit the same window contents over and over.
+     * If nothing changed since the last render, keep the existing
+     * text_image instead of laying out and rasterizing it again. */
+    if (window->text_image != NULL && window->cached_markup != NULL
+        && window->cached_justify_mode == window->justify_mode
+        && strcmp (window->cached_markup, out_str) == 0) {
+      GST_LOG ("window %d text unchanged, reusing rendered image", window_id);
+      g_free (out_str);
+      return TRUE;
+    }
+
+    if (window->layout)
+      g_object_unref (window->layout);
     window->layout = pango_layout_new (decoder->pango_context);
     align_mode = gst_cea708dec_get_align_mode (window->justify_mode);
     pango_layout_set_alignment (window->layout, (PangoAlignment) align_mode);
@@ -1635,6 +1660,13 @@ gst_cea708dec_render_text (Cea708Dec * decoder, GSList ** text_list,
       gst_cea708dec_adjust_values_with_fontdesc (window, desc);
       pango_font_description_free (desc);
       gst_cea708dec_render_pangocairo (window);
+      /* remember what was rendered, and flag the new image for the
+       * overlay to pick up */
+      g_free (window->cached_markup);
+      window->cached_markup = out_str;
+      out_str = NULL;
+      window->cached_justify_mode = window->justify_mode;
+      window->image_dirty = TRUE;
     } else {
       GST_ERROR ("font description parse failed: %s", font_desc);
     }
@@ -1642,7 +1674,6 @@ gst_cea708dec_render_text (Cea708Dec * decoder, GSList ** text_list,
     g_free (out_str);
     /* data freed in slist loop!
      *g_slist_free_full (*text_list, g_free); */
-    *text_list = NULL;
     return TRUE;
   }
 
@@ -442,6 +442,13 @@ typedef struct
   gint image_width;
   gint image_height;
   gboolean updated;
+  /* pango markup of the most recently rendered text, so identical
+   * window updates don't have to be rendered again */
+  gchar *cached_markup;
+  guint8 cached_justify_mode;
+  /* TRUE when text_image changed since the overlay last built an
+   * overlay rectangle for this window */
+  gboolean image_dirty;
 } cea708Window;
 
 struct _Cea708Dec
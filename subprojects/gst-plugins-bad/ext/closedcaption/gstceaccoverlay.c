@@ -296,6 +296,14 @@ static void
 gst_cea_cc_overlay_finalize (GObject * object)
 {
   GstCeaCcOverlay *overlay = GST_CEA_CC_OVERLAY (object);
+  guint i;
+
+  for (i = 0; i < MAX_708_WINDOWS; i++) {
+    if (overlay->window_rects[i]) {
+      gst_video_overlay_rectangle_unref (overlay->window_rects[i]);
+      overlay->window_rects[i] = NULL;
+    }
+  }
 
   if (overlay->current_composition) {
     gst_video_overlay_composition_unref (overlay->current_composition);
@@ -1267,7 +1275,6 @@ gst_cea_cc_overlay_create_and_push_buffer (GstCeaCcOverlay * overlay)
   GstBuffer *outbuf;
   GstMapInfo map;
   guint8 *window_image;
-  gint n;
   guint window_id;
   cea708Window *window;
   guint v_anchor = 0;
@@ -1283,28 +1290,6 @@ gst_cea_cc_overlay_create_and_push_buffer (GstCeaCcOverlay * overlay)
       continue;
     }
     if (!window->deleted && window->visible && window->text_image != NULL) {
-      GST_DEBUG_OBJECT (overlay, "Allocating buffer");
-      outbuf =
-          gst_buffer_new_and_alloc (window->image_width *
-          window->image_height * 4);
-      gst_buffer_map (outbuf, &map, GST_MAP_WRITE);
-      window_image = map.data;
-      if (decoder->use_ARGB) {
-        memset (window_image, 0,
-            window->image_width * window->image_height * 4);
-        gst_buffer_add_video_meta (outbuf, GST_VIDEO_FRAME_FLAG_NONE,
-            GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_RGB, window->image_width,
-            window->image_height);
-      } else {
-        for (n = 0; n < window->image_width * window->image_height; n++) {
-          window_image[n * 4] = window_image[n * 4 + 1] = 0;
-          window_image[n * 4 + 2] = window_image[n * 4 + 3] = 128;
-        }
-        gst_buffer_add_video_meta (outbuf, GST_VIDEO_FRAME_FLAG_NONE,
-            GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_YUV, window->image_width,
-            window->image_height);
-      }
-
       v_anchor = window->screen_vertical * overlay->height / 100;
       switch (overlay->default_window_h_pos) {
         case GST_CEA_CC_OVERLAY_WIN_H_LEFT:
@@ -1363,29 +1348,66 @@ gst_cea_cc_overlay_create_and_push_buffer (GstCeaCcOverlay * overlay)
         default:
           break;
       }
-      if (decoder->use_ARGB) {
-        gst_cea_cc_overlay_image_to_argb (window_image, window,
-            window->image_width * 4);
-      } else {
-        gst_cea_cc_overlay_image_to_ayuv (window_image, window,
-            window->image_width * 4);
-      }
-      gst_buffer_unmap (outbuf, &map);
       GST_INFO_OBJECT (overlay,
           "window->anchor_point=%d,v_anchor=%d,h_anchor=%d,window->image_height=%d,window->image_width=%d, window->v_offset=%d, window->h_offset=%d,window->justify_mode=%d",
           window->anchor_point, v_anchor, h_anchor, window->image_height,
           window->image_width, window->v_offset, window->h_offset,
           window->justify_mode);
-      rect =
-          gst_video_overlay_rectangle_new_raw (outbuf, window->h_offset,
-          window->v_offset, window->image_width, window->image_height, 0);
+
+      /* Reuse the rectangle from the previous composition if neither the
+       * window image nor its position changed, so that downstream can
+       * reuse any scaled/converted copies it cached for it */
+      rect = overlay->window_rects[window_id];
+      if (rect != NULL && !window->image_dirty) {
+        gint rx, ry;
+        guint rw, rh;
+
+        gst_video_overlay_rectangle_get_render_rectangle (rect, &rx, &ry,
+            &rw, &rh);
+        if (rx != window->h_offset || ry != window->v_offset
+            || rw != (guint) window->image_width
+            || rh != (guint) window->image_height)
+          rect = NULL;
+      } else {
+        rect = NULL;
+      }
+
+      if (rect == NULL) {
+        GST_DEBUG_OBJECT (overlay, "Allocating buffer");
+        outbuf =
+            gst_buffer_new_and_alloc (window->image_width *
+            window->image_height * 4);
+        gst_buffer_map (outbuf, &map, GST_MAP_WRITE);
+        window_image = map.data;
+        if (decoder->use_ARGB) {
+          gst_buffer_add_video_meta (outbuf, GST_VIDEO_FRAME_FLAG_NONE,
+              GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_RGB, window->image_width,
+              window->image_height);
+          gst_cea_cc_overlay_image_to_argb (window_image, window,
+              window->image_width * 4);
+        } else {
+          gst_buffer_add_video_meta (outbuf, GST_VIDEO_FRAME_FLAG_NONE,
+              GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_YUV, window->image_width,
+              window->image_height);
+          gst_cea_cc_overlay_image_to_ayuv (window_image, window,
+              window->image_width * 4);
+        }
+        gst_buffer_unmap (outbuf, &map);
+        rect =
+            gst_video_overlay_rectangle_new_raw (outbuf, window->h_offset,
+            window->v_offset, window->image_width, window->image_height, 0);
+        gst_buffer_unref (outbuf);
+        if (overlay->window_rects[window_id])
+          gst_video_overlay_rectangle_unref (overlay->window_rects[window_id]);
+        overlay->window_rects[window_id] = rect;
+        window->image_dirty = FALSE;
+      }
+
       if (comp == NULL) {
         comp = gst_video_overlay_composition_new (rect);
       } else {
         gst_video_overlay_composition_add_rectangle (comp, rect);
       }
-      gst_video_overlay_rectangle_unref (rect);
-      gst_buffer_unref (outbuf);
     }
   }
 
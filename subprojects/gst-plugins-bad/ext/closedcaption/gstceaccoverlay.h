@@ -119,6 +119,11 @@ struct _GstCeaCcOverlay
   gboolean need_update;
 
   gboolean attach_compo_to_buffer;
+
+  /* per-window overlay rectangles, kept so that windows whose image did
+   * not change are added to a new composition without converting and
+   * uploading their pixels again */
+  GstVideoOverlayRectangle *window_rects[MAX_708_WINDOWS];
 };
 
 /* FIXME : Pango context and MT-safe since 1.32.6 */
@@ -250,6 +250,14 @@ struct _GstDashSink
   guint64 minimum_update_period;
   guint64 min_buffer_time;
   gint64 period_duration;
+
+  /* I/O worker writing the MPD updates, so that the streaming thread is not
+   * stalled on (possibly remote) I/O while the next fragment is packaged */
+  GThread *io_thread;
+  GAsyncQueue *io_queue;
+  GMutex io_lock;
+  GCond io_cond;
+  guint io_pending;
 };
 
 typedef struct _GstDashSinkStream
@@ -398,6 +406,8 @@ gst_dash_sink_finalize (GObject * object)
   if (sink->mpd_client)
     gst_mpd_client_free (sink->mpd_client);
   g_mutex_clear (&sink->mpd_lock);
+  g_mutex_clear (&sink->io_lock);
+  g_cond_clear (&sink->io_cond);
 
   g_list_free_full (sink->streams, gst_dash_sink_stream_free);
 
@@ -682,6 +692,8 @@ gst_dash_sink_init (GstDashSink * sink)
   sink->period_duration = DEFAULT_MPD_PERIOD_DURATION;
 
   g_mutex_init (&sink->mpd_lock);
+  g_mutex_init (&sink->io_lock);
+  g_cond_init (&sink->io_cond);
 
   GST_OBJECT_FLAG_SET (sink, GST_ELEMENT_FLAG_SINK);
 
@@ -841,31 +853,28 @@ gst_dash_sink_generate_mpd_content (GstDashSink * sink,
   }
 }
 
+typedef struct _GstDashSinkIOJob
+{
+  gchar *mpd_content;           /* NULL means stop the I/O thread */
+  gchar *mpd_filepath;
+} GstDashSinkIOJob;
+
 static void
-gst_dash_sink_write_mpd_file (GstDashSink * sink,
-    GstDashSinkStream * current_stream)
+gst_dash_sink_io_job_free (GstDashSinkIOJob * job)
+{
+  g_free (job->mpd_content);
+  g_free (job->mpd_filepath);
+  g_free (job);
+}
+
+static void
+gst_dash_sink_write_mpd_content (GstDashSink * sink, const gchar * mpd_content,
+    const gchar * mpd_filepath)
 {
-  char *mpd_content = NULL;
-  gint size;
   GError *error = NULL;
-  gchar *mpd_filepath = NULL;
   GOutputStream *file_stream = NULL;
   gsize bytes_to_write;
 
-  g_mutex_lock (&sink->mpd_lock);
-  gst_dash_sink_generate_mpd_content (sink, current_stream);
-  if (!gst_mpd_client_get_xml_content (sink->mpd_client, &mpd_content, &size)) {
-    g_mutex_unlock (&sink->mpd_lock);
-    return;
-  }
-  g_mutex_unlock (&sink->mpd_lock);
-
-  if (sink->mpd_root_path)
-    mpd_filepath =
-        g_build_path (G_DIR_SEPARATOR_S, sink->mpd_root_path,
-        sink->mpd_filename, NULL);
-  else
-    mpd_filepath = g_strdup (sink->mpd_filename);
   GST_DEBUG_OBJECT (sink, "a new mpd content is available: %s", mpd_content);
   GST_DEBUG_OBJECT (sink, "write mpd to %s", mpd_filepath);
 
@@ -874,6 +883,7 @@ gst_dash_sink_write_mpd_file (GstDashSink * sink,
   if (!file_stream) {
     GST_ELEMENT_ERROR (sink, RESOURCE, OPEN_WRITE,
         (("Got no output stream for fragment '%s'."), mpd_filepath), (NULL));
+    return;
   }
 
   bytes_to_write = strlen (mpd_content);
@@ -886,11 +896,121 @@ gst_dash_sink_write_mpd_file (GstDashSink * sink,
     error = NULL;
   }
 
-  g_free (mpd_content);
-  g_free (mpd_filepath);
   g_object_unref (file_stream);
 }
 
+static gpointer
+gst_dash_sink_io_thread_func (gpointer data)
+{
+  GstDashSink *sink = GST_DASH_SINK (data);
+  GstDashSinkIOJob *job;
+  gboolean stop = FALSE;
+
+  while (!stop) {
+    job = g_async_queue_pop (sink->io_queue);
+
+    if (job->mpd_content)
+      gst_dash_sink_write_mpd_content (sink, job->mpd_content,
+          job->mpd_filepath);
+    else
+      stop = TRUE;
+
+    g_mutex_lock (&sink->io_lock);
+    sink->io_pending--;
+    g_cond_broadcast (&sink->io_cond);
+    g_mutex_unlock (&sink->io_lock);
+
+    gst_dash_sink_io_job_free (job);
+  }
+
+  return NULL;
+}
+
+static void
+gst_dash_sink_io_push_job (GstDashSink * sink, GstDashSinkIOJob * job)
+{
+  g_mutex_lock (&sink->io_lock);
+  sink->io_pending++;
+  g_mutex_unlock (&sink->io_lock);
+  g_async_queue_push (sink->io_queue, job);
+}
+
+/* Wait until all queued I/O jobs have been executed */
+static void
+gst_dash_sink_io_flush (GstDashSink * sink)
+{
+  if (!sink->io_thread)
+    return;
+
+  g_mutex_lock (&sink->io_lock);
+  while (sink->io_pending > 0)
+    g_cond_wait (&sink->io_cond, &sink->io_lock);
+  g_mutex_unlock (&sink->io_lock);
+}
+
+static void
+gst_dash_sink_io_start (GstDashSink * sink)
+{
+  sink->io_queue =
+      g_async_queue_new_full ((GDestroyNotify) gst_dash_sink_io_job_free);
+  sink->io_pending = 0;
+  sink->io_thread =
+      g_thread_new ("dashsink-io", gst_dash_sink_io_thread_func, sink);
+}
+
+static void
+gst_dash_sink_io_stop (GstDashSink * sink)
+{
+  if (!sink->io_thread)
+    return;
+
+  gst_dash_sink_io_push_job (sink, g_new0 (GstDashSinkIOJob, 1));
+
+  g_thread_join (sink->io_thread);
+  sink->io_thread = NULL;
+  g_async_queue_unref (sink->io_queue);
+  sink->io_queue = NULL;
+}
+
+/* Generates the updated MPD and queues it for writing on the I/O thread, so
+ * the streaming thread can go on packaging the next fragment while the
+ * manifest of the previous one is written or uploaded */
+static void
+gst_dash_sink_write_mpd_file (GstDashSink * sink,
+    GstDashSinkStream * current_stream)
+{
+  char *mpd_content = NULL;
+  gint size;
+  gchar *mpd_filepath = NULL;
+
+  g_mutex_lock (&sink->mpd_lock);
+  gst_dash_sink_generate_mpd_content (sink, current_stream);
+  if (!gst_mpd_client_get_xml_content (sink->mpd_client, &mpd_content, &size)) {
+    g_mutex_unlock (&sink->mpd_lock);
+    return;
+  }
+  g_mutex_unlock (&sink->mpd_lock);
+
+  if (sink->mpd_root_path)
+    mpd_filepath =
+        g_build_path (G_DIR_SEPARATOR_S, sink->mpd_root_path,
+        sink->mpd_filename, NULL);
+  else
+    mpd_filepath = g_strdup (sink->mpd_filename);
+
+  if (sink->io_thread) {
+    GstDashSinkIOJob *job = g_new0 (GstDashSinkIOJob, 1);
+
+    job->mpd_content = mpd_content;
+    job->mpd_filepath = mpd_filepath;
+    gst_dash_sink_io_push_job (sink, job);
+  } else {
+    gst_dash_sink_write_mpd_content (sink, mpd_content, mpd_filepath);
+    g_free (mpd_content);
+    g_free (mpd_filepath);
+  }
+}
+
 static void
 gst_dash_sink_handle_message (GstBin * bin, GstMessage * message)
 {
@@ -922,6 +1042,8 @@ gst_dash_sink_handle_message (GstBin * bin, GstMessage * message)
     }
     case GST_MESSAGE_EOS:{
       gst_dash_sink_write_mpd_file (sink, NULL);
+      /* make sure the final MPD is on disk before EOS is forwarded */
+      gst_dash_sink_io_flush (sink);
       break;
     }
     default:
@@ -1053,6 +1175,7 @@ gst_dash_sink_change_state (GstElement * element, GstStateChange trans)
       if (!g_list_length (sink->streams)) {
         return GST_STATE_CHANGE_FAILURE;
       }
+      gst_dash_sink_io_start (sink);
       break;
     default:
       break;
@@ -1064,7 +1187,11 @@ gst_dash_sink_change_state (GstElement * element, GstStateChange trans)
     case GST_STATE_CHANGE_PLAYING_TO_PAUSED:
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
+      gst_dash_sink_io_flush (sink);
+      gst_dash_sink_reset (sink);
+      break;
     case GST_STATE_CHANGE_READY_TO_NULL:
+      gst_dash_sink_io_stop (sink);
       gst_dash_sink_reset (sink);
       break;
     default:
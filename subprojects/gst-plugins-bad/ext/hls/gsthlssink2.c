@@ -139,6 +139,9 @@ gst_hls_sink2_finalize (GObject * object)
   g_queue_foreach (&sink->old_locations, (GFunc) g_free, NULL);
   g_queue_clear (&sink->old_locations);
 
+  g_mutex_clear (&sink->io_lock);
+  g_cond_clear (&sink->io_cond);
+
   G_OBJECT_CLASS (parent_class)->finalize ((GObject *) sink);
 }
 
@@ -349,6 +352,8 @@ gst_hls_sink2_init (GstHlsSink2 * sink)
   sink->target_duration = DEFAULT_TARGET_DURATION;
   sink->send_keyframe_requests = DEFAULT_SEND_KEYFRAME_REQUESTS;
   g_queue_init (&sink->old_locations);
+  g_mutex_init (&sink->io_lock);
+  g_cond_init (&sink->io_cond);
 
   sink->splitmuxsink = gst_element_factory_make ("splitmuxsink", NULL);
   gst_bin_add (GST_BIN (sink), sink->splitmuxsink);
@@ -385,10 +390,32 @@ gst_hls_sink2_reset (GstHlsSink2 * sink)
   sink->state = GST_M3U8_PLAYLIST_RENDER_INIT;
 }
 
+typedef enum
+{
+  GST_HLS_SINK2_IO_JOB_WRITE_PLAYLIST,
+  GST_HLS_SINK2_IO_JOB_DELETE_FRAGMENT,
+  GST_HLS_SINK2_IO_JOB_STOP,
+} GstHlsSink2IOJobType;
+
+typedef struct
+{
+  GstHlsSink2IOJobType type;
+  gchar *playlist_content;
+  gchar *location;
+} GstHlsSink2IOJob;
+
 static void
-gst_hls_sink2_write_playlist (GstHlsSink2 * sink)
+gst_hls_sink2_io_job_free (GstHlsSink2IOJob * job)
+{
+  g_free (job->playlist_content);
+  g_free (job->location);
+  g_free (job);
+}
+
+static void
+gst_hls_sink2_write_playlist_content (GstHlsSink2 * sink,
+    const gchar * playlist_content)
 {
-  char *playlist_content;
   GError *error = NULL;
   GOutputStream *stream = NULL;
   gsize bytes_to_write;
@@ -402,7 +429,6 @@ gst_hls_sink2_write_playlist (GstHlsSink2 * sink)
     return;
   }
 
-  playlist_content = gst_m3u8_playlist_render (sink->playlist);
   bytes_to_write = strlen (playlist_content);
   if (!g_output_stream_write_all (stream, playlist_content, bytes_to_write,
           NULL, NULL, &error)) {
@@ -413,10 +439,135 @@ gst_hls_sink2_write_playlist (GstHlsSink2 * sink)
     error = NULL;
   }
 
-  g_free (playlist_content);
   g_object_unref (stream);
 }
 
+static void
+gst_hls_sink2_delete_fragment (GstHlsSink2 * sink, const gchar * location)
+{
+  if (g_signal_has_handler_pending (sink,
+          signals[SIGNAL_DELETE_FRAGMENT], 0, FALSE)) {
+    g_signal_emit (sink, signals[SIGNAL_DELETE_FRAGMENT], 0, location);
+  } else {
+    GFile *file = g_file_new_for_path (location);
+    GError *err = NULL;
+
+    if (!g_file_delete (file, NULL, &err)) {
+      GST_ELEMENT_ERROR (sink, RESOURCE, OPEN_WRITE,
+          (("Failed to delete fragment file '%s': %s."),
+              location, err->message), (NULL));
+      g_clear_error (&err);
+    }
+
+    g_object_unref (file);
+  }
+}
+
+static gpointer
+gst_hls_sink2_io_thread_func (gpointer data)
+{
+  GstHlsSink2 *sink = GST_HLS_SINK2_CAST (data);
+  GstHlsSink2IOJob *job;
+  gboolean stop = FALSE;
+
+  while (!stop) {
+    job = g_async_queue_pop (sink->io_queue);
+
+    switch (job->type) {
+      case GST_HLS_SINK2_IO_JOB_WRITE_PLAYLIST:
+        gst_hls_sink2_write_playlist_content (sink, job->playlist_content);
+        break;
+      case GST_HLS_SINK2_IO_JOB_DELETE_FRAGMENT:
+        gst_hls_sink2_delete_fragment (sink, job->location);
+        break;
+      case GST_HLS_SINK2_IO_JOB_STOP:
+        stop = TRUE;
+        break;
+    }
+
+    g_mutex_lock (&sink->io_lock);
+    sink->io_pending--;
+    g_cond_broadcast (&sink->io_cond);
+    g_mutex_unlock (&sink->io_lock);
+
+    gst_hls_sink2_io_job_free (job);
+  }
+
+  return NULL;
+}
+
+static void
+gst_hls_sink2_io_push_job (GstHlsSink2 * sink, GstHlsSink2IOJob * job)
+{
+  g_mutex_lock (&sink->io_lock);
+  sink->io_pending++;
+  g_mutex_unlock (&sink->io_lock);
+  g_async_queue_push (sink->io_queue, job);
+}
+
+/* Wait until all queued I/O jobs have been executed */
+static void
+gst_hls_sink2_io_flush (GstHlsSink2 * sink)
+{
+  if (!sink->io_thread)
+    return;
+
+  g_mutex_lock (&sink->io_lock);
+  while (sink->io_pending > 0)
+    g_cond_wait (&sink->io_cond, &sink->io_lock);
+  g_mutex_unlock (&sink->io_lock);
+}
+
+static void
+gst_hls_sink2_io_start (GstHlsSink2 * sink)
+{
+  sink->io_queue =
+      g_async_queue_new_full ((GDestroyNotify) gst_hls_sink2_io_job_free);
+  sink->io_pending = 0;
+  sink->io_thread =
+      g_thread_new ("hlssink2-io", gst_hls_sink2_io_thread_func, sink);
+}
+
+static void
+gst_hls_sink2_io_stop (GstHlsSink2 * sink)
+{
+  GstHlsSink2IOJob *job;
+
+  if (!sink->io_thread)
+    return;
+
+  job = g_new0 (GstHlsSink2IOJob, 1);
+  job->type = GST_HLS_SINK2_IO_JOB_STOP;
+  gst_hls_sink2_io_push_job (sink, job);
+
+  g_thread_join (sink->io_thread);
+  sink->io_thread = NULL;
+  g_async_queue_unref (sink->io_queue);
+  sink->io_queue = NULL;
+}
+
+/* Renders the current playlist and queues it for writing on the I/O thread,
+ * so the streaming thread can go on packaging the next fragment while the
+ * playlist of the previous one is written or uploaded */
+static void
+gst_hls_sink2_write_playlist (GstHlsSink2 * sink)
+{
+  gchar *playlist_content;
+
+  playlist_content = gst_m3u8_playlist_render (sink->playlist);
+
+  if (sink->io_thread) {
+    GstHlsSink2IOJob *job = g_new0 (GstHlsSink2IOJob, 1);
+
+    job->type = GST_HLS_SINK2_IO_JOB_WRITE_PLAYLIST;
+    job->playlist_content = playlist_content;
+    gst_hls_sink2_io_push_job (sink, job);
+  } else {
+    gst_hls_sink2_write_playlist_content (sink, playlist_content);
+    g_free (playlist_content);
+  }
+}
+
 static void
 gst_hls_sink2_handle_message (GstBin * bin, GstMessage * message)
 {
@@ -466,25 +617,16 @@ gst_hls_sink2_handle_message (GstBin * bin, GstMessage * message)
             while (g_queue_get_length (&sink->old_locations) > sink->max_files) {
               gchar *old_location = g_queue_pop_head (&sink->old_locations);
 
+              if (sink->io_thread) {
+                GstHlsSink2IOJob *job = g_new0 (GstHlsSink2IOJob, 1);
 
-              if (g_signal_has_handler_pending (sink,
-                      signals[SIGNAL_DELETE_FRAGMENT], 0, FALSE)) {
-                g_signal_emit (sink, signals[SIGNAL_DELETE_FRAGMENT], 0,
-                    old_location);
+                job->type = GST_HLS_SINK2_IO_JOB_DELETE_FRAGMENT;
+                job->location = old_location;
+                gst_hls_sink2_io_push_job (sink, job);
               } else {
-                GFile *file = g_file_new_for_path (old_location);
-                GError *err = NULL;
-
-                if (!g_file_delete (file, NULL, &err)) {
-                  GST_ELEMENT_ERROR (sink, RESOURCE, OPEN_WRITE,
-                      (("Failed to delete fragment file '%s': %s."),
-                          old_location, err->message), (NULL));
-                  g_clear_error (&err);
-                }
-
-                g_object_unref (file);
+                gst_hls_sink2_delete_fragment (sink, old_location);
+                g_free (old_location);
               }
-              g_free (old_location);
             }
           }
 
@@ -497,6 +639,8 @@ gst_hls_sink2_handle_message (GstBin * bin, GstMessage * message)
     case GST_MESSAGE_EOS:{
       sink->playlist->end_list = TRUE;
       gst_hls_sink2_write_playlist (sink);
+      /* make sure the final playlist is on disk before EOS is forwarded */
+      gst_hls_sink2_io_flush (sink);
       sink->state |= GST_M3U8_PLAYLIST_RENDER_ENDED;
       break;
     }
@@ -579,6 +723,7 @@ gst_hls_sink2_change_state (GstElement * element, GstStateChange trans)
       if (!sink->splitmuxsink) {
         return GST_STATE_CHANGE_FAILURE;
       }
+      gst_hls_sink2_io_start (sink);
       break;
     default:
       break;
@@ -596,8 +741,11 @@ gst_hls_sink2_change_state (GstElement * element, GstStateChange trans)
         sink->playlist->end_list = TRUE;
         gst_hls_sink2_write_playlist (sink);
       }
-      /* fall-through */
+      gst_hls_sink2_io_flush (sink);
+      gst_hls_sink2_reset (sink);
+      break;
     case GST_STATE_CHANGE_READY_TO_NULL:
+      gst_hls_sink2_io_stop (sink);
       gst_hls_sink2_reset (sink);
       break;
     default:
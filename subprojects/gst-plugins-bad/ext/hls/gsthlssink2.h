@@ -58,6 +58,15 @@ struct _GstHlsSink2
   GstClockTime current_running_time_start;
   GQueue old_locations;
   GstM3U8PlaylistRenderState state;
+
+  /* I/O worker writing playlists and deleting old fragments, so that the
+   * streaming thread is not stalled on (possibly remote) I/O while the next
+   * fragment is being packaged */
+  GThread *io_thread;
+  GAsyncQueue *io_queue;
+  GMutex io_lock;
+  GCond io_cond;
+  guint io_pending;
 };
 
 struct _GstHlsSink2Class
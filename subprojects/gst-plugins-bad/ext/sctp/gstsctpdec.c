@@ -150,6 +150,8 @@ static GstStateChangeReturn gst_sctp_dec_change_state (GstElement * element,
     GstStateChange transition);
 static GstFlowReturn gst_sctp_dec_packet_chain (GstPad * pad, GstSctpDec * self,
     GstBuffer * buf);
+static GstFlowReturn gst_sctp_dec_packet_chain_list (GstPad * pad,
+    GstSctpDec * self, GstBufferList * list);
 static gboolean gst_sctp_dec_packet_event (GstPad * pad, GstSctpDec * self,
     GstEvent * event);
 static void gst_sctp_data_srcpad_loop (GstPad * pad);
@@ -233,6 +235,9 @@ gst_sctp_dec_init (GstSctpDec * self)
   self->sink_pad = gst_pad_new_from_static_template (&sink_template, "sink");
   gst_pad_set_chain_function (self->sink_pad,
       GST_DEBUG_FUNCPTR ((GstPadChainFunction) gst_sctp_dec_packet_chain));
+  gst_pad_set_chain_list_function (self->sink_pad,
+      GST_DEBUG_FUNCPTR ((GstPadChainListFunction)
+          gst_sctp_dec_packet_chain_list));
   gst_pad_set_event_function (self->sink_pad,
       GST_DEBUG_FUNCPTR ((GstPadEventFunction) gst_sctp_dec_packet_event));
 
@@ -353,6 +358,46 @@ gst_sctp_dec_packet_chain (GstPad * pad, GstSctpDec * self, GstBuffer * buf)
   return flow_ret;
 }
 
+static GstFlowReturn
+gst_sctp_dec_packet_chain_list (GstPad * pad, GstSctpDec * self,
+    GstBufferList * list)
+{
+  GstFlowReturn flow_ret;
+  guint i, len;
+
+  len = gst_buffer_list_length (list);
+  GST_DEBUG_OBJECT (self, "Processing received buffer list of %u packets", len);
+
+  /* Feed the whole list to usrsctp and only combine the flow returns once at
+   * the end, instead of paying for a chain call per packet */
+  for (i = 0; i < len; i++) {
+    GstBuffer *buf = gst_buffer_list_get (list, i);
+    GstMapInfo map;
+
+    if (!gst_buffer_map (buf, &map, GST_MAP_READ)) {
+      GST_ERROR_OBJECT (self, "Could not map GstBuffer");
+      continue;
+    }
+
+    gst_sctp_association_incoming_packet (self->sctp_association,
+        (const guint8 *) map.data, (guint32) map.size);
+    gst_buffer_unmap (buf, &map);
+  }
+
+  gst_buffer_list_unref (list);
+
+  GST_OBJECT_LOCK (self);
+  /* This gets the last combined flow return from all source pads */
+  flow_ret = gst_flow_combiner_update_flow (self->flow_combiner, GST_FLOW_OK);
+  GST_OBJECT_UNLOCK (self);
+
+  if (flow_ret != GST_FLOW_OK) {
+    GST_DEBUG_OBJECT (self, "Returning %s", gst_flow_get_name (flow_ret));
+  }
+
+  return flow_ret;
+}
+
 static void
 flush_srcpad (const GValue * item, gpointer user_data)
 {
@@ -612,6 +657,8 @@ remove_pad (GstSctpDec * self, GstPad * pad)
     gst_element_remove_pad (GST_ELEMENT (self), pad);
   GST_PAD_STREAM_UNLOCK (pad);
   GST_OBJECT_LOCK (self);
+  if (self->last_used_pad == pad)
+    gst_object_replace ((GstObject **) & self->last_used_pad, NULL);
   gst_flow_combiner_remove_pad (self->flow_combiner, pad);
   GST_OBJECT_UNLOCK (self);
 }
@@ -660,8 +707,23 @@ on_receive (GstSctpAssociation * sctp_association, guint8 * buf,
   GstDataQueueItem *item;
   GstBuffer *gstbuf;
 
-  src_pad = get_pad_for_stream_id (self, stream_id);
-  g_assert (src_pad);
+  GST_OBJECT_LOCK (self);
+  if (self->last_used_pad && self->last_stream_id == stream_id)
+    src_pad = gst_object_ref (self->last_used_pad);
+  else
+    src_pad = NULL;
+  GST_OBJECT_UNLOCK (self);
+
+  if (!src_pad) {
+    src_pad = get_pad_for_stream_id (self, stream_id);
+    g_assert (src_pad);
+
+    GST_OBJECT_LOCK (self);
+    gst_object_replace ((GstObject **) & self->last_used_pad,
+        GST_OBJECT (src_pad));
+    self->last_stream_id = stream_id;
+    GST_OBJECT_UNLOCK (self);
+  }
 
   GST_DEBUG_OBJECT (src_pad,
       "Received incoming packet of size %" G_GSIZE_FORMAT
@@ -719,6 +781,10 @@ stop_all_srcpad_tasks (GstSctpDec * self)
 static void
 sctpdec_cleanup (GstSctpDec * self)
 {
+  GST_OBJECT_LOCK (self);
+  gst_object_replace ((GstObject **) & self->last_used_pad, NULL);
+  GST_OBJECT_UNLOCK (self);
+
   if (self->sctp_association) {
     gst_sctp_association_set_on_packet_received (self->sctp_association, NULL,
         NULL, NULL);
@@ -53,6 +53,12 @@ struct _GstSctpDec
 
   GstSctpAssociation *sctp_association;
   gulong signal_handler_stream_reset;
+
+  /* Cache of the src pad the last message was delivered on, so consecutive
+   * messages on the same stream don't pay for a pad lookup by name.
+   * Protected by the object lock. */
+  GstPad *last_used_pad;
+  guint16 last_stream_id;
 };
 
 struct _GstSctpDecClass
@@ -1477,6 +1477,8 @@ gst_srt_object_read (GstSRTObject * srtobject,
   gint poll_timeout;
   GstSRTConnectionMode connection_mode = GST_SRT_CONNECTION_MODE_NONE;
   gint poll_id = SRT_ERROR;
+  SRTSOCKET read_sock = SRT_INVALID_SOCK;
+  gboolean retried_error = FALSE;
   gboolean auto_reconnect;
 
   /* Only source element can read data */
@@ -1505,6 +1507,7 @@ gst_srt_object_read (GstSRTObject * srtobject,
     if (srtobject->callers) {
       SRTCaller *caller = srtobject->callers->data;
       poll_id = caller->poll_id;
+      read_sock = caller->sock;
     }
     g_mutex_unlock (&srtobject->sock_lock);
 
@@ -1512,6 +1515,7 @@ gst_srt_object_read (GstSRTObject * srtobject,
       return 0;
   } else {
     poll_id = srtobject->poll_id;
+    read_sock = srtobject->sock;
   }
 
   while (!g_cancellable_is_cancelled (cancellable)) {
@@ -1521,6 +1525,32 @@ gst_srt_object_read (GstSRTObject * srtobject,
     SRTSOCKET wsock;
     gint wsocklen = 1;
 
+    /* Receive first: the socket is non-blocking, so while the SRT queue
+     * still holds packets (bursts on high-rate links) consecutive reads
+     * are served straight from it and the epoll round trip per message
+     * is only paid once the queue has been drained */
+    srt_msgctrl_init (mctrl);
+    len = srt_recvmsg2 (read_sock, (char *) data, size, mctrl);
+
+    if (len != SRT_ERROR) {
+      srtobject->bytes += len;
+      return len;
+    }
+
+    if (srt_getlasterror (NULL) != SRT_EASYNCRCV) {
+      /* let the poll below inspect the socket state once; a broken
+       * connection is reported there and handled with a reconnect,
+       * anything that persists beyond that is a real error */
+      if (retried_error) {
+        g_set_error (error, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_READ,
+            "Failed to receive from SRT socket: %s", srt_getlasterror_str ());
+        return -1;
+      }
+      retried_error = TRUE;
+    } else {
+      retried_error = FALSE;
+    }
+
     if (srt_epoll_wait (poll_id, &rsock, &rsocklen, &wsock, &wsocklen,
             poll_timeout, NULL, 0, NULL, 0) < 0) {
       gint srt_errno = srt_getlasterror (NULL);
@@ -1581,29 +1611,14 @@ gst_srt_object_read (GstSRTObject * srtobject,
       if (!gst_srt_object_open_internal (srtobject, cancellable, error)) {
         return -1;
       }
+      read_sock = srtobject->sock;
       continue;
     }
 
-
-    srt_msgctrl_init (mctrl);
-    len = srt_recvmsg2 (rsock, (char *) (data), size, mctrl);
-
-    if (len == SRT_ERROR) {
-      gint srt_errno = srt_getlasterror (NULL);
-      if (srt_errno == SRT_EASYNCRCV) {
-        continue;
-      } else {
-        g_set_error (error, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_READ,
-            "Failed to receive from SRT socket: %s", srt_getlasterror_str ());
-        return -1;
-      }
-    }
-
-    srtobject->bytes += len;
-    break;
+    /* readable (or at least inspected) now, loop back to the receive */
   }
 
-  return len;
+  return 0;
 }
 
 void
@@ -272,6 +272,46 @@ out:
   return ret;
 }
 
+static gboolean
+gst_srt_src_decide_allocation (GstBaseSrc * bsrc, GstQuery * query)
+{
+  GstBufferPool *pool;
+  gboolean update;
+  GstStructure *config;
+  GstCaps *caps = NULL;
+  guint blocksize;
+
+  if (gst_query_get_n_allocation_pools (query) > 0) {
+    update = TRUE;
+  } else {
+    update = FALSE;
+  }
+
+  /* messages are at most one SRT payload (1316 bytes by default), so the
+   * buffers are small and cycle at packet rate; hand basesrc a pool
+   * instead of having it allocate every one of them */
+  blocksize = gst_base_src_get_blocksize (bsrc);
+
+  pool = gst_buffer_pool_new ();
+
+  config = gst_buffer_pool_get_config (pool);
+
+  gst_query_parse_allocation (query, &caps, NULL);
+
+  gst_buffer_pool_config_set_params (config, caps, blocksize, 0, 0);
+
+  gst_buffer_pool_set_config (pool, config);
+
+  if (update)
+    gst_query_set_nth_allocation_pool (query, 0, pool, blocksize, 0, 0);
+  else
+    gst_query_add_allocation_pool (query, pool, blocksize, 0, 0);
+
+  gst_object_unref (pool);
+
+  return TRUE;
+}
+
 static void
 gst_srt_src_init (GstSRTSrc * self)
 {
@@ -476,6 +516,8 @@ gst_srt_src_class_init (GstSRTSrcClass * klass)
   gstbasesrc_class->unlock = GST_DEBUG_FUNCPTR (gst_srt_src_unlock);
   gstbasesrc_class->unlock_stop = GST_DEBUG_FUNCPTR (gst_srt_src_unlock_stop);
   gstbasesrc_class->query = GST_DEBUG_FUNCPTR (gst_srt_src_query);
+  gstbasesrc_class->decide_allocation =
+      GST_DEBUG_FUNCPTR (gst_srt_src_decide_allocation);
 
   gstpushsrc_class->fill = GST_DEBUG_FUNCPTR (gst_srt_src_fill);
 }
@@ -133,6 +133,11 @@ GST_DEBUG_CATEGORY_STATIC (gst_srtp_enc_debug);
 #define DEFAULT_REPLAY_WINDOW_SIZE 128
 #define DEFAULT_ALLOW_REPEAT_TX FALSE
 
+/* size of the recycled output packets; anything up to an ethernet MTU
+ * plus the SRTP trailer fits, larger packets fall back to a plain
+ * allocation */
+#define POOLED_BUFFER_SIZE 2048
+
 #define HAS_CRYPTO(filter) (filter->rtp_cipher != GST_SRTP_CIPHER_NULL || \
       filter->rtcp_cipher != GST_SRTP_CIPHER_NULL ||                      \
       filter->rtp_auth != GST_SRTP_AUTH_NULL ||                           \
@@ -161,14 +166,12 @@ enum
   PROP_MKI
 };
 
-typedef struct ProcessBufferItData
+typedef struct PreparedBuffer
 {
-  GstSrtpEnc *filter;
-  GstPad *pad;
-  GstBufferList *out_list;
-  GstFlowReturn flowret;
-  gboolean is_rtcp;
-} ProcessBufferItData;
+  GstBuffer *bufout;
+  GstMapInfo map;
+  gint size;
+} PreparedBuffer;
 
 /* the capabilities of the inputs and outputs.
  *
@@ -657,6 +660,12 @@ gst_srtp_enc_dispose (GObject * object)
     g_hash_table_unref (filter->ssrcs_set);
   filter->ssrcs_set = NULL;
 
+  if (filter->pool) {
+    gst_buffer_pool_set_active (filter->pool, FALSE);
+    gst_object_unref (filter->pool);
+    filter->pool = NULL;
+  }
+
   G_OBJECT_CLASS (gst_srtp_enc_parent_class)->dispose (object);
 }
 
@@ -1112,15 +1121,44 @@ gst_srtp_enc_check_set_caps (GstSrtpEnc * filter, GstPad * pad,
 }
 
 static void
-gst_srtp_enc_ensure_ssrc (GstSrtpEnc * filter, GstBuffer * buf)
+gst_srtp_enc_ensure_ssrc (GstSrtpEnc * filter, const guint8 * data, gsize size)
 {
-  GstRTPBuffer rtpbuf = GST_RTP_BUFFER_INIT;
-  if (gst_rtp_buffer_map (buf,
-          GST_MAP_READ | GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING, &rtpbuf)) {
-    guint32 ssrc = gst_rtp_buffer_get_ssrc (&rtpbuf);
-    gst_srtp_enc_add_ssrc (filter, ssrc);
-    gst_rtp_buffer_unmap (&rtpbuf);
+  /* the packet is already copied out, read the ssrc straight from the
+   * copy instead of mapping the input buffer a second time */
+  if (size >= 12 && (data[0] >> 6) == 2)
+    gst_srtp_enc_add_ssrc (filter, GST_READ_UINT32_BE (data + 8));
+}
+
+/* output packets are small and short-lived; recycle them through a pool
+ * instead of allocating each one */
+static GstBuffer *
+gst_srtp_enc_acquire_buffer (GstSrtpEnc * filter, gsize size_max)
+{
+  GstBufferPool *pool;
+  GstBuffer *buf = NULL;
+
+  if (size_max > POOLED_BUFFER_SIZE)
+    return gst_buffer_new_allocate (NULL, size_max, NULL);
+
+  GST_OBJECT_LOCK (filter);
+  if (filter->pool == NULL) {
+    GstStructure *config;
+
+    filter->pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (filter->pool);
+    gst_buffer_pool_config_set_params (config, NULL, POOLED_BUFFER_SIZE,
+        0, 0);
+    gst_buffer_pool_set_config (filter->pool, config);
+    gst_buffer_pool_set_active (filter->pool, TRUE);
   }
+  pool = gst_object_ref (filter->pool);
+  GST_OBJECT_UNLOCK (filter);
+
+  if (gst_buffer_pool_acquire_buffer (pool, &buf, NULL) != GST_FLOW_OK)
+    buf = gst_buffer_new_allocate (NULL, size_max, NULL);
+  gst_object_unref (pool);
+
+  return buf;
 }
 
 static GstFlowReturn
@@ -1136,7 +1174,7 @@ gst_srtp_enc_process_buffer (GstSrtpEnc * filter, GstPad * pad,
   /* Create a bigger buffer to add protection */
   size = gst_buffer_get_size (buf);
   size_max = size + SRTP_MAX_TRAILER_LEN + 10;
-  bufout = gst_buffer_new_allocate (NULL, size_max, NULL);
+  bufout = gst_srtp_enc_acquire_buffer (filter, size_max);
 
   gst_buffer_map (bufout, &mapout, GST_MAP_READWRITE);
 
@@ -1149,11 +1187,12 @@ gst_srtp_enc_process_buffer (GstSrtpEnc * filter, GstPad * pad,
   if (filter->session == NULL) {
     /* The rtcp session disappeared (element shutting down) */
     GST_OBJECT_UNLOCK (filter);
+    gst_buffer_unmap (bufout, &mapout);
     ret = GST_FLOW_FLUSHING;
     goto fail;
   }
 
-  gst_srtp_enc_ensure_ssrc (filter, buf);
+  gst_srtp_enc_ensure_ssrc (filter, mapout.data, size);
 
 #ifdef HAVE_SRTP2
   if (is_rtcp)
@@ -1257,23 +1296,102 @@ out:
   return ret;
 }
 
-static gboolean
-process_buffer_it (GstBuffer ** buffer, guint index, gpointer user_data)
+/* Like gst_srtp_enc_process_buffer() but for a whole list: the output
+ * buffers are prepared up front so the session lock is taken once for the
+ * batch of protect calls instead of once per packet */
+static GstFlowReturn
+gst_srtp_enc_process_buffer_list (GstSrtpEnc * filter, GstPad * pad,
+    GstBufferList * buf_list, gboolean is_rtcp, GstBufferList * out_list)
 {
-  ProcessBufferItData *data = user_data;
-  GstBuffer *bufout;
-  GstFlowReturn ret;
+  GstFlowReturn ret = GST_FLOW_OK;
+  srtp_err_status_t err = srtp_err_status_ok;
+  PreparedBuffer *prep;
+  guint i, n;
+
+  n = gst_buffer_list_length (buf_list);
+  prep = g_new (PreparedBuffer, n);
+
+  /* Copy each packet into a larger output buffer outside of the lock */
+  for (i = 0; i < n; i++) {
+    GstBuffer *buf = gst_buffer_list_get (buf_list, i);
+    gint size = gst_buffer_get_size (buf);
+
+    prep[i].size = size;
+    prep[i].bufout = gst_srtp_enc_acquire_buffer (filter,
+        size + SRTP_MAX_TRAILER_LEN + 10);
+    gst_buffer_map (prep[i].bufout, &prep[i].map, GST_MAP_READWRITE);
+    gst_buffer_extract (buf, 0, prep[i].map.data, size);
+  }
 
-  ret = gst_srtp_enc_process_buffer (data->filter, data->pad, *buffer,
-      data->is_rtcp, &bufout);
-  if (ret != GST_FLOW_OK) {
-    data->flowret = ret;
-    return FALSE;
+  GST_OBJECT_LOCK (filter);
+
+  gst_srtp_init_event_reporter ();
+
+  if (filter->session == NULL) {
+    /* The rtcp session disappeared (element shutting down) */
+    GST_OBJECT_UNLOCK (filter);
+    ret = GST_FLOW_FLUSHING;
+    goto cleanup;
   }
 
-  gst_buffer_list_add (data->out_list, bufout);
+  for (i = 0; i < n; i++) {
+    gst_srtp_enc_ensure_ssrc (filter, prep[i].map.data, prep[i].size);
 
-  return TRUE;
+#ifdef HAVE_SRTP2
+    if (is_rtcp)
+      err = srtp_protect_rtcp_mki (filter->session, prep[i].map.data,
+          &prep[i].size, (filter->mki != NULL), 0);
+    else
+      err = srtp_protect_mki (filter->session, prep[i].map.data,
+          &prep[i].size, (filter->mki != NULL), 0);
+#else
+    if (is_rtcp)
+      err = srtp_protect_rtcp (filter->session, prep[i].map.data,
+          &prep[i].size);
+    else
+      err = srtp_protect (filter->session, prep[i].map.data, &prep[i].size);
+#endif
+
+    if (err != srtp_err_status_ok)
+      break;
+  }
+
+  GST_OBJECT_UNLOCK (filter);
+
+  if (err == srtp_err_status_key_expired) {
+    GST_ELEMENT_ERROR (GST_ELEMENT_CAST (filter), STREAM, ENCODE,
+        ("Key usage limit has been reached"),
+        ("Unable to protect buffer (hard key usage limit reached)"));
+    ret = GST_FLOW_ERROR;
+    goto cleanup;
+  } else if (err != srtp_err_status_ok) {
+    GST_ELEMENT_ERROR (filter, LIBRARY, FAILED, (NULL),
+        ("Unable to protect buffer (protect failed) code %d", err));
+    ret = GST_FLOW_ERROR;
+    goto cleanup;
+  }
+
+  for (i = 0; i < n; i++) {
+    gst_buffer_unmap (prep[i].bufout, &prep[i].map);
+    gst_buffer_set_size (prep[i].bufout, prep[i].size);
+    gst_buffer_copy_into (prep[i].bufout, gst_buffer_list_get (buf_list, i),
+        GST_BUFFER_COPY_METADATA, 0, -1);
+    gst_buffer_list_add (out_list, prep[i].bufout);
+
+    GST_LOG_OBJECT (pad, "Encoding %s buffer of size %d",
+        is_rtcp ? "RTCP" : "RTP", prep[i].size);
+  }
+
+  g_free (prep);
+  return GST_FLOW_OK;
+
+cleanup:
+  for (i = 0; i < n; i++) {
+    gst_buffer_unmap (prep[i].bufout, &prep[i].map);
+    gst_buffer_unref (prep[i].bufout);
+  }
+  g_free (prep);
+  return ret;
 }
 
 static GstFlowReturn
@@ -1284,7 +1402,6 @@ gst_srtp_enc_chain_list (GstPad * pad, GstObject * parent,
   GstFlowReturn ret = GST_FLOW_OK;
   GstPad *otherpad;
   GstBufferList *out_list = NULL;
-  ProcessBufferItData process_data;
 
   GST_LOG_OBJECT (pad, "Buffer chain with list of %d",
       gst_buffer_list_length (buf_list));
@@ -1305,16 +1422,12 @@ gst_srtp_enc_chain_list (GstPad * pad, GstObject * parent,
 
   GST_OBJECT_UNLOCK (filter);
 
-  out_list = gst_buffer_list_new ();
+  out_list = gst_buffer_list_new_sized (gst_buffer_list_length (buf_list));
 
-  process_data.filter = filter;
-  process_data.pad = pad;
-  process_data.is_rtcp = is_rtcp;
-  process_data.out_list = out_list;
-  process_data.flowret = GST_FLOW_OK;
-
-  if (!gst_buffer_list_foreach (buf_list, process_buffer_it, &process_data)) {
-    ret = process_data.flowret;
+  ret = gst_srtp_enc_process_buffer_list (filter, pad, buf_list, is_rtcp,
+      out_list);
+  if (ret != GST_FLOW_OK) {
+    gst_buffer_list_unref (out_list);
     goto out;
   }
 
@@ -86,6 +86,9 @@ struct _GstSrtpEnc
   gboolean allow_repeat_tx;
 
   GHashTable *ssrcs_set;
+
+  /* pool the output packets are recycled through */
+  GstBufferPool *pool;
 };
 
 struct _GstSrtpEncClass
@@ -1063,74 +1063,148 @@ remove_ssrc_entry_by_ssrc (GstWebRTCBin * webrtc, guint rtp_session, guint ssrc)
   }
 }
 
-static gboolean
-_unlock_pc_thread (GMutex * lock)
-{
-  g_mutex_unlock (lock);
-  return G_SOURCE_REMOVE;
-}
+/* Pool of peerconnection threads shared by every webrtcbin instance in
+ * the process. Task ordering must stay queue-like per instance (from
+ * W3's peerconnection spec); pinning an instance to a single loop for
+ * its whole lifetime keeps that property while letting hundreds of
+ * instances share a handful of threads instead of one thread each.
+ * The pool threads exist while at least one instance uses them. */
+#define PC_POOL_SIZE 4
 
-static gpointer
-_gst_pc_thread (GstWebRTCBin * webrtc)
+typedef struct
 {
-  PC_LOCK (webrtc);
-  webrtc->priv->main_context = g_main_context_new ();
-  webrtc->priv->loop = g_main_loop_new (webrtc->priv->main_context, FALSE);
+  GMainContext *context;
+  GMainLoop *loop;
+  GThread *thread;
+} PcPoolLoop;
 
-  PC_COND_BROADCAST (webrtc);
-  g_main_context_invoke (webrtc->priv->main_context,
-      (GSourceFunc) _unlock_pc_thread, PC_GET_LOCK (webrtc));
+static GMutex pc_pool_lock;
+static PcPoolLoop pc_pool[PC_POOL_SIZE];
+static guint pc_pool_users = 0;
+static guint pc_pool_next = 0;
 
+static gpointer
+_gst_pc_pool_thread (PcPoolLoop * pool_loop)
+{
   /* Having the thread be the thread default GMainContext will break the
    * required queue-like ordering (from W3's peerconnection spec) of re-entrant
    * tasks */
-  g_main_loop_run (webrtc->priv->loop);
+  g_main_loop_run (pool_loop->loop);
 
-  GST_OBJECT_LOCK (webrtc);
-  g_main_context_unref (webrtc->priv->main_context);
-  webrtc->priv->main_context = NULL;
-  GST_OBJECT_UNLOCK (webrtc);
+  return NULL;
+}
 
-  PC_LOCK (webrtc);
-  g_main_loop_unref (webrtc->priv->loop);
-  webrtc->priv->loop = NULL;
-  PC_COND_BROADCAST (webrtc);
-  PC_UNLOCK (webrtc);
+static GMainContext *
+_pc_pool_acquire_context (void)
+{
+  GMainContext *ctx;
+  guint i;
 
-  return NULL;
+  g_mutex_lock (&pc_pool_lock);
+  if (pc_pool_users == 0) {
+    for (i = 0; i < PC_POOL_SIZE; i++) {
+      gchar *name = g_strdup_printf ("webrtc:pc%u", i);
+
+      pc_pool[i].context = g_main_context_new ();
+      pc_pool[i].loop = g_main_loop_new (pc_pool[i].context, FALSE);
+      pc_pool[i].thread = g_thread_new (name,
+          (GThreadFunc) _gst_pc_pool_thread, &pc_pool[i]);
+      g_free (name);
+    }
+  }
+  pc_pool_users++;
+  ctx = g_main_context_ref (pc_pool[pc_pool_next % PC_POOL_SIZE].context);
+  pc_pool_next++;
+  g_mutex_unlock (&pc_pool_lock);
+
+  return ctx;
+}
+
+static void
+_pc_pool_release_context (GMainContext * context)
+{
+  guint i;
+
+  g_main_context_unref (context);
+
+  g_mutex_lock (&pc_pool_lock);
+  if (--pc_pool_users == 0) {
+    for (i = 0; i < PC_POOL_SIZE; i++) {
+      g_main_loop_quit (pc_pool[i].loop);
+      g_thread_join (pc_pool[i].thread);
+      g_main_loop_unref (pc_pool[i].loop);
+      g_main_context_unref (pc_pool[i].context);
+      memset (&pc_pool[i], 0, sizeof (pc_pool[i]));
+    }
+    pc_pool_next = 0;
+  }
+  g_mutex_unlock (&pc_pool_lock);
 }
 
 static void
 _start_thread (GstWebRTCBin * webrtc)
 {
-  gchar *name;
+  GST_OBJECT_LOCK (webrtc);
+  webrtc->priv->main_context = _pc_pool_acquire_context ();
+  GST_OBJECT_UNLOCK (webrtc);
 
   PC_LOCK (webrtc);
-  name = g_strdup_printf ("%s:pc", GST_OBJECT_NAME (webrtc));
-  webrtc->priv->thread = g_thread_new (name, (GThreadFunc) _gst_pc_thread,
-      webrtc);
-  g_free (name);
-
-  while (!webrtc->priv->loop)
-    PC_COND_WAIT (webrtc);
   webrtc->priv->is_closed = FALSE;
   PC_UNLOCK (webrtc);
 }
 
+typedef struct
+{
+  GMutex lock;
+  GCond cond;
+  gboolean done;
+} PcFlushData;
+
+static gboolean
+_pc_flush_cb (PcFlushData * data)
+{
+  g_mutex_lock (&data->lock);
+  data->done = TRUE;
+  g_cond_signal (&data->cond);
+  g_mutex_unlock (&data->lock);
+
+  return G_SOURCE_REMOVE;
+}
+
 static void
 _stop_thread (GstWebRTCBin * webrtc)
 {
+  GMainContext *ctx;
+  GSource *source;
+  PcFlushData flush = { 0, };
+
   GST_OBJECT_LOCK (webrtc);
   webrtc->priv->is_closed = TRUE;
+  ctx = webrtc->priv->main_context;
+  webrtc->priv->main_context = NULL;
   GST_OBJECT_UNLOCK (webrtc);
 
-  PC_LOCK (webrtc);
-  g_main_loop_quit (webrtc->priv->loop);
-  while (webrtc->priv->loop)
-    PC_COND_WAIT (webrtc);
-  PC_UNLOCK (webrtc);
+  g_mutex_init (&flush.lock);
+  g_cond_init (&flush.cond);
+
+  /* tasks are dispatched in order of attachment; once this one has run,
+   * everything enqueued before the close has been executed (or aborted
+   * through is_closed) and cannot touch this instance anymore */
+  source = g_idle_source_new ();
+  g_source_set_priority (source, G_PRIORITY_DEFAULT);
+  g_source_set_callback (source, (GSourceFunc) _pc_flush_cb, &flush, NULL);
+  g_source_attach (source, ctx);
+  g_source_unref (source);
+
+  g_mutex_lock (&flush.lock);
+  while (!flush.done)
+    g_cond_wait (&flush.cond, &flush.lock);
+  g_mutex_unlock (&flush.lock);
+
+  g_mutex_clear (&flush.lock);
+  g_cond_clear (&flush.cond);
 
-  g_thread_unref (webrtc->priv->thread);
+  _pc_pool_release_context (ctx);
 }
 
 static gboolean
@@ -131,10 +131,8 @@ struct _GstWebRTCBinPrivate
   gboolean is_closed;
   gboolean need_negotiation;
 
-  /* peerconnection helper thread for promises */
+  /* peerconnection task context, borrowed from the shared loop pool */
   GMainContext *main_context;
-  GMainLoop *loop;
-  GThread *thread;
   GMutex pc_lock;
   GCond pc_cond;
 
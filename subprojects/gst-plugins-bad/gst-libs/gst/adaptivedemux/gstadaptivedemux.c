@@ -131,6 +131,7 @@ GST_DEBUG_CATEGORY (adaptivedemux_debug);
 #define DEFAULT_BITRATE_LIMIT 0.8f
 #define SRC_QUEUE_MAX_BYTES 20 * 1024 * 1024    /* For safety. Large enough to hold a segment. */
 #define NUM_LOOKBACK_FRAGMENTS 3
+#define MAX_CACHED_HEADERS 4    /* Per stream. Enough to switch between a few renditions. */
 
 #define GST_MANIFEST_GET_LOCK(d) (&(GST_ADAPTIVE_DEMUX_CAST(d)->priv->manifest_lock))
 #define GST_MANIFEST_LOCK(d) G_STMT_START { \
@@ -271,6 +272,7 @@ static gboolean gst_adaptive_demux_has_next_period (GstAdaptiveDemux * demux);
 static void gst_adaptive_demux_advance_period (GstAdaptiveDemux * demux);
 
 static void gst_adaptive_demux_stream_free (GstAdaptiveDemuxStream * stream);
+static void gst_adaptive_demux_cached_header_free (gpointer data);
 static GstFlowReturn
 gst_adaptive_demux_stream_push_event (GstAdaptiveDemuxStream * stream,
     GstEvent * event);
@@ -1405,6 +1407,11 @@ gst_adaptive_demux_stream_free (GstAdaptiveDemuxStream * stream)
 
   gst_adaptive_demux_stream_fragment_clear (&stream->fragment);
 
+  g_list_free_full (stream->cached_headers,
+      gst_adaptive_demux_cached_header_free);
+  stream->cached_headers = NULL;
+  gst_buffer_replace (&stream->pending_header, NULL);
+
   if (stream->pending_segment) {
     gst_event_unref (stream->pending_segment);
     stream->pending_segment = NULL;
@@ -2260,16 +2267,28 @@ _update_average_bitrate (GstAdaptiveDemux * demux,
     GstAdaptiveDemuxStream * stream, guint64 new_bitrate)
 {
   gint index = stream->moving_index % NUM_LOOKBACK_FRAGMENTS;
+  gdouble denominator = 0.0;
+  guint count, used, i;
 
-  stream->moving_bitrate -= stream->fragment_bitrates[index];
   stream->fragment_bitrates[index] = new_bitrate;
-  stream->moving_bitrate += new_bitrate;
-
   stream->moving_index += 1;
 
-  if (stream->moving_index > NUM_LOOKBACK_FRAGMENTS)
-    return stream->moving_bitrate / NUM_LOOKBACK_FRAGMENTS;
-  return stream->moving_bitrate / stream->moving_index;
+  count = MIN (stream->moving_index, NUM_LOOKBACK_FRAGMENTS);
+
+  /* Harmonic mean of the last fragments: one slow download pulls the
+   * average down much harder than one fast download pulls it up, which is
+   * the right bias for deciding what we can sustain */
+  for (i = used = 0; i < count; i++) {
+    if (stream->fragment_bitrates[i] == 0)
+      continue;
+    denominator += 1.0 / (gdouble) stream->fragment_bitrates[i];
+    used++;
+  }
+
+  if (used == 0 || denominator == 0.0)
+    return new_bitrate;
+
+  return (guint64) ((gdouble) used / denominator);
 }
 
 /* must be called with manifest_lock taken */
@@ -2688,6 +2707,16 @@ _src_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   GST_TRACE_OBJECT (stream->pad, "Received buffer of size %" G_GSIZE_FORMAT,
       gst_buffer_get_size (buffer));
 
+  /* Keep a copy of the raw header bytes aside, so that subsequent requests
+   * for the same header can be served from cache */
+  if (G_UNLIKELY (stream->downloading_header)) {
+    if (stream->pending_header)
+      stream->pending_header = gst_buffer_append (stream->pending_header,
+          gst_buffer_ref (buffer));
+    else
+      stream->pending_header = gst_buffer_ref (buffer);
+  }
+
   ret = klass->data_received (demux, stream, buffer);
 
   if (ret == GST_FLOW_FLUSHING) {
@@ -2877,16 +2906,26 @@ _uri_handler_probe (GstPad * pad, GstPadProbeInfo * info,
         break;
       case GST_EVENT_EOS:
       {
+        GstClockTime transfer_time;
+
         stream->last_download_time =
             gst_adaptive_demux_get_monotonic_time (stream->demux) -
             (stream->download_start_time * GST_USECOND);
+        /* The time until the first byte is dominated by the request round
+         * trip and the server think-time, not by the available bandwidth.
+         * Leave it out of the throughput estimate, otherwise a slow origin
+         * looks like a slow link and causes spurious rendition switches. */
+        transfer_time = stream->last_download_time;
+        if (stream->last_latency < transfer_time)
+          transfer_time -= stream->last_latency;
         stream->last_bitrate =
             gst_util_uint64_scale (stream->fragment_bytes_downloaded,
-            8 * GST_SECOND, stream->last_download_time);
+            8 * GST_SECOND, transfer_time);
         GST_DEBUG_OBJECT (pad,
-            "EOS since download_start %" GST_TIME_FORMAT " bitrate %"
-            G_GUINT64_FORMAT " bps", GST_TIME_ARGS (stream->last_download_time),
-            stream->last_bitrate);
+            "EOS since download_start %" GST_TIME_FORMAT " (%" GST_TIME_FORMAT
+            " transferring) bitrate %" G_GUINT64_FORMAT " bps",
+            GST_TIME_ARGS (stream->last_download_time),
+            GST_TIME_ARGS (transfer_time), stream->last_bitrate);
         /* Calculate bitrate since URI request */
       }
         break;
@@ -3344,6 +3383,130 @@ gst_adaptive_demux_stream_download_uri (GstAdaptiveDemux * demux,
   return ret;
 }
 
+typedef struct
+{
+  gchar *uri;
+  gint64 range_start;
+  gint64 range_end;
+  GstBuffer *buffer;
+} GstAdaptiveDemuxCachedHeader;
+
+static void
+gst_adaptive_demux_cached_header_free (gpointer data)
+{
+  GstAdaptiveDemuxCachedHeader *cached = data;
+
+  g_free (cached->uri);
+  gst_buffer_unref (cached->buffer);
+  g_free (cached);
+}
+
+/* must be called with manifest_lock taken */
+static GstBuffer *
+gst_adaptive_demux_stream_find_cached_header (GstAdaptiveDemuxStream * stream,
+    const gchar * uri, gint64 range_start, gint64 range_end)
+{
+  GList *iter;
+
+  for (iter = stream->cached_headers; iter; iter = g_list_next (iter)) {
+    GstAdaptiveDemuxCachedHeader *cached = iter->data;
+
+    if (cached->range_start == range_start && cached->range_end == range_end
+        && g_str_equal (cached->uri, uri)) {
+      /* keep the most recently used entry at the head of the list */
+      stream->cached_headers = g_list_delete_link (stream->cached_headers,
+          iter);
+      stream->cached_headers = g_list_prepend (stream->cached_headers, cached);
+      return gst_buffer_ref (cached->buffer);
+    }
+  }
+
+  return NULL;
+}
+
+/* must be called with manifest_lock taken. Takes ownership of @buffer */
+static void
+gst_adaptive_demux_stream_store_cached_header (GstAdaptiveDemuxStream * stream,
+    const gchar * uri, gint64 range_start, gint64 range_end,
+    GstBuffer * buffer)
+{
+  GstAdaptiveDemuxCachedHeader *cached;
+
+  cached = g_new0 (GstAdaptiveDemuxCachedHeader, 1);
+  cached->uri = g_strdup (uri);
+  cached->range_start = range_start;
+  cached->range_end = range_end;
+  cached->buffer = buffer;
+
+  stream->cached_headers = g_list_prepend (stream->cached_headers, cached);
+
+  /* drop the least recently used entry */
+  if (g_list_length (stream->cached_headers) > MAX_CACHED_HEADERS) {
+    GList *last = g_list_last (stream->cached_headers);
+
+    gst_adaptive_demux_cached_header_free (last->data);
+    stream->cached_headers = g_list_delete_link (stream->cached_headers, last);
+  }
+}
+
+/* must be called with manifest_lock taken.
+ * Can temporarily release manifest_lock
+ *
+ * Feeds a cached header to the sub-class, mirroring what _src_chain() and
+ * the EOS handling would do if the same bytes arrived from the source
+ * element.
+ */
+static GstFlowReturn
+gst_adaptive_demux_stream_push_cached_header (GstAdaptiveDemuxStream * stream,
+    GstBuffer * buffer)
+{
+  GstAdaptiveDemux *demux = stream->demux;
+  GstAdaptiveDemuxClass *klass = GST_ADAPTIVE_DEMUX_GET_CLASS (demux);
+  GstFlowReturn ret;
+
+  buffer = gst_buffer_make_writable (buffer);
+
+  if (stream->starting_fragment) {
+    GstClockTime offset =
+        gst_adaptive_demux_stream_get_presentation_offset (demux, stream);
+    GstClockTime period_start =
+        gst_adaptive_demux_get_period_start_time (demux);
+
+    stream->starting_fragment = FALSE;
+    if (klass->start_fragment) {
+      if (!klass->start_fragment (demux, stream)) {
+        gst_buffer_unref (buffer);
+        return GST_FLOW_ERROR;
+      }
+    }
+
+    GST_BUFFER_PTS (buffer) = stream->fragment.timestamp;
+    if (GST_BUFFER_PTS_IS_VALID (buffer))
+      GST_BUFFER_PTS (buffer) += offset;
+
+    if (GST_BUFFER_PTS_IS_VALID (buffer)) {
+      GST_ADAPTIVE_DEMUX_SEGMENT_LOCK (demux);
+      stream->segment.position = GST_BUFFER_PTS (buffer);
+
+      /* Convert from position inside the stream's segment to the demuxer's
+       * segment, they are not necessarily the same */
+      if (stream->segment.position - offset + period_start >
+          demux->segment.position)
+        demux->segment.position =
+            stream->segment.position - offset + period_start;
+      GST_ADAPTIVE_DEMUX_SEGMENT_UNLOCK (demux);
+    }
+  } else {
+    GST_BUFFER_PTS (buffer) = GST_CLOCK_TIME_NONE;
+  }
+
+  ret = klass->data_received (demux, stream, buffer);
+  if (ret != GST_FLOW_OK)
+    return ret;
+
+  return gst_adaptive_demux_eos_handling (stream);
+}
+
 /* must be called with manifest_lock taken.
  * Can temporarily release manifest_lock
  */
@@ -3355,15 +3518,47 @@ gst_adaptive_demux_stream_download_header_fragment (GstAdaptiveDemuxStream *
   GstFlowReturn ret = GST_FLOW_OK;
 
   if (stream->fragment.header_uri != NULL) {
-    GST_DEBUG_OBJECT (demux, "Fetching header %s %" G_GINT64_FORMAT "-%"
-        G_GINT64_FORMAT, stream->fragment.header_uri,
-        stream->fragment.header_range_start, stream->fragment.header_range_end);
+    GstBuffer *cached;
 
-    stream->downloading_header = TRUE;
-    ret = gst_adaptive_demux_stream_download_uri (demux, stream,
+    cached = gst_adaptive_demux_stream_find_cached_header (stream,
         stream->fragment.header_uri, stream->fragment.header_range_start,
-        stream->fragment.header_range_end, NULL);
-    stream->downloading_header = FALSE;
+        stream->fragment.header_range_end);
+
+    if (cached != NULL) {
+      /* The same header was downloaded before (e.g. we switched back to a
+       * rendition we already played, or a seek made us restart from the
+       * header); serve it from cache instead of stalling the stream on
+       * another round trip */
+      GST_DEBUG_OBJECT (demux, "Reusing cached header %s %" G_GINT64_FORMAT
+          "-%" G_GINT64_FORMAT, stream->fragment.header_uri,
+          stream->fragment.header_range_start,
+          stream->fragment.header_range_end);
+
+      stream->downloading_header = TRUE;
+      ret = gst_adaptive_demux_stream_push_cached_header (stream, cached);
+      stream->downloading_header = FALSE;
+    } else {
+      GST_DEBUG_OBJECT (demux, "Fetching header %s %" G_GINT64_FORMAT "-%"
+          G_GINT64_FORMAT, stream->fragment.header_uri,
+          stream->fragment.header_range_start,
+          stream->fragment.header_range_end);
+
+      gst_buffer_replace (&stream->pending_header, NULL);
+      stream->downloading_header = TRUE;
+      ret = gst_adaptive_demux_stream_download_uri (demux, stream,
+          stream->fragment.header_uri, stream->fragment.header_range_start,
+          stream->fragment.header_range_end, NULL);
+      stream->downloading_header = FALSE;
+
+      if (ret == GST_FLOW_OK && stream->pending_header != NULL) {
+        gst_adaptive_demux_stream_store_cached_header (stream,
+            stream->fragment.header_uri, stream->fragment.header_range_start,
+            stream->fragment.header_range_end, stream->pending_header);
+        stream->pending_header = NULL;
+      } else {
+        gst_buffer_replace (&stream->pending_header, NULL);
+      }
+    }
   }
 
   /* check if we have an index */
@@ -4251,7 +4446,11 @@ gst_adaptive_demux_stream_advance_fragment_unlocked (GstAdaptiveDemux * demux,
               "fragment-stop-time", GST_TYPE_CLOCK_TIME,
               gst_util_get_timestamp (), "fragment-size", G_TYPE_UINT64,
               stream->download_total_bytes, "fragment-download-time",
-              GST_TYPE_CLOCK_TIME, stream->last_download_time, NULL)));
+              GST_TYPE_CLOCK_TIME, stream->last_download_time,
+              "fragment-latency", GST_TYPE_CLOCK_TIME, stream->last_latency,
+              "fragment-bitrate", G_TYPE_UINT64, stream->last_bitrate,
+              "download-rate", G_TYPE_UINT64, stream->current_download_rate,
+              NULL)));
 
   /* Don't update to the end of the segment if in reverse playback */
   GST_ADAPTIVE_DEMUX_SEGMENT_LOCK (demux);
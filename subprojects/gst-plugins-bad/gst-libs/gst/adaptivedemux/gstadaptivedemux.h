@@ -179,8 +179,7 @@ struct _GstAdaptiveDemuxStream
   GstClockTime last_latency;
   GstClockTime last_download_time;
 
-  /* Average for the last fragments */
-  guint64 moving_bitrate;
+  /* Harmonic average over the last fragments */
   guint moving_index;
   guint64 *fragment_bitrates;
 
@@ -189,6 +188,12 @@ struct _GstAdaptiveDemuxStream
 
   GstAdaptiveDemuxStreamFragment fragment;
 
+  /* cache of recently downloaded header/init sections, so that bitrate
+   * switches and seeks don't have to re-fetch them */
+  GList *cached_headers;
+  /* accumulates the header currently being downloaded */
+  GstBuffer *pending_header;
+
   guint download_error_count;
 
   /* TODO check if used */
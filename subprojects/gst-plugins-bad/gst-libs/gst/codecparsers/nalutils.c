@@ -200,6 +200,7 @@ nal_reader_peek_bits_uint##bits (const NalReader *nr, guint##bits *val, guint nb
 }
 
 NAL_READER_PEEK_BITS (8);
+NAL_READER_PEEK_BITS (32);
 
 gboolean
 nal_reader_get_ue (NalReader * nr, guint32 * val)
@@ -208,6 +209,20 @@ nal_reader_get_ue (NalReader * nr, guint32 * val)
   guint8 bit;
   guint32 value;
 
+  /* Fast path: if the next 32 bits are available, the leading-zero count
+   * gives the code length directly and short codes (the vast majority)
+   * can be decoded with a single extraction instead of bit-by-bit reads */
+  if (nal_reader_peek_bits_uint32 (nr, &value, 32)) {
+    if (G_UNLIKELY (value == 0))
+      return FALSE;
+
+    i = 31 - g_bit_nth_msf (value, -1);
+    if (i <= 15) {
+      *val = (value >> (31 - 2 * i)) - 1;
+      return nal_reader_skip (nr, 2 * i + 1);
+    }
+  }
+
   if (G_UNLIKELY (!nal_reader_get_bits_uint8 (nr, &bit, 1)))
     return FALSE;
 
@@ -103,6 +103,7 @@ G_GNUC_INTERNAL \
 gboolean nal_reader_peek_bits_uint##bits (const NalReader *nr, guint##bits *val, guint nbits)
 
 NAL_READER_PEEK_BITS_H (8);
+NAL_READER_PEEK_BITS_H (32);
 
 G_GNUC_INTERNAL
 gboolean nal_reader_get_ue (NalReader * nr, guint32 * val);
@@ -22,21 +22,49 @@
 #endif
 
 #include "gsth265picture.h"
+#include <string.h>
 
 GST_DEBUG_CATEGORY_EXTERN (gst_h265_decoder_debug);
 #define GST_CAT_DEFAULT gst_h265_decoder_debug
 
 GST_DEFINE_MINI_OBJECT_TYPE (GstH265Picture, gst_h265_picture);
 
+/* decoders allocate a picture for every frame at a steady rate; recycle
+ * released ones through a small lock-free freelist instead of going back
+ * to the heap each time */
+#define PICTURE_FREE_QUEUE_SIZE 16
+
+static GstAtomicQueue *
+gst_h265_picture_free_queue (void)
+{
+  static GstAtomicQueue *queue = NULL;
+  static gsize init = 0;
+
+  if (g_once_init_enter (&init)) {
+    queue = gst_atomic_queue_new (PICTURE_FREE_QUEUE_SIZE);
+    g_once_init_leave (&init, 1);
+  }
+
+  return queue;
+}
+
 static void
 _gst_h265_picture_free (GstH265Picture * picture)
 {
+  GstAtomicQueue *queue;
+
   if (picture->notify)
     picture->notify (picture->user_data);
 
   if (picture->discont_state)
     gst_video_codec_state_unref (picture->discont_state);
 
+  queue = gst_h265_picture_free_queue ();
+  if (gst_atomic_queue_length (queue) < PICTURE_FREE_QUEUE_SIZE) {
+    gst_atomic_queue_push (queue, picture);
+    return;
+  }
+
   g_free (picture);
 }
 
@@ -52,7 +80,11 @@ gst_h265_picture_new (void)
 {
   GstH265Picture *pic;
 
-  pic = g_new0 (GstH265Picture, 1);
+  pic = gst_atomic_queue_pop (gst_h265_picture_free_queue ());
+  if (pic)
+    memset (pic, 0, sizeof (*pic));
+  else
+    pic = g_new0 (GstH265Picture, 1);
 
   pic->pic_struct = GST_H265_SEI_PIC_STRUCT_FRAME;
   /* 0: interlaced, 1: progressive, 2: unspecified, 3: reserved, can be
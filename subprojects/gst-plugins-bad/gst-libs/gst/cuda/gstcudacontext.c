@@ -52,6 +52,9 @@ struct _GstCudaContextPrivate
 
   gint tex_align;
 
+  /* stream shared by all the users of this context, lazily created */
+  CUstream stream;
+
   GHashTable *accessible_peer;
   gboolean owns_context;
 };
@@ -360,6 +363,14 @@ gst_cuda_context_finalize (GObject * object)
   GstCudaContext *context = GST_CUDA_CONTEXT_CAST (object);
   GstCudaContextPrivate *priv = context->priv;
 
+  if (priv->stream) {
+    if (gst_cuda_result (CuCtxPushCurrent (priv->context))) {
+      gst_cuda_result (CuStreamDestroy (priv->stream));
+      CuCtxPopCurrent (NULL);
+    }
+    priv->stream = NULL;
+  }
+
   if (priv->context && priv->owns_context) {
     GST_DEBUG_OBJECT (context, "Destroying CUDA context %p", priv->context);
     gst_cuda_result (CuCtxDestroy (priv->context));
@@ -464,6 +475,49 @@ gst_cuda_context_get_handle (GstCudaContext * ctx)
   return ctx->priv->context;
 }
 
+/**
+ * gst_cuda_context_get_stream:
+ * @ctx: a #GstCudaContext
+ *
+ * Get the CUDA stream shared by all users of @ctx. The context is
+ * negotiated pipeline-wide, so elements operating on the same device
+ * that queue their work on this stream are ordered by the stream
+ * itself and do not need to synchronize against each other between
+ * buffers. Caller must not destroy the returned stream.
+ *
+ * Returns: (nullable): the shared `CUstream` of @ctx, or %NULL if no
+ * stream could be created
+ *
+ * Since: 1.22
+ */
+CUstream
+gst_cuda_context_get_stream (GstCudaContext * ctx)
+{
+  GstCudaContextPrivate *priv;
+  CUstream stream;
+
+  g_return_val_if_fail (ctx, NULL);
+  g_return_val_if_fail (GST_IS_CUDA_CONTEXT (ctx), NULL);
+
+  priv = ctx->priv;
+
+  GST_OBJECT_LOCK (ctx);
+  if (!priv->stream) {
+    if (gst_cuda_context_push (ctx)) {
+      if (!gst_cuda_result (CuStreamCreate (&priv->stream,
+                  CU_STREAM_DEFAULT))) {
+        GST_WARNING_OBJECT (ctx, "Could not create stream");
+        priv->stream = NULL;
+      }
+      gst_cuda_context_pop (NULL);
+    }
+  }
+  stream = priv->stream;
+  GST_OBJECT_UNLOCK (ctx);
+
+  return stream;
+}
+
 /**
  * gst_cuda_context_get_texture_alignment:
  * @ctx: a #GstCudaContext
@@ -92,6 +92,9 @@ gboolean         gst_cuda_context_pop         (CUcontext * cuda_ctx);
 GST_CUDA_API
 gpointer         gst_cuda_context_get_handle  (GstCudaContext * ctx);
 
+GST_CUDA_API
+CUstream         gst_cuda_context_get_stream  (GstCudaContext * ctx);
+
 GST_CUDA_API
 gint             gst_cuda_context_get_texture_alignment (GstCudaContext * ctx);
 
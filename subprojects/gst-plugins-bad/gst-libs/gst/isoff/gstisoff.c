@@ -203,7 +203,9 @@ gst_isoff_tfhd_box_parse (GstTfhdBox * tfhd, GstByteReader * reader)
 static gboolean
 gst_isoff_trun_box_parse (GstTrunBox * trun, GstByteReader * reader)
 {
-  gint i;
+  GstTrunSample *samples;
+  guint entry_size;
+  guint i;
 
   memset (trun, 0, sizeof (*trun));
 
@@ -219,10 +221,6 @@ gst_isoff_trun_box_parse (GstTrunBox * trun, GstByteReader * reader)
   if (!gst_byte_reader_get_uint32_be (reader, &trun->sample_count))
     return FALSE;
 
-  trun->samples =
-      g_array_sized_new (FALSE, FALSE, sizeof (GstTrunSample),
-      trun->sample_count);
-
   if ((trun->flags & GST_TRUN_FLAGS_DATA_OFFSET_PRESENT) &&
       !gst_byte_reader_get_uint32_be (reader, (guint32 *) & trun->data_offset))
     return FALSE;
@@ -231,34 +229,48 @@ gst_isoff_trun_box_parse (GstTrunBox * trun, GstByteReader * reader)
       !gst_byte_reader_get_uint32_be (reader, &trun->first_sample_flags))
     return FALSE;
 
-  for (i = 0; i < trun->sample_count; i++) {
-    GstTrunSample sample = { 0, };
-
-    if ((trun->flags & GST_TRUN_FLAGS_SAMPLE_DURATION_PRESENT) &&
-        !gst_byte_reader_get_uint32_be (reader, &sample.sample_duration))
-      goto error;
-
-    if ((trun->flags & GST_TRUN_FLAGS_SAMPLE_SIZE_PRESENT) &&
-        !gst_byte_reader_get_uint32_be (reader, &sample.sample_size))
-      goto error;
-
-    if ((trun->flags & GST_TRUN_FLAGS_SAMPLE_FLAGS_PRESENT) &&
-        !gst_byte_reader_get_uint32_be (reader, &sample.sample_flags))
-      goto error;
+  /* All optional per-sample fields are 4 bytes, so the size of the whole
+   * sample table follows from the flags. Validating it once up front keeps
+   * bogus sample counts from causing a huge allocation and lets the loop
+   * below decode with unchecked reads straight into the array */
+  entry_size = 0;
+  if (trun->flags & GST_TRUN_FLAGS_SAMPLE_DURATION_PRESENT)
+    entry_size += 4;
+  if (trun->flags & GST_TRUN_FLAGS_SAMPLE_SIZE_PRESENT)
+    entry_size += 4;
+  if (trun->flags & GST_TRUN_FLAGS_SAMPLE_FLAGS_PRESENT)
+    entry_size += 4;
+  if (trun->flags & GST_TRUN_FLAGS_SAMPLE_COMPOSITION_TIME_OFFSETS_PRESENT)
+    entry_size += 4;
+
+  if (gst_byte_reader_get_remaining (reader) <
+      (guint64) entry_size * trun->sample_count)
+    return FALSE;
 
-    if ((trun->flags & GST_TRUN_FLAGS_SAMPLE_COMPOSITION_TIME_OFFSETS_PRESENT)
-        && !gst_byte_reader_get_uint32_be (reader,
-            &sample.sample_composition_time_offset.u))
-      goto error;
+  trun->samples =
+      g_array_sized_new (FALSE, FALSE, sizeof (GstTrunSample),
+      trun->sample_count);
+  g_array_set_size (trun->samples, trun->sample_count);
+  samples = (GstTrunSample *) trun->samples->data;
 
-    g_array_append_val (trun->samples, sample);
+  for (i = 0; i < trun->sample_count; i++) {
+    GstTrunSample *sample = &samples[i];
+
+    sample->sample_duration =
+        (trun->flags & GST_TRUN_FLAGS_SAMPLE_DURATION_PRESENT) ?
+        gst_byte_reader_get_uint32_be_unchecked (reader) : 0;
+    sample->sample_size =
+        (trun->flags & GST_TRUN_FLAGS_SAMPLE_SIZE_PRESENT) ?
+        gst_byte_reader_get_uint32_be_unchecked (reader) : 0;
+    sample->sample_flags =
+        (trun->flags & GST_TRUN_FLAGS_SAMPLE_FLAGS_PRESENT) ?
+        gst_byte_reader_get_uint32_be_unchecked (reader) : 0;
+    sample->sample_composition_time_offset.u =
+        (trun->flags & GST_TRUN_FLAGS_SAMPLE_COMPOSITION_TIME_OFFSETS_PRESENT)
+        ? gst_byte_reader_get_uint32_be_unchecked (reader) : 0;
   }
 
   return TRUE;
-
-error:
-  gst_isoff_trun_box_clear (trun);
-  return FALSE;
 }
 
 static gboolean
@@ -926,6 +938,50 @@ gst_isoff_sidx_parser_parse (GstSidxParser * parser,
   return res;
 }
 
+/**
+ * gst_isoff_sidx_parser_get_entry_for_time:
+ * @parser: a fully parsed #GstSidxParser
+ * @ts: the stream time to look up
+ *
+ * Binary-searches the sidx entries for the one whose time range contains
+ * @ts. Entries are stored with cumulative pts, so this is O(log n) where a
+ * linear scan over a long index would touch every entry.
+ *
+ * Returns: the entry containing @ts, or %NULL if the parser is not
+ * finished yet or @ts is outside the indexed range
+ */
+GstSidxBoxEntry *
+gst_isoff_sidx_parser_get_entry_for_time (GstSidxParser * parser,
+    GstClockTime ts)
+{
+  GstSidxBox *sidx = &parser->sidx;
+  guint l, r;
+
+  if (parser->status != GST_ISOFF_SIDX_PARSER_FINISHED ||
+      sidx->entries_count == 0)
+    return NULL;
+
+  if (ts < sidx->entries[0].pts)
+    return NULL;
+
+  /* Find the last entry with pts <= ts */
+  l = 0;
+  r = sidx->entries_count;
+  while (r - l > 1) {
+    guint mid = l + (r - l) / 2;
+
+    if (sidx->entries[mid].pts <= ts)
+      l = mid;
+    else
+      r = mid;
+  }
+
+  if (ts >= sidx->entries[l].pts + sidx->entries[l].duration)
+    return NULL;
+
+  return &sidx->entries[l];
+}
+
 GstIsoffParserResult
 gst_isoff_sidx_parser_add_buffer (GstSidxParser * parser, GstBuffer * buffer,
     guint * consumed)
@@ -294,6 +294,9 @@ GstIsoffParserResult gst_isoff_sidx_parser_parse (GstSidxParser * parser, GstByt
 GST_ISOFF_API
 GstIsoffParserResult gst_isoff_sidx_parser_add_buffer (GstSidxParser * parser, GstBuffer * buf, guint * consumed);
 
+GST_ISOFF_API
+GstSidxBoxEntry * gst_isoff_sidx_parser_get_entry_for_time (GstSidxParser * parser, GstClockTime ts);
+
 G_END_DECLS
 
 #endif /* __GST_ISOFF_H__ */
@@ -722,6 +722,12 @@ _copy_descriptor (GstMpegtsDescriptor * desc)
 void
 gst_mpegts_descriptor_free (GstMpegtsDescriptor * desc)
 {
+  /* descriptors from gst_mpegts_parse_descriptors () carry their data
+   * inline in the same allocation */
+  if (desc->data == (guint8 *) (desc + 1)) {
+    g_free (desc);
+    return;
+  }
   g_free ((gpointer) desc->data);
   g_slice_free (GstMpegtsDescriptor, desc);
 }
@@ -790,13 +796,16 @@ gst_mpegts_parse_descriptors (guint8 * buffer, gsize buf_len)
   data = buffer;
 
   for (i = 0; i < nb_desc; i++) {
-    GstMpegtsDescriptor *desc = g_slice_new0 (GstMpegtsDescriptor);
+    GstMpegtsDescriptor *desc;
 
-    desc->data = data;
+    /* Allocate the descriptor and the copy of its data as a single block;
+     * tables like a full EIT schedule produce descriptors by the million,
+     * where a second heap allocation per descriptor is a measurable cost */
+    desc = g_malloc0 (sizeof (GstMpegtsDescriptor) + data[1] + 2);
+    desc->data = (guint8 *) (desc + 1);
     desc->tag = *data++;
     desc->length = *data++;
-    /* Copy the data now that we known the size */
-    desc->data = g_memdup2 (desc->data, desc->length + 2);
+    memcpy (desc->data, data - 2, desc->length + 2);
     GST_LOG ("descriptor 0x%02x length:%d", desc->tag, desc->length);
     GST_MEMDUMP ("descriptor", desc->data + 2, desc->length);
     /* extended descriptors */
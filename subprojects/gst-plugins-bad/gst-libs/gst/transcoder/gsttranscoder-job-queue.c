@@ -0,0 +1,389 @@
+/* GStreamer
+ *
+ * Copyright (C) 2026 GStreamer developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gsttranscoder-job-queue
+ * @title: GstTranscoderJobQueue
+ * @short_description: Bounded scheduler for batches of transcode jobs
+ *
+ * Every #GstTranscoder runs its own pipeline and will happily use all
+ * available cores. When an application needs to transcode a large batch of
+ * files, starting all the jobs at once oversubscribes the machine and total
+ * throughput drops because of scheduling overhead. #GstTranscoderJobQueue
+ * keeps at most a configurable number of jobs transcoding at the same time
+ * and automatically starts pending jobs as running ones complete or fail.
+ *
+ * Jobs keep their full #GstTranscoder API while queued: applications can
+ * still connect to their signal adapters or message buses to track per-job
+ * progress, and gst_transcoder_set_cpu_usage() can be used to further limit
+ * what each individual job consumes.
+ *
+ * Since: 1.24
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gsttranscoder-job-queue.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_transcoder_job_queue_debug);
+#define GST_CAT_DEFAULT gst_transcoder_job_queue_debug
+
+#define DEFAULT_MAX_PARALLEL 0
+
+enum
+{
+  PROP_0,
+  PROP_MAX_PARALLEL,
+  PROP_LAST
+};
+
+enum
+{
+  SIGNAL_DRAINED,
+  SIGNAL_LAST
+};
+
+typedef struct
+{
+  GstTranscoder *transcoder;
+  GstTranscoderSignalAdapter *adapter;
+} GstTranscoderJob;
+
+struct _GstTranscoderJobQueue
+{
+  GstObject parent;
+
+  /* All fields are protected by the object lock. Jobs move from @pending to
+   * @running in FIFO order; completed jobs are removed from @running when
+   * their signal adapter reports done or error. */
+  GQueue pending;
+  GQueue running;
+  guint max_parallel;
+};
+
+static GParamSpec *param_specs[PROP_LAST] = { NULL, };
+static guint signals[SIGNAL_LAST] = { 0, };
+
+#define parent_class gst_transcoder_job_queue_parent_class
+G_DEFINE_TYPE (GstTranscoderJobQueue, gst_transcoder_job_queue,
+    GST_TYPE_OBJECT);
+
+static void
+gst_transcoder_job_free (GstTranscoderJob * job)
+{
+  gst_object_unref (job->adapter);
+  gst_object_unref (job->transcoder);
+  g_free (job);
+}
+
+/* Takes and releases the object lock. Must not be called with the lock
+ * held: starting a job can fail synchronously, in which case the error
+ * signal re-enters the queue from this very thread. */
+static void
+gst_transcoder_job_queue_schedule (GstTranscoderJobQueue * self)
+{
+  GstTranscoderJob *job;
+
+  GST_OBJECT_LOCK (self);
+  while (self->running.length < self->max_parallel &&
+      (job = g_queue_pop_head (&self->pending))) {
+    g_queue_push_tail (&self->running, job);
+    GST_OBJECT_UNLOCK (self);
+
+    GST_DEBUG_OBJECT (self, "starting transcoder %" GST_PTR_FORMAT,
+        job->transcoder);
+    gst_transcoder_run_async (job->transcoder);
+
+    GST_OBJECT_LOCK (self);
+  }
+  GST_OBJECT_UNLOCK (self);
+}
+
+static void
+gst_transcoder_job_queue_job_finished (GstTranscoderJobQueue * self,
+    GstTranscoderSignalAdapter * adapter)
+{
+  GstTranscoderJob *job = NULL;
+  gboolean drained;
+  GList *l;
+
+  GST_OBJECT_LOCK (self);
+  for (l = self->running.head; l; l = l->next) {
+    GstTranscoderJob *j = l->data;
+
+    if (j->adapter == adapter) {
+      job = j;
+      g_queue_delete_link (&self->running, l);
+      break;
+    }
+  }
+  GST_OBJECT_UNLOCK (self);
+
+  if (!job) {
+    /* Already removed, e.g. because dispose ran concurrently */
+    return;
+  }
+
+  GST_DEBUG_OBJECT (self, "transcoder %" GST_PTR_FORMAT " finished",
+      job->transcoder);
+
+  g_signal_handlers_disconnect_by_data (job->adapter, self);
+  gst_transcoder_job_free (job);
+
+  gst_transcoder_job_queue_schedule (self);
+
+  GST_OBJECT_LOCK (self);
+  drained = self->running.length == 0 && self->pending.length == 0;
+  GST_OBJECT_UNLOCK (self);
+
+  if (drained)
+    g_signal_emit (self, signals[SIGNAL_DRAINED], 0);
+}
+
+static void
+job_done_cb (GstTranscoderSignalAdapter * adapter,
+    GstTranscoderJobQueue * self)
+{
+  gst_transcoder_job_queue_job_finished (self, adapter);
+}
+
+static void
+job_error_cb (GstTranscoderSignalAdapter * adapter, GError * error,
+    GstStructure * details, GstTranscoderJobQueue * self)
+{
+  gst_transcoder_job_queue_job_finished (self, adapter);
+}
+
+static void
+gst_transcoder_job_queue_dispose (GObject * object)
+{
+  GstTranscoderJobQueue *self = GST_TRANSCODER_JOB_QUEUE (object);
+  GstTranscoderJob *job;
+  GQueue jobs = G_QUEUE_INIT;
+
+  GST_OBJECT_LOCK (self);
+  while ((job = g_queue_pop_head (&self->pending)))
+    g_queue_push_tail (&jobs, job);
+  while ((job = g_queue_pop_head (&self->running)))
+    g_queue_push_tail (&jobs, job);
+  GST_OBJECT_UNLOCK (self);
+
+  /* Running transcoders are not stopped, they just stop being tracked */
+  while ((job = g_queue_pop_head (&jobs))) {
+    g_signal_handlers_disconnect_by_data (job->adapter, self);
+    gst_transcoder_job_free (job);
+  }
+
+  G_OBJECT_CLASS (parent_class)->dispose (object);
+}
+
+static void
+gst_transcoder_job_queue_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstTranscoderJobQueue *self = GST_TRANSCODER_JOB_QUEUE (object);
+
+  switch (prop_id) {
+    case PROP_MAX_PARALLEL:
+      GST_OBJECT_LOCK (self);
+      g_value_set_uint (value, self->max_parallel);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_transcoder_job_queue_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstTranscoderJobQueue *self = GST_TRANSCODER_JOB_QUEUE (object);
+
+  switch (prop_id) {
+    case PROP_MAX_PARALLEL:{
+      guint max_parallel = g_value_get_uint (value);
+
+      if (max_parallel == 0)
+        max_parallel = g_get_num_processors ();
+
+      GST_OBJECT_LOCK (self);
+      self->max_parallel = max_parallel;
+      GST_OBJECT_UNLOCK (self);
+
+      /* A larger budget may allow pending jobs to start right away */
+      gst_transcoder_job_queue_schedule (self);
+      break;
+    }
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_transcoder_job_queue_init (GstTranscoderJobQueue * self)
+{
+  g_queue_init (&self->pending);
+  g_queue_init (&self->running);
+  self->max_parallel = g_get_num_processors ();
+}
+
+static void
+gst_transcoder_job_queue_class_init (GstTranscoderJobQueueClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+
+  GST_DEBUG_CATEGORY_INIT (gst_transcoder_job_queue_debug,
+      "gst-transcoder-job-queue", 0, "GstTranscoderJobQueue");
+
+  gobject_class->set_property = gst_transcoder_job_queue_set_property;
+  gobject_class->get_property = gst_transcoder_job_queue_get_property;
+  gobject_class->dispose = gst_transcoder_job_queue_dispose;
+
+  /**
+   * GstTranscoderJobQueue:max-parallel:
+   *
+   * Maximum number of transcode jobs running at the same time. Setting it
+   * to 0 selects the number of available processors. Raising the limit
+   * immediately starts pending jobs; lowering it only affects jobs that
+   * have not started yet.
+   *
+   * Since: 1.24
+   */
+  param_specs[PROP_MAX_PARALLEL] =
+      g_param_spec_uint ("max-parallel", "Max parallel",
+      "Maximum number of jobs transcoding at the same time (0 = number of processors)",
+      0, G_MAXUINT, DEFAULT_MAX_PARALLEL,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+  g_object_class_install_properties (gobject_class, PROP_LAST, param_specs);
+
+  /**
+   * GstTranscoderJobQueue::drained:
+   *
+   * Emitted when the last job finished and no pending jobs are left.
+   *
+   * Since: 1.24
+   */
+  signals[SIGNAL_DRAINED] =
+      g_signal_new ("drained", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST, 0, NULL, NULL, NULL, G_TYPE_NONE, 0, G_TYPE_INVALID);
+}
+
+/**
+ * gst_transcoder_job_queue_new:
+ * @max_parallel: maximum number of jobs transcoding at the same time,
+ * 0 for the number of available processors
+ *
+ * Returns: (transfer full): a new #GstTranscoderJobQueue
+ *
+ * Since: 1.24
+ */
+GstTranscoderJobQueue *
+gst_transcoder_job_queue_new (guint max_parallel)
+{
+  return g_object_new (GST_TYPE_TRANSCODER_JOB_QUEUE,
+      "max-parallel", max_parallel, NULL);
+}
+
+/**
+ * gst_transcoder_job_queue_push:
+ * @self: the #GstTranscoderJobQueue
+ * @transcoder: (transfer none): a configured #GstTranscoder
+ *
+ * Queues @transcoder for execution. The job starts immediately when fewer
+ * than #GstTranscoderJobQueue:max-parallel jobs are running, otherwise it
+ * starts as soon as a running job completes. The queue keeps a reference
+ * to @transcoder until the job is done.
+ *
+ * Since: 1.24
+ */
+void
+gst_transcoder_job_queue_push (GstTranscoderJobQueue * self,
+    GstTranscoder * transcoder)
+{
+  GstTranscoderJob *job;
+
+  g_return_if_fail (GST_IS_TRANSCODER_JOB_QUEUE (self));
+  g_return_if_fail (GST_IS_TRANSCODER (transcoder));
+
+  job = g_new0 (GstTranscoderJob, 1);
+  job->transcoder = gst_object_ref (transcoder);
+  job->adapter = gst_transcoder_get_sync_signal_adapter (transcoder);
+
+  g_signal_connect_object (job->adapter, "done",
+      G_CALLBACK (job_done_cb), self, 0);
+  g_signal_connect_object (job->adapter, "error",
+      G_CALLBACK (job_error_cb), self, 0);
+
+  GST_OBJECT_LOCK (self);
+  g_queue_push_tail (&self->pending, job);
+  GST_OBJECT_UNLOCK (self);
+
+  gst_transcoder_job_queue_schedule (self);
+}
+
+/**
+ * gst_transcoder_job_queue_get_n_running:
+ * @self: the #GstTranscoderJobQueue
+ *
+ * Returns: the number of jobs currently transcoding
+ *
+ * Since: 1.24
+ */
+guint
+gst_transcoder_job_queue_get_n_running (GstTranscoderJobQueue * self)
+{
+  guint res;
+
+  g_return_val_if_fail (GST_IS_TRANSCODER_JOB_QUEUE (self), 0);
+
+  GST_OBJECT_LOCK (self);
+  res = self->running.length;
+  GST_OBJECT_UNLOCK (self);
+
+  return res;
+}
+
+/**
+ * gst_transcoder_job_queue_get_n_pending:
+ * @self: the #GstTranscoderJobQueue
+ *
+ * Returns: the number of jobs waiting for a free slot
+ *
+ * Since: 1.24
+ */
+guint
+gst_transcoder_job_queue_get_n_pending (GstTranscoderJobQueue * self)
+{
+  guint res;
+
+  g_return_val_if_fail (GST_IS_TRANSCODER_JOB_QUEUE (self), 0);
+
+  GST_OBJECT_LOCK (self);
+  res = self->pending.length;
+  GST_OBJECT_UNLOCK (self);
+
+  return res;
+}
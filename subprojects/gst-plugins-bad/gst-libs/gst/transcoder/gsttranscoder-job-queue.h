@@ -0,0 +1,58 @@
+/* GStreamer
+ *
+ * Copyright (C) 2026 GStreamer developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#pragma once
+
+#include <gst/gst.h>
+#include <gst/transcoder/gsttranscoder.h>
+
+G_BEGIN_DECLS
+
+/**
+ * GST_TYPE_TRANSCODER_JOB_QUEUE:
+ *
+ * Since: 1.24
+ */
+#define GST_TYPE_TRANSCODER_JOB_QUEUE             (gst_transcoder_job_queue_get_type ())
+
+/**
+ * GstTranscoderJobQueue:
+ *
+ * Runs a set of #GstTranscoder jobs while keeping the number of jobs
+ * transcoding at the same time under a configurable limit.
+ *
+ * Since: 1.24
+ */
+GST_TRANSCODER_API
+G_DECLARE_FINAL_TYPE (GstTranscoderJobQueue, gst_transcoder_job_queue, GST, TRANSCODER_JOB_QUEUE, GstObject)
+
+GST_TRANSCODER_API
+GstTranscoderJobQueue * gst_transcoder_job_queue_new           (guint max_parallel);
+
+GST_TRANSCODER_API
+void                    gst_transcoder_job_queue_push          (GstTranscoderJobQueue * self,
+                                                                GstTranscoder * transcoder);
+
+GST_TRANSCODER_API
+guint                   gst_transcoder_job_queue_get_n_running (GstTranscoderJobQueue * self);
+
+GST_TRANSCODER_API
+guint                   gst_transcoder_job_queue_get_n_pending (GstTranscoderJobQueue * self);
+
+G_END_DECLS
@@ -173,6 +173,8 @@ GST_TRANSCODER_API
 GstTranscoderSignalAdapter*
 gst_transcoder_get_sync_signal_adapter                    (GstTranscoder * self);
 
+#include "gsttranscoder-job-queue.h"
+
 G_END_DECLS
 
 #endif
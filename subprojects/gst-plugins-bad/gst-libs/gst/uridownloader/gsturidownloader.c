@@ -30,6 +30,19 @@
 #define GST_CAT_DEFAULT uridownloader_debug
 GST_DEBUG_CATEGORY (uridownloader_debug);
 
+/* Process-wide pool of idle source elements, keyed by URI origin
+ * (scheme://host:port). The source elements keep their connection state
+ * (HTTP keep-alive connection, TLS session, resolved addresses) alive
+ * across READY, so re-using a pooled element avoids a new DNS lookup and
+ * TLS handshake for every fragment when many downloaders hit the same
+ * server. Pooled elements are kept until the process exits. */
+#define MAX_POOLED_SOURCES_PER_ORIGIN 4
+
+G_LOCK_DEFINE_STATIC (source_pool);
+static GHashTable *source_pool = NULL;  /* origin -> GQueue of GstElement */
+static guint64 source_pool_hits = 0;
+static guint64 source_pool_misses = 0;
+
 struct _GstUriDownloaderPrivate
 {
   /* Fragments fetcher */
@@ -356,6 +369,46 @@ gst_uri_downloader_reset (GstUriDownloader * downloader)
   GST_OBJECT_UNLOCK (downloader);
 }
 
+/**
+ * gst_uri_downloader_get_pool_stats:
+ *
+ * Returns statistics about the process-wide pool of re-usable source
+ * elements as a #GstStructure named
+ * `application/x-uridownloader-pool-stats` with the fields `hits` and
+ * `misses` (#G_TYPE_UINT64, pool lookups that did/did not find an idle
+ * source element for the requested origin), `idle-sources`
+ * (#G_TYPE_UINT64, elements currently parked in the pool) and `origins`
+ * (#G_TYPE_UINT, distinct origins with pooled elements). Callers can post
+ * this on their bus as an element message for monitoring.
+ *
+ * Returns: (transfer full): the pool statistics
+ */
+GstStructure *
+gst_uri_downloader_get_pool_stats (void)
+{
+  GstStructure *stats;
+  GHashTableIter iter;
+  gpointer value;
+  guint64 idle = 0;
+  guint origins = 0;
+
+  G_LOCK (source_pool);
+  if (source_pool) {
+    origins = g_hash_table_size (source_pool);
+    g_hash_table_iter_init (&iter, source_pool);
+    while (g_hash_table_iter_next (&iter, NULL, &value))
+      idle += ((GQueue *) value)->length;
+  }
+  stats = gst_structure_new ("application/x-uridownloader-pool-stats",
+      "hits", G_TYPE_UINT64, source_pool_hits,
+      "misses", G_TYPE_UINT64, source_pool_misses,
+      "idle-sources", G_TYPE_UINT64, idle,
+      "origins", G_TYPE_UINT, origins, NULL);
+  G_UNLOCK (source_pool);
+
+  return stats;
+}
+
 void
 gst_uri_downloader_cancel (GstUriDownloader * downloader)
 {
@@ -397,6 +450,63 @@ gst_uri_downloader_set_range (GstUriDownloader * downloader,
   return TRUE;
 }
 
+static gchar *
+gst_uri_downloader_get_origin (const gchar * uri)
+{
+  GstUri *parsed = gst_uri_from_string (uri);
+  gchar *origin;
+
+  if (!parsed)
+    return NULL;
+
+  if (!gst_uri_get_scheme (parsed) || !gst_uri_get_host (parsed)) {
+    gst_uri_unref (parsed);
+    return NULL;
+  }
+
+  origin = g_strdup_printf ("%s://%s:%u", gst_uri_get_scheme (parsed),
+      gst_uri_get_host (parsed), gst_uri_get_port (parsed));
+  gst_uri_unref (parsed);
+
+  return origin;
+}
+
+static GstElement *
+gst_uri_downloader_acquire_pooled_src (const gchar * uri)
+{
+  GstElement *src = NULL;
+  gchar *origin;
+  GQueue *queue;
+
+  origin = gst_uri_downloader_get_origin (uri);
+  if (!origin)
+    return NULL;
+
+  G_LOCK (source_pool);
+  if (source_pool && (queue = g_hash_table_lookup (source_pool, origin)))
+    src = g_queue_pop_head (queue);
+  if (src)
+    source_pool_hits++;
+  else
+    source_pool_misses++;
+  G_UNLOCK (source_pool);
+  g_free (origin);
+
+  if (src) {
+    GError *err = NULL;
+
+    if (!gst_uri_handler_set_uri (GST_URI_HANDLER (src), uri, &err)) {
+      GST_DEBUG ("Failed to re-use pooled source element: %s", err->message);
+      g_clear_error (&err);
+      gst_element_set_state (src, GST_STATE_NULL);
+      gst_object_unref (src);
+      src = NULL;
+    }
+  }
+
+  return src;
+}
+
 static gboolean
 gst_uri_downloader_ensure_src (GstUriDownloader * downloader, const gchar * uri)
 {
@@ -429,6 +539,13 @@ gst_uri_downloader_ensure_src (GstUriDownloader * downloader, const gchar * uri)
     g_free (new_protocol);
   }
 
+  if (!downloader->priv->urisrc) {
+    downloader->priv->urisrc = gst_uri_downloader_acquire_pooled_src (uri);
+    if (downloader->priv->urisrc)
+      GST_DEBUG_OBJECT (downloader,
+          "Re-using pooled source element for the URI:%s", uri);
+  }
+
   if (!downloader->priv->urisrc) {
     GST_DEBUG_OBJECT (downloader, "Creating source element for the URI:%s",
         uri);
@@ -449,12 +566,48 @@ gst_uri_downloader_ensure_src (GstUriDownloader * downloader, const gchar * uri)
 static void
 gst_uri_downloader_destroy_src (GstUriDownloader * downloader)
 {
-  if (!downloader->priv->urisrc)
+  GstElement *urisrc = downloader->priv->urisrc;
+  gchar *uri, *origin = NULL;
+
+  if (!urisrc)
     return;
 
-  gst_element_set_state (downloader->priv->urisrc, GST_STATE_NULL);
-  gst_object_unref (downloader->priv->urisrc);
   downloader->priv->urisrc = NULL;
+
+  uri = gst_uri_handler_get_uri (GST_URI_HANDLER (urisrc));
+  if (uri) {
+    origin = gst_uri_downloader_get_origin (uri);
+    g_free (uri);
+  }
+
+  /* Park the element in READY to keep its connection state alive and hand
+   * it to the pool for the next downloader targeting the same origin */
+  gst_element_set_bus (urisrc, NULL);
+  if (origin && gst_element_set_state (urisrc, GST_STATE_READY) ==
+      GST_STATE_CHANGE_SUCCESS) {
+    GQueue *queue;
+
+    G_LOCK (source_pool);
+    if (!source_pool)
+      source_pool =
+          g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+    queue = g_hash_table_lookup (source_pool, origin);
+    if (!queue) {
+      queue = g_queue_new ();
+      g_hash_table_insert (source_pool, g_strdup (origin), queue);
+    }
+    if (queue->length < MAX_POOLED_SOURCES_PER_ORIGIN) {
+      g_queue_push_tail (queue, urisrc);
+      urisrc = NULL;
+    }
+    G_UNLOCK (source_pool);
+  }
+  g_free (origin);
+
+  if (urisrc) {
+    gst_element_set_state (urisrc, GST_STATE_NULL);
+    gst_object_unref (urisrc);
+  }
 }
 
 static gboolean
@@ -79,5 +79,8 @@ void gst_uri_downloader_reset (GstUriDownloader *downloader);
 GST_URI_DOWNLOADER_API
 void gst_uri_downloader_cancel (GstUriDownloader *downloader);
 
+GST_URI_DOWNLOADER_API
+GstStructure * gst_uri_downloader_get_pool_stats (void);
+
 G_END_DECLS
 #endif /* __GSTURIDOWNLOADER_H__ */
@@ -188,6 +188,66 @@ gst_va_display_drm_init (GstVaDisplayDrm * self)
   self->fd = -1;
 }
 
+/* Cache of opened displays, keyed by render node path, so all the
+ * pipelines of one process share a single driver connection (and its
+ * surface bookkeeping) per device. Entries only hold weak references;
+ * a display goes away when its last user unrefs it. */
+
+typedef struct
+{
+  gchar *path;
+  GWeakRef display;
+} DisplayCacheEntry;
+
+static GMutex cache_lock;
+static GList *display_cache = NULL;
+
+static void
+display_cache_entry_free (DisplayCacheEntry * entry)
+{
+  g_weak_ref_clear (&entry->display);
+  g_free (entry->path);
+  g_free (entry);
+}
+
+/* called with cache_lock held */
+static GstVaDisplay *
+display_cache_lookup_unlocked (const gchar * path)
+{
+  GList *l = display_cache;
+
+  while (l) {
+    DisplayCacheEntry *entry = l->data;
+    GList *next = l->next;
+    GstVaDisplay *dpy = g_weak_ref_get (&entry->display);
+
+    if (!dpy) {
+      /* display already went away, drop the stale entry */
+      display_cache = g_list_delete_link (display_cache, l);
+      display_cache_entry_free (entry);
+    } else if (g_strcmp0 (entry->path, path) == 0) {
+      return dpy;
+    } else {
+      gst_object_unref (dpy);
+    }
+
+    l = next;
+  }
+
+  return NULL;
+}
+
+/* called with cache_lock held */
+static void
+display_cache_add_unlocked (const gchar * path, GstVaDisplay * display)
+{
+  DisplayCacheEntry *entry = g_new (DisplayCacheEntry, 1);
+
+  entry->path = g_strdup (path);
+  g_weak_ref_init (&entry->display, display);
+  display_cache = g_list_prepend (display_cache, entry);
+}
+
 /**
  * gst_va_display_drm_new_from_path:
  * @path: the path to the DRM device
@@ -195,6 +255,10 @@ gst_va_display_drm_init (GstVaDisplayDrm * self)
  * Creates a new #GstVaDisplay from a DRM device . It will try to open
  * and operate the device in @path.
  *
+ * Displays are cached per device path, so concurrent pipelines in the
+ * same process get the same #GstVaDisplay for the same render node
+ * rather than each opening their own driver connection.
+ *
  * Returns: (transfer full): a newly allocated #GstVaDisplay if the
  *     specified DRM render device could be opened and initialized;
  *     otherwise %NULL is returned.
@@ -208,11 +272,26 @@ gst_va_display_drm_new_from_path (const gchar * path)
 
   g_return_val_if_fail (path, NULL);
 
+  g_mutex_lock (&cache_lock);
+
+  dpy = display_cache_lookup_unlocked (path);
+  if (dpy) {
+    g_mutex_unlock (&cache_lock);
+    GST_LOG_OBJECT (dpy, "reusing cached display for %s", path);
+    return dpy;
+  }
+
   dpy = g_object_new (GST_TYPE_VA_DISPLAY_DRM, "path", path, NULL);
   if (!gst_va_display_initialize (dpy)) {
+    g_mutex_unlock (&cache_lock);
     gst_object_unref (dpy);
     return NULL;
   }
 
-  return gst_object_ref_sink (dpy);
+  dpy = gst_object_ref_sink (dpy);
+  display_cache_add_unlocked (path, dpy);
+
+  g_mutex_unlock (&cache_lock);
+
+  return dpy;
 }
@@ -418,11 +418,27 @@ gst_vulkan_trash_fence_list_gc (GstVulkanTrashList * trash_list)
 {
   GstVulkanTrashFenceList *fence_list = (GstVulkanTrashFenceList *) trash_list;
   GList *l = fence_list->list;
+  GstVulkanFence *checked_fence = NULL;
+  gboolean checked_signaled = FALSE;
 
   while (l) {
     GstVulkanTrash *trash = l->data;
+    gboolean signaled;
+
+    /* A single submission usually queues several objects for destruction
+     * against the same fence, so only ask the driver about each distinct
+     * fence once. The ref makes sure the pointer comparison stays valid
+     * across notify callbacks. */
+    if (trash->fence == checked_fence) {
+      signaled = checked_signaled;
+    } else {
+      if (checked_fence)
+        gst_vulkan_fence_unref (checked_fence);
+      checked_fence = gst_vulkan_fence_ref (trash->fence);
+      checked_signaled = signaled = gst_vulkan_fence_is_signaled (trash->fence);
+    }
 
-    if (gst_vulkan_fence_is_signaled (trash->fence)) {
+    if (signaled) {
       GList *next = g_list_next (l);
       GST_TRACE_OBJECT (fence_list, "fence %" GST_PTR_FORMAT " has been "
           "signalled, notifying", trash->fence);
@@ -434,6 +450,9 @@ gst_vulkan_trash_fence_list_gc (GstVulkanTrashList * trash_list)
       l = g_list_next (l);
     }
   }
+
+  if (checked_fence)
+    gst_vulkan_fence_unref (checked_fence);
 }
 
 static gboolean
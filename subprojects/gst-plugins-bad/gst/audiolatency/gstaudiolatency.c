@@ -49,12 +49,19 @@
  * "average-latency" fields in the GstStructure.
  *
  * The average latency is a running average of the last 5 measurements.
+ *
+ * The distribution of all measurements made since the element last started
+ * is available in the 'stats' property, and is also included in the "latency"
+ * element message, so that latency regressions can be tracked over long runs
+ * without scraping every individual measurement.
  */
 
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
 
+#include <math.h>
+
 #include "gstaudiolatency.h"
 
 #define AUDIOLATENCY_CAPS "audio/x-raw, " \
@@ -95,10 +102,14 @@ enum
   PROP_LAST_LATENCY,
   PROP_AVERAGE_LATENCY,
   PROP_SAMPLES_PER_BUFFER,
+  PROP_STATS,
 };
 
 static gint64 gst_audiolatency_get_latency (GstAudioLatency * self);
 static gint64 gst_audiolatency_get_average_latency (GstAudioLatency * self);
+static GstStructure *gst_audiolatency_get_stats (GstAudioLatency * self);
+static GstStateChangeReturn gst_audiolatency_change_state (GstElement * element,
+    GstStateChange transition);
 static GstFlowReturn gst_audiolatency_sink_chain (GstPad * pad,
     GstObject * parent, GstBuffer * buffer);
 static gboolean gst_audiolatency_sink_event (GstPad * pad,
@@ -125,6 +136,9 @@ gst_audiolatency_get_property (GObject * object,
     case PROP_SAMPLES_PER_BUFFER:
       g_value_set_int (value, self->samples_per_buffer);
       break;
+    case PROP_STATS:
+      g_value_take_boxed (value, gst_audiolatency_get_stats (self));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -190,6 +204,33 @@ gst_audiolatency_class_init (GstAudioLatencyClass * klass)
           1, G_MAXINT, DEFAULT_SAMPLES_PER_BUFFER,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioLatency:stats:
+   *
+   * Various latency statistics, as a #GstStructure with the following fields:
+   *
+   * * "measurements" G_TYPE_UINT64 number of measurements made
+   * * "minimum-latency" G_TYPE_INT64 smallest latency measured, in microseconds
+   * * "maximum-latency" G_TYPE_INT64 largest latency measured, in microseconds
+   * * "mean-latency" G_TYPE_INT64 mean of all measurements, in microseconds
+   * * "stddev-latency" G_TYPE_INT64 standard deviation of all measurements,
+   *   in microseconds
+   *
+   * The statistics cover every measurement made since the element last left
+   * the READY state, unlike #GstAudioLatency:average-latency which only covers
+   * the last few seconds. They are also included in the "latency" element
+   * message.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Various latency statistics", GST_TYPE_STRUCTURE,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  gstelement_class->change_state =
+      GST_DEBUG_FUNCPTR (gst_audiolatency_change_state);
+
   gst_element_class_add_static_pad_template (gstelement_class, &src_template);
   gst_element_class_add_static_pad_template (gstelement_class, &sink_template);
 
@@ -283,10 +324,58 @@ gst_audiolatency_get_average_latency (GstAudioLatency * self)
   return average;
 }
 
+static GstStructure *
+gst_audiolatency_get_stats_unlocked (GstAudioLatency * self)
+{
+  gint64 min_latency = 0, max_latency = 0;
+  gdouble mean = 0, stddev = 0;
+
+  if (self->num_measurements > 0) {
+    min_latency = self->min_latency;
+    max_latency = self->max_latency;
+    mean = self->latency_sum / self->num_measurements;
+    stddev =
+        sqrt (MAX (self->latency_sq_sum / self->num_measurements -
+            mean * mean, 0));
+  }
+
+  return gst_structure_new ("application/x-audiolatency-stats",
+      "measurements", G_TYPE_UINT64, self->num_measurements,
+      "minimum-latency", G_TYPE_INT64, min_latency,
+      "maximum-latency", G_TYPE_INT64, max_latency,
+      "mean-latency", G_TYPE_INT64, (gint64) mean,
+      "stddev-latency", G_TYPE_INT64, (gint64) stddev, NULL);
+}
+
+static GstStructure *
+gst_audiolatency_get_stats (GstAudioLatency * self)
+{
+  GstStructure *stats;
+
+  GST_OBJECT_LOCK (self);
+  stats = gst_audiolatency_get_stats_unlocked (self);
+  GST_OBJECT_UNLOCK (self);
+
+  return stats;
+}
+
+static void
+gst_audiolatency_reset_stats (GstAudioLatency * self)
+{
+  GST_OBJECT_LOCK (self);
+  self->num_measurements = 0;
+  self->min_latency = 0;
+  self->max_latency = 0;
+  self->latency_sum = 0;
+  self->latency_sq_sum = 0;
+  GST_OBJECT_UNLOCK (self);
+}
+
 static void
 gst_audiolatency_set_latency (GstAudioLatency * self, gint64 latency)
 {
   gint64 avg_latency;
+  GstStructure *s;
 
   GST_OBJECT_LOCK (self);
   self->latencies[self->next_latency_idx] = latency;
@@ -298,16 +387,29 @@ gst_audiolatency_set_latency (GstAudioLatency * self, gint64 latency)
 
   avg_latency = gst_audiolatency_get_average_latency_unlocked (self);
 
+  /* Update the overall distribution */
+  if (self->num_measurements == 0 || latency < self->min_latency)
+    self->min_latency = latency;
+  if (latency > self->max_latency)
+    self->max_latency = latency;
+  self->latency_sum += latency;
+  self->latency_sq_sum += (gdouble) latency * latency;
+  self->num_measurements += 1;
+
+  s = gst_audiolatency_get_stats_unlocked (self);
+
   if (self->print_latency)
     g_print ("last latency: %" G_GINT64_FORMAT "ms, running average: %"
         G_GINT64_FORMAT "ms\n", latency / 1000, avg_latency / 1000);
   GST_OBJECT_UNLOCK (self);
 
+  gst_structure_set_name (s, "latency");
+  gst_structure_set (s, "last-latency", G_TYPE_INT64, latency,
+      "average-latency", G_TYPE_INT64, avg_latency, NULL);
+
   /* Post an element message about it */
   gst_element_post_message (GST_ELEMENT (self),
-      gst_message_new_element (GST_OBJECT (self),
-          gst_structure_new ("latency", "last-latency", G_TYPE_INT64, latency,
-              "average-latency", G_TYPE_INT64, avg_latency, NULL)));
+      gst_message_new_element (GST_OBJECT (self), s));
 }
 
 static gint64
@@ -480,6 +582,23 @@ gst_audiolatency_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
   return gst_pad_event_default (pad, parent, event);
 }
 
+static GstStateChangeReturn
+gst_audiolatency_change_state (GstElement * element, GstStateChange transition)
+{
+  GstAudioLatency *self = GST_AUDIOLATENCY (element);
+
+  switch (transition) {
+    case GST_STATE_CHANGE_READY_TO_PAUSED:
+      /* Each run gets its own distribution */
+      gst_audiolatency_reset_stats (self);
+      break;
+    default:
+      break;
+  }
+
+  return GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
+}
+
 /* Element registration */
 static gboolean
 plugin_init (GstPlugin * plugin)
@@ -54,6 +54,14 @@ struct _GstAudioLatency
   gint next_latency_idx;
   gint latencies[GST_AUDIOLATENCY_NUM_LATENCIES];
 
+  /* distribution over all measurements since the last state change,
+   * protected by the object lock */
+  guint64 num_measurements;
+  gint64 min_latency;
+  gint64 max_latency;
+  gdouble latency_sum;
+  gdouble latency_sq_sum;
+
   /* properties */
   gboolean print_latency;
   gint samples_per_buffer;
@@ -43,9 +43,14 @@ enum
 {
   PROP_0,
   PROP_VIDEO_SRC,
-  PROP_VIDEO_SRC_FILTER
+  PROP_VIDEO_SRC_FILTER,
+  PROP_ZSL_MODE,
+  PROP_ZSL_RING_SIZE
 };
 
+#define DEFAULT_ZSL_MODE FALSE
+#define DEFAULT_ZSL_RING_SIZE 6
+
 GST_DEBUG_CATEGORY (wrapper_camera_bin_src_debug);
 #define GST_CAT_DEFAULT wrapper_camera_bin_src_debug
 
@@ -76,11 +81,25 @@ GST_STATIC_PAD_TEMPLATE (GST_BASE_CAMERA_SRC_VIDEO_PAD_NAME,
 static void set_capsfilter_caps (GstWrapperCameraBinSrc * self,
     GstCaps * new_caps);
 
+/* Must be called with the capturing_mutex held */
+static void
+gst_wrapper_camera_bin_src_zsl_clear (GstWrapperCameraBinSrc * self)
+{
+  GstSample *sample;
+
+  while ((sample = g_queue_pop_head (&self->zsl_ring)))
+    gst_sample_unref (sample);
+  self->zsl_pending = FALSE;
+}
+
 static void
 gst_wrapper_camera_bin_src_dispose (GObject * object)
 {
   GstWrapperCameraBinSrc *self = GST_WRAPPER_CAMERA_BIN_SRC (object);
 
+  gst_wrapper_camera_bin_src_zsl_clear (self);
+  gst_caps_replace (&self->zsl_caps, NULL);
+
   if (self->src_pad) {
     gst_object_unref (self->src_pad);
     self->src_pad = NULL;
@@ -149,6 +168,26 @@ gst_wrapper_camera_bin_src_set_property (GObject * object,
           gst_object_ref (self->app_vid_filter);
       }
       break;
+    case PROP_ZSL_MODE:{
+      GstBaseCameraSrc *camerasrc = GST_BASE_CAMERA_SRC (self);
+
+      g_mutex_lock (&camerasrc->capturing_mutex);
+      self->zsl_mode = g_value_get_boolean (value);
+      if (!self->zsl_mode)
+        gst_wrapper_camera_bin_src_zsl_clear (self);
+      g_mutex_unlock (&camerasrc->capturing_mutex);
+      break;
+    }
+    case PROP_ZSL_RING_SIZE:{
+      GstBaseCameraSrc *camerasrc = GST_BASE_CAMERA_SRC (self);
+
+      g_mutex_lock (&camerasrc->capturing_mutex);
+      self->zsl_ring_size = g_value_get_uint (value);
+      while (g_queue_get_length (&self->zsl_ring) > self->zsl_ring_size)
+        gst_sample_unref (g_queue_pop_head (&self->zsl_ring));
+      g_mutex_unlock (&camerasrc->capturing_mutex);
+      break;
+    }
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
       break;
@@ -174,6 +213,12 @@ gst_wrapper_camera_bin_src_get_property (GObject * object,
       else
         g_value_set_object (value, self->app_vid_filter);
       break;
+    case PROP_ZSL_MODE:
+      g_value_set_boolean (value, self->zsl_mode);
+      break;
+    case PROP_ZSL_RING_SIZE:
+      g_value_set_uint (value, self->zsl_ring_size);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
       break;
@@ -294,6 +339,111 @@ gst_wrapper_camera_bin_src_imgsrc_probe (GstPad * pad, GstPadProbeInfo * info,
   return ret;
 }
 
+/* Pick the ring sample to resolve a pending capture against: the newest
+ * frame that was captured before the trigger, falling back to the newest
+ * frame overall. Must be called with the capturing_mutex held; returns a
+ * reference. */
+static GstSample *
+gst_wrapper_camera_bin_src_zsl_select (GstWrapperCameraBinSrc * self)
+{
+  GList *l;
+
+  if (g_queue_is_empty (&self->zsl_ring))
+    return NULL;
+
+  if (GST_CLOCK_TIME_IS_VALID (self->zsl_trigger_time)) {
+    for (l = self->zsl_ring.tail; l != NULL; l = l->prev) {
+      GstSample *sample = l->data;
+      GstClockTime ts = GST_BUFFER_TIMESTAMP (gst_sample_get_buffer (sample));
+
+      if (GST_CLOCK_TIME_IS_VALID (ts) && ts <= self->zsl_trigger_time)
+        return gst_sample_ref (sample);
+    }
+  }
+
+  return gst_sample_ref (g_queue_peek_tail (&self->zsl_ring));
+}
+
+/* Push a ring sample out of the imgsrc pad. The pad has no ghostpad target
+ * in zsl mode, so the stream-start/caps/segment events have to be pushed
+ * here. Must be called without the capturing_mutex held since the imgsrc
+ * buffer probe takes it again. */
+static void
+gst_wrapper_camera_bin_src_zsl_push (GstWrapperCameraBinSrc * self,
+    GstSample * sample)
+{
+  GstBuffer *buffer = gst_sample_get_buffer (sample);
+  GstCaps *caps = gst_sample_get_caps (sample);
+  GstSegment segment;
+  GstClockTime ts;
+
+  if (!self->zsl_sent_stream_start) {
+    gchar *stream_id = gst_pad_create_stream_id (self->imgsrc,
+        GST_ELEMENT_CAST (self), "zsl");
+    gst_pad_push_event (self->imgsrc, gst_event_new_stream_start (stream_id));
+    g_free (stream_id);
+    self->zsl_sent_stream_start = TRUE;
+  }
+
+  if (caps && (!self->zsl_caps || !gst_caps_is_equal (self->zsl_caps, caps))) {
+    gst_caps_replace (&self->zsl_caps, caps);
+    gst_pad_push_event (self->imgsrc, gst_event_new_caps (caps));
+  }
+
+  ts = GST_BUFFER_TIMESTAMP (buffer);
+  if (!GST_CLOCK_TIME_IS_VALID (ts))
+    ts = 0;
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  segment.start = ts;
+  gst_pad_push_event (self->imgsrc, gst_event_new_segment (&segment));
+
+  gst_pad_push (self->imgsrc, gst_buffer_ref (buffer));
+}
+
+/**
+ * gst_wrapper_camera_bin_src_zsl_probe:
+ *
+ * Buffer probe retaining the most recent frames in the zsl ring and
+ * resolving pending captures against it.
+ */
+static GstPadProbeReturn
+gst_wrapper_camera_bin_src_zsl_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer data)
+{
+  GstWrapperCameraBinSrc *self = GST_WRAPPER_CAMERA_BIN_SRC (data);
+  GstBaseCameraSrc *camerasrc = GST_BASE_CAMERA_SRC (data);
+  GstBuffer *buffer = GST_BUFFER (info->data);
+  GstSample *capture = NULL;
+  GstCaps *caps;
+
+  g_mutex_lock (&camerasrc->capturing_mutex);
+  if (!self->zsl_mode || camerasrc->mode != MODE_IMAGE) {
+    g_mutex_unlock (&camerasrc->capturing_mutex);
+    return GST_PAD_PROBE_OK;
+  }
+
+  caps = gst_pad_get_current_caps (pad);
+  g_queue_push_tail (&self->zsl_ring, gst_sample_new (buffer, caps, NULL,
+          NULL));
+  while (g_queue_get_length (&self->zsl_ring) > self->zsl_ring_size)
+    gst_sample_unref (g_queue_pop_head (&self->zsl_ring));
+  if (caps)
+    gst_caps_unref (caps);
+
+  if (self->zsl_pending) {
+    self->zsl_pending = FALSE;
+    capture = gst_wrapper_camera_bin_src_zsl_select (self);
+  }
+  g_mutex_unlock (&camerasrc->capturing_mutex);
+
+  if (capture) {
+    gst_wrapper_camera_bin_src_zsl_push (self, capture);
+    gst_sample_unref (capture);
+  }
+
+  return GST_PAD_PROBE_OK;
+}
+
 /**
  * gst_wrapper_camera_bin_src_vidsrc_probe:
  *
@@ -613,6 +763,8 @@ gst_wrapper_camera_bin_src_construct_pipeline (GstBaseCameraSrc * bcamsrc)
         gst_wrapper_camera_bin_src_imgsrc_probe, self, NULL);
     gst_pad_add_probe (self->video_tee_sink, GST_PAD_PROBE_TYPE_BUFFER,
         gst_wrapper_camera_bin_src_vidsrc_probe, self, NULL);
+    gst_pad_add_probe (self->src_pad, GST_PAD_PROBE_TYPE_BUFFER,
+        gst_wrapper_camera_bin_src_zsl_probe, self, NULL);
   }
 
   /* Do this even if pipeline is constructed */
@@ -843,6 +995,11 @@ gst_wrapper_camera_bin_src_set_mode (GstBaseCameraSrc * bcamsrc,
     self->image_renegotiate = TRUE;
   } else {
     self->video_renegotiate = TRUE;
+
+    /* the retained frames are only useful for image captures */
+    g_mutex_lock (&bcamsrc->capturing_mutex);
+    gst_wrapper_camera_bin_src_zsl_clear (self);
+    g_mutex_unlock (&bcamsrc->capturing_mutex);
   }
   self->mode = mode;
 
@@ -1014,9 +1171,24 @@ gst_wrapper_camera_bin_src_start_capture (GstBaseCameraSrc * camerasrc)
   if (src->mode == MODE_IMAGE) {
     src->image_capture_count = 1;
 
-    src->image_capture_probe =
-        gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_IDLE, start_image_capture,
-        src, NULL);
+    if (src->zsl_mode) {
+      GstClock *clock = gst_element_get_clock (GST_ELEMENT_CAST (src));
+
+      /* resolve the capture against the already-captured frames in the ring
+       * on the next ring update, instead of reconfiguring the source and
+       * waiting for a frame captured after the trigger */
+      src->zsl_trigger_time = GST_CLOCK_TIME_NONE;
+      if (clock) {
+        src->zsl_trigger_time = gst_clock_get_time (clock) -
+            GST_ELEMENT_CAST (src)->base_time;
+        gst_object_unref (clock);
+      }
+      src->zsl_pending = TRUE;
+    } else {
+      src->image_capture_probe =
+          gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_IDLE, start_image_capture,
+          src, NULL);
+    }
   } else if (src->mode == MODE_VIDEO) {
     if (src->video_rec_status == GST_VIDEO_RECORDING_STATUS_DONE) {
       src->video_rec_status = GST_VIDEO_RECORDING_STATUS_STARTING;
@@ -1068,6 +1240,11 @@ gst_wrapper_camera_bin_src_change_state (GstElement * element,
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       self->video_renegotiate = TRUE;
       self->image_renegotiate = TRUE;
+      g_mutex_lock (&GST_BASE_CAMERA_SRC (self)->capturing_mutex);
+      gst_wrapper_camera_bin_src_zsl_clear (self);
+      g_mutex_unlock (&GST_BASE_CAMERA_SRC (self)->capturing_mutex);
+      self->zsl_sent_stream_start = FALSE;
+      gst_caps_replace (&self->zsl_caps, NULL);
       break;
     case GST_STATE_CHANGE_READY_TO_NULL:
       break;
@@ -1108,6 +1285,40 @@ gst_wrapper_camera_bin_src_class_init (GstWrapperCameraBinSrcClass * klass)
           "Optional video source filter element",
           GST_TYPE_ELEMENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstWrapperCameraBinSrc:zsl-mode:
+   *
+   * When enabled, the most recent viewfinder frames are retained in a
+   * bounded ring and image captures are resolved against it, so the
+   * captured frame predates the capture trigger (zero shutter lag)
+   * instead of waiting for the source to reconfigure and produce a new
+   * frame. Captures use the current viewfinder caps; no renegotiation to
+   * the image capture caps is done in this mode.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_ZSL_MODE,
+      g_param_spec_boolean ("zsl-mode", "Zero shutter lag mode",
+          "Resolve image captures against a ring of recently captured frames "
+          "instead of waiting for a new frame", DEFAULT_ZSL_MODE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstWrapperCameraBinSrc:zsl-ring-size:
+   *
+   * Number of recent frames retained for zsl-mode. Note that the retained
+   * frames keep their buffers referenced, so the video source's buffer
+   * pool needs this many buffers of headroom on top of what the pipeline
+   * has in flight.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_ZSL_RING_SIZE,
+      g_param_spec_uint ("zsl-ring-size", "ZSL ring size",
+          "Number of recent frames to retain for zsl-mode",
+          1, 32, DEFAULT_ZSL_RING_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state = gst_wrapper_camera_bin_src_change_state;
 
   gstbasecamerasrc_class->construct_pipeline =
@@ -1166,4 +1377,9 @@ gst_wrapper_camera_bin_src_init (GstWrapperCameraBinSrc * self)
   self->image_renegotiate = TRUE;
   self->mode = GST_BASE_CAMERA_SRC_CAST (self)->mode;
   self->app_vid_filter = NULL;
+
+  self->zsl_mode = DEFAULT_ZSL_MODE;
+  self->zsl_ring_size = DEFAULT_ZSL_RING_SIZE;
+  g_queue_init (&self->zsl_ring);
+  self->zsl_trigger_time = GST_CLOCK_TIME_NONE;
 }
@@ -112,6 +112,19 @@ struct _GstWrapperCameraBinSrc
   GstCaps *image_capture_caps;
   gboolean image_renegotiate;
   gboolean video_renegotiate;
+
+  /* Zero-shutter-lag capture: bounded ring of the most recent viewfinder
+   * frames that image captures are resolved against, instead of
+   * reconfiguring the source and waiting for the next frame.
+   * The ring and the pending/trigger state are protected by the
+   * basecamerasrc capturing_mutex. */
+  gboolean zsl_mode;
+  guint zsl_ring_size;
+  GQueue zsl_ring;              /* of GstSample */
+  gboolean zsl_pending;
+  GstClockTime zsl_trigger_time;
+  gboolean zsl_sent_stream_start;
+  GstCaps *zsl_caps;            /* caps last pushed on imgsrc */
 };
 
 
@@ -47,6 +47,12 @@
 #include "gstalphacombine.h"
 
 
+/* How many decoded alpha buffers we are willing to hold. One is enough for
+ * correctness, but then the alpha decoder can never work ahead and the two
+ * decoders end up taking turns. A little slack lets them run in parallel;
+ * more would only add memory usage since we pair frames in order anyway. */
+#define ALPHA_QUEUE_DEPTH 2
+
 #define SUPPORTED_SINK_FORMATS "{ I420, NV12 }"
 #define SUPPORTED_ALPHA_FORMATS "{ GRAY8, I420, NV12 }"
 #define SUPPORTED_SRC_FORMATS "{ A420, AV12 }"
@@ -102,7 +108,9 @@ struct _GstAlphaCombine
 
   GMutex buffer_lock;
   GCond buffer_cond;
-  GstBuffer *alpha_buffer;
+  /* Decoded alpha buffers waiting to be paired, bounded to
+   * ALPHA_QUEUE_DEPTH */
+  GQueue alpha_queue;
   /* Ref-counted flushing state */
   guint flushing;
 
@@ -172,7 +180,7 @@ gst_alpha_combine_unlock_stop (GstAlphaCombine * self)
 static void
 gst_alpha_combine_reset (GstAlphaCombine * self)
 {
-  gst_buffer_replace (&self->alpha_buffer, NULL);
+  g_queue_clear_full (&self->alpha_queue, (GDestroyNotify) gst_buffer_unref);
   gst_buffer_replace (&self->last_alpha_buffer, NULL);
   self->last_flow_ret = GST_FLOW_OK;
 }
@@ -230,7 +238,7 @@ gst_alpha_combine_peek_alpha_buffer (GstAlphaCombine * self,
 {
   g_mutex_lock (&self->buffer_lock);
 
-  while (!self->alpha_buffer && !self->flushing)
+  while (g_queue_is_empty (&self->alpha_queue) && !self->flushing)
     g_cond_wait (&self->buffer_cond, &self->buffer_lock);
 
   if (self->flushing) {
@@ -239,13 +247,13 @@ gst_alpha_combine_peek_alpha_buffer (GstAlphaCombine * self,
   }
 
   /* Now is a good time to validate the formats, as the alpha_vinfo won't be
-   * updated until we signal this alpha_buffer_as being consumed */
+   * updated until the queued alpha buffers have all been consumed */
   if (!gst_alpha_combine_negotiate (self)) {
     g_mutex_unlock (&self->buffer_lock);
     return GST_FLOW_NOT_NEGOTIATED;
   }
 
-  *alpha_buffer = gst_buffer_ref (self->alpha_buffer);
+  *alpha_buffer = gst_buffer_ref (g_queue_peek_head (&self->alpha_queue));
   g_mutex_unlock (&self->buffer_lock);
 
   if (GST_BUFFER_FLAG_IS_SET (*alpha_buffer, GST_BUFFER_FLAG_GAP)) {
@@ -267,9 +275,14 @@ static void
 gst_alpha_combine_pop_alpha_buffer (GstAlphaCombine * self,
     GstFlowReturn flow_ret)
 {
+  GstBuffer *buffer;
+
   g_mutex_lock (&self->buffer_lock);
   self->last_flow_ret = flow_ret;
-  gst_clear_buffer (&self->alpha_buffer);
+  /* The queue may have been cleared by a concurrent flush */
+  buffer = g_queue_pop_head (&self->alpha_queue);
+  if (buffer)
+    gst_buffer_unref (buffer);
   g_cond_broadcast (&self->buffer_cond);
   g_mutex_unlock (&self->buffer_lock);
 }
@@ -281,9 +294,10 @@ gst_alpha_combine_push_alpha_buffer (GstAlphaCombine * self, GstBuffer * buffer)
 
   g_mutex_lock (&self->buffer_lock);
 
-  /* We wait for the alpha_buffer to be consumed and store the buffer for the
+  /* Wait for a free slot in the queue and store the buffer for the
    * sink_chain to pick it up */
-  while (self->alpha_buffer && !self->flushing)
+  while (g_queue_get_length (&self->alpha_queue) >= ALPHA_QUEUE_DEPTH &&
+      !self->flushing)
     g_cond_wait (&self->buffer_cond, &self->buffer_lock);
 
   if (self->flushing) {
@@ -292,7 +306,7 @@ gst_alpha_combine_push_alpha_buffer (GstAlphaCombine * self, GstBuffer * buffer)
     return GST_FLOW_FLUSHING;
   }
 
-  self->alpha_buffer = buffer;
+  g_queue_push_tail (&self->alpha_queue, buffer);
   GST_DEBUG_OBJECT (self, "Stored pending alpha buffer %p", buffer);
   g_cond_signal (&self->buffer_cond);
   ret = self->last_flow_ret;
@@ -437,13 +451,11 @@ gst_alpha_combine_set_sink_format (GstAlphaCombine * self, GstCaps * caps)
 static gboolean
 gst_alpha_combine_set_alpha_format (GstAlphaCombine * self, GstCaps * caps)
 {
-  /* We wait for the alpha_buffer to be consumed, so that we don't pick the
-   * caps too soon */
+  /* We wait for the queued alpha buffers to be consumed, so that we don't
+   * pick the caps too soon */
   g_mutex_lock (&self->buffer_lock);
 
-  /* We wait for the alpha_buffer to be consumed and store the buffer for the
-   * sink_chain to pick it up */
-  while (self->alpha_buffer && !self->flushing)
+  while (!g_queue_is_empty (&self->alpha_queue) && !self->flushing)
     g_cond_wait (&self->buffer_cond, &self->buffer_lock);
 
   if (self->flushing) {
@@ -669,6 +681,7 @@ gst_alpha_combine_init (GstAlphaCombine * self)
 
   g_mutex_init (&self->buffer_lock);
   g_cond_init (&self->buffer_cond);
+  g_queue_init (&self->alpha_queue);
 
   GST_PAD_SET_PROXY_SCHEDULING (self->sink_pad);
   GST_PAD_SET_PROXY_SCHEDULING (self->src_pad);
@@ -943,6 +943,7 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
     guint32 *palette, *data;
     gint rx, ry, rw, rh, stride;
     gint k, l;
+    gint left, right, top, bottom;
     GstMapInfo map;
 
     GST_LOG_OBJECT (overlay, "rectangle %d: %dx%d @ (%d, %d)", i,
@@ -950,13 +951,48 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
 
     w = srect->w;
     h = srect->h;
+    in_data = srect->pict.data;
+    palette = srect->pict.palette;
+    stride = srect->pict.rowstride;
+
+    /* Regions are often page-sized with the visible pixels covering only a
+     * small part, the rest being fully transparent padding. The blend is
+     * paid on every video frame for as long as the page is on screen, so
+     * shrink each rectangle to the bounding box of its visible pixels. */
+    left = w;
+    right = -1;
+    top = -1;
+    bottom = -1;
+    for (k = 0; k < h; k++) {
+      const guint8 *line = in_data + k * stride;
+
+      for (l = 0; l < w; l++) {
+        if ((palette[line[l]] >> 24) == 0)
+          continue;
+        left = MIN (left, l);
+        right = MAX (right, l);
+        if (top < 0)
+          top = k;
+        bottom = k;
+      }
+    }
+
+    if (right < 0) {
+      GST_LOG_OBJECT (overlay, "rectangle %d is fully transparent, skipping",
+          i);
+      continue;
+    }
+
+    in_data += top * stride + left;
+    w = right - left + 1;
+    h = bottom - top + 1;
+
+    GST_LOG_OBJECT (overlay, "rectangle %d visible area: %dx%d @ (%d, %d)", i,
+        w, h, left, top);
 
     buf = gst_buffer_new_and_alloc (w * h * 4);
     gst_buffer_map (buf, &map, GST_MAP_WRITE);
     data = (guint32 *) map.data;
-    in_data = srect->pict.data;
-    palette = srect->pict.palette;
-    stride = srect->pict.rowstride;
     for (k = 0; k < h; k++) {
       for (l = 0; l < w; l++) {
         guint32 ayuv;
@@ -974,10 +1010,10 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
      * to the window (if there is one) within a display of specified dimension.
      * Coordinate wrt the latter is then scaled to the actual dimension of
      * the video we are dealing with here. */
-    rx = gst_util_uint64_scale (wx + srect->x, width, dw);
-    ry = gst_util_uint64_scale (wy + srect->y, height, dh);
-    rw = gst_util_uint64_scale (srect->w, width, dw);
-    rh = gst_util_uint64_scale (srect->h, height, dh);
+    rx = gst_util_uint64_scale (wx + srect->x + left, width, dw);
+    ry = gst_util_uint64_scale (wy + srect->y + top, height, dh);
+    rw = gst_util_uint64_scale (w, width, dw);
+    rh = gst_util_uint64_scale (h, height, dh);
 
     GST_LOG_OBJECT (overlay, "rectangle %d rendered: %dx%d @ (%d, %d)", i,
         rw, rh, rx, ry);
@@ -1123,10 +1159,11 @@ gst_dvbsub_overlay_chain_video (GstPad * pad, GstObject * parent,
   }
 
   /* Now render it */
-  if (g_atomic_int_get (&overlay->enable) && overlay->current_subtitle) {
+  /* current_comp may be NULL if all regions turned out fully transparent */
+  if (g_atomic_int_get (&overlay->enable) && overlay->current_subtitle
+      && overlay->current_comp) {
     GstVideoFrame frame;
 
-    g_assert (overlay->current_comp);
     if (overlay->attach_compo_to_buffer) {
       GST_DEBUG_OBJECT (overlay, "Attaching overlay image to video buffer");
       gst_buffer_add_video_overlay_composition_meta (buffer,
@@ -82,6 +82,8 @@ GST_DEBUG_CATEGORY_STATIC (gst_field_analysis_debug);
 #define DEFAULT_BLOCK_HEIGHT 16
 #define DEFAULT_BLOCK_THRESH 80
 #define DEFAULT_IGNORED_LINES 2
+#define DEFAULT_METRIC_DECIMATION 1
+#define DEFAULT_POST_METRICS FALSE
 
 enum
 {
@@ -96,7 +98,9 @@ enum
   PROP_BLOCK_WIDTH,
   PROP_BLOCK_HEIGHT,
   PROP_BLOCK_THRESH,
-  PROP_IGNORED_LINES
+  PROP_IGNORED_LINES,
+  PROP_METRIC_DECIMATION,
+  PROP_POST_METRICS
 };
 
 static GstStaticPadTemplate sink_factory =
@@ -280,6 +284,15 @@ gst_field_analysis_class_init (GstFieldAnalysisClass * klass)
           "Ignore this many lines from the top and bottom for windowed comb detection",
           2, G_MAXUINT64, DEFAULT_IGNORED_LINES,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_METRIC_DECIMATION,
+      g_param_spec_uint ("metric-decimation", "Metric decimation",
+          "Compute the same parity field metrics on every Nth line pair only, trading accuracy for less CPU",
+          1, 32, DEFAULT_METRIC_DECIMATION,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_POST_METRICS,
+      g_param_spec_boolean ("post-metrics", "Post metrics",
+          "Post the per-frame metric scores on the bus as element messages",
+          DEFAULT_POST_METRICS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_field_analysis_change_state);
@@ -367,6 +380,8 @@ gst_field_analysis_init (GstFieldAnalysis * filter)
   filter->block_height = DEFAULT_BLOCK_HEIGHT;
   filter->block_thresh = DEFAULT_BLOCK_THRESH;
   filter->ignored_lines = DEFAULT_IGNORED_LINES;
+  filter->metric_decimation = DEFAULT_METRIC_DECIMATION;
+  filter->post_metrics = DEFAULT_POST_METRICS;
 }
 
 static void
@@ -454,6 +469,12 @@ gst_field_analysis_set_property (GObject * object, guint prop_id,
     case PROP_IGNORED_LINES:
       filter->ignored_lines = g_value_get_uint64 (value);
       break;
+    case PROP_METRIC_DECIMATION:
+      filter->metric_decimation = g_value_get_uint (value);
+      break;
+    case PROP_POST_METRICS:
+      filter->post_metrics = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -528,6 +549,12 @@ gst_field_analysis_get_property (GObject * object, guint prop_id,
     case PROP_IGNORED_LINES:
       g_value_set_uint64 (value, filter->ignored_lines);
       break;
+    case PROP_METRIC_DECIMATION:
+      g_value_set_uint (value, filter->metric_decimation);
+      break;
+    case PROP_POST_METRICS:
+      g_value_set_boolean (value, filter->post_metrics);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -814,7 +841,7 @@ gst_field_analysis_sink_event (GstPad * pad, GstObject * parent,
 static gfloat
 same_parity_sad (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
 {
-  gint j;
+  gint j, rows;
   gfloat sum;
   guint8 *f1j, *f2j;
 
@@ -825,6 +852,7 @@ same_parity_sad (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
   const gint stride1x2 =
       GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1;
   const guint32 noise_floor = filter->noise_floor;
+  const gint decimation = filter->metric_decimation;
 
   f1j =
       GST_VIDEO_FRAME_COMP_DATA (&(*history)[0].frame,
@@ -840,22 +868,24 @@ same_parity_sad (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
       0);
 
   sum = 0.0f;
-  for (j = 0; j < (height >> 1); j++) {
+  rows = 0;
+  for (j = 0; j < (height >> 1); j += decimation) {
     guint32 tempsum = 0;
     fieldanalysis_orc_same_parity_sad_planar_yuv (&tempsum, f1j, f2j,
         noise_floor, width);
     sum += tempsum;
-    f1j += stride0x2;
-    f2j += stride1x2;
+    f1j += stride0x2 * decimation;
+    f2j += stride1x2 * decimation;
+    rows++;
   }
 
-  return sum / (0.5f * width * height);
+  return sum / ((gfloat) rows * width);
 }
 
 static gfloat
 same_parity_ssd (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
 {
-  gint j;
+  gint j, rows;
   gfloat sum;
   guint8 *f1j, *f2j;
 
@@ -867,6 +897,7 @@ same_parity_ssd (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
       GST_VIDEO_FRAME_COMP_STRIDE (&(*history)[1].frame, 0) << 1;
   /* noise floor needs to be squared for SSD */
   const guint32 noise_floor = filter->noise_floor * filter->noise_floor;
+  const gint decimation = filter->metric_decimation;
 
   f1j =
       GST_VIDEO_FRAME_COMP_DATA (&(*history)[0].frame,
@@ -882,16 +913,18 @@ same_parity_ssd (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
       0);
 
   sum = 0.0f;
-  for (j = 0; j < (height >> 1); j++) {
+  rows = 0;
+  for (j = 0; j < (height >> 1); j += decimation) {
     guint32 tempsum = 0;
     fieldanalysis_orc_same_parity_ssd_planar_yuv (&tempsum, f1j, f2j,
         noise_floor, width);
     sum += tempsum;
-    f1j += stride0x2;
-    f2j += stride1x2;
+    f1j += stride0x2 * decimation;
+    f2j += stride1x2 * decimation;
+    rows++;
   }
 
-  return sum / (0.5f * width * height); /* field is half height */
+  return sum / ((gfloat) rows * width);
 }
 
 /* horizontal [1,4,1] diff between fields - is this a good idea or should the
@@ -899,7 +932,7 @@ same_parity_ssd (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
 static gfloat
 same_parity_3_tap (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
 {
-  gint i, j;
+  gint i, j, rows;
   gfloat sum;
   guint8 *f1j, *f2j;
 
@@ -912,6 +945,7 @@ same_parity_3_tap (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
   const gint incr = GST_VIDEO_FRAME_COMP_PSTRIDE (&(*history)[0].frame, 0);
   /* noise floor needs to be *6 for [1,4,1] */
   const guint32 noise_floor = filter->noise_floor * 6;
+  const gint decimation = filter->metric_decimation;
 
   f1j = GST_VIDEO_FRAME_COMP_DATA (&(*history)[0].frame, 0) +
       GST_VIDEO_FRAME_COMP_OFFSET (&(*history)[0].frame, 0) +
@@ -925,7 +959,8 @@ same_parity_3_tap (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
       0);
 
   sum = 0.0f;
-  for (j = 0; j < (height >> 1); j++) {
+  rows = 0;
+  for (j = 0; j < (height >> 1); j += decimation) {
     guint32 tempsum = 0;
     guint32 diff;
 
@@ -947,11 +982,12 @@ same_parity_3_tap (GstFieldAnalysis * filter, FieldAnalysisFields (*history)[2])
     if (diff > noise_floor)
       sum += diff;
 
-    f1j += stride0x2;
-    f2j += stride1x2;
+    f1j += stride0x2 * decimation;
+    f2j += stride1x2 * decimation;
+    rows++;
   }
 
-  return sum / ((6.0f / 2.0f) * width * height);        /* 1 + 4 + 1 = 6; field is half height */
+  return sum / (6.0f * rows * width);   /* 1 + 4 + 1 = 6 */
 }
 
 /* vertical [1,-3,4,-3,1] - same as is used in FieldDiff from TIVTC,
@@ -1393,6 +1429,32 @@ opposite_parity_windowed_comb (GstFieldAnalysis * filter,
   return (gfloat) slightly_combed;      /* TRUE means blend, else don't */
 }
 
+/* Post the metric scores of the current frame as an element message so
+ * external cadence classifiers can consume them from the bus. Called with
+ * the object lock held; it is released around the post as a sync bus
+ * handler may call back into the element */
+static void
+gst_field_analysis_post_metrics (GstFieldAnalysis * filter,
+    const FieldAnalysis * results)
+{
+  GstStructure *s;
+
+  if (!filter->post_metrics)
+    return;
+
+  s = gst_structure_new ("fieldanalysis-metrics",
+      "same-frame", G_TYPE_FLOAT, results->f,
+      "top-field", G_TYPE_FLOAT, results->t,
+      "bottom-field", G_TYPE_FLOAT, results->b,
+      "top-bottom", G_TYPE_FLOAT, results->t_b,
+      "bottom-top", G_TYPE_FLOAT, results->b_t, NULL);
+
+  GST_OBJECT_UNLOCK (filter);
+  gst_element_post_message (GST_ELEMENT (filter),
+      gst_message_new_element (GST_OBJECT (filter), s));
+  GST_OBJECT_LOCK (filter);
+}
+
 /* this is where the magic happens
  *
  * the buffer incoming to the chain function (buf_to_queue) is added to the
@@ -1491,6 +1553,8 @@ gst_field_analysis_process_buffer (GstFieldAnalysis * filter,
         "Scores: f %f, t %f, b %f, t_b %f, b_t %f", res0->f,
         res0->t, res0->b, res0->t_b, res0->b_t);
 
+    gst_field_analysis_post_metrics (filter, res0);
+
     /* analysis */
     telecine_matches = 0;
     if (res0->t_b <= filter->frame_thresh)
@@ -135,6 +135,8 @@ struct _GstFieldAnalysis
   guint64 block_width, block_height; /* width/height of window used for comb clusted detection */
   guint64 block_thresh;
   guint64 ignored_lines;
+  guint metric_decimation; /* process every Nth line pair in the same parity metrics */
+  gboolean post_metrics; /* post the per-frame metric scores as element messages */
 };
 
 struct _GstFieldAnalysisClass
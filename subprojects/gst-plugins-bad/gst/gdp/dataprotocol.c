@@ -365,6 +365,56 @@ static const guint16 gst_dp_crc_table[256] = {
   0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0
 };
 
+/* Derived tables for a slice-by-4 CRC update. Table n advances a byte
+ * through n additional zero bytes, so four input bytes can be folded into
+ * the register with four parallel lookups instead of four dependent ones */
+static guint16 gst_dp_crc_table1[256];
+static guint16 gst_dp_crc_table2[256];
+static guint16 gst_dp_crc_table3[256];
+
+static void
+gst_dp_crc_init_tables (void)
+{
+  static gsize init_done = 0;
+
+  if (g_once_init_enter (&init_done)) {
+    guint i;
+
+    for (i = 0; i < 256; i++) {
+      gst_dp_crc_table1[i] = (guint16) (gst_dp_crc_table[i] << 8) ^
+          gst_dp_crc_table[gst_dp_crc_table[i] >> 8];
+      gst_dp_crc_table2[i] = (guint16) (gst_dp_crc_table1[i] << 8) ^
+          gst_dp_crc_table[gst_dp_crc_table1[i] >> 8];
+      gst_dp_crc_table3[i] = (guint16) (gst_dp_crc_table2[i] << 8) ^
+          gst_dp_crc_table[gst_dp_crc_table2[i] >> 8];
+    }
+    g_once_init_leave (&init_done, 1);
+  }
+}
+
+/* updates the crc register over the given bytes; does not finalize */
+static guint16
+gst_dp_crc_update (guint16 crc_register, const guint8 * buffer, gsize length)
+{
+  gst_dp_crc_init_tables ();
+
+  while (length >= 4) {
+    crc_register =
+        gst_dp_crc_table3[((crc_register >> 8) & 0x00ff) ^ buffer[0]] ^
+        gst_dp_crc_table2[(crc_register & 0x00ff) ^ buffer[1]] ^
+        gst_dp_crc_table1[buffer[2]] ^ gst_dp_crc_table[buffer[3]];
+    buffer += 4;
+    length -= 4;
+  }
+
+  while (length-- > 0) {
+    crc_register = (guint16) ((crc_register << 8) ^
+        gst_dp_crc_table[((crc_register >> 8) & 0x00ff) ^ *buffer++]);
+  }
+
+  return crc_register;
+}
+
 /**
  * gst_dp_crc:
  * @buffer: array of bytes
@@ -379,19 +429,12 @@ static const guint16 gst_dp_crc_table[256] = {
 static guint16
 gst_dp_crc (const guint8 * buffer, guint length)
 {
-  guint16 crc_register = CRC_INIT;
-
   if (length == 0)
     return 0;
 
   g_assert (buffer != NULL);
 
-  /* calc CRC */
-  for (; length--;) {
-    crc_register = (guint16) ((crc_register << 8) ^
-        gst_dp_crc_table[((crc_register >> 8) & 0x00ff) ^ *buffer++]);
-  }
-  return (0xffff ^ crc_register);
+  return (0xffff ^ gst_dp_crc_update (CRC_INIT, buffer, length));
 }
 
 static guint16
@@ -407,15 +450,8 @@ gst_dp_crc_from_memory_maps (const GstMapInfo * maps, guint n_maps)
 
   /* calc CRC */
   while (n_maps > 0) {
-    guint8 *buffer = maps->data;
-    gsize length = maps->size;
-
-    total_length += length;
-
-    while (length-- > 0) {
-      crc_register = (guint16) ((crc_register << 8) ^
-          gst_dp_crc_table[((crc_register >> 8) & 0x00ff) ^ *buffer++]);
-    }
+    crc_register = gst_dp_crc_update (crc_register, maps->data, maps->size);
+    total_length += maps->size;
     --n_maps;
     ++maps;
   }
@@ -508,14 +544,43 @@ gst_dp_buffer_from_header (guint header_length, const guint8 * header,
       gst_buffer_new_allocate (allocator,
       (guint) GST_DP_HEADER_PAYLOAD_LENGTH (header), allocation_params);
 
+  gst_dp_buffer_apply_header (header_length, header, buffer);
+
+  return buffer;
+}
+
+/**
+ * gst_dp_buffer_apply_header:
+ * @header_length: the length of the packet header
+ * @header: the byte array of the packet header
+ * @buffer: the #GstBuffer to set the properties on
+ *
+ * Sets the buffer properties (timestamps, offsets and flags) described by
+ * @header on the given @buffer.
+ *
+ * Use this function if you already have a buffer holding the packet
+ * payload, e.g. one taken out of an adapter, and only need the properties
+ * applied to it.
+ *
+ * This function does not check the header passed to it, use
+ * gst_dp_validate_header() first if the header data is unchecked.
+ */
+void
+gst_dp_buffer_apply_header (guint header_length, const guint8 * header,
+    GstBuffer * buffer)
+{
+  g_return_if_fail (header != NULL);
+  g_return_if_fail (header_length >= GST_DP_HEADER_LENGTH);
+  g_return_if_fail (GST_IS_BUFFER (buffer));
+  g_return_if_fail (GST_DP_HEADER_PAYLOAD_TYPE (header) ==
+      GST_DP_PAYLOAD_BUFFER);
+
   GST_BUFFER_TIMESTAMP (buffer) = GST_DP_HEADER_TIMESTAMP (header);
   GST_BUFFER_DTS (buffer) = GST_DP_HEADER_DTS (header);
   GST_BUFFER_DURATION (buffer) = GST_DP_HEADER_DURATION (header);
   GST_BUFFER_OFFSET (buffer) = GST_DP_HEADER_OFFSET (header);
   GST_BUFFER_OFFSET_END (buffer) = GST_DP_HEADER_OFFSET_END (header);
   GST_BUFFER_FLAGS (buffer) = GST_DP_HEADER_BUFFER_FLAGS (header);
-
-  return buffer;
 }
 
 /**
@@ -81,6 +81,9 @@ GstBuffer *     gst_dp_buffer_from_header       (guint header_length,
                                                 const guint8 * header,
                                                 GstAllocator * allocator,
                                                 GstAllocationParams * allocation_params);
+void            gst_dp_buffer_apply_header      (guint header_length,
+                                                const guint8 * header,
+                                                GstBuffer * buffer);
 GstCaps *       gst_dp_caps_from_packet         (guint header_length,
                                                 const guint8 * header,
                                                 const guint8 * payload);
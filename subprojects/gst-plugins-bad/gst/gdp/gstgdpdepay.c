@@ -365,21 +365,30 @@ gst_gdp_depay_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
           goto no_caps;
 
         GST_LOG_OBJECT (this, "reading GDP buffer from adapter");
-        buf =
-            gst_dp_buffer_from_header (GST_DP_HEADER_LENGTH, this->header,
-            this->allocator, &this->allocation_params);
-        if (!buf)
-          goto buffer_failed;
-
-        /* now take the payload if there is any */
-        if (this->payload_length > 0) {
-          GstMapInfo map;
-
-          gst_buffer_map (buf, &map, GST_MAP_WRITE);
-          gst_adapter_copy (this->adapter, map.data, 0, this->payload_length);
-          gst_buffer_unmap (buf, &map);
-
-          gst_adapter_flush (this->adapter, this->payload_length);
+        if (this->allocator == NULL && this->payload_length > 0) {
+          /* downstream didn't request a specific allocator, so the payload
+           * can be taken out of the adapter directly, sharing the incoming
+           * memory instead of allocating and copying */
+          buf = gst_adapter_take_buffer_fast (this->adapter,
+              this->payload_length);
+          gst_dp_buffer_apply_header (GST_DP_HEADER_LENGTH, this->header, buf);
+        } else {
+          buf =
+              gst_dp_buffer_from_header (GST_DP_HEADER_LENGTH, this->header,
+              this->allocator, &this->allocation_params);
+          if (!buf)
+            goto buffer_failed;
+
+          /* now take the payload if there is any */
+          if (this->payload_length > 0) {
+            GstMapInfo map;
+
+            gst_buffer_map (buf, &map, GST_MAP_WRITE);
+            gst_adapter_copy (this->adapter, map.data, 0, this->payload_length);
+            gst_buffer_unmap (buf, &map);
+
+            gst_adapter_flush (this->adapter, this->payload_length);
+          }
         }
 
         if (GST_BUFFER_TIMESTAMP (buf) > -this->ts_offset)
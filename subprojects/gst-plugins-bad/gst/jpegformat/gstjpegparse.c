@@ -63,6 +63,7 @@
 #include <gst/video/video.h>
 
 #include "gstjpegparse.h"
+#include "gstjpegrestartmeta.h"
 
 enum ParserState
 {
@@ -590,6 +591,9 @@ gst_jpeg_parse_reset (GstJpegParse * parse)
   parse->adobe_transform = 0;
   parse->x_density = 0;
   parse->y_density = 0;
+  parse->restart_interval = 0;
+  if (parse->rst_offsets)
+    g_array_set_size (parse->rst_offsets, 0);
 
   if (parse->tags) {
     gst_tag_list_unref (parse->tags);
@@ -743,15 +747,36 @@ gst_jpeg_parse_handle_frame (GstBaseParse * bparse, GstBaseParseFrame * frame,
               GST_TAG_MERGE_REPLACE);
         }
 
+        /* Expose the restart-marker layout so decoders can decode the
+         * entropy-coded segments in parallel */
+        if (parse->restart_interval > 0 && parse->rst_offsets->len > 0) {
+          gst_buffer_add_jpeg_restart_meta (frame->buffer,
+              parse->restart_interval,
+              (const gsize *) parse->rst_offsets->data,
+              parse->rst_offsets->len);
+        }
+
         ret = gst_jpeg_parse_push_frame (parse, frame, seg.offset);
         gst_jpeg_parse_reset (parse);
 
         return ret;
       }
-      case GST_JPEG_MARKER_SOS:
+      case GST_JPEG_MARKER_SOS:{
+        gsize scan_start = offset;
+
         if (!valid_state (parse->state, GST_JPEG_PARSER_STATE_GOT_SOF))
           GST_WARNING_OBJECT (parse, "SOS marker without SOF one");
         parse->state |= GST_JPEG_PARSER_STATE_GOT_SOS;
+        /* the entropy-coded data starts right after the SOS header */
+        g_array_append_val (parse->rst_offsets, scan_start);
+        break;
+      }
+      case GST_JPEG_MARKER_DRI:
+        if (!gst_jpeg_segment_parse_restart_interval (&seg,
+                &parse->restart_interval)) {
+          GST_ELEMENT_WARNING (parse, STREAM, FORMAT,
+              ("Failed to parse dri segment"), (NULL));
+        }
         break;
       case GST_JPEG_MARKER_COM:
         if (!gst_jpeg_parse_com (parse, &seg)) {
@@ -782,6 +807,14 @@ gst_jpeg_parse_handle_frame (GstBaseParse * bparse, GstBaseParseFrame * frame,
         /* to avoid break the below SOF interval */
         break;
       default:
+        /* restart markers delimit independently decodable segments */
+        if (marker >= GST_JPEG_MARKER_RST_MIN &&
+            marker <= GST_JPEG_MARKER_RST_MAX) {
+          gsize rst_start = offset;
+
+          g_array_append_val (parse->rst_offsets, rst_start);
+          break;
+        }
         /* SOFn segments */
         if (marker >= GST_JPEG_MARKER_SOF_MIN &&
             marker <= GST_JPEG_MARKER_SOF_MAX) {
@@ -833,6 +866,7 @@ gst_jpeg_parse_start (GstBaseParse * bparse)
 
   parse->framerate_numerator = 0;
   parse->framerate_denominator = 1;
+  parse->rst_offsets = g_array_new (FALSE, FALSE, sizeof (gsize));
 
   gst_jpeg_parse_reset (parse);
 
@@ -852,5 +886,10 @@ gst_jpeg_parse_stop (GstBaseParse * bparse)
   }
   gst_clear_caps (&parse->prev_caps);
 
+  if (parse->rst_offsets) {
+    g_array_unref (parse->rst_offsets);
+    parse->rst_offsets = NULL;
+  }
+
   return TRUE;
 }
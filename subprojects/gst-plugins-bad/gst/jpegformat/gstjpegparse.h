@@ -69,6 +69,10 @@ struct _GstJpegParse {
 
   /* tags */
   GstTagList *tags;
+
+  /* restart-marker layout of the current frame */
+  guint restart_interval;
+  GArray *rst_offsets;
 };
 
 struct _GstJpegParseClass {
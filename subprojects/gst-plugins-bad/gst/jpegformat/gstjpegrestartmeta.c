@@ -0,0 +1,152 @@
+/* GStreamer
+ *
+ * jpegrestartmeta: restart-marker layout meta for JPEG images
+ *
+ * Copyright (C) <2009> Arnout Vandecappelle (Essensium/Mind) <arnout@mind.be>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+
+#include "gstjpegrestartmeta.h"
+
+GType
+gst_jpeg_restart_meta_api_get_type (void)
+{
+  static GType type = 0;
+  static const gchar *tags[] = { NULL };
+
+  if (g_once_init_enter (&type)) {
+    GType _type = gst_meta_api_type_register ("GstJpegRestartMetaAPI", tags);
+    g_once_init_leave (&type, _type);
+  }
+
+  return type;
+}
+
+static gboolean
+gst_jpeg_restart_meta_init (GstMeta * meta, gpointer params,
+    GstBuffer * buffer)
+{
+  GstJpegRestartMeta *rmeta = (GstJpegRestartMeta *) meta;
+
+  rmeta->restart_interval = 0;
+  rmeta->num_segments = 0;
+  rmeta->segment_offsets = NULL;
+
+  return TRUE;
+}
+
+static void
+gst_jpeg_restart_meta_free (GstMeta * meta, GstBuffer * buffer)
+{
+  GstJpegRestartMeta *rmeta = (GstJpegRestartMeta *) meta;
+
+  g_free (rmeta->segment_offsets);
+}
+
+static gboolean
+gst_jpeg_restart_meta_transform (GstBuffer * dest, GstMeta * meta,
+    GstBuffer * buffer, GQuark type, gpointer data)
+{
+  GstJpegRestartMeta *smeta = (GstJpegRestartMeta *) meta;
+
+  if (GST_META_TRANSFORM_IS_COPY (type)) {
+    GstMetaTransformCopy *copy = data;
+
+    /* The offsets are relative to the start of the buffer, so they only
+     * stay valid if the copied region starts there too */
+    if (copy->region && copy->offset != 0)
+      return FALSE;
+
+    return gst_buffer_add_jpeg_restart_meta (dest, smeta->restart_interval,
+        smeta->segment_offsets, smeta->num_segments) != NULL;
+  }
+
+  return FALSE;
+}
+
+const GstMetaInfo *
+gst_jpeg_restart_meta_get_info (void)
+{
+  static const GstMetaInfo *meta_info = NULL;
+
+  if (g_once_init_enter ((GstMetaInfo **) & meta_info)) {
+    const GstMetaInfo *mi = gst_meta_register (GST_JPEG_RESTART_META_API_TYPE,
+        "GstJpegRestartMeta", sizeof (GstJpegRestartMeta),
+        gst_jpeg_restart_meta_init, gst_jpeg_restart_meta_free,
+        gst_jpeg_restart_meta_transform);
+    g_once_init_leave ((GstMetaInfo **) & meta_info, (GstMetaInfo *) mi);
+  }
+
+  return meta_info;
+}
+
+/**
+ * gst_buffer_add_jpeg_restart_meta:
+ * @buffer: a #GstBuffer holding one JPEG image
+ * @restart_interval: number of MCUs per restart interval
+ * @segment_offsets: (array length=num_segments): byte offsets of the
+ *   entropy-coded segments, relative to the start of @buffer
+ * @num_segments: number of offsets in @segment_offsets
+ *
+ * Attaches a #GstJpegRestartMeta to @buffer describing the layout of its
+ * entropy-coded segments. The offsets are copied.
+ *
+ * Returns: (transfer none): the added #GstJpegRestartMeta
+ *
+ * Since: 1.24
+ */
+GstJpegRestartMeta *
+gst_buffer_add_jpeg_restart_meta (GstBuffer * buffer, guint restart_interval,
+    const gsize * segment_offsets, guint num_segments)
+{
+  GstJpegRestartMeta *meta;
+
+  g_return_val_if_fail (GST_IS_BUFFER (buffer), NULL);
+  g_return_val_if_fail (segment_offsets != NULL || num_segments == 0, NULL);
+
+  meta = (GstJpegRestartMeta *) gst_buffer_add_meta (buffer,
+      GST_JPEG_RESTART_META_INFO, NULL);
+
+  meta->restart_interval = restart_interval;
+  meta->num_segments = num_segments;
+  meta->segment_offsets =
+      g_memdup2 (segment_offsets, num_segments * sizeof (gsize));
+
+  return meta;
+}
+
+/**
+ * gst_buffer_get_jpeg_restart_meta:
+ * @buffer: a #GstBuffer
+ *
+ * Returns: (transfer none) (nullable): the #GstJpegRestartMeta attached to
+ * @buffer, or %NULL if there is none
+ *
+ * Since: 1.24
+ */
+GstJpegRestartMeta *
+gst_buffer_get_jpeg_restart_meta (GstBuffer * buffer)
+{
+  return (GstJpegRestartMeta *) gst_buffer_get_meta (buffer,
+      GST_JPEG_RESTART_META_API_TYPE);
+}
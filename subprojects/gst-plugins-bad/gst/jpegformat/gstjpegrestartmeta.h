@@ -0,0 +1,75 @@
+/* GStreamer
+ *
+ * jpegrestartmeta: restart-marker layout meta for JPEG images
+ *
+ * Copyright (C) <2009> Arnout Vandecappelle (Essensium/Mind) <arnout@mind.be>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_JPEG_RESTART_META_H__
+#define __GST_JPEG_RESTART_META_H__
+
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+#define GST_JPEG_RESTART_META_API_TYPE (gst_jpeg_restart_meta_api_get_type())
+#define GST_JPEG_RESTART_META_INFO (gst_jpeg_restart_meta_get_info())
+
+typedef struct _GstJpegRestartMeta GstJpegRestartMeta;
+
+/**
+ * GstJpegRestartMeta:
+ * @meta: parent #GstMeta
+ * @restart_interval: number of MCUs per restart interval (Ri from the DRI
+ *   segment)
+ * @num_segments: number of entropy-coded segments in the scan
+ * @segment_offsets: array of @num_segments byte offsets from the start of
+ *   the buffer to the first entropy-coded byte of each segment (the scan
+ *   data after the SOS header, then the byte following each RSTn marker)
+ *
+ * Describes where the independently decodable entropy-coded segments of a
+ * baseline JPEG image start, so a decoder can hand each restart interval to
+ * a separate thread instead of decoding the whole scan sequentially.
+ *
+ * The offsets are only valid for the buffer the meta is attached to; the
+ * meta is therefore dropped on transforms that do not preserve the start of
+ * the buffer.
+ *
+ * Since: 1.24
+ */
+struct _GstJpegRestartMeta
+{
+  GstMeta meta;
+
+  guint restart_interval;
+  guint num_segments;
+  gsize *segment_offsets;
+};
+
+GType gst_jpeg_restart_meta_api_get_type (void);
+
+const GstMetaInfo *gst_jpeg_restart_meta_get_info (void);
+
+GstJpegRestartMeta *gst_buffer_add_jpeg_restart_meta (GstBuffer * buffer,
+    guint restart_interval, const gsize * segment_offsets, guint num_segments);
+
+GstJpegRestartMeta *gst_buffer_get_jpeg_restart_meta (GstBuffer * buffer);
+
+G_END_DECLS
+
+#endif /* __GST_JPEG_RESTART_META_H__ */
@@ -307,6 +307,7 @@ gst_ps_demux_init (GstPsDemux * demux)
   demux->adapter = gst_adapter_new ();
   demux->rev_adapter = gst_adapter_new ();
   demux->flowcombiner = gst_flow_combiner_new ();
+  demux->scr_index = g_array_new (FALSE, FALSE, sizeof (GstPsDemuxScrEntry));
 
   gst_ps_demux_reset (demux);
 
@@ -323,6 +324,7 @@ gst_ps_demux_finalize (GstPsDemux * demux)
   gst_flow_combiner_free (demux->flowcombiner);
   g_object_unref (demux->adapter);
   g_object_unref (demux->rev_adapter);
+  g_array_free (demux->scr_index, TRUE);
 
   G_OBJECT_CLASS (parent_class)->finalize (G_OBJECT (demux));
 }
@@ -386,6 +388,7 @@ gst_ps_demux_reset (GstPsDemux * demux)
 
   gst_adapter_clear (demux->adapter);
   gst_adapter_clear (demux->rev_adapter);
+  g_array_set_size (demux->scr_index, 0);
 
   demux->adapter_offset = G_MAXUINT64;
   demux->first_scr = G_MAXUINT64;
@@ -1201,6 +1204,88 @@ not_supported:
 
 #define MAX_RECURSION_COUNT 100
 
+#define SCR_INDEX_MAX_ENTRIES 4096
+
+/* Returns the position of the first index entry with an SCR >= @scr */
+static guint
+gst_ps_demux_scr_index_search (GstPsDemux * demux, guint64 scr)
+{
+  GArray *index = demux->scr_index;
+  guint l = 0, r = index->len;
+
+  while (l < r) {
+    guint mid = l + (r - l) / 2;
+
+    if (g_array_index (index, GstPsDemuxScrEntry, mid).scr < scr)
+      l = mid + 1;
+    else
+      r = mid;
+  }
+
+  return l;
+}
+
+/* Remember an SCR found at @offset while scanning, so later seeks around
+ * the same position can start from a much tighter search bracket */
+static void
+gst_ps_demux_scr_index_add (GstPsDemux * demux, guint64 scr, guint64 offset)
+{
+  GArray *index = demux->scr_index;
+  GstPsDemuxScrEntry entry;
+  guint pos;
+
+  if (scr == G_MAXUINT64 || index->len >= SCR_INDEX_MAX_ENTRIES)
+    return;
+
+  pos = gst_ps_demux_scr_index_search (demux, scr);
+
+  if (pos < index->len &&
+      g_array_index (index, GstPsDemuxScrEntry, pos).scr == scr)
+    return;
+
+  /* Only keep entries whose offsets are ordered like their SCRs, so a
+   * stream with SCR discontinuities can't poison the bracket lookup */
+  if (pos > 0 &&
+      g_array_index (index, GstPsDemuxScrEntry, pos - 1).offset >= offset)
+    return;
+  if (pos < index->len &&
+      g_array_index (index, GstPsDemuxScrEntry, pos).offset <= offset)
+    return;
+
+  entry.scr = scr;
+  entry.offset = offset;
+  g_array_insert_val (index, pos, entry);
+}
+
+/* Tighten the search bracket around @scr with previously indexed entries */
+static void
+gst_ps_demux_scr_index_bracket (GstPsDemux * demux, guint64 scr,
+    guint64 * min_scr, guint64 * min_scr_offset,
+    guint64 * max_scr, guint64 * max_scr_offset)
+{
+  GArray *index = demux->scr_index;
+  GstPsDemuxScrEntry *entry;
+  guint pos;
+
+  pos = gst_ps_demux_scr_index_search (demux, scr);
+
+  if (pos > 0) {
+    entry = &g_array_index (index, GstPsDemuxScrEntry, pos - 1);
+    if (entry->scr > *min_scr) {
+      *min_scr = entry->scr;
+      *min_scr_offset = entry->offset;
+    }
+  }
+
+  if (pos < index->len) {
+    entry = &g_array_index (index, GstPsDemuxScrEntry, pos);
+    if (entry->scr < *max_scr) {
+      *max_scr = entry->scr;
+      *max_scr_offset = entry->offset;
+    }
+  }
+}
+
 /* Binary search for requested SCR */
 static inline guint64
 find_offset (GstPsDemux * demux, guint64 scr,
@@ -1211,6 +1296,7 @@ find_offset (GstPsDemux * demux, guint64 scr,
   guint64 scr_rate_d = max_scr - min_scr;
   guint64 fscr = scr;
   guint64 offset;
+  gboolean found;
 
   if (recursion_count > MAX_RECURSION_COUNT) {
     return -1;
@@ -1220,9 +1306,12 @@ find_offset (GstPsDemux * demux, guint64 scr,
       MIN (gst_util_uint64_scale (scr - min_scr, scr_rate_n,
           scr_rate_d), demux->sink_segment.stop);
 
-  if (!gst_ps_demux_scan_forward_ts (demux, &offset, SCAN_SCR, &fscr, 0)) {
-    gst_ps_demux_scan_backward_ts (demux, &offset, SCAN_SCR, &fscr, 0);
-  }
+  found = gst_ps_demux_scan_forward_ts (demux, &offset, SCAN_SCR, &fscr, 0);
+  if (!found)
+    found = gst_ps_demux_scan_backward_ts (demux, &offset, SCAN_SCR, &fscr, 0);
+
+  if (found)
+    gst_ps_demux_scr_index_add (demux, fscr, offset);
 
   if (fscr == scr || fscr == min_scr || fscr == max_scr) {
     return offset;
@@ -1242,6 +1331,7 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
 {
   gboolean found;
   guint64 fscr, offset;
+  guint64 min_scr, min_scr_offset, max_scr, max_scr_offset;
   guint64 scr = GSTTIME_TO_MPEGTIME (seeksegment->position + demux->base_time);
 
   /* In some clips the PTS values are completely unaligned with SCR values.
@@ -1257,9 +1347,17 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
   GST_INFO_OBJECT (demux, "sink segment configured %" GST_SEGMENT_FORMAT
       ", trying to go at SCR: %" G_GUINT64_FORMAT, &demux->sink_segment, scr);
 
+  /* Start from the tightest bracket previous seeks have discovered */
+  min_scr = demux->first_scr;
+  min_scr_offset = demux->first_scr_offset;
+  max_scr = demux->last_scr;
+  max_scr_offset = demux->last_scr_offset;
+  gst_ps_demux_scr_index_bracket (demux, scr, &min_scr, &min_scr_offset,
+      &max_scr, &max_scr_offset);
+
   offset =
-      find_offset (demux, scr, demux->first_scr, demux->first_scr_offset,
-      demux->last_scr, demux->last_scr_offset, 0);
+      find_offset (demux, scr, min_scr, min_scr_offset,
+      max_scr, max_scr_offset, 0);
 
   if (offset == (guint64) - 1) {
     return FALSE;
@@ -1279,6 +1377,9 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
     found = gst_ps_demux_scan_backward_ts (demux, &offset, SCAN_SCR, &fscr, 0);
   }
 
+  if (found)
+    gst_ps_demux_scr_index_add (demux, fscr, offset);
+
   GST_INFO_OBJECT (demux, "doing seek at offset %" G_GUINT64_FORMAT
       " SCR: %" G_GUINT64_FORMAT " %" GST_TIME_FORMAT,
       offset, fscr, GST_TIME_ARGS (MPEGTIME_TO_GSTTIME (fscr)));
@@ -84,6 +84,12 @@ typedef enum
   STATE_PS_DEMUX_NEED_MORE_DATA,
 } GstPsDemuxState;
 
+typedef struct
+{
+  guint64 scr;
+  guint64 offset;
+} GstPsDemuxScrEntry;
+
 /* Information associated with a single FluPS stream. */
 struct _GstPsStream
 {
@@ -134,6 +140,11 @@ struct _GstPsDemux
   guint64 last_scr_offset;
   guint64 cur_scr_offset;
 
+  /* SCR/offset pairs discovered while scanning, sorted by SCR. They are
+   * used to narrow the binary search bracket of later seeks, so scrubbing
+   * doesn't rescan the whole file on every seek */
+  GArray *scr_index;
+
   guint64 first_pts;
   guint64 last_pts;
 
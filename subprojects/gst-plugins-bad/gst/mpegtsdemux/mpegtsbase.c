@@ -285,6 +285,7 @@ mpegts_base_reset (MpegTSBase * base)
   g_ptr_array_remove_range (base->programs, 0, base->programs->len);
   g_hash_table_remove_all (base->ecms);
   g_hash_table_remove_all (base->stream_map);
+  base->dm2_last_stream = NULL;
 
   base->streams_aware = GST_OBJECT_PARENT (base)
       && GST_OBJECT_FLAG_IS_SET (GST_OBJECT_PARENT (base),
@@ -761,6 +762,7 @@ mpegts_base_program_add_stream (MpegTSBase * base,
   program->streams[pid] = bstream;
   program->stream_list = g_list_append (program->stream_list, bstream);
   g_hash_table_insert (base->stream_map, GUINT_TO_POINTER (pid), bstream);
+  base->dm2_last_stream = NULL;
 
   if (klass->stream_added)
     if (klass->stream_added (base, bstream, program)) {
@@ -1129,6 +1131,7 @@ mpegts_base_deactivate_program (MpegTSBase * base, MpegTSBaseProgram * program)
           MPEGTS_BIT_UNSET (base->is_pes, stream->pid);
         }
         g_hash_table_remove (base->stream_map, GUINT_TO_POINTER (stream->pid));
+        base->dm2_last_stream = NULL;
       }
     }
 
@@ -1724,15 +1727,21 @@ mpegts_base_packet_scrambled (MpegTSBase * base,
 {
 #ifdef CONFIG_DEMULTI2
   MpegTSBaseStream *stream;
-  guint16 len;
+  guint16 hdr_len, len;
   int ret;
-  static guint8 buf[MPEGTS_MAX_PACKETSIZE];
+  guint8 *buf = base->dm2_buf;
 
-  stream =
-      g_hash_table_lookup (base->stream_map, GUINT_TO_POINTER (packet->pid));
-  if (stream == NULL) {
-    GST_LOG ("PMT not ready yet for pid:0x%04hx.", packet->pid);
-    return;
+  if (base->dm2_last_stream && base->dm2_last_pid == packet->pid) {
+    stream = base->dm2_last_stream;
+  } else {
+    stream =
+        g_hash_table_lookup (base->stream_map, GUINT_TO_POINTER (packet->pid));
+    if (stream == NULL) {
+      GST_LOG ("PMT not ready yet for pid:0x%04hx.", packet->pid);
+      return;
+    }
+    base->dm2_last_stream = stream;
+    base->dm2_last_pid = packet->pid;
   }
 
   if (stream->ecm_pid >= 0x1FFF) {
@@ -1740,19 +1749,25 @@ mpegts_base_packet_scrambled (MpegTSBase * base,
     return;
   }
 
-  memcpy (buf, packet->data_start, packet->data_end - packet->data_start);
-  packet->payload = buf + (packet->payload - packet->data_start);
-  packet->data = buf + (packet->data - packet->data_start);
-  packet->data_end = buf + (packet->data_end - packet->data_start);
-  packet->data_start = buf;
+  if (packet->payload == NULL)
+    return;
+
+  /* only the header and adaptation field need copying; the payload gets
+   * descrambled straight from the adapter data into the writable copy */
+  hdr_len = packet->payload - packet->data_start;
   len = packet->data_end - packet->payload;
+  memcpy (buf, packet->data_start, hdr_len);
 
   ret = demulti2_descramble (base->dm2_handle, packet->payload, len,
-      packet->scram_afc_cc, stream->ecm_pid, NULL);
+      packet->scram_afc_cc, stream->ecm_pid, buf + hdr_len);
   if (ret > 0) {
     GST_LOG ("Failed to descramble pid:0x%04hx. ret:%d.", packet->pid, ret);
     return;
   }
+  packet->data = buf + (packet->data - packet->data_start);
+  packet->payload = buf + hdr_len;
+  packet->data_end = buf + hdr_len + len;
+  packet->data_start = buf;
   buf[3] &= 0x3F;
   packet->scram_afc_cc = buf[3];
 #endif /* CONFIG_DEMULTI2 */
@@ -180,6 +180,12 @@ struct _MpegTSBase {
   /* Whether to descramble packets (ISDB only) */
   gboolean descramble;
   gpointer dm2_handle;
+  /* landing buffer for a descrambled packet; the packet points into it
+   * until the next one is processed, so it has to outlive the caller */
+  guint8 dm2_buf[MPEGTS_MAX_PACKETSIZE];
+  /* cache of the last stream_map lookup, packets of one pid come in runs */
+  MpegTSBaseStream *dm2_last_stream;
+  guint16 dm2_last_pid;
 
   /* Whether to push data and/or sections to subclasses */
   gboolean push_data;
@@ -138,17 +138,27 @@ mpegts_packetizer_get_current_time (MpegTSPacketizer2 * packetizer,
 }
 
 static inline MpegTSPacketizerStreamSubtable *
-find_subtable (GSList * subtables, guint8 table_id, guint16 subtable_extension)
+find_subtable (MpegTSPacketizerStream * stream, guint8 table_id,
+    guint16 subtable_extension)
 {
-  GSList *tmp;
+  GSList *tmp, *prev = NULL;
 
-  /* FIXME: Make this an array ! */
-  for (tmp = subtables; tmp; tmp = tmp->next) {
+  /* The sections of one subtable are transmitted back to back, so keep the
+   * list in most-recently-used order and the match is almost always at the
+   * head. ISDB EIT schedule easily accumulates hundreds of subtables on one
+   * pid, which made a plain scan per section noticeably expensive. */
+  for (tmp = stream->subtables; tmp; prev = tmp, tmp = tmp->next) {
     MpegTSPacketizerStreamSubtable *sub =
         (MpegTSPacketizerStreamSubtable *) tmp->data;
     if (sub->table_id == table_id
-        && sub->subtable_extension == subtable_extension)
+        && sub->subtable_extension == subtable_extension) {
+      if (prev) {
+        prev->next = tmp->next;
+        tmp->next = stream->subtables;
+        stream->subtables = tmp;
+      }
       return sub;
+    }
   }
 
   return NULL;
@@ -162,7 +172,7 @@ seen_section_before (MpegTSPacketizerStream * stream, guint8 table_id,
   MpegTSPacketizerStreamSubtable *subtable;
 
   /* Check if we've seen this table_id/subtable_extension first */
-  subtable = find_subtable (stream->subtables, table_id, subtable_extension);
+  subtable = find_subtable (stream, table_id, subtable_extension);
   if (!subtable) {
     GST_DEBUG ("Haven't seen subtable");
     return FALSE;
@@ -515,8 +525,7 @@ mpegts_packetizer_parse_section_header (MpegTSPacketizer2 * packetizer,
   GstMpegtsSection *res;
 
   subtable =
-      find_subtable (stream->subtables, stream->table_id,
-      stream->subtable_extension);
+      find_subtable (stream, stream->table_id, stream->subtable_extension);
   if (subtable) {
     GST_DEBUG ("Found previous subtable_extension:0x%04x",
         stream->subtable_extension);
@@ -765,9 +774,17 @@ mpegts_try_discover_packet_size (MpegTSPacketizer2 * packetizer)
   data = packetizer->map_data + packetizer->map_offset;
 
   for (i = 0; i + 3 * MPEGTS_MAX_PACKETSIZE < size; i++) {
-    /* find a sync byte */
-    if (data[i] != PACKET_SYNC_BYTE)
-      continue;
+    const guint8 *candidate;
+
+    /* find a sync byte; memchr scans a word (or vector register) at a
+     * time instead of byte per byte */
+    candidate = memchr (data + i, PACKET_SYNC_BYTE,
+        size - 3 * MPEGTS_MAX_PACKETSIZE - i);
+    if (candidate == NULL) {
+      i = size - 3 * MPEGTS_MAX_PACKETSIZE;
+      break;
+    }
+    i = candidate - data;
 
     /* check for 4 consecutive sync bytes with each possible packet size */
     for (j = 0; j < G_N_ELEMENTS (psizes); j++) {
@@ -823,8 +840,18 @@ mpegts_packetizer_sync (MpegTSPacketizer2 * packetizer)
     sync_offset = 0;
 
   for (i = sync_offset; i + 2 * packet_size < size; i++) {
-    if (data[i] == PACKET_SYNC_BYTE &&
-        data[i + packet_size] == PACKET_SYNC_BYTE &&
+    const guint8 *candidate;
+
+    /* jump to the next sync byte candidate with memchr and only do the
+     * stride checks there */
+    candidate = memchr (data + i, PACKET_SYNC_BYTE, size - 2 * packet_size - i);
+    if (candidate == NULL) {
+      i = size - 2 * packet_size;
+      break;
+    }
+    i = candidate - data;
+
+    if (data[i + packet_size] == PACKET_SYNC_BYTE &&
         data[i + 2 * packet_size] == PACKET_SYNC_BYTE) {
       found = TRUE;
       break;
@@ -2348,6 +2348,11 @@ gst_base_ts_mux_dispose (GObject * object)
     g_object_unref (mux->out_adapter);
     mux->out_adapter = NULL;
   }
+  if (mux->packet_pool) {
+    gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+    gst_object_unref (mux->packet_pool);
+    mux->packet_pool = NULL;
+  }
   if (mux->prog_map) {
     gst_structure_free (mux->prog_map);
     mux->prog_map = NULL;
@@ -2514,11 +2519,30 @@ static void
 gst_base_ts_mux_default_allocate_packet (GstBaseTsMux * mux,
     GstBuffer ** buffer)
 {
-  GstBuffer *buf;
+  /* Packets are produced in large numbers and released again as soon as
+   * downstream is done with them, so recycle them through a pool instead
+   * of hitting the allocator for every 188 bytes */
+  if (G_UNLIKELY (mux->packet_pool == NULL
+          || mux->packet_pool_size != mux->packet_size)) {
+    GstStructure *config;
+
+    if (mux->packet_pool) {
+      gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+      gst_object_unref (mux->packet_pool);
+    }
 
-  buf = gst_buffer_new_and_alloc (mux->packet_size);
+    mux->packet_pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (mux->packet_pool);
+    gst_buffer_pool_config_set_params (config, NULL, mux->packet_size, 0, 0);
+    gst_buffer_pool_set_config (mux->packet_pool, config);
+    gst_buffer_pool_set_active (mux->packet_pool, TRUE);
+    mux->packet_pool_size = mux->packet_size;
+  }
 
-  *buffer = buf;
+  *buffer = NULL;
+  if (gst_buffer_pool_acquire_buffer (mux->packet_pool, buffer,
+          NULL) != GST_FLOW_OK)
+    *buffer = gst_buffer_new_and_alloc (mux->packet_size);
 }
 
 static gboolean
@@ -179,6 +179,10 @@ struct GstBaseTsMux {
   gsize packet_size;
   gsize automatic_alignment;
 
+  /* pool the 188 (or 192/204/208) byte output packets come from */
+  GstBufferPool *packet_pool;
+  gsize packet_pool_size;
+
   /* output buffer aggregation */
   GstAdapter *out_adapter;
   GstBuffer *out_buffer;
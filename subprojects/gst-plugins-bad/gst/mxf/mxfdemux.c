@@ -619,18 +619,17 @@ gst_mxf_demux_resolve_references (GstMXFDemux * demux)
     m->resolved = MXF_METADATA_BASE_RESOLVE_STATE_NONE;
   }
 
-  g_hash_table_iter_init (&iter, demux->metadata);
-  while (g_hash_table_iter_next (&iter, NULL, (gpointer) & m)) {
-    gboolean resolved;
-
-    resolved = mxf_metadata_base_resolve (m, demux->metadata);
-
-    /* Resolving can fail for anything but the preface, as the preface
-     * will resolve everything required */
-    if (!resolved && MXF_IS_METADATA_PREFACE (m)) {
-      ret = GST_FLOW_ERROR;
-      goto error;
-    }
+  /* The preface resolves everything required, recursively pulling in all
+   * the sets that are reachable from it (packages, tracks, descriptors,
+   * ...). Sets that are not referenced from the preface are left
+   * unresolved: eagerly resolving them could take seconds on files with
+   * lots of dark or descriptive metadata, and their resolution was
+   * allowed to fail anyway. */
+  if (!demux->preface
+      || !mxf_metadata_base_resolve (MXF_METADATA_BASE (demux->preface),
+          demux->metadata)) {
+    ret = GST_FLOW_ERROR;
+    goto error;
   }
 
   demux->metadata_resolved = TRUE;
@@ -56,6 +56,7 @@ distribution_get_type (void)
 enum
 {
   PROP_0,
+  PROP_SEED,
   PROP_MIN_DELAY,
   PROP_MAX_DELAY,
   PROP_DELAY_DISTRIBUTION,
@@ -69,6 +70,7 @@ enum
 };
 
 /* these numbers are nothing but wild guesses and don't reflect any reality */
+#define DEFAULT_SEED 0
 #define DEFAULT_MIN_DELAY 200
 #define DEFAULT_MAX_DELAY 400
 #define DEFAULT_DELAY_DISTRIBUTION DISTRIBUTION_UNIFORM
@@ -100,8 +102,7 @@ static gboolean
 gst_net_sim_source_dispatch (GSource * source,
     GSourceFunc callback, gpointer user_data)
 {
-  callback (user_data);
-  return FALSE;
+  return callback (user_data);
 }
 
 GSourceFuncs gst_net_sim_source_funcs = {
@@ -161,6 +162,15 @@ gst_net_sim_src_activatemode (GstPad * pad, GstObject * parent,
     if (netsim->main_loop == NULL) {
       GMainContext *main_context = g_main_context_new ();
       netsim->main_loop = g_main_loop_new (main_context, FALSE);
+
+      /* One persistent source drains the whole delay queue; its ready time
+       * always tracks the head of the queue (-1 when the queue is empty) */
+      netsim->delay_source =
+          g_source_new (&gst_net_sim_source_funcs, sizeof (GSource));
+      g_source_set_ready_time (netsim->delay_source, -1);
+      g_source_set_callback (netsim->delay_source, gst_net_sim_push_delayed,
+          netsim, NULL);
+      g_source_attach (netsim->delay_source, main_context);
       g_main_context_unref (main_context);
 
       GST_TRACE_OBJECT (netsim, "ACT: Starting task on srcpad");
@@ -192,6 +202,12 @@ gst_net_sim_src_activatemode (GstPad * pad, GstObject * parent,
       g_main_loop_unref (netsim->main_loop);
       netsim->main_loop = NULL;
 
+      /* drop packets that were still waiting for their release time */
+      g_source_destroy (netsim->delay_source);
+      g_clear_pointer (&netsim->delay_source, g_source_unref);
+      g_sequence_remove_range (g_sequence_get_begin_iter (netsim->delay_queue),
+          g_sequence_get_end_iter (netsim->delay_queue));
+
       GST_TRACE_OBJECT (netsim, "DEACT: Wait for mainloop and task to pause");
       g_assert (netsim->running);
       while (netsim->running)
@@ -209,16 +225,16 @@ gst_net_sim_src_activatemode (GstPad * pad, GstObject * parent,
 
 typedef struct
 {
-  GstPad *pad;
   GstBuffer *buf;
+  gint64 ready_time;
 } PushBufferCtx;
 
 static inline PushBufferCtx *
-push_buffer_ctx_new (GstPad * pad, GstBuffer * buf)
+push_buffer_ctx_new (GstBuffer * buf, gint64 ready_time)
 {
   PushBufferCtx *ctx = g_slice_new (PushBufferCtx);
-  ctx->pad = gst_object_ref (pad);
   ctx->buf = gst_buffer_ref (buf);
+  ctx->ready_time = ready_time;
   return ctx;
 }
 
@@ -227,17 +243,63 @@ push_buffer_ctx_free (PushBufferCtx * ctx)
 {
   if (G_LIKELY (ctx != NULL)) {
     gst_buffer_unref (ctx->buf);
-    gst_object_unref (ctx->pad);
     g_slice_free (PushBufferCtx, ctx);
   }
 }
 
+static gint
+push_buffer_ctx_compare (gconstpointer a, gconstpointer b, gpointer user_data)
+{
+  const PushBufferCtx *ctx_a = a;
+  const PushBufferCtx *ctx_b = b;
+
+  /* never return 0 so that packets with equal release times keep their
+   * arrival order */
+  return ctx_a->ready_time < ctx_b->ready_time ? -1 : 1;
+}
+
+/* Callback of the single persistent source on the delay thread's context:
+ * release every packet that is due, as one buffer list, and re-arm the
+ * source for the next pending packet */
 static gboolean
-push_buffer_ctx_push (PushBufferCtx * ctx)
+gst_net_sim_push_delayed (gpointer user_data)
 {
-  GST_DEBUG_OBJECT (ctx->pad, "Pushing buffer now");
-  gst_pad_push (ctx->pad, gst_buffer_ref (ctx->buf));
-  return FALSE;
+  GstNetSim *netsim = user_data;
+  GstBufferList *list = NULL;
+  gint64 now_time, next_ready_time = -1;
+  GSequenceIter *iter;
+
+  g_mutex_lock (&netsim->loop_mutex);
+  now_time = g_get_monotonic_time ();
+
+  while (!g_sequence_iter_is_end ((iter =
+              g_sequence_get_begin_iter (netsim->delay_queue)))) {
+    PushBufferCtx *ctx = g_sequence_get (iter);
+
+    if (ctx->ready_time > now_time) {
+      next_ready_time = ctx->ready_time;
+      break;
+    }
+
+    if (list == NULL)
+      list = gst_buffer_list_new ();
+    gst_buffer_list_add (list, gst_buffer_ref (ctx->buf));
+    g_sequence_remove (iter);
+  }
+
+  if (netsim->delay_source != NULL)
+    g_source_set_ready_time (netsim->delay_source, next_ready_time);
+  g_mutex_unlock (&netsim->loop_mutex);
+
+  /* push outside of the lock so a blocking downstream doesn't stall the
+   * chain function */
+  if (list != NULL) {
+    GST_DEBUG_OBJECT (netsim, "Pushing %u delayed buffers",
+        gst_buffer_list_length (list));
+    gst_pad_push_list (netsim->srcpad, list);
+  }
+
+  return TRUE;
 }
 
 static gint
@@ -338,8 +400,7 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
       g_rand_double (netsim->rand_seed) < netsim->delay_probability) {
     gint delay;
     PushBufferCtx *ctx;
-    GSource *source;
-    gint64 ready_time, now_time;
+    gint64 ready_time, now_time, cur_ready_time;
 
     switch (netsim->delay_distribution) {
       case DISTRIBUTION_UNIFORM:
@@ -362,9 +423,6 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
     if (delay < 0)
       delay = 0;
 
-    ctx = push_buffer_ctx_new (netsim->srcpad, buf);
-
-    source = g_source_new (&gst_net_sim_source_funcs, sizeof (GSource));
     now_time = g_get_monotonic_time ();
     ready_time = now_time + delay * 1000;
     if (!netsim->allow_reordering && ready_time < netsim->last_ready_time)
@@ -374,11 +432,15 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
     GST_DEBUG_OBJECT (netsim, "Delaying packet by %" G_GINT64_FORMAT "ms",
         (ready_time - now_time) / 1000);
 
-    g_source_set_ready_time (source, ready_time);
-    g_source_set_callback (source, (GSourceFunc) push_buffer_ctx_push,
-        ctx, (GDestroyNotify) push_buffer_ctx_free);
-    g_source_attach (source, g_main_loop_get_context (netsim->main_loop));
-    g_source_unref (source);
+    ctx = push_buffer_ctx_new (buf, ready_time);
+    g_sequence_insert_sorted (netsim->delay_queue, ctx,
+        push_buffer_ctx_compare, NULL);
+
+    /* only wake up the delay thread if this packet is due before whatever
+     * the source is currently armed for (-1 means it's not armed at all) */
+    cur_ready_time = g_source_get_ready_time (netsim->delay_source);
+    if (cur_ready_time == -1 || ready_time < cur_ready_time)
+      g_source_set_ready_time (netsim->delay_source, ready_time);
   } else {
     ret = gst_pad_push (netsim->srcpad, gst_buffer_ref (buf));
   }
@@ -510,6 +572,11 @@ gst_net_sim_set_property (GObject * object,
   GstNetSim *netsim = GST_NET_SIM (object);
 
   switch (prop_id) {
+    case PROP_SEED:
+      netsim->seed = g_value_get_uint (value);
+      if (netsim->seed != 0)
+        g_rand_set_seed (netsim->rand_seed, netsim->seed);
+      break;
     case PROP_MIN_DELAY:
       netsim->min_delay = g_value_get_int (value);
       break;
@@ -555,6 +622,9 @@ gst_net_sim_get_property (GObject * object,
   GstNetSim *netsim = GST_NET_SIM (object);
 
   switch (prop_id) {
+    case PROP_SEED:
+      g_value_set_uint (value, netsim->seed);
+      break;
     case PROP_MIN_DELAY:
       g_value_set_int (value, netsim->min_delay);
       break;
@@ -607,6 +677,8 @@ gst_net_sim_init (GstNetSim * netsim)
   g_cond_init (&netsim->start_cond);
   netsim->rand_seed = g_rand_new ();
   netsim->main_loop = NULL;
+  netsim->delay_queue =
+      g_sequence_new ((GDestroyNotify) push_buffer_ctx_free);
   netsim->prev_time = GST_CLOCK_TIME_NONE;
 
   GST_OBJECT_FLAG_SET (netsim->sinkpad,
@@ -624,6 +696,7 @@ gst_net_sim_finalize (GObject * object)
   GstNetSim *netsim = GST_NET_SIM (object);
 
   g_rand_free (netsim->rand_seed);
+  g_sequence_free (netsim->delay_queue);
   g_mutex_clear (&netsim->loop_mutex);
   g_cond_clear (&netsim->start_cond);
 
@@ -665,6 +738,21 @@ gst_net_sim_class_init (GstNetSimClass * klass)
   gobject_class->set_property = gst_net_sim_set_property;
   gobject_class->get_property = gst_net_sim_get_property;
 
+  /**
+   * GstNetSim:seed:
+   *
+   * Seed for the random number generators driving loss, duplication and
+   * delay, so that a given impairment scenario can be reproduced exactly.
+   * The default of 0 keeps the generators randomly seeded.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_SEED,
+      g_param_spec_uint ("seed", "Seed",
+          "Seed for the random number generators (0 = random seed)",
+          0, G_MAXUINT, DEFAULT_SEED,
+          G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
   g_object_class_install_property (gobject_class, PROP_MIN_DELAY,
       g_param_spec_int ("min-delay", "Minimum delay (ms)",
           "The minimum delay in ms to apply to buffers",
@@ -77,7 +77,14 @@ struct _GstNetSim
   NormalDistributionState delay_state;
   gint64 last_ready_time;
 
+  /* delayed packets sorted by release time, drained in batches by a single
+   * persistent source on the srcpad task's main context. Protected by
+   * loop_mutex. */
+  GSequence *delay_queue;
+  GSource *delay_source;
+
   /* properties */
+  guint seed;
   gint min_delay;
   gint max_delay;
   GstNetSimDistribution delay_distribution;
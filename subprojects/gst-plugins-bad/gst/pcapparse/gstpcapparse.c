@@ -357,6 +357,12 @@ gst_pcap_parse_read_uint32 (GstPcapParse * self, const guint8 * p)
 #define IP_PROTO_UDP      17
 #define IP_PROTO_TCP      6
 
+/* Largest prefix of a packet gst_pcap_parse_scan_frame() ever dereferences:
+ * link header (worst case ethernet + vlan), maximum IPv4 header and maximum
+ * TCP header. Everything beyond that is only used via pointer arithmetic. */
+#define SCAN_MAX_HEADERS_LEN \
+    (ETH_HEADER_LEN + ETH_VLAN_HEADER_LEN + 60 + 60)
+
 
 static gboolean
 gst_pcap_parse_scan_frame (GstPcapParse * self,
@@ -457,6 +463,19 @@ gst_pcap_parse_scan_frame (GstPcapParse * self,
   src_port = GUINT16_FROM_BE (*((guint16 *) (buf_proto + 0)));
   dst_port = GUINT16_FROM_BE (*((guint16 *) (buf_proto + 2)));
 
+  /* filter before bothering with the payload */
+  if (self->src_ip >= 0 && ip_src_addr != self->src_ip)
+    return FALSE;
+
+  if (self->dst_ip >= 0 && ip_dst_addr != self->dst_ip)
+    return FALSE;
+
+  if (self->src_port >= 0 && src_port != self->src_port)
+    return FALSE;
+
+  if (self->dst_port >= 0 && dst_port != self->dst_port)
+    return FALSE;
+
   /* extract some params and data according to protocol */
   if (ip_protocol == IP_PROTO_UDP) {
     len = GUINT16_FROM_BE (*((guint16 *) (buf_proto + 4)));
@@ -477,19 +496,6 @@ gst_pcap_parse_scan_frame (GstPcapParse * self,
     *payload_size = ip_packet_len - ip_header_size - len;
   }
 
-  /* but still filter as configured */
-  if (self->src_ip >= 0 && ip_src_addr != self->src_ip)
-    return FALSE;
-
-  if (self->dst_ip >= 0 && ip_dst_addr != self->dst_ip)
-    return FALSE;
-
-  if (self->src_port >= 0 && src_port != self->src_port)
-    return FALSE;
-
-  if (self->dst_port >= 0 && dst_port != self->dst_port)
-    return FALSE;
-
   return TRUE;
 }
 
@@ -517,8 +523,15 @@ gst_pcap_parse_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
         if (self->cur_packet_size > 0) {
           const guint8 *payload_data;
           gint payload_size;
-
-          data = gst_adapter_map (self->adapter, self->cur_packet_size);
+          gsize map_size;
+
+          /* Only the headers are ever read; mapping the whole record would
+           * force the adapter to merge all the memories it spans, for every
+           * packet, including the ones the filter then drops. The payload is
+           * taken from the adapter by offset below, without going through
+           * this mapping. */
+          map_size = MIN (self->cur_packet_size, SCAN_MAX_HEADERS_LEN);
+          data = gst_adapter_map (self->adapter, map_size);
 
           GST_LOG_OBJECT (self, "examining packet size %" G_GINT64_FORMAT,
               self->cur_packet_size);
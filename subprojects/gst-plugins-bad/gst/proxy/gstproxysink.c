@@ -118,11 +118,27 @@ gst_proxy_sink_dispose (GObject * object)
 {
   GstProxySink *self = GST_PROXY_SINK (object);
 
-  g_weak_ref_clear (&self->proxysrc);
+  GST_OBJECT_LOCK (self);
+  gst_clear_object (&self->srcpad);
+  GST_OBJECT_UNLOCK (self);
 
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
+/* Returns a ref to the internal srcpad of the proxysrc we are connected to,
+ * or NULL if there is none */
+static GstPad *
+gst_proxy_sink_get_srcpad (GstProxySink * self)
+{
+  GstPad *srcpad;
+
+  GST_OBJECT_LOCK (self);
+  srcpad = self->srcpad ? gst_object_ref (self->srcpad) : NULL;
+  GST_OBJECT_UNLOCK (self);
+
+  return srcpad;
+}
+
 static GstStateChangeReturn
 gst_proxy_sink_change_state (GstElement * element, GstStateChange transition)
 {
@@ -175,20 +191,16 @@ static gboolean
 gst_proxy_sink_sink_query (GstPad * pad, GstObject * parent, GstQuery * query)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   gboolean ret = FALSE;
 
   GST_LOG_OBJECT (pad, "Handling query of type '%s'",
       gst_query_type_get_name (GST_QUERY_TYPE (query)));
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_get_srcpad (self);
+  if (srcpad) {
     ret = gst_pad_peer_query (srcpad, query);
     gst_object_unref (srcpad);
-    gst_object_unref (src);
   }
 
   return ret;
@@ -250,7 +262,7 @@ static gboolean
 gst_proxy_sink_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   gboolean ret = FALSE;
   gboolean sticky = GST_EVENT_IS_STICKY (event);
   GstEventType event_type = GST_EVENT_TYPE (event);
@@ -260,17 +272,13 @@ gst_proxy_sink_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
   if (event_type == GST_EVENT_FLUSH_STOP)
     self->pending_sticky_events = FALSE;
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_get_srcpad (self);
+  if (srcpad) {
     if (sticky)
       gst_proxy_sink_send_sticky_events (self, pad, srcpad);
 
     ret = gst_pad_push_event (srcpad, gst_event_ref (event));
     gst_object_unref (srcpad);
-    gst_object_unref (src);
 
     switch (event_type) {
       case GST_EVENT_STREAM_START:
@@ -314,21 +322,17 @@ static GstFlowReturn
 gst_proxy_sink_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   GstFlowReturn ret = GST_FLOW_OK;
 
   GST_LOG_OBJECT (pad, "Chaining buffer %p", buffer);
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_get_srcpad (self);
+  if (srcpad) {
     gst_proxy_sink_send_sticky_events (self, pad, srcpad);
 
     ret = gst_pad_push (srcpad, buffer);
     gst_object_unref (srcpad);
-    gst_object_unref (src);
 
     GST_LOG_OBJECT (pad, "Chained buffer %p: %s", buffer,
         gst_flow_get_name (ret));
@@ -345,21 +349,17 @@ gst_proxy_sink_sink_chain_list (GstPad * pad, GstObject * parent,
     GstBufferList * list)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   GstFlowReturn ret = GST_FLOW_OK;
 
   GST_LOG_OBJECT (pad, "Chaining buffer list %p", list);
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_get_srcpad (self);
+  if (srcpad) {
     gst_proxy_sink_send_sticky_events (self, pad, srcpad);
 
     ret = gst_pad_push_list (srcpad, list);
     gst_object_unref (srcpad);
-    gst_object_unref (src);
     GST_LOG_OBJECT (pad, "Chained buffer list %p: %s", list,
         gst_flow_get_name (ret));
   } else {
@@ -383,6 +383,18 @@ gst_proxy_sink_get_internal_sinkpad (GstProxySink * self)
 void
 gst_proxy_sink_set_proxysrc (GstProxySink * self, GstProxySrc * src)
 {
+  GstPad *srcpad = NULL, *old;
+
   g_return_if_fail (self);
-  g_weak_ref_set (&self->proxysrc, src);
+
+  if (src)
+    srcpad = gst_proxy_src_get_internal_srcpad (src);
+
+  GST_OBJECT_LOCK (self);
+  old = self->srcpad;
+  self->srcpad = srcpad;
+  GST_OBJECT_UNLOCK (self);
+
+  if (old)
+    gst_object_unref (old);
 }
@@ -43,8 +43,14 @@ struct _GstProxySink {
   /* < private > */
   GstPad *sinkpad;
 
-  /* The proxysrc that we push events, buffers, queries to */
-  GWeakRef proxysrc;
+  /* The internal srcpad of the proxysrc that we push events, buffers, queries
+   * to. Cached here, protected by the object lock, so the streaming thread
+   * doesn't have to resolve a GWeakRef for every single buffer: GWeakRef
+   * resolution takes a process-wide lock, which becomes a point of contention
+   * between otherwise independent pipelines when many proxy pairs are active.
+   * Holding a ref on the pad does not keep the proxysrc alive; once it goes
+   * away or is unset, pushes simply return FLUSHING. */
+  GstPad *srcpad;
 
   /* Whether there are sticky events pending */
   gboolean pending_sticky_events;
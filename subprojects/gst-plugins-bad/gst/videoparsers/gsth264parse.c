@@ -286,6 +286,8 @@ gst_h264_parse_reset_stream_info (GstH264Parse * h264parse)
     gst_buffer_replace (&h264parse->sps_nals[i], NULL);
   for (i = 0; i < GST_H264_MAX_PPS_COUNT; i++)
     gst_buffer_replace (&h264parse->pps_nals[i], NULL);
+  h264parse->last_sps_id = -1;
+  h264parse->last_pps_id = -1;
 
   gst_video_mastering_display_info_init (&h264parse->mastering_display_info);
   h264parse->mastering_display_info_state = GST_H264_PARSE_SEI_EXPIRED;
@@ -539,6 +541,31 @@ gst_h264_parser_store_nal (GstH264Parse * h264parse, guint id,
     gst_buffer_unref (store[id]);
 
   store[id] = buf;
+
+  if (naltype == GST_H264_NAL_SPS)
+    h264parse->last_sps_id = id;
+  else if (naltype == GST_H264_NAL_PPS)
+    h264parse->last_pps_id = id;
+}
+
+/* checks whether @nalu is byte-identical to the most recently stored
+ * SPS/PPS; if so the parser state is already up to date and the whole
+ * (re)parse can be skipped */
+static gboolean
+gst_h264_parse_is_repeated_nal (GstH264Parse * h264parse, gint last_id,
+    GstBuffer ** store, GstH264NalUnit * nalu)
+{
+  GstBuffer *stored;
+
+  if (last_id < 0)
+    return FALSE;
+
+  stored = store[last_id];
+  if (!stored || gst_buffer_get_size (stored) != nalu->size)
+    return FALSE;
+
+  return gst_buffer_memcmp (stored, 0, nalu->data + nalu->offset,
+      nalu->size) == 0;
 }
 
 #ifndef GST_DISABLE_GST_DEBUG
@@ -980,6 +1007,25 @@ gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
     case GST_H264_NAL_SPS:
       /* reset state, everything else is obsolete */
       h264parse->state &= GST_H264_PARSE_STATE_GOT_PPS;
+
+      /* broadcast streams retransmit the same SPS ahead of every IDR;
+       * nothing changed, so don't reparse it or recheck the caps */
+      if (gst_h264_parse_is_repeated_nal (h264parse, h264parse->last_sps_id,
+              h264parse->sps_nals, nalu)) {
+        GST_DEBUG_OBJECT (h264parse, "SPS unchanged, skipping reparse");
+        h264parse->have_sps = TRUE;
+        h264parse->have_sps_in_frame = TRUE;
+        if (h264parse->push_codec && h264parse->have_pps) {
+          GST_INFO_OBJECT (h264parse, "have SPS/PPS in stream");
+          h264parse->push_codec = FALSE;
+          h264parse->have_sps = FALSE;
+          h264parse->have_pps = FALSE;
+        }
+        h264parse->state |= GST_H264_PARSE_STATE_GOT_SPS;
+        h264parse->header = TRUE;
+        break;
+      }
+
       pres = gst_h264_parser_parse_sps (nalparser, nalu, &sps);
 
     process_sps:
@@ -1015,6 +1061,23 @@ gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
       if (!GST_H264_PARSE_STATE_VALID (h264parse, GST_H264_PARSE_STATE_GOT_SPS))
         return FALSE;
 
+      /* same short-cut as for the SPS above */
+      if (gst_h264_parse_is_repeated_nal (h264parse, h264parse->last_pps_id,
+              h264parse->pps_nals, nalu)) {
+        GST_DEBUG_OBJECT (h264parse, "PPS unchanged, skipping reparse");
+        h264parse->have_pps = TRUE;
+        h264parse->have_pps_in_frame = TRUE;
+        if (h264parse->push_codec && h264parse->have_sps) {
+          GST_INFO_OBJECT (h264parse, "have SPS/PPS in stream");
+          h264parse->push_codec = FALSE;
+          h264parse->have_sps = FALSE;
+          h264parse->have_pps = FALSE;
+        }
+        h264parse->state |= GST_H264_PARSE_STATE_GOT_PPS;
+        h264parse->header = TRUE;
+        break;
+      }
+
       pres = gst_h264_parser_parse_pps (nalparser, nalu, &pps);
       /* arranged for a fallback pps.id, so use that one and only warn */
       if (pres != GST_H264_PARSER_OK) {
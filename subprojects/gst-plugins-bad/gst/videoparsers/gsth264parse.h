@@ -107,6 +107,10 @@ struct _GstH264Parse
   /* collected SPS and PPS NALUs */
   GstBuffer *sps_nals[GST_H264_MAX_SPS_COUNT];
   GstBuffer *pps_nals[GST_H264_MAX_PPS_COUNT];
+  /* ids of the most recently stored SPS/PPS, to short-cut the in-band
+   * retransmissions ahead of every IDR (-1 when nothing is stored) */
+  gint last_sps_id;
+  gint last_pps_id;
 
   /* collected SEI timestamps */
   guint num_clock_timestamp;
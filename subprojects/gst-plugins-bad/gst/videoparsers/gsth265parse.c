@@ -246,6 +246,9 @@ gst_h265_parse_reset_stream_info (GstH265Parse * h265parse)
     gst_buffer_replace (&h265parse->sps_nals[i], NULL);
   for (i = 0; i < GST_H265_MAX_PPS_COUNT; i++)
     gst_buffer_replace (&h265parse->pps_nals[i], NULL);
+  h265parse->last_vps_id = -1;
+  h265parse->last_sps_id = -1;
+  h265parse->last_pps_id = -1;
 
   gst_video_mastering_display_info_init (&h265parse->mastering_display_info);
   h265parse->mastering_display_info_state = GST_H265_PARSE_SEI_EXPIRED;
@@ -488,6 +491,33 @@ gst_h265_parser_store_nal (GstH265Parse * h265parse, guint id,
     gst_buffer_unref (store[id]);
 
   store[id] = buf;
+
+  if (naltype == GST_H265_NAL_VPS)
+    h265parse->last_vps_id = id;
+  else if (naltype == GST_H265_NAL_SPS)
+    h265parse->last_sps_id = id;
+  else if (naltype == GST_H265_NAL_PPS)
+    h265parse->last_pps_id = id;
+}
+
+/* checks whether @nalu is byte-identical to the most recently stored
+ * VPS/SPS/PPS; if so the parser state is already up to date and the whole
+ * (re)parse can be skipped */
+static gboolean
+gst_h265_parse_is_repeated_nal (GstH265Parse * h265parse, gint last_id,
+    GstBuffer ** store, GstH265NalUnit * nalu)
+{
+  GstBuffer *stored;
+
+  if (last_id < 0)
+    return FALSE;
+
+  stored = store[last_id];
+  if (!stored || gst_buffer_get_size (stored) != nalu->size)
+    return FALSE;
+
+  return gst_buffer_memcmp (stored, 0, nalu->data + nalu->offset,
+      nalu->size) == 0;
 }
 
 #ifndef GST_DISABLE_GST_DEBUG
@@ -735,6 +765,25 @@ gst_h265_parse_process_nal (GstH265Parse * h265parse, GstH265NalUnit * nalu)
     case GST_H265_NAL_VPS:
       /* It is not mandatory to have VPS in the stream. But it might
        * be needed for other extensions like svc */
+
+      /* broadcast streams retransmit the same VPS ahead of every IDR;
+       * nothing changed, so don't reparse it or recheck the caps */
+      if (gst_h265_parse_is_repeated_nal (h265parse, h265parse->last_vps_id,
+              h265parse->vps_nals, nalu)) {
+        GST_DEBUG_OBJECT (h265parse, "VPS unchanged, skipping reparse");
+        h265parse->have_vps = TRUE;
+        h265parse->have_vps_in_frame = TRUE;
+        if (h265parse->push_codec && h265parse->have_pps) {
+          GST_INFO_OBJECT (h265parse, "have VPS/SPS/PPS in stream");
+          h265parse->push_codec = FALSE;
+          h265parse->have_vps = FALSE;
+          h265parse->have_sps = FALSE;
+          h265parse->have_pps = FALSE;
+        }
+        h265parse->header = TRUE;
+        break;
+      }
+
       pres = gst_h265_parser_parse_vps (nalparser, nalu, &vps);
       if (pres != GST_H265_PARSER_OK) {
         GST_WARNING_OBJECT (h265parse, "failed to parse VPS");
@@ -762,6 +811,23 @@ gst_h265_parse_process_nal (GstH265Parse * h265parse, GstH265NalUnit * nalu)
       /* reset state, everything else is obsolete */
       h265parse->state &= GST_H265_PARSE_STATE_GOT_PPS;
 
+      /* same short-cut as for the VPS above */
+      if (gst_h265_parse_is_repeated_nal (h265parse, h265parse->last_sps_id,
+              h265parse->sps_nals, nalu)) {
+        GST_DEBUG_OBJECT (h265parse, "SPS unchanged, skipping reparse");
+        h265parse->have_sps = TRUE;
+        h265parse->have_sps_in_frame = TRUE;
+        if (h265parse->push_codec && h265parse->have_pps) {
+          GST_INFO_OBJECT (h265parse, "have SPS/PPS in stream");
+          h265parse->push_codec = FALSE;
+          h265parse->have_sps = FALSE;
+          h265parse->have_pps = FALSE;
+        }
+        h265parse->header = TRUE;
+        h265parse->state |= GST_H265_PARSE_STATE_GOT_SPS;
+        break;
+      }
+
       pres = gst_h265_parser_parse_sps (nalparser, nalu, &sps, TRUE);
 
 
@@ -797,6 +863,23 @@ gst_h265_parse_process_nal (GstH265Parse * h265parse, GstH265NalUnit * nalu)
       h265parse->state |= GST_H265_PARSE_STATE_GOT_SPS;
       break;
     case GST_H265_NAL_PPS:
+      /* same short-cut as for the VPS above */
+      if (gst_h265_parse_is_repeated_nal (h265parse, h265parse->last_pps_id,
+              h265parse->pps_nals, nalu)) {
+        GST_DEBUG_OBJECT (h265parse, "PPS unchanged, skipping reparse");
+        h265parse->have_pps = TRUE;
+        h265parse->have_pps_in_frame = TRUE;
+        if (h265parse->push_codec && h265parse->have_sps) {
+          GST_INFO_OBJECT (h265parse, "have SPS/PPS in stream");
+          h265parse->push_codec = FALSE;
+          h265parse->have_sps = FALSE;
+          h265parse->have_pps = FALSE;
+        }
+        h265parse->header = TRUE;
+        h265parse->state |= GST_H265_PARSE_STATE_GOT_PPS;
+        break;
+      }
+
       pres = gst_h265_parser_parse_pps (nalparser, nalu, &pps);
 
       /* arranged for a fallback pps.id, so use that one and only warn */
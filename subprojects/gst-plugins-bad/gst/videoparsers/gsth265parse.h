@@ -92,6 +92,11 @@ struct _GstH265Parse
   GstBuffer *vps_nals[GST_H265_MAX_VPS_COUNT];
   GstBuffer *sps_nals[GST_H265_MAX_SPS_COUNT];
   GstBuffer *pps_nals[GST_H265_MAX_PPS_COUNT];
+  /* ids of the most recently stored VPS/SPS/PPS, to short-cut the in-band
+   * retransmissions ahead of every IDR (-1 when nothing is stored) */
+  gint last_vps_id;
+  gint last_sps_id;
+  gint last_pps_id;
 
   /* Infos we need to keep track of */
   guint8 sei_pic_struct;
@@ -1250,6 +1250,7 @@ gst_decklink_video_src_create (GstPushSrc * bsrc, GstBuffer ** buffer)
   GstCaps *caps;
   gboolean caps_changed = FALSE;
   const GstDecklinkMode *mode;
+  GstMessage *qos_msg = NULL;
   static GstStaticCaps stream_reference =
       GST_STATIC_CAPS ("timestamp/x-decklink-stream");
   static GstStaticCaps hardware_reference =
@@ -1304,6 +1305,38 @@ retry:
   // If we're not flushing, we should have a valid frame from the queue
   g_assert (f.frame != NULL);
 
+  /* 1 ns error can be just a rounding error, so that's OK. The Decklink
+   * drivers give us a really steady stream time, so anything above 1 ns can't
+   * be a rounding error and is therefore something to worry about */
+  if (self->expected_stream_time != GST_CLOCK_TIME_NONE &&
+      ABSDIFF (self->expected_stream_time, f.stream_timestamp) > 1) {
+    GstClockTime running_time;
+
+    self->dropped += f.stream_timestamp - self->expected_stream_time;
+    running_time = gst_segment_to_running_time (&GST_BASE_SRC (self)->segment,
+        GST_FORMAT_TIME, f.timestamp);
+
+    qos_msg =
+        gst_message_new_qos (GST_OBJECT (self), TRUE, running_time,
+        f.stream_timestamp, f.timestamp, f.duration);
+    gst_message_set_qos_stats (qos_msg, GST_FORMAT_TIME, self->processed,
+        self->dropped);
+  }
+  if (self->first_stream_time == GST_CLOCK_TIME_NONE)
+    self->first_stream_time = f.stream_timestamp;
+  self->processed =
+      f.stream_timestamp - self->dropped - self->first_stream_time;
+  self->expected_stream_time = f.stream_timestamp + f.stream_duration;
+
+  /* Everything below only touches state owned by the streaming thread, so
+   * drop the lock before wrapping the frame and parsing VANC: the capture
+   * thread takes the same lock in its frame callback, and blocking it there
+   * for the per-frame work here defeats the point of the frame queue */
+  g_mutex_unlock (&self->lock);
+
+  if (qos_msg)
+    gst_element_post_message (GST_ELEMENT (self), qos_msg);
+
   // Create output buffer
   f.frame->GetBytes ((gpointer *) & data);
   data_size = f.frame->GetHeight() * f.frame->GetRowBytes();
@@ -1378,7 +1411,6 @@ retry:
       caps_changed = TRUE;
       self->caps_mode = f.mode;
     } else {
-      g_mutex_unlock (&self->lock);
       GST_ELEMENT_ERROR (self, CORE, NEGOTIATION,
           ("Invalid mode in captured frame"),
           ("Mode set to %d but captured %d", self->caps_mode, f.mode));
@@ -1395,7 +1427,6 @@ retry:
       caps_changed = TRUE;
       self->caps_format = f.format;
     } else {
-      g_mutex_unlock (&self->lock);
       GST_ELEMENT_ERROR (self, CORE, NEGOTIATION,
           ("Invalid pixel format in captured frame"),
           ("Format set to %d but captured %d", self->caps_format, f.format));
@@ -1405,32 +1436,6 @@ retry:
     }
   }
 
-  /* 1 ns error can be just a rounding error, so that's OK. The Decklink
-   * drivers give us a really steady stream time, so anything above 1 ns can't
-   * be a rounding error and is therefore something to worry about */
-  if (self->expected_stream_time != GST_CLOCK_TIME_NONE &&
-      ABSDIFF (self->expected_stream_time, f.stream_timestamp) > 1) {
-    GstMessage *msg;
-    GstClockTime running_time;
-
-    self->dropped += f.stream_timestamp - self->expected_stream_time;
-    running_time = gst_segment_to_running_time (&GST_BASE_SRC (self)->segment,
-        GST_FORMAT_TIME, f.timestamp);
-
-    msg =
-        gst_message_new_qos (GST_OBJECT (self), TRUE, running_time,
-        f.stream_timestamp, f.timestamp, f.duration);
-    gst_message_set_qos_stats (msg, GST_FORMAT_TIME, self->processed,
-        self->dropped);
-    gst_element_post_message (GST_ELEMENT (self), msg);
-  }
-  if (self->first_stream_time == GST_CLOCK_TIME_NONE)
-    self->first_stream_time = f.stream_timestamp;
-  self->processed =
-      f.stream_timestamp - self->dropped - self->first_stream_time;
-  self->expected_stream_time = f.stream_timestamp + f.stream_duration;
-
-  g_mutex_unlock (&self->lock);
   if (caps_changed) {
     self->last_cc_vbi_line = -1;
     self->last_afd_bar_vbi_line = -1;
@@ -222,7 +222,7 @@ enum
 #define DEFAULT_TIMEOUT 1000000 /* 1 second */
 #define DEFAULT_TUNING_TIMEOUT 10 * GST_SECOND  /* 10 seconds */
 #define DEFAULT_DVB_BUFFER_SIZE (10*188*1024)   /* kernel default is 8192 */
-#define DEFAULT_BUFFER_SIZE 8192        /* not a property */
+#define DEFAULT_BUFFER_SIZE (348 * 188) /* ~64kB, packet aligned; not a property */
 #define DEFAULT_DELSYS SYS_UNDEFINED
 #define DEFAULT_PILOT PILOT_AUTO
 #define DEFAULT_ROLLOFF ROLLOFF_AUTO
@@ -1881,7 +1881,7 @@ gst_dvbsrc_read_device (GstDvbSrc * object, int size, GstBuffer ** buffer)
     return GST_FLOW_ERROR;
 
   gst_buffer_map (buf, &map, GST_MAP_WRITE);
-  while (count < size) {
+  while (count == 0) {
     ret_val = gst_poll_wait (object->poll, timeout);
     GST_LOG_OBJECT (object, "select returned %d", ret_val);
     if (G_UNLIKELY (ret_val < 0)) {
@@ -1897,9 +1897,15 @@ gst_dvbsrc_read_device (GstDvbSrc * object, int size, GstBuffer ** buffer)
           gst_message_new_element (GST_OBJECT (object),
               gst_structure_new_empty ("dvb-read-failure")));
     } else {
-      int nread = read (object->fd_dvr, map.data + count, size - count);
+      /* Grab everything the driver has buffered, up to our buffer size.
+       * On a loaded mux this drains the kernel ring with a few large
+       * reads instead of many fixed-size ones, and on a slow one we push
+       * whatever arrived instead of waiting for a full buffer */
+      int nread = read (object->fd_dvr, map.data, size);
 
       if (G_UNLIKELY (nread < 0)) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+          continue;
         GST_WARNING_OBJECT
             (object,
             "Unable to read from device: /dev/dvb/adapter%d/dvr%d (%d)",
@@ -1908,7 +1914,7 @@ gst_dvbsrc_read_device (GstDvbSrc * object, int size, GstBuffer ** buffer)
             gst_message_new_element (GST_OBJECT (object),
                 gst_structure_new_empty ("dvb-read-failure")));
       } else
-        count = count + nread;
+        count = nread;
     }
   }
   gst_buffer_unmap (buf, &map);
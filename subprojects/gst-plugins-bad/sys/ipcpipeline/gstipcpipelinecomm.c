@@ -27,6 +27,9 @@
 #ifdef HAVE_UNISTD_H
 #  include <unistd.h>
 #endif
+#ifndef _MSC_VER
+#  include <sys/uio.h>
+#endif
 #ifdef _MSC_VER
 /* ssize_t is not available, so match return value of recv()/send() on MSVC */
 #  define ssize_t int
@@ -262,6 +265,67 @@ done:
   return ret;
 }
 
+typedef struct
+{
+  const guint8 *data;
+  size_t size;
+} CommWriteVector;
+
+#ifndef _MSC_VER
+/* Write several blocks with a single syscall where possible, so a buffer
+ * (header + payload + meta) doesn't cost three wakeups on the other end */
+static gboolean
+write_vectors_to_fd (GstIpcPipelineComm * comm, CommWriteVector * vecs,
+    guint n_vecs)
+{
+  struct iovec iov[8];
+  guint i, first = 0;
+
+  g_assert (n_vecs <= G_N_ELEMENTS (iov));
+
+  for (i = 0; i < n_vecs; i++) {
+    iov[i].iov_base = (void *) vecs[i].data;
+    iov[i].iov_len = vecs[i].size;
+  }
+
+  while (first < n_vecs) {
+    ssize_t written = writev (comm->fdout, iov + first, n_vecs - first);
+
+    if (written < 0) {
+      if (errno == EAGAIN || errno == EINTR)
+        continue;
+      GST_ERROR_OBJECT (comm->element, "Failed to write to fd: %s",
+          strerror (errno));
+      return FALSE;
+    }
+    while (first < n_vecs && (size_t) written >= iov[first].iov_len) {
+      written -= iov[first].iov_len;
+      first++;
+    }
+    if (first < n_vecs) {
+      iov[first].iov_base = (guint8 *) iov[first].iov_base + written;
+      iov[first].iov_len -= written;
+    }
+  }
+
+  return TRUE;
+}
+#else
+static gboolean
+write_vectors_to_fd (GstIpcPipelineComm * comm, CommWriteVector * vecs,
+    guint n_vecs)
+{
+  guint i;
+
+  for (i = 0; i < n_vecs; i++) {
+    if (!write_to_fd_raw (comm, vecs[i].data, vecs[i].size))
+      return FALSE;
+  }
+
+  return TRUE;
+}
+#endif
+
 static gboolean
 write_byte_writer_to_fd (GstIpcPipelineComm * comm, GstByteWriter * bw)
 {
@@ -530,7 +594,10 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   CommBufferMetadata meta;
   GstFlowReturn ret;
   MetaListRepresentation repr = { comm, 0, 4, NULL };   /* starts a 4 for n_meta */
-  GstByteWriter bw;
+  GstByteWriter bw, mw;
+  guint8 *header_data = NULL, *meta_data = NULL;
+  guint header_size, meta_size;
+  CommWriteVector vecs[3];
 
   g_mutex_lock (&comm->mutex);
   ++comm->send_id;
@@ -538,8 +605,6 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   GST_TRACE_OBJECT (comm->element, "Writing buffer %u: %" GST_PTR_FORMAT,
       comm->send_id, buffer);
 
-  gst_byte_writer_init (&bw);
-
   meta.pts = GST_BUFFER_PTS (buffer);
   meta.dts = GST_BUFFER_DTS (buffer);
   meta.duration = GST_BUFFER_DURATION (buffer);
@@ -550,6 +615,12 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   /* work out meta size */
   gst_buffer_foreach_meta (buffer, build_meta, &repr);
 
+  /* both sizes are known in advance, so the writers never have to grow */
+  gst_byte_writer_init_with_size (&bw,
+      1 + 2 * sizeof (guint32) + sizeof (CommBufferMetadata) +
+      sizeof (guint32), FALSE);
+  gst_byte_writer_init_with_size (&mw, repr.total_bytes, FALSE);
+
   if (!gst_byte_writer_put_uint8 (&bw, payload_type))
     goto write_failed;
   if (!gst_byte_writer_put_uint32_le (&bw, comm->send_id))
@@ -564,51 +635,62 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   size = gst_buffer_get_size (buffer);
   if (!gst_byte_writer_put_uint32_le (&bw, size))
     goto write_failed;
-  if (!write_byte_writer_to_fd (comm, &bw))
-    goto write_failed;
-
-  if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
-    goto map_failed;
-  ret = write_to_fd_raw (comm, map.data, map.size);
-  gst_buffer_unmap (buffer, &map);
-  if (!ret)
-    goto write_failed;
 
   /* meta */
-  gst_byte_writer_init (&bw);
-  if (!gst_byte_writer_put_uint32_le (&bw, repr.n_meta))
+  if (!gst_byte_writer_put_uint32_le (&mw, repr.n_meta))
     goto write_failed;
   for (n = 0; n < repr.n_meta; ++n) {
     const MetaBuildInfo *info = repr.info + n;
     guint32 len;
     const char *s;
 
-    if (!gst_byte_writer_put_uint32_le (&bw, info->bytes))
+    if (!gst_byte_writer_put_uint32_le (&mw, info->bytes))
       goto write_failed;
 
-    if (!gst_byte_writer_put_uint32_le (&bw, info->flags))
+    if (!gst_byte_writer_put_uint32_le (&mw, info->flags))
       goto write_failed;
 
     s = g_type_name (info->api);
     len = strlen (s) + 1;
-    if (!gst_byte_writer_put_uint32_le (&bw, len))
+    if (!gst_byte_writer_put_uint32_le (&mw, len))
       goto write_failed;
-    if (!gst_byte_writer_put_data (&bw, (const guint8 *) s, len))
+    if (!gst_byte_writer_put_data (&mw, (const guint8 *) s, len))
       goto write_failed;
 
-    if (!gst_byte_writer_put_uint64_le (&bw, info->size))
+    if (!gst_byte_writer_put_uint64_le (&mw, info->size))
       goto write_failed;
 
     s = info->str;
     len = s ? (strlen (s) + 1) : 0;
-    if (!gst_byte_writer_put_uint32_le (&bw, len))
+    if (!gst_byte_writer_put_uint32_le (&mw, len))
       goto write_failed;
     if (len)
-      if (!gst_byte_writer_put_data (&bw, (const guint8 *) s, len))
+      if (!gst_byte_writer_put_data (&mw, (const guint8 *) s, len))
         goto write_failed;
   }
 
-  if (!write_byte_writer_to_fd (comm, &bw))
+  if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
+    goto map_failed;
+
+  header_size = gst_byte_writer_get_size (&bw);
+  header_data = gst_byte_writer_reset_and_get_data (&bw);
+  meta_size = gst_byte_writer_get_size (&mw);
+  meta_data = gst_byte_writer_reset_and_get_data (&mw);
+  if (!header_data || !meta_data) {
+    gst_buffer_unmap (buffer, &map);
+    goto write_failed;
+  }
+
+  /* header, payload and meta as one gathered write */
+  vecs[0].data = header_data;
+  vecs[0].size = header_size;
+  vecs[1].data = map.data;
+  vecs[1].size = map.size;
+  vecs[2].data = meta_data;
+  vecs[2].size = meta_size;
+  ret = write_vectors_to_fd (comm, vecs, 3);
+  gst_buffer_unmap (buffer, &map);
+  if (!ret)
     goto write_failed;
 
   if (!gst_ipc_pipeline_comm_sync_fd (comm, comm->send_id, NULL, &ret32,
@@ -619,6 +701,9 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
 done:
   g_mutex_unlock (&comm->mutex);
   gst_byte_writer_reset (&bw);
+  gst_byte_writer_reset (&mw);
+  g_free (header_data);
+  g_free (meta_data);
   for (n = 0; n < repr.n_meta; ++n)
     g_free (repr.info[n].str);
   g_free (repr.info);
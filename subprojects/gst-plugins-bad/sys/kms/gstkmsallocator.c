@@ -588,12 +588,24 @@ export_fd_failed:
   }
 }
 
+/* The cache is looked up for every frame shown by kmssink, so don't go
+ * through the global quark table each time */
+static GQuark
+kmsmem_quark (void)
+{
+  static GQuark quark = 0;
+
+  if (quark == 0)
+    quark = g_quark_from_static_string ("kmsmem");
+
+  return quark;
+}
+
 /* FIXME, using gdata for caching on upstream memory is not tee safe */
 GstMemory *
 gst_kms_allocator_get_cached (GstMemory * mem)
 {
-  return gst_mini_object_get_qdata (GST_MINI_OBJECT (mem),
-      g_quark_from_static_string ("kmsmem"));
+  return gst_mini_object_get_qdata (GST_MINI_OBJECT (mem), kmsmem_quark ());
 }
 
 static void
@@ -617,8 +629,7 @@ gst_kms_allocator_clear_cache (GstAllocator * allocator)
     GstMiniObject *obj = iter->data;
     gst_mini_object_weak_unref (obj,
         (GstMiniObjectNotify) cached_kmsmem_disposed_cb, alloc);
-    gst_mini_object_set_qdata (obj,
-        g_quark_from_static_string ("kmsmem"), NULL, NULL);
+    gst_mini_object_set_qdata (obj, kmsmem_quark (), NULL, NULL);
     iter = iter->next;
   }
 
@@ -641,7 +652,6 @@ gst_kms_allocator_cache (GstAllocator * allocator, GstMemory * mem,
   alloc->priv->mem_cache = g_list_prepend (alloc->priv->mem_cache, mem);
   GST_OBJECT_UNLOCK (alloc);
 
-  gst_mini_object_set_qdata (GST_MINI_OBJECT (mem),
-      g_quark_from_static_string ("kmsmem"), kmsmem,
+  gst_mini_object_set_qdata (GST_MINI_OBJECT (mem), kmsmem_quark (), kmsmem,
       (GDestroyNotify) gst_memory_unref);
 }
@@ -1690,7 +1690,10 @@ gst_kms_sink_import_dmabuf (GstKMSSink * self, GstBuffer * inbuf,
     }
   }
 
-  /* Find and validate all memories */
+  /* Find and validate all memories, starting with the one holding the first
+   * plane: with upstream cycling buffers from a pool this is usually enough
+   * to hit the framebuffer cache, in which case the remaining planes don't
+   * need to be located and validated again for every frame */
   for (i = 0; i < n_planes; i++) {
     guint length;
 
@@ -1708,15 +1711,18 @@ gst_kms_sink_import_dmabuf (GstKMSSink * self, GstBuffer * inbuf,
     /* And all memory found must be dmabuf */
     if (!gst_is_dmabuf_memory (mems[i]))
       return FALSE;
-  }
 
-  ensure_kms_allocator (self);
+    if (i == 0) {
+      ensure_kms_allocator (self);
 
-  kmsmem = (GstKMSMemory *) gst_kms_allocator_get_cached (mems[0]);
-  if (kmsmem) {
-    GST_LOG_OBJECT (self, "found KMS mem %p in DMABuf mem %p with fb id = %d",
-        kmsmem, mems[0], kmsmem->fb_id);
-    goto wrap_mem;
+      kmsmem = (GstKMSMemory *) gst_kms_allocator_get_cached (mems[0]);
+      if (kmsmem) {
+        GST_LOG_OBJECT (self,
+            "found KMS mem %p in DMABuf mem %p with fb id = %d",
+            kmsmem, mems[0], kmsmem->fb_id);
+        goto wrap_mem;
+      }
+    }
   }
 
   for (i = 0; i < n_planes; i++)
@@ -43,6 +43,7 @@ struct _GstCudaBaseTransform
   GstBaseTransform parent;
 
   GstCudaContext *context;
+  /* shared stream of @context, owned by the context */
   CUstream cuda_stream;
 
   GstVideoInfo in_info;
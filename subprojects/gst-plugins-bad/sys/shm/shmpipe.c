@@ -135,7 +135,11 @@ struct _ShmPipe
 
   int next_area_id;
 
+  /* Pending buffers in send order, oldest first. Acks almost always come
+   * for the oldest buffer, so keep a tail pointer and append there instead
+   * of prepending, which made every ack lookup walk the whole list. */
   ShmBuffer *buffers;
+  ShmBuffer *buffers_tail;
 
   int num_clients;
   ShmClient *clients;
@@ -632,8 +636,11 @@ sp_writer_send_buf (ShmPipe * self, char *buf, size_t size, void *tag)
 
   sb->use_count = c;
 
-  sb->next = self->buffers;
-  self->buffers = sb;
+  if (self->buffers_tail)
+    self->buffers_tail->next = sb;
+  else
+    self->buffers = sb;
+  self->buffers_tail = sb;
 
   return c;
 }
@@ -878,6 +885,8 @@ sp_shmbuf_dec (ShmPipe * self, ShmBuffer * buf, ShmBuffer * prev_buf,
       prev_buf->next = buf->next;
     else
       self->buffers = buf->next;
+    if (self->buffers_tail == buf)
+      self->buffers_tail = prev_buf;
 
     if (tag)
       *tag = buf->tag;
@@ -1222,6 +1222,21 @@ export_complete:
 }
 #endif /* GST_GL_HAVE_PLATFORM_EGL && GST_GL_HAVE_DMABUF */
 
+/* called on the GL thread */
+static void
+_do_pbo_transfers (GstBuffer * buffer)
+{
+  guint i, n;
+
+  n = gst_buffer_n_memory (buffer);
+  for (i = 0; i < n; i++) {
+    GstMemory *mem = gst_buffer_peek_memory (buffer, i);
+
+    if (gst_is_gl_memory_pbo (mem))
+      gst_gl_memory_pbo_download_transfer ((GstGLMemoryPBO *) mem);
+  }
+}
+
 static GstFlowReturn
 gst_gl_download_element_prepare_output_buffer (GstBaseTransform * bt,
     GstBuffer * inbuf, GstBuffer ** outbuf)
@@ -1230,7 +1245,6 @@ gst_gl_download_element_prepare_output_buffer (GstBaseTransform * bt,
   GstBaseTransformClass *bclass = GST_BASE_TRANSFORM_GET_CLASS (bt);
   GstGLContext *context = GST_GL_BASE_FILTER (bt)->context;
   GstGLSyncMeta *in_sync_meta;
-  gint i, n;
 
   *outbuf = inbuf;
 
@@ -1323,13 +1337,16 @@ gst_gl_download_element_prepare_output_buffer (GstBaseTransform * bt,
 #endif
 
   if (dl->mode == GST_GL_DOWNLOAD_MODE_PBO_TRANSFERS) {
-    n = gst_buffer_n_memory (*outbuf);
-    for (i = 0; i < n; i++) {
-      GstMemory *mem = gst_buffer_peek_memory (*outbuf, i);
-
-      if (gst_is_gl_memory_pbo (mem))
-        gst_gl_memory_pbo_download_transfer ((GstGLMemoryPBO *) mem);
-    }
+    GstGLWindow *window = gst_gl_context_get_window (context);
+
+    /* Kick the texture -> PBO copies from the GL thread without waiting for
+     * them, so the streaming thread doesn't block on a round-trip per plane
+     * and the readback overlaps with whatever runs next. Mapping the memory
+     * later synchronizes with the copy if it hasn't landed yet. */
+    gst_gl_window_send_message_async (window,
+        (GstGLWindowCB) _do_pbo_transfers, gst_buffer_ref (*outbuf),
+        (GDestroyNotify) gst_buffer_unref);
+    gst_object_unref (window);
   }
 
   return GST_FLOW_OK;
@@ -1837,6 +1837,127 @@ gst_app_sink_try_pull_sample (GstAppSink * appsink, GstClockTime timeout)
   }
 }
 
+/**
+ * gst_app_sink_try_pull_samples:
+ * @appsink: a #GstAppSink
+ * @samples: (array length=max_samples) (out caller-allocates): an array to
+ *     store the samples
+ * @max_samples: the size of @samples
+ * @timeout: the maximum amount of time to wait for the first sample
+ *
+ * This function blocks until a sample or EOS becomes available or the appsink
+ * element is set to the READY/NULL state or the timeout expires, and then
+ * fills @samples with as many queued samples as are available, up to
+ * @max_samples, while taking the internal lock and signalling the streaming
+ * thread only once. When samples are produced at a high rate this is
+ * considerably cheaper than calling gst_app_sink_try_pull_sample() in a loop.
+ *
+ * Queued events are processed and discarded, like with
+ * gst_app_sink_try_pull_sample(); use gst_app_sink_try_pull_object() when the
+ * application needs to see them.
+ *
+ * If an EOS event was received before any buffers or the timeout expires,
+ * this function returns 0. Use gst_app_sink_is_eos () to check for the EOS
+ * condition.
+ *
+ * Returns: the number of samples stored in @samples; call gst_sample_unref()
+ *     on each of them after usage.
+ *
+ * Since: 1.24
+ */
+guint
+gst_app_sink_try_pull_samples (GstAppSink * appsink, GstSample ** samples,
+    guint max_samples, GstClockTime timeout)
+{
+  GstAppSinkPrivate *priv;
+  gboolean timeout_valid;
+  gint64 end_time;
+  guint n = 0;
+
+  g_return_val_if_fail (GST_IS_APP_SINK (appsink), 0);
+  g_return_val_if_fail (samples != NULL, 0);
+  g_return_val_if_fail (max_samples > 0, 0);
+
+  timeout_valid = GST_CLOCK_TIME_IS_VALID (timeout);
+
+  if (timeout_valid)
+    end_time =
+        g_get_monotonic_time () + timeout / (GST_SECOND / G_TIME_SPAN_SECOND);
+
+  priv = appsink->priv;
+
+  g_mutex_lock (&priv->mutex);
+  gst_buffer_replace (&priv->preroll_buffer, NULL);
+
+  while (TRUE) {
+    GST_DEBUG_OBJECT (appsink, "trying to grab a batch of samples");
+    if (!priv->started)
+      goto not_started;
+
+    if (priv->num_buffers > 0)
+      break;
+
+    if (priv->is_eos)
+      goto eos;
+
+    /* nothing to return, wait */
+    GST_DEBUG_OBJECT (appsink, "waiting for a sample");
+    priv->wait_status |= APP_WAITING;
+    if (timeout_valid) {
+      if (!g_cond_wait_until (&priv->cond, &priv->mutex, end_time))
+        goto expired;
+    } else {
+      g_cond_wait (&priv->cond, &priv->mutex);
+    }
+    priv->wait_status &= ~APP_WAITING;
+  }
+
+  while (n < max_samples && priv->num_buffers > 0) {
+    GstMiniObject *obj = dequeue_buffer (appsink);
+
+    priv->sample = gst_sample_make_writable (priv->sample);
+    if (GST_IS_BUFFER (obj)) {
+      GST_DEBUG_OBJECT (appsink, "we have a buffer %p", obj);
+      gst_sample_set_buffer_list (priv->sample, NULL);
+      gst_sample_set_buffer (priv->sample, GST_BUFFER_CAST (obj));
+    } else {
+      GST_DEBUG_OBJECT (appsink, "we have a list %p", obj);
+      gst_sample_set_buffer (priv->sample, NULL);
+      gst_sample_set_buffer_list (priv->sample, GST_BUFFER_LIST_CAST (obj));
+    }
+    samples[n++] = gst_sample_ref (priv->sample);
+    gst_mini_object_unref (obj);
+  }
+
+  if ((priv->wait_status & STREAM_WAITING))
+    g_cond_signal (&priv->cond);
+
+  g_mutex_unlock (&priv->mutex);
+
+  return n;
+
+  /* special conditions */
+expired:
+  {
+    GST_DEBUG_OBJECT (appsink, "timeout expired, return 0");
+    priv->wait_status &= ~APP_WAITING;
+    g_mutex_unlock (&priv->mutex);
+    return 0;
+  }
+eos:
+  {
+    GST_DEBUG_OBJECT (appsink, "we are EOS, return 0");
+    g_mutex_unlock (&priv->mutex);
+    return 0;
+  }
+not_started:
+  {
+    GST_DEBUG_OBJECT (appsink, "we are stopped, return 0");
+    g_mutex_unlock (&priv->mutex);
+    return 0;
+  }
+}
+
 /**
  * gst_app_sink_try_pull_object: (skip)
  * @appsink: a #GstAppSink
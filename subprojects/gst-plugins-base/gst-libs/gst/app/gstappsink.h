@@ -177,6 +177,10 @@ GstSample *     gst_app_sink_try_pull_preroll (GstAppSink *appsink, GstClockTime
 GST_APP_API
 GstSample *     gst_app_sink_try_pull_sample  (GstAppSink *appsink, GstClockTime timeout);
 
+GST_APP_API
+guint           gst_app_sink_try_pull_samples (GstAppSink *appsink, GstSample **samples,
+                                               guint max_samples, GstClockTime timeout);
+
 GST_APP_API
 GstMiniObject * gst_app_sink_try_pull_object    (GstAppSink *appsink, GstClockTime timeout);
 
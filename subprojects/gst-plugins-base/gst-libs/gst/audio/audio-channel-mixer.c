@@ -782,6 +782,49 @@ gst_audio_channel_mixer_mix_##type##_##inlayout##_##outlayout ( \
   } \
 }
 
+/* In the planar case every channel is contiguous, so apply the matrix one
+ * coefficient at a time over whole sample runs: the inner loops are plain
+ * multiply(-accumulate) loops over contiguous memory that the compiler can
+ * vectorize, and input channels with a zero coefficient (most of the matrix
+ * for a large downmix) are skipped entirely. */
+#define DEFINE_FLOAT_MIX_PLANAR_FUNC(type) \
+static void \
+gst_audio_channel_mixer_mix_##type##_planar_planar ( \
+    GstAudioChannelMixer * mix, const g##type * in_data[], \
+    g##type * out_data[], gint samples) \
+{ \
+  gint in, out, n; \
+  gint inchannels, outchannels; \
+  \
+  inchannels = mix->in_channels; \
+  outchannels = mix->out_channels; \
+  \
+  for (out = 0; out < outchannels; out++) { \
+    g##type *o = out_data[out]; \
+    gboolean filled = FALSE; \
+    \
+    for (in = 0; in < inchannels; in++) { \
+      const g##type *i = in_data[in]; \
+      g##type coeff = mix->matrix[in][out]; \
+      \
+      if (coeff == 0.0) \
+        continue; \
+      \
+      if (!filled) { \
+        for (n = 0; n < samples; n++) \
+          o[n] = i[n] * coeff; \
+        filled = TRUE; \
+      } else { \
+        for (n = 0; n < samples; n++) \
+          o[n] += i[n] * coeff; \
+      } \
+    } \
+    \
+    if (!filled) \
+      memset (o, 0, samples * sizeof (g##type)); \
+  } \
+}
+
 DEFINE_GET_DATA_FUNCS (gint16);
 DEFINE_INTEGER_MIX_FUNC (16, 32, interleaved, interleaved);
 DEFINE_INTEGER_MIX_FUNC (16, 32, interleaved, planar);
@@ -798,13 +841,13 @@ DEFINE_GET_DATA_FUNCS (gfloat);
 DEFINE_FLOAT_MIX_FUNC (float, interleaved, interleaved);
 DEFINE_FLOAT_MIX_FUNC (float, interleaved, planar);
 DEFINE_FLOAT_MIX_FUNC (float, planar, interleaved);
-DEFINE_FLOAT_MIX_FUNC (float, planar, planar);
+DEFINE_FLOAT_MIX_PLANAR_FUNC (float);
 
 DEFINE_GET_DATA_FUNCS (gdouble);
 DEFINE_FLOAT_MIX_FUNC (double, interleaved, interleaved);
 DEFINE_FLOAT_MIX_FUNC (double, interleaved, planar);
 DEFINE_FLOAT_MIX_FUNC (double, planar, interleaved);
-DEFINE_FLOAT_MIX_FUNC (double, planar, planar);
+DEFINE_FLOAT_MIX_PLANAR_FUNC (double);
 
 /**
  * gst_audio_channel_mixer_new_with_matrix: (skip):
@@ -1516,6 +1516,14 @@ gst_audio_resampler_update (GstAudioResampler * resampler,
   if (out_rate <= 0)
     out_rate = resampler->out_rate;
 
+  /* when only the rates are updated and the ratio stays the same, as with a
+   * small drift correction that returns to the previous rate, nothing needs
+   * to be recalculated at all */
+  if (options == NULL && resampler->out_rate > 0 &&
+      (guint64) in_rate * resampler->out_rate ==
+      (guint64) out_rate * resampler->in_rate)
+    return TRUE;
+
   if (resampler->out_rate > 0) {
     GST_INFO ("old phase %d/%d", resampler->samp_phase, resampler->out_rate);
     samp_phase =
@@ -1605,7 +1613,11 @@ gst_audio_resampler_update (GstAudioResampler * resampler,
 
       resampler->samples_avail += diff;
     }
-  } else if (resampler->filter_mode == GST_AUDIO_RESAMPLER_FILTER_MODE_FULL) {
+  } else if (resampler->filter_mode == GST_AUDIO_RESAMPLER_FILTER_MODE_FULL &&
+      resampler->n_phases != resampler->out_rate) {
+    /* The cached taps only depend on the phase position i/n_phases, so when
+     * the reduced output rate is unchanged the lazily filled cache stays
+     * valid and reallocating it would only throw away work. */
     GST_DEBUG ("setting up filter cache");
     resampler->n_phases = resampler->out_rate;
     alloc_cache_mem (resampler, resampler->bps, resampler->n_taps,
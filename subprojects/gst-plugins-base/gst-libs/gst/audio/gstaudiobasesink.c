@@ -1387,6 +1387,29 @@ gst_audio_base_sink_resample_slaving (GstAudioBaseSink * sink,
   if (crate_num == 0)
     crate_denom = crate_num = 1;
 
+  /* Elide the rate conversion while it would move the sample position by
+   * less than half the drift tolerance. Converting with a unity rate keeps
+   * the input and output sample counts identical, so the ring buffer
+   * commits with a plain copy instead of adding/dropping samples on every
+   * single buffer for rates that are only marginally off. The error this
+   * accumulates is bounded: it engages the real rate as soon as the
+   * positions diverge by the tolerance, and every new clock observation
+   * re-anchors the calibration offsets, resetting the divergence. */
+  if (crate_num != crate_denom) {
+    GstClockTimeDiff err, mdrift2;
+
+    mdrift2 = (sink->priv->drift_tolerance * 1000) / 2;
+    err = GST_CLOCK_DIFF (clock_convert_external (render_start, cinternal,
+            cexternal, crate_num, crate_denom),
+        clock_convert_external (render_start, cinternal, cexternal, 1, 1));
+
+    if (err > -mdrift2 && err < mdrift2) {
+      GST_DEBUG_OBJECT (sink, "rate correction %" GST_STIME_FORMAT " below "
+          "tolerance, using unity rate", GST_STIME_ARGS (err));
+      crate_num = crate_denom = 1;
+    }
+  }
+
   /* bring external time to internal time */
   render_start = clock_convert_external (render_start, cinternal, cexternal,
       crate_num, crate_denom);
@@ -1335,10 +1335,13 @@ gst_audio_ring_buffer_clear_all (GstAudioRingBuffer * buf)
 }
 
 
+/* wait for the device to process another segment. @segments is the segdone
+ * value the caller based its decision to wait on; when it changed in the
+ * meantime the device already made progress and we return without waiting
+ * instead of stalling for a whole extra segment. */
 static gboolean
-wait_segment (GstAudioRingBuffer * buf)
+wait_segment (GstAudioRingBuffer * buf, gint segments)
 {
-  gint segments;
   gboolean wait = TRUE;
 
   /* buffer must be started now or we deadlock since nobody is reading */
@@ -1349,15 +1352,14 @@ wait_segment (GstAudioRingBuffer * buf)
       goto no_start;
 
     GST_DEBUG_OBJECT (buf, "start!");
-    segments = g_atomic_int_get (&buf->segdone);
     gst_audio_ring_buffer_start (buf);
-
-    /* After starting, the writer may have wrote segments already and then we
-     * don't need to wait anymore */
-    if (G_LIKELY (g_atomic_int_get (&buf->segdone) != segments))
-      wait = FALSE;
   }
 
+  /* After starting, the device may have processed segments already and then
+   * we don't need to wait anymore */
+  if (G_LIKELY (g_atomic_int_get (&buf->segdone) != segments))
+    wait = FALSE;
+
   /* take lock first, then update our waiting flag */
   GST_OBJECT_LOCK (buf);
   if (G_UNLIKELY (buf->flushing))
@@ -1369,6 +1371,14 @@ wait_segment (GstAudioRingBuffer * buf)
 
   if (G_LIKELY (wait)) {
     if (g_atomic_int_compare_and_exchange (&buf->waiting, 0, 1)) {
+      /* recheck the progress counter now that the waiting flag is set: the
+       * device signals only when it sees the flag, so an advance between our
+       * snapshot and here would otherwise go unnoticed until the next one */
+      if (G_UNLIKELY (g_atomic_int_get (&buf->segdone) != segments)) {
+        g_atomic_int_compare_and_exchange (&buf->waiting, 1, 0);
+        GST_OBJECT_UNLOCK (buf);
+        return TRUE;
+      }
       GST_DEBUG_OBJECT (buf, "waiting..");
       GST_AUDIO_RING_BUFFER_WAIT (buf);
 
@@ -1597,7 +1607,7 @@ default_commit (GstAudioRingBuffer * buf, guint64 * sample,
       }
 
       /* else we need to wait for the segment to become writable. */
-      if (!wait_segment (buf))
+      if (!wait_segment (buf, segdone + buf->segbase))
         goto not_started;
     }
 
@@ -1813,7 +1823,7 @@ gst_audio_ring_buffer_read (GstAudioRingBuffer * buf, guint64 sample,
         break;
 
       /* else we need to wait for the segment to become readable. */
-      if (!wait_segment (buf))
+      if (!wait_segment (buf, segdone + buf->segbase))
         goto not_started;
     }
 
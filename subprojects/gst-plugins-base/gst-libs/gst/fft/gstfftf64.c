@@ -67,6 +67,10 @@ struct _GstFFTF64
   void *cfg;
   gboolean inverse;
   gint len;
+
+  /* cached coefficients of the last window function applied */
+  gdouble *window_coeffs;
+  GstFFTWindow window_type;
 };
 
 /**
@@ -170,6 +174,7 @@ gst_fft_f64_inverse_fft (GstFFTF64 * self, const GstFFTF64Complex * freqdata,
 void
 gst_fft_f64_free (GstFFTF64 * self)
 {
+  g_free (self->window_coeffs);
   g_free (self);
 }
 
@@ -186,35 +191,49 @@ void
 gst_fft_f64_window (GstFFTF64 * self, gdouble * timedata, GstFFTWindow window)
 {
   gint i, len;
+  gdouble *coeffs;
 
   g_return_if_fail (self);
   g_return_if_fail (timedata);
 
   len = self->len;
 
-  switch (window) {
-    case GST_FFT_WINDOW_RECTANGULAR:
-      /* do nothing */
-      break;
-    case GST_FFT_WINDOW_HAMMING:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.53836 - 0.46164 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_HANN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.5 - 0.5 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_BARTLETT:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (1.0 - fabs ((2.0 * i - len) / len));
-      break;
-    case GST_FFT_WINDOW_BLACKMAN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.42 - 0.5 * cos ((2.0 * i) / len) +
-            0.08 * cos ((4.0 * i) / len));
-      break;
-    default:
-      g_assert_not_reached ();
-      break;
+  if (window == GST_FFT_WINDOW_RECTANGULAR)
+    return;
+
+  /* the coefficients only depend on the window type and the length of
+   * this instance, so compute them once and reuse them afterwards */
+  if (self->window_coeffs == NULL || self->window_type != window) {
+    if (self->window_coeffs == NULL)
+      self->window_coeffs = g_new (gdouble, len);
+
+    coeffs = self->window_coeffs;
+    switch (window) {
+      case GST_FFT_WINDOW_HAMMING:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (0.53836 - 0.46164 * cos (2.0 * G_PI * i / len));
+        break;
+      case GST_FFT_WINDOW_HANN:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (0.5 - 0.5 * cos (2.0 * G_PI * i / len));
+        break;
+      case GST_FFT_WINDOW_BARTLETT:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (1.0 - fabs ((2.0 * i - len) / len));
+        break;
+      case GST_FFT_WINDOW_BLACKMAN:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (0.42 - 0.5 * cos ((2.0 * i) / len) +
+              0.08 * cos ((4.0 * i) / len));
+        break;
+      default:
+        g_assert_not_reached ();
+        break;
+    }
+    self->window_type = window;
   }
+
+  coeffs = self->window_coeffs;
+  for (i = 0; i < len; i++)
+    timedata[i] *= coeffs[i];
 }
@@ -66,6 +66,10 @@ struct _GstFFTS32
   void *cfg;
   gboolean inverse;
   gint len;
+
+  /* cached coefficients of the last window function applied */
+  gdouble *window_coeffs;
+  GstFFTWindow window_type;
 };
 
 /**
@@ -169,6 +173,7 @@ gst_fft_s32_inverse_fft (GstFFTS32 * self, const GstFFTS32Complex * freqdata,
 void
 gst_fft_s32_free (GstFFTS32 * self)
 {
+  g_free (self->window_coeffs);
   g_free (self);
 }
 
@@ -185,35 +190,49 @@ void
 gst_fft_s32_window (GstFFTS32 * self, gint32 * timedata, GstFFTWindow window)
 {
   gint i, len;
+  gdouble *coeffs;
 
   g_return_if_fail (self);
   g_return_if_fail (timedata);
 
   len = self->len;
 
-  switch (window) {
-    case GST_FFT_WINDOW_RECTANGULAR:
-      /* do nothing */
-      break;
-    case GST_FFT_WINDOW_HAMMING:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.53836 - 0.46164 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_HANN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.5 - 0.5 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_BARTLETT:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (1.0 - fabs ((2.0 * i - len) / len));
-      break;
-    case GST_FFT_WINDOW_BLACKMAN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.42 - 0.5 * cos ((2.0 * i) / len) +
-            0.08 * cos ((4.0 * i) / len));
-      break;
-    default:
-      g_assert_not_reached ();
-      break;
+  if (window == GST_FFT_WINDOW_RECTANGULAR)
+    return;
+
+  /* the coefficients only depend on the window type and the length of
+   * this instance, so compute them once and reuse them afterwards */
+  if (self->window_coeffs == NULL || self->window_type != window) {
+    if (self->window_coeffs == NULL)
+      self->window_coeffs = g_new (gdouble, len);
+
+    coeffs = self->window_coeffs;
+    switch (window) {
+      case GST_FFT_WINDOW_HAMMING:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (0.53836 - 0.46164 * cos (2.0 * G_PI * i / len));
+        break;
+      case GST_FFT_WINDOW_HANN:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (0.5 - 0.5 * cos (2.0 * G_PI * i / len));
+        break;
+      case GST_FFT_WINDOW_BARTLETT:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (1.0 - fabs ((2.0 * i - len) / len));
+        break;
+      case GST_FFT_WINDOW_BLACKMAN:
+        for (i = 0; i < len; i++)
+          coeffs[i] = (0.42 - 0.5 * cos ((2.0 * i) / len) +
+              0.08 * cos ((4.0 * i) / len));
+        break;
+      default:
+        g_assert_not_reached ();
+        break;
+    }
+    self->window_type = window;
   }
+
+  coeffs = self->window_coeffs;
+  for (i = 0; i < len; i++)
+    timedata[i] *= coeffs[i];
 }
@@ -2411,6 +2411,85 @@ _unbind_buffer (GstGLColorConvert * convert)
   }
 }
 
+/* Compiled stages are cached on the GstGLContext and shared between all
+ * converters using it, so renegotiations and multiple converter instances
+ * only pay the compilation cost once per source. Compilation dominates
+ * (re)configuration time on embedded drivers while attaching and linking a
+ * program is cheap, and caching stages rather than linked programs keeps
+ * uniform values per-converter. */
+static GQuark
+_stage_cache_quark (void)
+{
+  static GQuark quark = 0;
+
+  if (!quark)
+    quark = g_quark_from_static_string ("GstGLColorConvertStageCache");
+
+  return quark;
+}
+
+static GstGLSLStage *
+_create_stage_cached (GstGLColorConvert * convert, guint type,
+    GstGLSLVersion version, GstGLSLProfile profile, gint n_strings,
+    const gchar ** strings, GError ** error)
+{
+  GstGLContext *context = convert->context;
+  GHashTable *cache;
+  GstGLSLStage *stage;
+  GString *key_str;
+  gchar *key;
+  gint i;
+
+  key_str = g_string_new (NULL);
+  g_string_append_printf (key_str, "%u:%u:%u:", type, version, profile);
+  for (i = 0; i < n_strings; i++)
+    g_string_append (key_str, strings[i]);
+  key = g_compute_checksum_for_string (G_CHECKSUM_SHA256, key_str->str,
+      key_str->len);
+  g_string_free (key_str, TRUE);
+
+  GST_OBJECT_LOCK (context);
+  cache = g_object_get_qdata (G_OBJECT (context), _stage_cache_quark ());
+  if (!cache) {
+    cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+        gst_object_unref);
+    g_object_set_qdata_full (G_OBJECT (context), _stage_cache_quark (), cache,
+        (GDestroyNotify) g_hash_table_unref);
+  }
+  stage = g_hash_table_lookup (cache, key);
+  if (stage)
+    gst_object_ref (stage);
+  GST_OBJECT_UNLOCK (context);
+
+  if (stage) {
+    GST_LOG_OBJECT (convert, "reusing cached compiled stage for key %s", key);
+    g_free (key);
+    return stage;
+  }
+
+  stage = gst_glsl_stage_new_with_strings (context, type, version, profile,
+      n_strings, strings);
+  if (!stage) {
+    g_set_error (error, GST_GLSL_ERROR, GST_GLSL_ERROR_COMPILE,
+        "Failed to create stage");
+    g_free (key);
+    return NULL;
+  }
+  gst_object_ref_sink (stage);
+
+  if (!gst_glsl_stage_compile (stage, error)) {
+    gst_object_unref (stage);
+    g_free (key);
+    return NULL;
+  }
+
+  GST_OBJECT_LOCK (context);
+  g_hash_table_replace (cache, key, gst_object_ref (stage));
+  GST_OBJECT_UNLOCK (context);
+
+  return stage;
+}
+
 static GstGLShader *
 _create_shader (GstGLColorConvert * convert)
 {
@@ -2438,25 +2517,26 @@ _create_shader (GstGLColorConvert * convert)
 
   strings[0] = version_str;
   strings[1] = tmp;
-  if (!(stage = gst_glsl_stage_new_with_strings (convert->context,
-              GL_VERTEX_SHADER, version, profile, 2, strings))) {
-    GST_ERROR_OBJECT (convert, "Failed to create vertex stage");
+  stage = _create_stage_cached (convert, GL_VERTEX_SHADER, version, profile,
+      2, strings, &error);
+  g_free (tmp);
+  if (!stage) {
+    GST_ERROR_OBJECT (convert, "Failed to compile vertex shader %s",
+        error->message);
+    g_clear_error (&error);
     g_free (version_str);
-    g_free (tmp);
     gst_object_unref (ret);
     return NULL;
   }
-  g_free (tmp);
 
-  if (!gst_gl_shader_compile_attach_stage (ret, stage, &error)) {
-    GST_ERROR_OBJECT (convert, "Failed to compile vertex shader %s",
-        error->message);
-    g_clear_error (&error);
+  if (!gst_gl_shader_attach (ret, stage)) {
+    GST_ERROR_OBJECT (convert, "Failed to attach vertex stage");
     g_free (version_str);
     gst_object_unref (stage);
     gst_object_unref (ret);
     return NULL;
   }
+  gst_object_unref (stage);
 
   if (info->templ->extensions)
     g_string_append (str, info->templ->extensions);
@@ -2546,26 +2626,28 @@ _create_shader (GstGLColorConvert * convert)
   g_free (tmp);
 
   strings[1] = info->frag_prog;
-  if (!(stage = gst_glsl_stage_new_with_strings (convert->context,
-              GL_FRAGMENT_SHADER, version, profile, 2, strings))) {
-    GST_ERROR_OBJECT (convert, "Failed to create fragment stage");
+  stage = _create_stage_cached (convert, GL_FRAGMENT_SHADER, version, profile,
+      2, strings, &error);
+  g_free (version_str);
+  if (!stage) {
+    GST_ERROR_OBJECT (convert, "Failed to compile fragment shader %s",
+        error->message);
+    g_clear_error (&error);
     g_free (info->frag_prog);
     info->frag_prog = NULL;
-    g_free (version_str);
     gst_object_unref (ret);
     return NULL;
   }
-  g_free (version_str);
-  if (!gst_gl_shader_compile_attach_stage (ret, stage, &error)) {
-    GST_ERROR_OBJECT (convert, "Failed to compile fragment shader %s",
-        error->message);
-    g_clear_error (&error);
+
+  if (!gst_gl_shader_attach (ret, stage)) {
+    GST_ERROR_OBJECT (convert, "Failed to attach fragment stage");
     g_free (info->frag_prog);
     info->frag_prog = NULL;
     gst_object_unref (stage);
     gst_object_unref (ret);
     return NULL;
   }
+  gst_object_unref (stage);
 
   if (!gst_gl_shader_link (ret, &error)) {
     GST_ERROR_OBJECT (convert, "Failed to link shader %s", error->message);
@@ -501,6 +501,14 @@ struct DmabufUpload
   GstVideoInfo out_info;
   /* only used for pointer comparison */
   gpointer out_caps;
+
+  /* cached direct import support as reported by the driver, only valid for
+   * @checked_format/@checked_target */
+  GstVideoFormat checked_format;
+  GstGLTextureTarget checked_target;
+  gboolean checked_result;
+
+  GstGLMemoryAllocator *allocator;
 };
 
 static GstStaticCaps _dma_buf_upload_caps =
@@ -735,10 +743,21 @@ _dma_buf_upload_accept (gpointer impl, GstBuffer * buffer, GstCaps * in_caps,
   }
 
   if (dmabuf->direct) {
-    /* Check if this format is supported by the driver */
+    GstVideoFormat format = GST_VIDEO_INFO_FORMAT (in_info);
+
+    /* Check if this format is supported by the driver. The answer only
+     * depends on the format and target, so don't query the driver again for
+     * every buffer. */
     dmabuf->n_mem = 1;
-    if (!gst_egl_image_check_dmabuf_direct (dmabuf->upload->context, in_info,
-            dmabuf->target)) {
+    if (format != dmabuf->checked_format ||
+        dmabuf->target != dmabuf->checked_target) {
+      dmabuf->checked_result =
+          gst_egl_image_check_dmabuf_direct (dmabuf->upload->context, in_info,
+          dmabuf->target);
+      dmabuf->checked_format = format;
+      dmabuf->checked_target = dmabuf->target;
+    }
+    if (!dmabuf->checked_result) {
       GST_DEBUG_OBJECT (dmabuf->upload, "direct check failed");
       return FALSE;
     }
@@ -788,17 +807,16 @@ static void
 _dma_buf_upload_perform_gl_thread (GstGLContext * context,
     struct DmabufUpload *dmabuf)
 {
-  GstGLMemoryAllocator *allocator;
-
-  allocator =
-      GST_GL_MEMORY_ALLOCATOR (gst_allocator_find
-      (GST_GL_MEMORY_EGL_ALLOCATOR_NAME));
+  if (!dmabuf->allocator)
+    dmabuf->allocator =
+        GST_GL_MEMORY_ALLOCATOR (gst_allocator_find
+        (GST_GL_MEMORY_EGL_ALLOCATOR_NAME));
 
   /* FIXME: buffer pool */
   dmabuf->outbuf = gst_buffer_new ();
-  gst_gl_memory_setup_buffer (allocator, dmabuf->outbuf, dmabuf->params,
-      dmabuf->formats, (gpointer *) dmabuf->eglimage, dmabuf->n_mem);
-  gst_object_unref (allocator);
+  gst_gl_memory_setup_buffer (dmabuf->allocator, dmabuf->outbuf,
+      dmabuf->params, dmabuf->formats, (gpointer *) dmabuf->eglimage,
+      dmabuf->n_mem);
 }
 
 static GstGLUploadReturn
@@ -836,6 +854,7 @@ _dma_buf_upload_free (gpointer impl)
 
   if (dmabuf->params)
     gst_gl_allocation_params_free ((GstGLAllocationParams *) dmabuf->params);
+  gst_clear_object (&dmabuf->allocator);
 
   g_free (impl);
 }
@@ -1489,6 +1489,10 @@ discoverer_collect (GstDiscoverer * dc)
       dc->priv->current_info->result == GST_DISCOVERER_OK) {
     GVariant *variant = gst_discoverer_info_to_variant (dc->priv->current_info,
         GST_DISCOVERER_SERIALIZE_ALL);
+    gchar *cache_dir = g_path_get_dirname (dc->priv->current_info->cachefile);
+
+    g_mkdir_with_parents (cache_dir, 0777);
+    g_free (cache_dir);
 
     g_file_set_contents (dc->priv->current_info->cachefile,
         g_variant_get_data (variant), g_variant_get_size (variant), NULL);
@@ -1790,10 +1794,12 @@ _serialized_info_get_path (GstDiscoverer * dc, gchar * uri)
 
   hash_dirname[0] = checksum[0];
   hash_dirname[1] = checksum[1];
+  /* only build the path here; the directory is created when a result is
+   * actually written, so cache lookups during a large scan don't create
+   * directories for entries that are never stored */
   cache_dir =
       g_build_filename (g_get_user_cache_dir (), "gstreamer-" GST_API_VERSION,
       CACHE_DIRNAME, hash_dirname, NULL);
-  g_mkdir_with_parents (cache_dir, 0777);
 
   res = g_build_filename (cache_dir, &checksum[2], NULL);
 
@@ -1559,6 +1559,12 @@ typedef struct
   GstClockTime pts;
   guint64 offset;
   guint32 rtptime;
+  /* header extension layout, determined once per pushed buffer/list */
+  gboolean have_exts;
+  GstRTPHeaderExtensionFlags ext_flags;
+  gsize ext_allocated_size;
+  gsize ext_hdr_unit_size;
+  guint16 ext_bit_pattern;
 } HeaderData;
 
 static gboolean
@@ -1727,33 +1733,20 @@ set_headers (GstBuffer ** buffer, guint idx, gpointer user_data)
   gst_rtp_buffer_set_timestamp (&rtp, data->rtptime);
 
   GST_OBJECT_LOCK (data->payload);
-  if (data->payload->priv->header_exts->len > 0
-      && data->payload->priv->input_meta_buffer) {
+  if (data->have_exts) {
     guint wordlen;
     gsize extlen;
-    guint16 bit_pattern;
 
-    /* write header extensions */
+    if (data->ext_flags == 0)
+      goto unsupported_flags;
+
+    /* write header extensions, using the flags and sizes determined once for
+     * the whole buffer/list in gst_rtp_base_payload_prepare_push() */
     hdrext.payload = data->payload;
     hdrext.output = *buffer;
-    /* XXX: pre-calculate these flags and sizes? */
-    hdrext.flags =
-        GST_RTP_HEADER_EXTENSION_ONE_BYTE | GST_RTP_HEADER_EXTENSION_TWO_BYTE;
-    g_ptr_array_foreach (data->payload->priv->header_exts,
-        (GFunc) determine_header_extension_flags_size, &hdrext);
-    hdrext.hdr_unit_size = 0;
-    if (hdrext.flags & GST_RTP_HEADER_EXTENSION_ONE_BYTE) {
-      /* prefer the one byte header */
-      hdrext.hdr_unit_size = 1;
-      /* TODO: support mixed size writing modes, i.e. RFC8285 */
-      hdrext.flags &= ~GST_RTP_HEADER_EXTENSION_TWO_BYTE;
-      bit_pattern = 0xBEDE;
-    } else if (hdrext.flags & GST_RTP_HEADER_EXTENSION_TWO_BYTE) {
-      hdrext.hdr_unit_size = 2;
-      bit_pattern = 0x1000;
-    } else {
-      goto unsupported_flags;
-    }
+    hdrext.flags = data->ext_flags;
+    hdrext.allocated_size = data->ext_allocated_size;
+    hdrext.hdr_unit_size = data->ext_hdr_unit_size;
 
     extlen =
         hdrext.hdr_unit_size * data->payload->priv->header_exts->len +
@@ -1762,7 +1755,7 @@ set_headers (GstBuffer ** buffer, guint idx, gpointer user_data)
 
     /* XXX: do we need to add to any existing extension data instead of
      * overwriting everything? */
-    gst_rtp_buffer_set_extension_data (&rtp, bit_pattern, wordlen);
+    gst_rtp_buffer_set_extension_data (&rtp, data->ext_bit_pattern, wordlen);
     gst_rtp_buffer_get_extension_data (&rtp, NULL, (gpointer) & hdrext.data,
         &wordlen);
 
@@ -1779,7 +1772,7 @@ set_headers (GstBuffer ** buffer, guint idx, gpointer user_data)
       memset (&hdrext.data[hdrext.written_size], 0,
           wordlen * 4 - hdrext.written_size);
 
-      gst_rtp_buffer_set_extension_data (&rtp, bit_pattern, wordlen);
+      gst_rtp_buffer_set_extension_data (&rtp, data->ext_bit_pattern, wordlen);
     } else {
       gst_rtp_buffer_remove_extension_data (&rtp);
     }
@@ -1850,6 +1843,42 @@ gst_rtp_base_payload_prepare_push (GstRTPBasePayload * payload,
   data.ssrc = payload->current_ssrc;
   data.pt = payload->pt;
 
+  /* the header extension flags and sizes only depend on the negotiated
+   * extensions and the input buffer, so determine them once here instead of
+   * for every packet in the list */
+  data.have_exts = FALSE;
+  data.ext_flags = 0;
+  GST_OBJECT_LOCK (payload);
+  if (priv->header_exts->len > 0 && priv->input_meta_buffer) {
+    HeaderExt hdrext = { NULL, };
+
+    data.have_exts = TRUE;
+
+    hdrext.payload = payload;
+    hdrext.flags =
+        GST_RTP_HEADER_EXTENSION_ONE_BYTE | GST_RTP_HEADER_EXTENSION_TWO_BYTE;
+    g_ptr_array_foreach (priv->header_exts,
+        (GFunc) determine_header_extension_flags_size, &hdrext);
+    if (hdrext.flags & GST_RTP_HEADER_EXTENSION_ONE_BYTE) {
+      /* prefer the one byte header */
+      hdrext.hdr_unit_size = 1;
+      /* TODO: support mixed size writing modes, i.e. RFC8285 */
+      hdrext.flags &= ~GST_RTP_HEADER_EXTENSION_TWO_BYTE;
+      data.ext_bit_pattern = 0xBEDE;
+    } else if (hdrext.flags & GST_RTP_HEADER_EXTENSION_TWO_BYTE) {
+      hdrext.hdr_unit_size = 2;
+      data.ext_bit_pattern = 0x1000;
+    } else {
+      hdrext.flags = 0;
+      hdrext.hdr_unit_size = 0;
+    }
+
+    data.ext_flags = hdrext.flags;
+    data.ext_allocated_size = hdrext.allocated_size;
+    data.ext_hdr_unit_size = hdrext.hdr_unit_size;
+  }
+  GST_OBJECT_UNLOCK (payload);
+
   /* find the first buffer with a timestamp */
   if (is_list) {
     data.dts = -1;
@@ -364,35 +364,58 @@ gst_rtp_buffer_map (GstBuffer * buffer, GstMapFlags flags, GstRTPBuffer * rtp)
 
   rtp->size[0] = header_len;
 
-  bufsize = gst_buffer_get_size (buffer);
+  if (n_mem == 1)
+    bufsize = size;
+  else
+    bufsize = gst_buffer_get_size (buffer);
 
   /* calc extension length when present. */
   if (data[0] & 0x10) {
     guint8 *extdata;
     gsize extlen;
 
-    /* find memory for the extension bits, we find the block for the first 4
-     * bytes, all other extension bytes should also be in this block */
-    if (!gst_buffer_find_memory (buffer, header_len, 4, &idx, &length, &skip))
-      goto wrong_length;
-
-    if (!gst_buffer_map_range (buffer, idx, length, &rtp->map[1], flags))
-      goto map_failed;
+    if (n_mem == 1 && (flags & GST_MAP_WRITE) == 0) {
+      /* single block mapped read-only: the extension is contiguous with the
+       * header, so point into the mapping we already have instead of doing
+       * another find/map cycle. Writable maps keep a separate mapping of the
+       * extension block because the mutation API relies on it. */
+      if (G_UNLIKELY (size < header_len + 4))
+        goto wrong_length;
 
-    extdata = rtp->data[1] = rtp->map[1].data + skip;
-    /* skip id */
-    extdata += 2;
-    /* read length as the number of 32 bits words */
-    extlen = GST_READ_UINT16_BE (extdata);
-    extlen *= sizeof (guint32);
-    /* add id and length */
-    extlen += 4;
+      extdata = rtp->data[1] = data + header_len;
+      /* skip id, read length as the number of 32 bits words, add id and
+       * length */
+      extlen = GST_READ_UINT16_BE (extdata + 2) * sizeof (guint32) + 4;
 
-    /* all extension bytes must be in this block */
-    if (G_UNLIKELY (rtp->map[1].size < extlen))
-      goto wrong_length;
+      if (G_UNLIKELY (size - header_len < extlen))
+        goto wrong_length;
 
-    rtp->size[1] = extlen;
+      rtp->size[1] = extlen;
+    } else {
+      /* find memory for the extension bits, we find the block for the first 4
+       * bytes, all other extension bytes should also be in this block */
+      if (!gst_buffer_find_memory (buffer, header_len, 4, &idx, &length,
+              &skip))
+        goto wrong_length;
+
+      if (!gst_buffer_map_range (buffer, idx, length, &rtp->map[1], flags))
+        goto map_failed;
+
+      extdata = rtp->data[1] = rtp->map[1].data + skip;
+      /* skip id */
+      extdata += 2;
+      /* read length as the number of 32 bits words */
+      extlen = GST_READ_UINT16_BE (extdata);
+      extlen *= sizeof (guint32);
+      /* add id and length */
+      extlen += 4;
+
+      /* all extension bytes must be in this block */
+      if (G_UNLIKELY (rtp->map[1].size < extlen))
+        goto wrong_length;
+
+      rtp->size[1] = extlen;
+    }
 
     header_len += rtp->size[1];
   } else {
@@ -403,19 +426,30 @@ gst_rtp_buffer_map (GstBuffer * buffer, GstMapFlags flags, GstRTPBuffer * rtp)
   /* check for padding unless flags says to skip */
   if ((data[0] & 0x20) != 0 &&
       (flags & GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING) == 0) {
-    /* find memory for the padding bits */
-    if (!gst_buffer_find_memory (buffer, bufsize - 1, 1, &idx, &length, &skip))
-      goto wrong_length;
+    if (n_mem == 1 && (flags & GST_MAP_WRITE) == 0) {
+      /* single block mapped read-only, the padding is at the end of it */
+      padding = data[size - 1];
+      rtp->data[3] = data + size - padding;
+      rtp->size[3] = padding;
+
+      if (padding > size)
+        goto wrong_length;
+    } else {
+      /* find memory for the padding bits */
+      if (!gst_buffer_find_memory (buffer, bufsize - 1, 1, &idx, &length,
+              &skip))
+        goto wrong_length;
 
-    if (!gst_buffer_map_range (buffer, idx, length, &rtp->map[3], flags))
-      goto map_failed;
+      if (!gst_buffer_map_range (buffer, idx, length, &rtp->map[3], flags))
+        goto map_failed;
 
-    padding = rtp->map[3].data[skip];
-    rtp->data[3] = rtp->map[3].data + skip + 1 - padding;
-    rtp->size[3] = padding;
+      padding = rtp->map[3].data[skip];
+      rtp->data[3] = rtp->map[3].data + skip + 1 - padding;
+      rtp->size[3] = padding;
 
-    if (skip + 1 < padding)
-      goto wrong_length;
+      if (skip + 1 < padding)
+        goto wrong_length;
+    }
   } else {
     rtp->data[3] = NULL;
     rtp->size[3] = 0;
@@ -367,6 +367,7 @@ struct _GstVideoConverter
   GstStructure *config;
 
   GstParallelizedTaskRunner *conversion_runner;
+  gint slice_counter;           /* atomic */
 
   guint16 **tmpline;
 
@@ -3223,7 +3224,9 @@ typedef struct
 {
   GstLineCache *pack_lines;
   gint idx;
-  gint h_0, h_1;
+  gint out_height;
+  gint lines_per_slice;
+  gint *slice_counter;
   gint pack_lines_count;
   gint out_y;
   gboolean identity_pack;
@@ -3236,20 +3239,34 @@ convert_generic_task (ConvertTask * task)
 {
   gint i;
 
-  for (i = task->h_0; i < task->h_1; i += task->pack_lines_count) {
-    gpointer *lines;
-
-    /* load the lines needed to pack */
-    lines =
-        gst_line_cache_get_lines (task->pack_lines, task->idx, i + task->out_y,
-        i, task->pack_lines_count);
+  /* pull slices from the shared counter until the frame is done. A thread
+   * that finished its slice early simply takes the next one, which keeps
+   * all threads busy when the per-line cost varies over the frame. The
+   * counter is monotonic so each thread sees its lines in increasing order
+   * and the per-thread line caches keep working forward. */
+  while (TRUE) {
+    gint h_0, h_1;
 
-    if (!task->identity_pack) {
-      /* take away the border */
-      guint8 *l = ((guint8 *) lines[0]) - task->lb_width;
-      /* and pack into destination */
-      GST_DEBUG ("pack line %d %p (%p)", i + task->out_y, lines[0], l);
-      PACK_FRAME (task->dest, l, i + task->out_y, task->out_maxwidth);
+    h_0 = g_atomic_int_add (task->slice_counter, 1) * task->lines_per_slice;
+    if (h_0 >= task->out_height)
+      break;
+    h_1 = MIN (h_0 + task->lines_per_slice, task->out_height);
+
+    for (i = h_0; i < h_1; i += task->pack_lines_count) {
+      gpointer *lines;
+
+      /* load the lines needed to pack */
+      lines =
+          gst_line_cache_get_lines (task->pack_lines, task->idx,
+          i + task->out_y, i, task->pack_lines_count);
+
+      if (!task->identity_pack) {
+        /* take away the border */
+        guint8 *l = ((guint8 *) lines[0]) - task->lb_width;
+        /* and pack into destination */
+        GST_DEBUG ("pack line %d %p (%p)", i + task->out_y, lines[0], l);
+        PACK_FRAME (task->dest, l, i + task->out_y, task->out_maxwidth);
+      }
     }
   }
 }
@@ -3266,7 +3283,7 @@ video_converter_generic (GstVideoConverter * convert, const GstVideoFrame * src,
   ConvertTask *tasks;
   ConvertTask **tasks_p;
   gint n_threads;
-  gint lines_per_thread;
+  gint lines_per_slice;
 
   out_height = convert->out_height;
   out_maxwidth = convert->out_maxwidth;
@@ -3321,8 +3338,15 @@ video_converter_generic (GstVideoConverter * convert, const GstVideoFrame * src,
   tasks_p = convert->tasks_p[0] =
       g_renew (ConvertTask *, convert->tasks_p[0], n_threads);
 
-  lines_per_thread =
-      GST_ROUND_UP_N ((out_height + n_threads - 1) / n_threads, pack_lines);
+  /* use slices a few times smaller than the per-thread share so that
+   * threads that run ahead take over work from slower ones, while keeping
+   * the slices big enough that the line caches mostly work on contiguous
+   * ranges */
+  lines_per_slice =
+      GST_ROUND_UP_N (MAX ((out_height + n_threads - 1) / (n_threads * 4), 8),
+      pack_lines);
+
+  g_atomic_int_set (&convert->slice_counter, 0);
 
   for (i = 0; i < n_threads; i++) {
     tasks[i].dest = dest;
@@ -3334,8 +3358,9 @@ video_converter_generic (GstVideoConverter * convert, const GstVideoFrame * src,
     tasks[i].lb_width = lb_width;
     tasks[i].out_maxwidth = out_maxwidth;
 
-    tasks[i].h_0 = i * lines_per_thread;
-    tasks[i].h_1 = MIN ((i + 1) * lines_per_thread, out_height);
+    tasks[i].out_height = out_height;
+    tasks[i].lines_per_slice = lines_per_slice;
+    tasks[i].slice_counter = &convert->slice_counter;
 
     tasks_p[i] = &tasks[i];
   }
@@ -567,11 +567,87 @@ unpack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   guint16 y0, y1, y2, y3, y4, y5;
   guint16 u0, u2, u4;
   guint16 v0, v2, v4;
+  gint full;
 
   if (x != 0)
     GST_FIXME ("Horizontal offsets are not supported for v210");
 
-  for (i = 0; i < width; i += 6) {
+  /* process the groups of 6 pixels that are fully inside the line without
+   * the per-pixel guards needed for the tail, so the compiler is free to
+   * vectorize the bit shuffling */
+  full = (width / 6) * 6;
+
+  for (i = 0; i < full; i += 6) {
+    a0 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 0);
+    a1 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 4);
+    a2 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 8);
+    a3 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 12);
+
+    u0 = ((a0 >> 0) & 0x3ff) << 6;
+    y0 = ((a0 >> 10) & 0x3ff) << 6;
+    v0 = ((a0 >> 20) & 0x3ff) << 6;
+    y1 = ((a1 >> 0) & 0x3ff) << 6;
+
+    u2 = ((a1 >> 10) & 0x3ff) << 6;
+    y2 = ((a1 >> 20) & 0x3ff) << 6;
+    v2 = ((a2 >> 0) & 0x3ff) << 6;
+    y3 = ((a2 >> 10) & 0x3ff) << 6;
+
+    u4 = ((a2 >> 20) & 0x3ff) << 6;
+    y4 = ((a3 >> 0) & 0x3ff) << 6;
+    v4 = ((a3 >> 10) & 0x3ff) << 6;
+    y5 = ((a3 >> 20) & 0x3ff) << 6;
+
+    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+      y0 |= (y0 >> 10);
+      y1 |= (y1 >> 10);
+      u0 |= (u0 >> 10);
+      v0 |= (v0 >> 10);
+
+      y2 |= (y2 >> 10);
+      y3 |= (y3 >> 10);
+      u2 |= (u2 >> 10);
+      v2 |= (v2 >> 10);
+
+      y4 |= (y4 >> 10);
+      y5 |= (y5 >> 10);
+      u4 |= (u4 >> 10);
+      v4 |= (v4 >> 10);
+    }
+
+    d[4 * (i + 0) + 0] = 0xffff;
+    d[4 * (i + 0) + 1] = y0;
+    d[4 * (i + 0) + 2] = u0;
+    d[4 * (i + 0) + 3] = v0;
+
+    d[4 * (i + 1) + 0] = 0xffff;
+    d[4 * (i + 1) + 1] = y1;
+    d[4 * (i + 1) + 2] = u0;
+    d[4 * (i + 1) + 3] = v0;
+
+    d[4 * (i + 2) + 0] = 0xffff;
+    d[4 * (i + 2) + 1] = y2;
+    d[4 * (i + 2) + 2] = u2;
+    d[4 * (i + 2) + 3] = v2;
+
+    d[4 * (i + 3) + 0] = 0xffff;
+    d[4 * (i + 3) + 1] = y3;
+    d[4 * (i + 3) + 2] = u2;
+    d[4 * (i + 3) + 3] = v2;
+
+    d[4 * (i + 4) + 0] = 0xffff;
+    d[4 * (i + 4) + 1] = y4;
+    d[4 * (i + 4) + 2] = u4;
+    d[4 * (i + 4) + 3] = v4;
+
+    d[4 * (i + 5) + 0] = 0xffff;
+    d[4 * (i + 5) + 1] = y5;
+    d[4 * (i + 5) + 2] = u4;
+    d[4 * (i + 5) + 3] = v4;
+  }
+
+  /* last partial group */
+  for (; i < width; i += 6) {
     a0 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 0);
     a1 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 4);
     a2 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 8);
@@ -660,8 +736,45 @@ pack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   guint16 y0, y1, y2, y3, y4, y5;
   guint16 u0, u1, u2;
   guint16 v0, v1, v2;
+  gint full;
+
+  /* process the groups of 6 pixels that are fully inside the line without
+   * the per-pixel guards needed for the tail, so the compiler is free to
+   * vectorize the bit shuffling */
+  full = (width / 6) * 6;
+
+  for (i = 0; i < full; i += 6) {
+    y0 = s[4 * (i + 0) + 1] >> 6;
+    u0 = s[4 * (i + 0) + 2] >> 6;
+    v0 = s[4 * (i + 0) + 3] >> 6;
+
+    y1 = s[4 * (i + 1) + 1] >> 6;
+
+    y2 = s[4 * (i + 2) + 1] >> 6;
+    u1 = s[4 * (i + 2) + 2] >> 6;
+    v1 = s[4 * (i + 2) + 3] >> 6;
+
+    y3 = s[4 * (i + 3) + 1] >> 6;
+
+    y4 = s[4 * (i + 4) + 1] >> 6;
+    u2 = s[4 * (i + 4) + 2] >> 6;
+    v2 = s[4 * (i + 4) + 3] >> 6;
+
+    y5 = s[4 * (i + 5) + 1] >> 6;
+
+    a0 = u0 | (y0 << 10) | (v0 << 20);
+    a1 = y1 | (u1 << 10) | (y2 << 20);
+    a2 = v1 | (y3 << 10) | (u2 << 20);
+    a3 = y4 | (v2 << 10) | (y5 << 20);
+
+    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 0, a0);
+    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 4, a1);
+    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 8, a2);
+    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 12, a3);
+  }
 
-  for (i = 0; i < width; i += 6) {
+  /* last partial group */
+  for (; i < width; i += 6) {
     y1 = y2 = y3 = y4 = y5 = 0;
     u1 = u2 = v1 = v2 = 0;
 
@@ -60,6 +60,8 @@
 #include "config.h"
 #endif
 
+#include <string.h>
+
 #include "gstaudiomixerelements.h"
 #include "gstaudiomixerorc.h"
 
@@ -313,8 +315,18 @@ gst_audiomixer_aggregate_one_buffer (GstAudioAggregator * aagg,
   GST_LOG_OBJECT (pad, "mixing %u bytes at offset %u from offset %u",
       num_frames * bpf, out_offset * bpf, in_offset * bpf);
 
-  /* further buffers, need to add them */
-  if (pad->volume == 1.0) {
+  if (pad->volume == 1.0
+      && GST_BUFFER_FLAG_IS_SET (outbuf, GST_BUFFER_FLAG_GAP)) {
+    /* The output buffer still only contains silence: the base class fills
+     * new output buffers with silence and only clears the GAP flag once a
+     * pad was mixed into them. The first unity-volume pad can therefore be
+     * copied in directly instead of read-modify-writing the silence, which
+     * matters when most pads are muted or gapping and a single pad ends up
+     * providing the output */
+    memcpy (outmap.data + out_offset * bpf, inmap.data + in_offset * bpf,
+        num_frames * bpf);
+  } else if (pad->volume == 1.0) {
+    /* further buffers, need to add them */
     switch (srcpad->info.finfo->format) {
       case GST_AUDIO_FORMAT_U8:
         audiomixer_orc_add_u8 ((gpointer) (outmap.data + out_offset * bpf),
@@ -96,7 +96,77 @@ method##_ ##name (GstVideoFrame * srcframe, gint xpos, gint ypos, \
   } \
 }
 
-#define OVERLAY_A32_LOOP(name)			\
+/* per-scanline alpha classification for the A32 formats: scanlines that are
+ * fully opaque can be copied instead of blended and fully transparent ones
+ * can be skipped entirely. Graphics and logo sources typically consist of
+ * long runs of such scanlines. */
+enum
+{
+  A32_ROW_TRANSPARENT,
+  A32_ROW_OPAQUE,
+  A32_ROW_MIXED
+};
+
+static inline guint
+_a32_row_alpha_class (const guint8 * row, gint alpha_off, gint width)
+{
+  guint8 and_acc = 0xff, or_acc = 0;
+  gint i;
+
+  row += alpha_off;
+  for (i = 0; i < width; i++) {
+    and_acc &= row[4 * i];
+    or_acc |= row[4 * i];
+  }
+
+  if (and_acc == 0xff)
+    return A32_ROW_OPAQUE;
+  if (or_acc == 0)
+    return A32_ROW_TRANSPARENT;
+  return A32_ROW_MIXED;
+}
+
+typedef void (*A32OrcBlendFunc) (guint8 * dest, int dest_stride,
+    const guint8 * src, int src_stride, int alpha, int width, int height);
+
+/* blend a fully opaque (s_alpha == 255) source by classifying runs of
+ * scanlines: opaque runs degrade to memcpy, transparent runs are skipped and
+ * only mixed runs go through the full per-pixel blend */
+static void
+_blend_a32_alpha_runs (guint8 * dest, const guint8 * src, gint src_height,
+    gint src_width, gint src_stride, gint dest_stride, gint alpha_off,
+    A32OrcBlendFunc orc_blend)
+{
+  gint y = 0;
+
+  while (y < src_height) {
+    gint run_start = y;
+    guint klass = _a32_row_alpha_class (src + y * src_stride, alpha_off,
+        src_width);
+
+    do {
+      y++;
+    } while (y < src_height &&
+        _a32_row_alpha_class (src + y * src_stride, alpha_off,
+            src_width) == klass);
+
+    if (klass == A32_ROW_TRANSPARENT)
+      continue;
+
+    if (klass == A32_ROW_OPAQUE) {
+      gint i;
+
+      for (i = run_start; i < y; i++)
+        memcpy (dest + i * dest_stride, src + i * src_stride, 4 * src_width);
+    } else {
+      orc_blend (dest + run_start * dest_stride, dest_stride,
+          src + run_start * src_stride, src_stride, 255, src_width,
+          y - run_start);
+    }
+  }
+}
+
+#define OVERLAY_A32_LOOP(name, alpha_off)	\
 static inline void \
 _overlay_loop_##name (guint8 * dest, const guint8 * src, gint src_height, \
     gint src_width, gint src_stride, gint dest_stride, guint s_alpha, \
@@ -118,8 +188,13 @@ _overlay_loop_##name (guint8 * dest, const guint8 * src, gint src_height, \
       } \
       break;\
     case COMPOSITOR_BLEND_MODE_OVER:\
-      compositor_orc_overlay_##name (dest, dest_stride, src, src_stride, \
-        s_alpha, src_width, src_height); \
+      if (s_alpha == 255) { \
+        _blend_a32_alpha_runs (dest, src, src_height, src_width, src_stride, \
+          dest_stride, alpha_off, compositor_orc_overlay_##name); \
+      } else { \
+        compositor_orc_overlay_##name (dest, dest_stride, src, src_stride, \
+          s_alpha, src_width, src_height); \
+      } \
       break;\
     case COMPOSITOR_BLEND_MODE_ADD:\
       compositor_orc_overlay_##name##_addition (dest, dest_stride, src, src_stride, \
@@ -128,7 +203,7 @@ _overlay_loop_##name (guint8 * dest, const guint8 * src, gint src_height, \
   }\
 }
 
-#define BLEND_A32_LOOP(name) \
+#define BLEND_A32_LOOP(name, alpha_off) \
 static inline void \
 _blend_loop_##name (guint8 * dest, const guint8 * src, gint src_height, \
     gint src_width, gint src_stride, gint dest_stride, guint s_alpha, \
@@ -152,16 +227,21 @@ _blend_loop_##name (guint8 * dest, const guint8 * src, gint src_height, \
     case COMPOSITOR_BLEND_MODE_OVER:\
     case COMPOSITOR_BLEND_MODE_ADD:\
       /* both modes are the same for opaque background */ \
-      compositor_orc_blend_##name (dest, dest_stride, src, src_stride, \
-        s_alpha, src_width, src_height); \
+      if (s_alpha == 255) { \
+        _blend_a32_alpha_runs (dest, src, src_height, src_width, src_stride, \
+          dest_stride, alpha_off, compositor_orc_blend_##name); \
+      } else { \
+        compositor_orc_blend_##name (dest, dest_stride, src, src_stride, \
+          s_alpha, src_width, src_height); \
+      } \
       break;\
   }\
 }
 
-OVERLAY_A32_LOOP (argb);
-OVERLAY_A32_LOOP (bgra);
-BLEND_A32_LOOP (argb);
-BLEND_A32_LOOP (bgra);
+OVERLAY_A32_LOOP (argb, 0);
+OVERLAY_A32_LOOP (bgra, 3);
+BLEND_A32_LOOP (argb, 0);
+BLEND_A32_LOOP (bgra, 3);
 
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
 BLEND_A32 (argb, blend, _blend_loop_argb);
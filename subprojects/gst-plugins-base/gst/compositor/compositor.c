@@ -742,6 +742,7 @@ gst_compositor_pad_init (GstCompositorPad * compo_pad)
 #define DEFAULT_BACKGROUND COMPOSITOR_BACKGROUND_CHECKER
 #define DEFAULT_ZERO_SIZE_IS_UNSCALED TRUE
 #define DEFAULT_MAX_THREADS 0
+#define DEFAULT_SKIP_UNCHANGED FALSE
 
 enum
 {
@@ -750,8 +751,128 @@ enum
   PROP_ZERO_SIZE_IS_UNSCALED,
   PROP_MAX_THREADS,
   PROP_IGNORE_INACTIVE_PADS,
+  PROP_SKIP_UNCHANGED,
 };
 
+/* snapshot of one sink pad as it contributed to the cached output frame,
+ * used to detect whether re-blending can be skipped. The buffer reference
+ * makes pointer comparison against the pad's current buffer safe: as long
+ * as we hold the reference the buffer cannot be returned to a pool and its
+ * content cannot legally change. */
+typedef struct
+{
+  GstCompositorPad *pad;
+  GstBuffer *buffer;
+
+  gint xpos, ypos;
+  gint width, height;
+  gdouble alpha;
+  GstCompositorSizingPolicy sizing_policy;
+  GstCompositorOperator op;
+} GstCompositorCachePad;
+
+static void
+gst_compositor_cache_pad_clear (GstCompositorCachePad * cpad)
+{
+  gst_clear_buffer (&cpad->buffer);
+}
+
+/* must be called with the object lock taken (except from finalize) */
+static void
+gst_compositor_cache_clear (GstCompositor * self)
+{
+  gst_clear_buffer (&self->cache_outbuf);
+  if (self->cache_pads) {
+    g_array_unref (self->cache_pads);
+    self->cache_pads = NULL;
+  }
+}
+
+/* must be called with the object lock taken */
+static gboolean
+gst_compositor_cache_matches (GstCompositor * self)
+{
+  GstVideoAggregator *vagg = GST_VIDEO_AGGREGATOR (self);
+  GList *l;
+  guint i = 0;
+
+  if (self->cache_outbuf == NULL || self->cache_pads == NULL)
+    return FALSE;
+
+  if (self->cache_background != self->background ||
+      self->cache_zero_size_is_unscaled != self->zero_size_is_unscaled)
+    return FALSE;
+
+  if (!gst_video_info_is_equal (&self->cache_info, &vagg->info))
+    return FALSE;
+
+  for (l = GST_ELEMENT (vagg)->sinkpads; l; l = l->next) {
+    GstVideoAggregatorPad *vpad = l->data;
+    GstCompositorPad *pad = GST_COMPOSITOR_PAD (vpad);
+    GstCompositorCachePad *cpad;
+
+    if (i >= self->cache_pads->len)
+      return FALSE;
+
+    cpad = &g_array_index (self->cache_pads, GstCompositorCachePad, i);
+    i++;
+
+    if (cpad->pad != pad)
+      return FALSE;
+
+    if (cpad->buffer != gst_video_aggregator_pad_get_current_buffer (vpad))
+      return FALSE;
+
+    /* x_offset/y_offset are derived from these, no need to compare them */
+    if (cpad->xpos != pad->xpos || cpad->ypos != pad->ypos ||
+        cpad->width != pad->width || cpad->height != pad->height ||
+        cpad->alpha != pad->alpha || cpad->op != pad->op ||
+        cpad->sizing_policy != pad->sizing_policy)
+      return FALSE;
+  }
+
+  return i == self->cache_pads->len;
+}
+
+/* must be called with the object lock taken */
+static void
+gst_compositor_cache_update (GstCompositor * self, GstBuffer * outbuf)
+{
+  GstVideoAggregator *vagg = GST_VIDEO_AGGREGATOR (self);
+  GList *l;
+
+  gst_compositor_cache_clear (self);
+
+  self->cache_pads =
+      g_array_new (FALSE, FALSE, sizeof (GstCompositorCachePad));
+  g_array_set_clear_func (self->cache_pads,
+      (GDestroyNotify) gst_compositor_cache_pad_clear);
+
+  for (l = GST_ELEMENT (vagg)->sinkpads; l; l = l->next) {
+    GstVideoAggregatorPad *vpad = l->data;
+    GstCompositorPad *pad = GST_COMPOSITOR_PAD (vpad);
+    GstBuffer *buffer = gst_video_aggregator_pad_get_current_buffer (vpad);
+    GstCompositorCachePad cpad;
+
+    cpad.pad = pad;
+    cpad.buffer = buffer ? gst_buffer_ref (buffer) : NULL;
+    cpad.xpos = pad->xpos;
+    cpad.ypos = pad->ypos;
+    cpad.width = pad->width;
+    cpad.height = pad->height;
+    cpad.alpha = pad->alpha;
+    cpad.sizing_policy = pad->sizing_policy;
+    cpad.op = pad->op;
+
+    g_array_append_val (self->cache_pads, cpad);
+  }
+
+  self->cache_outbuf = gst_buffer_ref (outbuf);
+  self->cache_info = vagg->info;
+  self->cache_background = self->background;
+  self->cache_zero_size_is_unscaled = self->zero_size_is_unscaled;
+}
+
 static void
 gst_compositor_get_property (GObject * object,
     guint prop_id, GValue * value, GParamSpec * pspec)
@@ -772,6 +893,9 @@ gst_compositor_get_property (GObject * object,
       g_value_set_boolean (value,
           gst_aggregator_get_ignore_inactive_pads (GST_AGGREGATOR (object)));
       break;
+    case PROP_SKIP_UNCHANGED:
+      g_value_set_boolean (value, self->skip_unchanged);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -798,6 +922,13 @@ gst_compositor_set_property (GObject * object,
       gst_aggregator_set_ignore_inactive_pads (GST_AGGREGATOR (object),
           g_value_get_boolean (value));
       break;
+    case PROP_SKIP_UNCHANGED:
+      GST_OBJECT_LOCK (self);
+      self->skip_unchanged = g_value_get_boolean (value);
+      if (!self->skip_unchanged)
+        gst_compositor_cache_clear (self);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1489,6 +1620,10 @@ gst_composior_stop (GstAggregator * agg)
   gst_clear_buffer (&self->intermediate_frame);
   g_clear_pointer (&self->intermediate_convert, gst_video_converter_free);
 
+  GST_OBJECT_LOCK (self);
+  gst_compositor_cache_clear (self);
+  GST_OBJECT_UNLOCK (self);
+
   return GST_AGGREGATOR_CLASS (parent_class)->stop (agg);
 }
 
@@ -1651,6 +1786,32 @@ gst_compositor_aggregate_frames (GstVideoAggregator * vagg, GstBuffer * outbuf)
 
   outframe = &out_frame;
 
+  if (compositor->skip_unchanged) {
+    GstBuffer *cached = NULL;
+
+    GST_OBJECT_LOCK (vagg);
+    if (gst_compositor_cache_matches (compositor))
+      cached = gst_buffer_ref (compositor->cache_outbuf);
+    GST_OBJECT_UNLOCK (vagg);
+
+    if (cached) {
+      GstVideoFrame cached_frame;
+
+      /* the cache stores the final output, so this also skips the
+       * intermediate conversion */
+      if (gst_video_frame_map (&cached_frame, &vagg->info, cached,
+              GST_MAP_READ)) {
+        GST_LOG_OBJECT (vagg, "inputs unchanged, reusing previous frame");
+        gst_video_frame_copy (&out_frame, &cached_frame);
+        gst_video_frame_unmap (&cached_frame);
+        gst_video_frame_unmap (&out_frame);
+        gst_buffer_unref (cached);
+        return GST_FLOW_OK;
+      }
+      gst_buffer_unref (cached);
+    }
+  }
+
   if (compositor->intermediate_frame) {
     if (!gst_video_frame_map (&intermediate_frame,
             &compositor->intermediate_info, compositor->intermediate_frame,
@@ -1772,6 +1933,11 @@ gst_compositor_aggregate_frames (GstVideoAggregator * vagg, GstBuffer * outbuf)
 
   gst_video_frame_unmap (&out_frame);
 
+  GST_OBJECT_LOCK (vagg);
+  if (compositor->skip_unchanged)
+    gst_compositor_cache_update (compositor, outbuf);
+  GST_OBJECT_UNLOCK (vagg);
+
   return GST_FLOW_OK;
 }
 
@@ -1939,6 +2105,8 @@ gst_compositor_finalize (GObject * object)
     gst_parallelized_task_runner_free (compositor->blend_runner);
   compositor->blend_runner = NULL;
 
+  gst_compositor_cache_clear (compositor);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -2032,6 +2200,26 @@ gst_compositor_class_init (GstCompositorClass * klass)
           "Avoid timing out waiting for inactive pads", FALSE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * compositor:skip-unchanged:
+   *
+   * Reuse the previously composited frame when neither the input buffers
+   * nor the pad properties changed since the last aggregation cycle, e.g.
+   * when a low framerate logo is mixed over a high framerate stream.
+   *
+   * When enabled, the element keeps a reference to the last output buffer
+   * it pushed, which prevents downstream from modifying it in place and
+   * keeps one extra buffer of the downstream pool in use, which is why
+   * this is off by default.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_SKIP_UNCHANGED,
+      g_param_spec_boolean ("skip-unchanged", "Skip unchanged",
+          "Reuse the previous output frame when no input changed "
+          "instead of re-blending all inputs", DEFAULT_SKIP_UNCHANGED,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_type_mark_as_plugin_api (GST_TYPE_COMPOSITOR_PAD, 0);
   gst_type_mark_as_plugin_api (GST_TYPE_COMPOSITOR_OPERATOR, 0);
   gst_type_mark_as_plugin_api (GST_TYPE_COMPOSITOR_BACKGROUND, 0);
@@ -2044,6 +2232,7 @@ gst_compositor_init (GstCompositor * self)
   self->background = DEFAULT_BACKGROUND;
   self->zero_size_is_unscaled = DEFAULT_ZERO_SIZE_IS_UNSCALED;
   self->max_threads = DEFAULT_MAX_THREADS;
+  self->skip_unchanged = DEFAULT_SKIP_UNCHANGED;
 }
 
 /* GstChildProxy implementation */
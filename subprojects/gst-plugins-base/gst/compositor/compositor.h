@@ -154,6 +154,18 @@ struct _GstCompositor
   GstVideoConverter *intermediate_convert;
 
   GstParallelizedTaskRunner *blend_runner;
+
+  /* Property to reuse the previously composited frame when neither the input
+   * buffers nor the pad properties changed since the last aggregation cycle,
+   * instead of re-blending all inputs. The cache below snapshots the inputs
+   * that produced the last output; all of it is protected by the object lock
+   * of the aggregator. */
+  gboolean skip_unchanged;
+  GArray *cache_pads;
+  GstBuffer *cache_outbuf;
+  GstVideoInfo cache_info;
+  GstCompositorBackground cache_background;
+  gboolean cache_zero_size_is_unscaled;
 };
 
 /**
@@ -432,24 +432,61 @@ gst_encode_base_bin_dispose (GObject * object)
   G_OBJECT_CLASS (gst_encode_base_bin_parent_class)->dispose (object);
 }
 
+/* Global cache of the factory lists, shared between all encodebin instances
+ * and refreshed when the registry changes. Building these lists walks the
+ * whole registry four times, which is a measurable part of creating an
+ * encodebin for applications spinning up one per transcode job. */
+static GMutex factories_lock;
+static guint32 factories_cookie = 0;
+static GList *cached_muxers = NULL;
+static GList *cached_formatters = NULL;
+static GList *cached_encoders = NULL;
+static GList *cached_parsers = NULL;
+
 static void
-gst_encode_base_bin_init (GstEncodeBaseBin * encode_bin)
+gst_encode_base_bin_update_factories_list (GstEncodeBaseBin * encode_bin)
 {
-  encode_bin->muxers =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_MUXER,
-      GST_RANK_MARGINAL);
-
-  encode_bin->formatters =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_FORMATTER,
-      GST_RANK_SECONDARY);
-
-  encode_bin->encoders =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_ENCODER,
-      GST_RANK_MARGINAL);
+  guint32 cookie;
+
+  g_mutex_lock (&factories_lock);
+  cookie = gst_registry_get_feature_list_cookie (gst_registry_get ());
+  if (!cached_muxers || factories_cookie != cookie) {
+    if (cached_muxers)
+      gst_plugin_feature_list_free (cached_muxers);
+    if (cached_formatters)
+      gst_plugin_feature_list_free (cached_formatters);
+    if (cached_encoders)
+      gst_plugin_feature_list_free (cached_encoders);
+    if (cached_parsers)
+      gst_plugin_feature_list_free (cached_parsers);
+
+    cached_muxers =
+        gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_MUXER,
+        GST_RANK_MARGINAL);
+    cached_formatters =
+        gst_element_factory_list_get_elements
+        (GST_ELEMENT_FACTORY_TYPE_FORMATTER, GST_RANK_SECONDARY);
+    cached_encoders =
+        gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_ENCODER,
+        GST_RANK_MARGINAL);
+    cached_parsers =
+        gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_PARSER,
+        GST_RANK_MARGINAL);
+
+    factories_cookie = cookie;
+  }
+
+  encode_bin->muxers = gst_plugin_feature_list_copy (cached_muxers);
+  encode_bin->formatters = gst_plugin_feature_list_copy (cached_formatters);
+  encode_bin->encoders = gst_plugin_feature_list_copy (cached_encoders);
+  encode_bin->parsers = gst_plugin_feature_list_copy (cached_parsers);
+  g_mutex_unlock (&factories_lock);
+}
 
-  encode_bin->parsers =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_PARSER,
-      GST_RANK_MARGINAL);
+static void
+gst_encode_base_bin_init (GstEncodeBaseBin * encode_bin)
+{
+  gst_encode_base_bin_update_factories_list (encode_bin);
 
   encode_bin->raw_video_caps = gst_caps_from_string ("video/x-raw");
   encode_bin->raw_audio_caps = gst_caps_from_string ("audio/x-raw");
@@ -258,6 +258,9 @@ struct _GstDecodebin3
   GList *decoder_factories;
   /* DECODABLE but not DECODER factories */
   GList *decodable_factories;
+  /* MRU list of CachedDecoderList, most recent first. Re-tuning to a stream
+   * with already-seen caps then skips the factory filtering/scoring */
+  GList *cached_decoder_lists;
 
   /* counters for pads */
   guint32 apadcount, vpadcount, tpadcount, opadcount;
@@ -485,7 +488,30 @@ static GstStateChangeReturn gst_decodebin3_change_state (GstElement * element,
 static gboolean gst_decodebin3_send_event (GstElement * element,
     GstEvent * event);
 
+/* Filtered decoder factory list for a given caps, kept in an MRU list so
+ * that re-tuning to already-seen caps skips the registry filtering.
+ *
+ * Maximum amount of cached lists: adaptive streams regularly update the
+ * fixed caps (resolution, ...) so keep enough entries around for a handful
+ * of programs without growing without bounds */
+#define MAX_CACHED_DECODER_LISTS 16
+
+typedef struct
+{
+  GstCaps *caps;
+  GList *factories;
+} CachedDecoderList;
+
+static void
+cached_decoder_list_free (CachedDecoderList * cached)
+{
+  gst_caps_unref (cached->caps);
+  gst_plugin_feature_list_free (cached->factories);
+  g_free (cached);
+}
+
 static void gst_decode_bin_update_factories_list (GstDecodebin3 * dbin);
+static GList *get_decoder_factory_list (GstDecodebin3 * dbin, GstCaps * caps);
 #if 0
 static gboolean have_factory (GstDecodebin3 * dbin, GstCaps * caps,
     GstElementFactoryListType ftype);
@@ -709,6 +735,9 @@ gst_decodebin3_dispose (GObject * object)
     g_list_free (dbin->decodable_factories);
     dbin->decodable_factories = NULL;
   }
+  g_list_free_full (dbin->cached_decoder_lists,
+      (GDestroyNotify) cached_decoder_list_free);
+  dbin->cached_decoder_lists = NULL;
 
   gst_clear_object (&dbin->collection);
 
@@ -1240,10 +1269,7 @@ is_parsebin_required_for_input (GstDecodebin3 * dbin, DecodebinInput * input,
     /* If the incoming caps are compatible with a decoder, we don't need to
      * process it before */
     g_mutex_lock (&dbin->factories_lock);
-    gst_decode_bin_update_factories_list (dbin);
-    decoder_list =
-        gst_element_factory_list_filter (dbin->decoder_factories, newcaps,
-        GST_PAD_SINK, TRUE);
+    decoder_list = get_decoder_factory_list (dbin, newcaps);
     g_mutex_unlock (&dbin->factories_lock);
     if (decoder_list) {
       GST_FIXME_OBJECT (sinkpad, "parsebin not needed (available decoders) !");
@@ -1488,6 +1514,9 @@ gst_decode_bin_update_factories_list (GstDecodebin3 * dbin)
       g_list_free (dbin->decoder_factories);
     if (dbin->decodable_factories)
       g_list_free (dbin->decodable_factories);
+    g_list_free_full (dbin->cached_decoder_lists,
+        (GDestroyNotify) cached_decoder_list_free);
+    dbin->cached_decoder_lists = NULL;
     dbin->factories =
         gst_element_factory_list_get_elements
         (GST_ELEMENT_FACTORY_TYPE_DECODABLE, GST_RANK_MARGINAL);
@@ -2677,15 +2706,61 @@ have_factory (GstDecodebin3 * dbin, GstCaps * caps,
 }
 #endif
 
+/* Must be called with factories lock! Returns a filtered list of decoder
+ * factories for @caps, served from the MRU cache when the caps were seen
+ * before. */
 static GList *
-create_decoder_factory_list (GstDecodebin3 * dbin, GstCaps * caps)
+get_decoder_factory_list (GstDecodebin3 * dbin, GstCaps * caps)
 {
-  GList *res;
+  GList *tmp, *res;
+  CachedDecoderList *cached;
 
-  g_mutex_lock (&dbin->factories_lock);
   gst_decode_bin_update_factories_list (dbin);
+
+  for (tmp = dbin->cached_decoder_lists; tmp; tmp = tmp->next) {
+    cached = tmp->data;
+    if (gst_caps_is_equal (cached->caps, caps)) {
+      /* move to the front of the MRU list */
+      if (tmp != dbin->cached_decoder_lists) {
+        dbin->cached_decoder_lists =
+            g_list_remove_link (dbin->cached_decoder_lists, tmp);
+        dbin->cached_decoder_lists =
+            g_list_concat (tmp, dbin->cached_decoder_lists);
+      }
+      GST_LOG_OBJECT (dbin, "Using cached factory list for %" GST_PTR_FORMAT,
+          caps);
+      return gst_plugin_feature_list_copy (cached->factories);
+    }
+  }
+
   res = gst_element_factory_list_filter (dbin->decoder_factories,
       caps, GST_PAD_SINK, TRUE);
+
+  cached = g_new0 (CachedDecoderList, 1);
+  cached->caps = gst_caps_ref (caps);
+  cached->factories = gst_plugin_feature_list_copy (res);
+  dbin->cached_decoder_lists =
+      g_list_prepend (dbin->cached_decoder_lists, cached);
+
+  /* drop the least recently used entry when the cache is full */
+  if (g_list_length (dbin->cached_decoder_lists) > MAX_CACHED_DECODER_LISTS) {
+    GList *last = g_list_last (dbin->cached_decoder_lists);
+
+    cached_decoder_list_free (last->data);
+    dbin->cached_decoder_lists =
+        g_list_delete_link (dbin->cached_decoder_lists, last);
+  }
+
+  return res;
+}
+
+static GList *
+create_decoder_factory_list (GstDecodebin3 * dbin, GstCaps * caps)
+{
+  GList *res;
+
+  g_mutex_lock (&dbin->factories_lock);
+  res = get_decoder_factory_list (dbin, caps);
   g_mutex_unlock (&dbin->factories_lock);
   return res;
 }
@@ -444,7 +444,8 @@ enum
   PROP_VIDEO_FILTER,
   PROP_MULTIVIEW_MODE,
   PROP_MULTIVIEW_FLAGS,
-  PROP_INSTANT_URI
+  PROP_INSTANT_URI,
+  PROP_PREBUFFER_NEXT_URI
 };
 
 /* signals */
@@ -839,6 +840,21 @@ gst_play_bin3_class_init (GstPlayBin3Class * klass)
           "When enabled, URI changes are applied immediately", FALSE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstPlayBin3:prebuffer-next-uri:
+   *
+   * A uri queued from #GstPlayBin3::about-to-finish (or set while another one
+   * is playing) is started and pre-buffered in the background right away, so
+   * that switching to it does not have to wait for connection setup and
+   * preroll.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_klass, PROP_PREBUFFER_NEXT_URI,
+      g_param_spec_boolean ("prebuffer-next-uri", "Pre-buffer next URI",
+          "When enabled, queued URIs are started and pre-buffered immediately",
+          FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstPlayBin3::about-to-finish
    * @playbin: a #GstPlayBin3
@@ -1528,6 +1544,10 @@ gst_play_bin3_set_property (GObject * object, guint prop_id,
       g_object_set_property ((GObject *) playbin->uridecodebin,
           "instant-uri", value);
       break;
+    case PROP_PREBUFFER_NEXT_URI:
+      g_object_set_property ((GObject *) playbin->uridecodebin,
+          "prebuffer-next-uri", value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1704,6 +1724,10 @@ gst_play_bin3_get_property (GObject * object, guint prop_id, GValue * value,
       g_object_get_property ((GObject *) playbin->uridecodebin,
           "instant-uri", value);
       break;
+    case PROP_PREBUFFER_NEXT_URI:
+      g_object_get_property ((GObject *) playbin->uridecodebin,
+          "prebuffer-next-uri", value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -226,6 +226,7 @@ struct _GstURIDecodeBin3
   gboolean use_buffering;
   guint64 ring_buffer_max_size;
   gboolean instant_uri;         /* Whether URI changes should be applied immediately or not */
+  gboolean prebuffer_next_uri;  /* Whether queued URIs should be started immediately */
 
   /* Mutex to protect play_items/input_item/output_item */
   GMutex play_items_lock;
@@ -300,6 +301,7 @@ enum
 #define DEFAULT_USE_BUFFERING       FALSE
 #define DEFAULT_RING_BUFFER_MAX_SIZE 0
 #define DEFAULT_INSTANT_URI         FALSE
+#define DEFAULT_PREBUFFER_NEXT_URI  FALSE
 
 enum
 {
@@ -316,7 +318,8 @@ enum
   PROP_USE_BUFFERING,
   PROP_RING_BUFFER_MAX_SIZE,
   PROP_CAPS,
-  PROP_INSTANT_URI
+  PROP_INSTANT_URI,
+  PROP_PREBUFFER_NEXT_URI
 };
 
 static guint gst_uri_decode_bin3_signals[LAST_SIGNAL] = { 0 };
@@ -515,6 +518,24 @@ gst_uri_decode_bin3_class_init (GstURIDecodeBin3Class * klass)
           "When enabled, URI changes are applied immediately",
           DEFAULT_INSTANT_URI, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstURIDecodeBin3:prebuffer-next-uri:
+   *
+   * Start queued URIs immediately instead of waiting for the current one to
+   * be about to finish. The upcoming source and parsing chain are brought up
+   * in the background with their pads blocked, so switching to the next item
+   * does not have to wait for connection setup and preroll anymore. Memory
+   * use stays bounded by the queues inside the source chain, which fill up
+   * and then block until the switch happens.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_PREBUFFER_NEXT_URI,
+      g_param_spec_boolean ("prebuffer-next-uri", "Pre-buffer next URI",
+          "When enabled, queued URIs are started and pre-buffered immediately",
+          DEFAULT_PREBUFFER_NEXT_URI,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstURIDecodebin3::select-stream
    * @decodebin: a #GstURIDecodebin3
@@ -1533,6 +1554,11 @@ gst_uri_decode_bin3_set_property (GObject * object, guint prop_id,
       dec->instant_uri = g_value_get_boolean (value);
       GST_OBJECT_UNLOCK (dec);
       break;
+    case PROP_PREBUFFER_NEXT_URI:
+      GST_OBJECT_LOCK (dec);
+      dec->prebuffer_next_uri = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1625,6 +1651,11 @@ gst_uri_decode_bin3_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value, dec->instant_uri);
       GST_OBJECT_UNLOCK (dec);
       break;
+    case PROP_PREBUFFER_NEXT_URI:
+      GST_OBJECT_LOCK (dec);
+      g_value_set_boolean (value, dec->prebuffer_next_uri);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1866,6 +1897,12 @@ gst_uri_decode_bin3_set_uri (GstURIDecodeBin3 * dec, const gchar * uri)
       GST_DEBUG_OBJECT (dec, "Starting new entry (gapless mode)");
       start_item = TRUE;
     }
+  } else if (dec->prebuffer_next_uri && item != dec->input_item) {
+    /* Bring up the source and parsing chain right away. The pads of items
+     * which are not the current input item will be blocked in
+     * src_pad_added_cb() until we switch to them */
+    GST_DEBUG_OBJECT (dec, "Pre-buffering new entry");
+    start_item = TRUE;
   }
 
   if (start_item) {
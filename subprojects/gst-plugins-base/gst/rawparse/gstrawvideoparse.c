@@ -96,6 +96,7 @@ enum
   PROP_PLANE_OFFSETS,
   PROP_FRAME_SIZE,
   PROP_COLORIMETRY,
+  PROP_ZERO_COPY,
 };
 
 #define DEFAULT_WIDTH                 320
@@ -108,6 +109,7 @@ enum
 #define DEFAULT_INTERLACED            FALSE
 #define DEFAULT_TOP_FIELD_FIRST       FALSE
 #define DEFAULT_FRAME_STRIDE          0
+#define DEFAULT_ZERO_COPY             FALSE
 
 #define GST_RAW_VIDEO_PARSE_CAPS \
         GST_VIDEO_CAPS_MAKE(GST_VIDEO_FORMATS_ALL) "; "
@@ -320,6 +322,26 @@ gst_raw_video_parse_class_init (GstRawVideoParseClass * klass)
           "The video source colorimetry",
           NULL, G_PARAM_WRITABLE | G_PARAM_STATIC_STRINGS)
       );
+  /**
+   * GstRawVideoParse:zero-copy:
+   *
+   * If set to %TRUE, output buffers share the memory of the input buffers
+   * instead of being copied into a newly allocated, 32-byte aligned buffer.
+   * The attached #GstVideoMeta describes the actual plane offsets and
+   * strides, so downstream elements that map frames through the meta see
+   * the correct layout. Only enable this if downstream does not require
+   * specially aligned, contiguous memory.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (object_class,
+      PROP_ZERO_COPY,
+      g_param_spec_boolean ("zero-copy",
+          "Zero copy",
+          "Output buffers that share the input memory instead of copying frames "
+          "into newly allocated, aligned buffers",
+          DEFAULT_ZERO_COPY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+      );
 
   gst_element_class_set_static_metadata (element_class,
       "rawvideoparse",
@@ -343,6 +365,8 @@ gst_raw_video_parse_init (GstRawVideoParse * raw_video_parse)
   raw_video_parse->properties_config.ready = TRUE;
   raw_video_parse->properties_config.top_field_first = DEFAULT_TOP_FIELD_FIRST;
   raw_video_parse->properties_config.frame_size = DEFAULT_FRAME_STRIDE;
+
+  raw_video_parse->zero_copy = DEFAULT_ZERO_COPY;
 }
 
 static void
@@ -643,6 +667,11 @@ gst_raw_video_parse_set_property (GObject * object, guint prop_id,
 
       break;
     }
+    case PROP_ZERO_COPY:
+      GST_RAW_BASE_PARSE_CONFIG_MUTEX_LOCK (object);
+      raw_video_parse->zero_copy = g_value_get_boolean (value);
+      GST_RAW_BASE_PARSE_CONFIG_MUTEX_UNLOCK (object);
+      break;
 
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -755,6 +784,12 @@ gst_raw_video_parse_get_property (GObject * object, guint prop_id,
       GST_RAW_BASE_PARSE_CONFIG_MUTEX_UNLOCK (object);
       break;
 
+    case PROP_ZERO_COPY:
+      GST_RAW_BASE_PARSE_CONFIG_MUTEX_LOCK (object);
+      g_value_set_boolean (value, raw_video_parse->zero_copy);
+      GST_RAW_BASE_PARSE_CONFIG_MUTEX_UNLOCK (object);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -927,22 +962,31 @@ gst_raw_video_parse_process (GstRawBaseParse * raw_base_parse,
   GstVideoInfo *video_info = &(config_ptr->info);
   GstBuffer *out_data;
 
-  if (!gst_buffer_map (in_data, &map_info, GST_MAP_READ)) {
-    GST_WARNING_OBJECT (raw_video_parse, "Failed to map input data");
-    return FALSE;
-  }
+  if (raw_video_parse->zero_copy) {
+    /* Share the input memory instead of copying it. The video meta added
+     * below describes the actual plane offsets and strides, so downstream
+     * elements mapping the frame through the meta see the right layout */
+    *processed_data = out_data = gst_buffer_copy_region (in_data,
+        GST_BUFFER_COPY_MEMORY | GST_BUFFER_COPY_FLAGS |
+        GST_BUFFER_COPY_TIMESTAMPS, 0, GST_VIDEO_INFO_SIZE (video_info));
+  } else {
+    if (!gst_buffer_map (in_data, &map_info, GST_MAP_READ)) {
+      GST_WARNING_OBJECT (raw_video_parse, "Failed to map input data");
+      return FALSE;
+    }
 
-  /* Allocate the output memory our required alignment */
-  *processed_data = out_data = gst_buffer_new_allocate (NULL,
-      GST_VIDEO_INFO_SIZE (video_info), &alloc_params);
-  gst_buffer_fill (*processed_data, 0, map_info.data,
-      GST_VIDEO_INFO_SIZE (video_info));
-  gst_buffer_unmap (in_data, &map_info);
-
-  /* And copy the metadata */
-  gst_buffer_copy_into (*processed_data, in_data,
-      GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_TIMESTAMPS, 0,
-      GST_VIDEO_INFO_SIZE (video_info));
+    /* Allocate the output memory our required alignment */
+    *processed_data = out_data = gst_buffer_new_allocate (NULL,
+        GST_VIDEO_INFO_SIZE (video_info), &alloc_params);
+    gst_buffer_fill (*processed_data, 0, map_info.data,
+        GST_VIDEO_INFO_SIZE (video_info));
+    gst_buffer_unmap (in_data, &map_info);
+
+    /* And copy the metadata */
+    gst_buffer_copy_into (*processed_data, in_data,
+        GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_TIMESTAMPS, 0,
+        GST_VIDEO_INFO_SIZE (video_info));
+  }
 
   if (config_ptr->interlaced) {
     GST_BUFFER_FLAG_SET (out_data, GST_VIDEO_BUFFER_FLAG_INTERLACED);
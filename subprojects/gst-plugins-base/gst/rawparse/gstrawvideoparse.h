@@ -89,6 +89,10 @@ struct _GstRawVideoParse
   /* Currently active configuration. Points either to properties_config
    * or to sink_caps_config. This is never NULL. */
   GstRawVideoParseConfig *current_config;
+
+  /* If TRUE, output buffers share the input memory instead of being
+   * copied into a newly allocated, 32-byte aligned buffer. */
+  gboolean zero_copy;
 };
 
 G_END_DECLS
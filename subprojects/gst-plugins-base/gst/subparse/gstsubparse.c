@@ -473,27 +473,39 @@ static gchar *
 get_next_line (GstSubParse * self)
 {
   char *line = NULL;
+  const char *line_start;
   const char *line_end;
   int line_len;
   gboolean have_r = FALSE;
 
-  line_end = strchr (self->textbuf->str, '\n');
+  line_start = self->textbuf->str + self->textbuf_pos;
+  line_end = strchr (line_start, '\n');
 
   if (!line_end) {
-    /* end-of-line not found; return for more data */
+    /* end-of-line not found; drop what we consumed so far and return for
+     * more data */
+    if (self->textbuf_pos > 0) {
+      g_string_erase (self->textbuf, 0, self->textbuf_pos);
+      self->textbuf_pos = 0;
+    }
     return NULL;
   }
 
   /* get rid of '\r' */
-  if (line_end != self->textbuf->str && *(line_end - 1) == '\r') {
+  if (line_end != line_start && *(line_end - 1) == '\r') {
     line_end--;
     have_r = TRUE;
   }
 
-  line_len = line_end - self->textbuf->str;
-  line = g_strndup (self->textbuf->str, line_len);
-  self->textbuf = g_string_erase (self->textbuf, 0,
-      line_len + (have_r ? 2 : 1));
+  line_len = line_end - line_start;
+  line = g_strndup (line_start, line_len);
+
+  /* just advance our read position instead of erasing the line from the
+   * front of the buffer; erasing would memmove all remaining text for every
+   * single line, which gets quadratic when a whole file is buffered up, and
+   * that happens on every seek since we seek back to the start in BYTES
+   * format and re-feed the file */
+  self->textbuf_pos += line_len + (have_r ? 2 : 1);
   return line;
 }
 
@@ -1486,6 +1498,7 @@ feed_textbuf (GstSubParse * self, GstBuffer * buf)
     /* flush the parser state */
     parser_state_init (&self->state);
     g_string_truncate (self->textbuf, 0);
+    self->textbuf_pos = 0;
     gst_adapter_clear (self->adapter);
     if (self->parser_type == GST_SUB_PARSE_FORMAT_SAMI)
       sami_context_reset (&self->state);
@@ -1872,6 +1885,7 @@ gst_sub_parse_change_state (GstElement * element, GstStateChange transition)
       g_free (self->detected_encoding);
       self->detected_encoding = NULL;
       g_string_truncate (self->textbuf, 0);
+      self->textbuf_pos = 0;
       gst_adapter_clear (self->adapter);
       break;
     default:
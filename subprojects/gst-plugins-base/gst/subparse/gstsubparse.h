@@ -63,6 +63,8 @@ struct _GstSubParse {
   GstAdapter *adapter;
   /* contains the UTF-8 decoded input */
   GString *textbuf;
+  /* offset of the first line not yet consumed from @textbuf */
+  gsize textbuf_pos;
 
   GstSubParseFormat parser_type;
   gboolean parser_detected;
@@ -1609,6 +1609,7 @@ gst_multi_handle_sink_queue_buffer (GstMultiHandleSink * mhsink,
   GList *clients, *next;
   gint queuelen;
   gboolean hash_changed = FALSE;
+  gboolean need_action = FALSE;
   gint max_buffer_usage;
   gint i;
   GstClockTime now;
@@ -1635,8 +1636,10 @@ gst_multi_handle_sink_queue_buffer (GstMultiHandleSink * mhsink,
   GST_LOG_OBJECT (sink, "Using max %d, softmax %d", max_buffers,
       soft_max_buffers);
 
+  max_buffer_usage = 0;
+  now = g_get_monotonic_time () * GST_USECOND;
+
   /* then loop over the clients and update the positions */
-  cookie = mhsink->clients_cookie;
   for (clients = mhsink->clients; clients; clients = clients->next) {
     GstMultiHandleClient *mhclient = clients->data;
 
@@ -1660,10 +1663,25 @@ gst_multi_handle_sink_queue_buffer (GstMultiHandleSink * mhsink,
             "%s client %p not recovering position", mhclient->debug, mhclient);
       }
     }
+
+    /* remember whether any client needs to be removed or signaled, so we
+     * can skip the second walk over all clients in the common case where
+     * everybody is just keeping up */
+    if ((max_buffers > 0 && mhclient->bufpos >= max_buffers) ||
+        (mhsink->timeout > 0
+            && now - mhclient->last_activity_time_monotonic > mhsink->timeout)
+        || mhclient->bufpos == 0 || mhclient->new_connection)
+      need_action = TRUE;
+
+    /* keep track of maximum buffer usage */
+    if (mhclient->bufpos > max_buffer_usage)
+      max_buffer_usage = mhclient->bufpos;
   }
 
+  if (!need_action)
+    goto trim_queue;
+
   max_buffer_usage = 0;
-  now = g_get_monotonic_time () * GST_USECOND;
 
   /* now check for new or slow clients */
 restart:
@@ -1707,6 +1725,7 @@ restart:
     }
   }
 
+trim_queue:
   /* make sure we respect bytes-min, buffers-min and time-min when they are set */
   {
     gint usage, max;
@@ -2580,6 +2580,24 @@ mpeg_ts_type_find (GstTypeFind * tf, gpointer unused)
       size = GST_MPEGTS_TYPEFIND_SYNC_SIZE;
     }
 
+    /* Skip ahead to the next sync byte candidate with memchr(), which is
+     * vectorized by the libc, instead of re-evaluating the full header
+     * check on every single byte of a misaligned capture */
+    if (data[0] != 0x47) {
+      const guint8 *sync = memchr (data, 0x47, size);
+
+      if (sync == NULL) {
+        skipped += size;
+        size = 0;
+        continue;
+      }
+      skipped += sync - data;
+      size -= sync - data;
+      data = sync;
+      if (size < MPEGTS_HDR_SIZE)
+        continue;
+    }
+
     /* Have at least MPEGTS_HDR_SIZE bytes at this point */
     if (IS_MPEGTS_HEADER (data)) {
       gsize p;
@@ -733,6 +733,27 @@ gst_video_convert_scale_transform_meta (GstBaseTransform * trans,
   return TRUE;
 }
 
+/* All instances share one task pool capped at the number of processors, so
+ * pipelines with many parallel converters don't each spawn their own set of
+ * worker threads.  The pool is only used when n-threads > 1; with a single
+ * thread the conversion runs inline in the streaming thread as before. */
+static GstTaskPool *
+gst_video_convert_scale_get_task_pool (void)
+{
+  static GstTaskPool *pool = NULL;
+  static gsize init = 0;
+
+  if (g_once_init_enter (&init)) {
+    pool = gst_shared_task_pool_new ();
+    gst_shared_task_pool_set_max_threads (GST_SHARED_TASK_POOL (pool),
+        g_get_num_processors ());
+    gst_task_pool_prepare (pool, NULL);
+    g_once_init_leave (&init, 1);
+  }
+
+  return pool;
+}
+
 static gboolean
 gst_video_convert_scale_set_info (GstVideoFilter * filter, GstCaps * in,
     GstVideoInfo * in_info, GstCaps * out, GstVideoInfo * out_info)
@@ -900,7 +921,8 @@ gst_video_convert_scale_set_info (GstVideoFilter * filter, GstCaps * in,
         priv->primaries_mode, GST_VIDEO_CONVERTER_OPT_THREADS, G_TYPE_UINT,
         priv->n_threads, NULL);
 
-    priv->convert = gst_video_converter_new (in_info, out_info, options);
+    priv->convert = gst_video_converter_new_with_pool (in_info, out_info,
+        options, gst_video_convert_scale_get_task_pool ());
     if (priv->convert == NULL)
       goto no_convert;
   }
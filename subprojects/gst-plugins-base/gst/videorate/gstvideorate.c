@@ -672,10 +672,14 @@ gst_video_rate_init (GstVideoRate * videorate)
   gst_base_transform_set_gap_aware (GST_BASE_TRANSFORM (videorate), TRUE);
 }
 
-/* @outbuf: (transfer full) needs to be writable */
+/* @outbuf: (transfer full) needs to be writable.
+ * When @list is non-NULL the buffer is collected there instead of being
+ * pushed, so that runs of duplicates can go downstream as a single buffer
+ * list. */
 static GstFlowReturn
 gst_video_rate_push_buffer (GstVideoRate * videorate, GstBuffer * outbuf,
-    gboolean duplicate, GstClockTime next_intime, gboolean invalid_duration)
+    gboolean duplicate, GstClockTime next_intime, gboolean invalid_duration,
+    GstBufferList * list)
 {
   GstFlowReturn res;
   GstClockTime push_ts;
@@ -755,7 +759,12 @@ gst_video_rate_push_buffer (GstVideoRate * videorate, GstBuffer * outbuf,
       "old is best, dup, pushing buffer outgoing ts %" GST_TIME_FORMAT,
       GST_TIME_ARGS (push_ts));
 
-  res = gst_pad_push (GST_BASE_TRANSFORM_SRC_PAD (videorate), outbuf);
+  if (list) {
+    gst_buffer_list_add (list, outbuf);
+    res = GST_FLOW_OK;
+  } else {
+    res = gst_pad_push (GST_BASE_TRANSFORM_SRC_PAD (videorate), outbuf);
+  }
 
   return res;
 }
@@ -763,7 +772,7 @@ gst_video_rate_push_buffer (GstVideoRate * videorate, GstBuffer * outbuf,
 /* flush the oldest buffer */
 static GstFlowReturn
 gst_video_rate_flush_prev (GstVideoRate * videorate, gboolean duplicate,
-    GstClockTime next_intime, gboolean invalid_duration)
+    GstClockTime next_intime, gboolean invalid_duration, GstBufferList * list)
 {
   GstBuffer *outbuf;
 
@@ -775,7 +784,7 @@ gst_video_rate_flush_prev (GstVideoRate * videorate, gboolean duplicate,
   outbuf = gst_buffer_make_writable (outbuf);
 
   return gst_video_rate_push_buffer (videorate, outbuf, duplicate, next_intime,
-      invalid_duration);
+      invalid_duration, list);
 
   /* WARNINGS */
 eos_before_buffers:
@@ -891,7 +900,7 @@ gst_video_rate_duplicate_to_close_segment (GstVideoRate * videorate)
           last_input_ts, count < 1)) {
     res =
         gst_video_rate_flush_prev (videorate, count > 0, GST_CLOCK_TIME_NONE,
-        FALSE);
+        FALSE, NULL);
 
     count++;
   }
@@ -1061,7 +1070,7 @@ gst_video_rate_sink_event (GstBaseTransform * trans, GstEvent * event)
                   || count < 1)) {
             res =
                 gst_video_rate_flush_prev (videorate, count > 0,
-                GST_CLOCK_TIME_NONE, FALSE);
+                GST_CLOCK_TIME_NONE, FALSE, NULL);
             count++;
           }
         } else {
@@ -1069,7 +1078,7 @@ gst_video_rate_sink_event (GstBaseTransform * trans, GstEvent * event)
            * received a single buffer and not output framerate was set. */
           res =
               gst_video_rate_flush_prev (videorate, FALSE, GST_CLOCK_TIME_NONE,
-              TRUE);
+              TRUE, NULL);
           count = 1;
         }
       }
@@ -1574,13 +1583,13 @@ gst_video_rate_do_max_duplicate (GstVideoRate * videorate, GstBuffer * buffer,
     if (videorate->segment.rate < 0.0) {
       while (videorate->next_ts > prevtime) {
         gst_video_rate_flush_prev (videorate, *count > 0, GST_CLOCK_TIME_NONE,
-            FALSE);
+            FALSE, NULL);
         *count += 1;
       }
     } else {
       while (videorate->next_ts <= prevtime) {
         gst_video_rate_flush_prev (videorate, *count > 0, GST_CLOCK_TIME_NONE,
-            FALSE);
+            FALSE, NULL);
         *count += 1;
       }
     }
@@ -1772,7 +1781,7 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
          * GstBaseTransform can get its reference back. */
         if ((r = gst_video_rate_push_buffer (videorate,
                     gst_buffer_ref (buffer), FALSE,
-                    GST_CLOCK_TIME_NONE, FALSE)) != GST_FLOW_OK) {
+                    GST_CLOCK_TIME_NONE, FALSE, NULL)) != GST_FLOW_OK) {
           res = r;
           goto done;
         }
@@ -1782,6 +1791,7 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
     }
   } else {
     GstClockTime prevtime;
+    GstBufferList *dups = NULL;
     gint count = 0;
     gint64 diff1 = 0, diff2 = 0;
 
@@ -1898,9 +1908,13 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
         GstFlowReturn r;
         count++;
 
+        if (!dups)
+          dups = gst_buffer_list_new ();
+
         /* on error the _flush function posted a warning already */
         if ((r = gst_video_rate_flush_prev (videorate,
-                    count > 1, intime, FALSE)) != GST_FLOW_OK) {
+                    count > 1, intime, FALSE, dups)) != GST_FLOW_OK) {
+          gst_buffer_list_unref (dups);
           res = r;
           goto done;
         }
@@ -1911,6 +1925,26 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
     }
     while (diff1 < diff2);
 
+    /* push collected output in one go; a run of duplicates goes downstream
+     * as a single buffer list, a single buffer is pushed as before */
+    if (dups) {
+      GstFlowReturn r;
+
+      if (gst_buffer_list_length (dups) == 1) {
+        GstBuffer *outbuf = gst_buffer_ref (gst_buffer_list_get (dups, 0));
+
+        gst_buffer_list_unref (dups);
+        r = gst_pad_push (GST_BASE_TRANSFORM_SRC_PAD (videorate), outbuf);
+      } else {
+        r = gst_pad_push_list (GST_BASE_TRANSFORM_SRC_PAD (videorate), dups);
+      }
+
+      if (r != GST_FLOW_OK) {
+        res = r;
+        goto done;
+      }
+    }
+
     /* if we outputted the first buffer more then once, we have dups */
     if (count > 1) {
       videorate->dup += count - 1;
@@ -61,6 +61,7 @@ GST_DEBUG_CATEGORY_STATIC (video_test_src_debug);
 #define DEFAULT_FOREGROUND_COLOR   0xffffffff
 #define DEFAULT_BACKGROUND_COLOR   0xff000000
 #define DEFAULT_HORIZONTAL_SPEED   0
+#define DEFAULT_REUSE_PATTERN      FALSE
 
 enum
 {
@@ -86,6 +87,7 @@ enum
   PROP_ANIMATION_MODE,
   PROP_MOTION_TYPE,
   PROP_FLIP,
+  PROP_REUSE_PATTERN,
   PROP_LAST
 };
 
@@ -134,6 +136,8 @@ static gboolean gst_video_test_src_decide_allocation (GstBaseSrc * bsrc,
     GstQuery * query);
 static GstFlowReturn gst_video_test_src_fill (GstPushSrc * psrc,
     GstBuffer * buffer);
+static GstFlowReturn gst_video_test_src_create (GstPushSrc * psrc,
+    GstBuffer ** buffer);
 static gboolean gst_video_test_src_start (GstBaseSrc * basesrc);
 static gboolean gst_video_test_src_stop (GstBaseSrc * basesrc);
 
@@ -362,6 +366,24 @@ gst_video_test_src_class_init (GstVideoTestSrcClass * klass)
           G_MININT32, G_MAXINT32, DEFAULT_HORIZONTAL_SPEED,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstVideoTestSrc:reuse-pattern:
+   *
+   * For static patterns, push metadata-only copies sharing the memory of
+   * the pattern rendered once at negotiation, instead of copying it into a
+   * freshly allocated buffer for every frame. Only the timestamps differ
+   * between the pushed buffers, so a static source costs close to no CPU,
+   * but the buffers bypass the downstream-negotiated buffer pool and the
+   * same memory is pushed repeatedly, which not all sinks accept.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_REUSE_PATTERN,
+      g_param_spec_boolean ("reuse-pattern", "Reuse pattern",
+          "Push zero-copy references to the static pattern instead of "
+          "copying it into every buffer", DEFAULT_REUSE_PATTERN,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (gstelement_class,
       "Video test source", "Source/Video",
       "Creates a test video stream", "David A. Schleef <ds@schleef.org>");
@@ -379,6 +401,7 @@ gst_video_test_src_class_init (GstVideoTestSrcClass * klass)
   gstbasesrc_class->stop = gst_video_test_src_stop;
   gstbasesrc_class->decide_allocation = gst_video_test_src_decide_allocation;
 
+  gstpushsrc_class->create = gst_video_test_src_create;
   gstpushsrc_class->fill = gst_video_test_src_fill;
 
   gst_type_mark_as_plugin_api (GST_TYPE_VIDEO_TEST_SRC_ANIMATION_MODE, 0);
@@ -404,6 +427,7 @@ gst_video_test_src_init (GstVideoTestSrc * src)
   src->animation_mode = DEFAULT_ANIMATION_MODE;
   src->motion_type = DEFAULT_MOTION_TYPE;
   src->flip = DEFAULT_FLIP;
+  src->reuse_pattern = DEFAULT_REUSE_PATTERN;
 
 }
 
@@ -739,6 +763,9 @@ gst_video_test_src_set_property (GObject * object, guint prop_id,
     case PROP_FLIP:
       src->flip = g_value_get_boolean (value);
       break;
+    case PROP_REUSE_PATTERN:
+      src->reuse_pattern = g_value_get_boolean (value);
+      break;
     default:
       break;
   }
@@ -820,6 +847,9 @@ gst_video_test_src_get_property (GObject * object, guint prop_id,
     case PROP_FLIP:
       g_value_set_boolean (value, src->flip);
       break;
+    case PROP_REUSE_PATTERN:
+      g_value_set_boolean (value, src->reuse_pattern);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1247,11 +1277,108 @@ invalid_frame:
   }
 }
 
+/* Set timestamp, offset and duration on the next outgoing buffer and
+ * advance the frame counters. Shared between the fill path and the
+ * zero-copy reuse path. */
+static void
+gst_video_test_src_stamp_buffer (GstVideoTestSrc * src, GstBuffer * buffer,
+    GstClockTime pts)
+{
+  GstClockTime next_time;
+
+  GST_BUFFER_PTS (buffer) = pts;
+  GST_BUFFER_DTS (buffer) = GST_CLOCK_TIME_NONE;
+
+  GST_DEBUG_OBJECT (src, "Timestamp: %" GST_TIME_FORMAT " = accumulated %"
+      GST_TIME_FORMAT " + offset: %"
+      GST_TIME_FORMAT " + running time: %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (GST_BUFFER_PTS (buffer)), GST_TIME_ARGS (src->accum_rtime),
+      GST_TIME_ARGS (src->timestamp_offset), GST_TIME_ARGS (src->running_time));
+
+  GST_BUFFER_OFFSET (buffer) = src->accum_frames + src->n_frames;
+  if (src->reverse) {
+    src->n_frames--;
+  } else {
+    src->n_frames++;
+  }
+  GST_BUFFER_OFFSET_END (buffer) = GST_BUFFER_OFFSET (buffer) + 1;
+  if (src->info.fps_n) {
+    next_time = gst_util_uint64_scale (src->n_frames,
+        src->info.fps_d * GST_SECOND, src->info.fps_n);
+    if (src->reverse) {
+      /* We already decremented to next frame */
+      GstClockTime prev_pts = gst_util_uint64_scale (src->n_frames + 2,
+          src->info.fps_d * GST_SECOND, src->info.fps_n);
+
+      GST_BUFFER_DURATION (buffer) = prev_pts - GST_BUFFER_PTS (buffer);
+    } else {
+      GST_BUFFER_DURATION (buffer) = next_time - src->running_time;
+    }
+  } else {
+    next_time = src->timestamp_offset;
+    /* NONE means forever */
+    GST_BUFFER_DURATION (buffer) = GST_CLOCK_TIME_NONE;
+  }
+
+  src->running_time = next_time;
+}
+
+static GstFlowReturn
+gst_video_test_src_create (GstPushSrc * psrc, GstBuffer ** buffer)
+{
+  GstVideoTestSrc *src = GST_VIDEO_TEST_SRC (psrc);
+  GstBaseSrc *bsrc = GST_BASE_SRC (psrc);
+  GstBuffer *outbuf = NULL;
+  GstFlowReturn ret;
+  GstClockTime pts;
+
+  if (!src->reuse_pattern || !src->have_static_pattern) {
+    /* the usual alloc + fill path */
+    ret = GST_BASE_SRC_GET_CLASS (bsrc)->alloc (bsrc, -1,
+        gst_base_src_get_blocksize (bsrc), &outbuf);
+    if (G_UNLIKELY (ret != GST_FLOW_OK))
+      return ret;
+
+    ret = gst_video_test_src_fill (psrc, outbuf);
+    if (G_UNLIKELY (ret != GST_FLOW_OK)) {
+      gst_buffer_unref (outbuf);
+      return ret;
+    }
+
+    *buffer = outbuf;
+    return GST_FLOW_OK;
+  }
+
+  pts = src->accum_rtime + src->timestamp_offset + src->running_time;
+
+  gst_object_sync_values (GST_OBJECT (src), pts);
+
+  if (src->cached == NULL) {
+    src->cached = gst_buffer_new_allocate (NULL, src->info.size, NULL);
+
+    ret = fill_image (psrc, src->cached);
+    if (G_UNLIKELY (ret != GST_FLOW_OK)) {
+      gst_clear_buffer (&src->cached);
+      return ret;
+    }
+  } else {
+    GST_LOG_OBJECT (src, "Reusing cached pattern buffer");
+  }
+
+  /* metadata-only copy sharing the pattern memory; a downstream element
+   * mapping it writable gets its own copy and cannot disturb the cache */
+  outbuf = gst_buffer_copy (src->cached);
+  gst_video_test_src_stamp_buffer (src, outbuf, pts);
+
+  *buffer = outbuf;
+
+  return GST_FLOW_OK;
+}
+
 static GstFlowReturn
 gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
 {
   GstVideoTestSrc *src = GST_VIDEO_TEST_SRC (psrc);
-  GstClockTime next_time;
   GstFlowReturn ret;
 
   GstClockTime pts =
@@ -1290,41 +1417,7 @@ gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
       goto fill_failed;
   }
 
-  GST_BUFFER_PTS (buffer) = pts;
-  GST_BUFFER_DTS (buffer) = GST_CLOCK_TIME_NONE;
-
-  GST_DEBUG_OBJECT (src, "Timestamp: %" GST_TIME_FORMAT " = accumulated %"
-      GST_TIME_FORMAT " + offset: %"
-      GST_TIME_FORMAT " + running time: %" GST_TIME_FORMAT,
-      GST_TIME_ARGS (GST_BUFFER_PTS (buffer)), GST_TIME_ARGS (src->accum_rtime),
-      GST_TIME_ARGS (src->timestamp_offset), GST_TIME_ARGS (src->running_time));
-
-  GST_BUFFER_OFFSET (buffer) = src->accum_frames + src->n_frames;
-  if (src->reverse) {
-    src->n_frames--;
-  } else {
-    src->n_frames++;
-  }
-  GST_BUFFER_OFFSET_END (buffer) = GST_BUFFER_OFFSET (buffer) + 1;
-  if (src->info.fps_n) {
-    next_time = gst_util_uint64_scale (src->n_frames,
-        src->info.fps_d * GST_SECOND, src->info.fps_n);
-    if (src->reverse) {
-      /* We already decremented to next frame */
-      GstClockTime prev_pts = gst_util_uint64_scale (src->n_frames + 2,
-          src->info.fps_d * GST_SECOND, src->info.fps_n);
-
-      GST_BUFFER_DURATION (buffer) = prev_pts - GST_BUFFER_PTS (buffer);
-    } else {
-      GST_BUFFER_DURATION (buffer) = next_time - src->running_time;
-    }
-  } else {
-    next_time = src->timestamp_offset;
-    /* NONE means forever */
-    GST_BUFFER_DURATION (buffer) = GST_CLOCK_TIME_NONE;
-  }
-
-  src->running_time = next_time;
+  gst_video_test_src_stamp_buffer (src, buffer, pts);
 
   return GST_FLOW_OK;
 
@@ -210,6 +210,7 @@ struct _GstVideoTestSrc {
   /* cached buffer used for static patterns that don't change */
   GstBuffer *cached;
   gboolean have_static_pattern;
+  gboolean reuse_pattern;
 };
 
 GST_ELEMENT_REGISTER_DECLARE (videotestsrc);
@@ -355,20 +355,41 @@ videotestsrc_blend_line (GstVideoTestSrc * v, guint8 * dest,
     const guint8 * src, const struct vts_color_struct *a,
     const struct vts_color_struct *b, int x1, int x2)
 {
+  guint8 pa[4], pb[4];
   int i;
+
   if (v->bayer || GST_VIDEO_INFO_IS_RGB (&v->info)) {
-    for (i = x1; i < x2; i++) {
-      dest[i * 4 + 0] = BLEND (a->A, b->A, src[i]);
-      dest[i * 4 + 1] = BLEND (a->R, b->R, src[i]);
-      dest[i * 4 + 2] = BLEND (a->G, b->G, src[i]);
-      dest[i * 4 + 3] = BLEND (a->B, b->B, src[i]);
-    }
+    pa[0] = a->A;
+    pa[1] = a->R;
+    pa[2] = a->G;
+    pa[3] = a->B;
+    pb[0] = b->A;
+    pb[1] = b->R;
+    pb[2] = b->G;
+    pb[3] = b->B;
   } else {
-    for (i = x1; i < x2; i++) {
-      dest[i * 4 + 0] = BLEND (a->A, b->A, src[i]);
-      dest[i * 4 + 1] = BLEND (a->Y, b->Y, src[i]);
-      dest[i * 4 + 2] = BLEND (a->U, b->U, src[i]);
-      dest[i * 4 + 3] = BLEND (a->V, b->V, src[i]);
+    pa[0] = a->A;
+    pa[1] = a->Y;
+    pa[2] = a->U;
+    pa[3] = a->V;
+    pb[0] = b->A;
+    pb[1] = b->Y;
+    pb[2] = b->U;
+    pb[3] = b->V;
+  }
+
+  for (i = x1; i < x2; i++) {
+    /* most of the coverage line is fully transparent or fully opaque,
+     * only the anti-aliased edges need the real blend */
+    if (src[i] == 0) {
+      memcpy (dest + i * 4, pb, 4);
+    } else if (src[i] == 255) {
+      memcpy (dest + i * 4, pa, 4);
+    } else {
+      dest[i * 4 + 0] = BLEND (pa[0], pb[0], src[i]);
+      dest[i * 4 + 1] = BLEND (pa[1], pb[1], src[i]);
+      dest[i * 4 + 2] = BLEND (pa[2], pb[2], src[i]);
+      dest[i * 4 + 3] = BLEND (pa[3], pb[3], src[i]);
     }
   }
 #undef BLEND
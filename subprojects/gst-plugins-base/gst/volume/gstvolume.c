@@ -42,7 +42,11 @@
 #include "config.h"
 #endif
 
+/* the "volume-level" message carries GValueArrays like the level element */
+#define GLIB_DISABLE_DEPRECATION_WARNINGS
+
 #include <string.h>
+#include <math.h>
 #include <gst/gst.h>
 #include <gst/base/gstbasetransform.h>
 #include <gst/audio/audio.h>
@@ -89,14 +93,21 @@ enum
   LAST_SIGNAL
 };
 
-#define DEFAULT_PROP_MUTE       FALSE
-#define DEFAULT_PROP_VOLUME     1.0
+#define DEFAULT_PROP_MUTE           FALSE
+#define DEFAULT_PROP_VOLUME         1.0
+#define DEFAULT_PROP_POST_MESSAGES  FALSE
+#define DEFAULT_PROP_INTERVAL       (GST_SECOND / 10)
+
+/* avoid taking the log of zero when converting to dB */
+#define EPSILON 1e-35
 
 enum
 {
   PROP_0,
   PROP_MUTE,
-  PROP_VOLUME
+  PROP_VOLUME,
+  PROP_POST_MESSAGES,
+  PROP_INTERVAL
 };
 
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
@@ -161,6 +172,19 @@ static void volume_process_int8_clamp (GstVolume * self, gpointer bytes,
 static void volume_process_controlled_int8_clamp (GstVolume * self,
     gpointer bytes, gdouble * volume, guint channels, guint n_bytes);
 
+static void volume_meter_double (GstVolume * self, gpointer bytes,
+    guint n_bytes);
+static void volume_meter_float (GstVolume * self, gpointer bytes,
+    guint n_bytes);
+static void volume_meter_int32 (GstVolume * self, gpointer bytes,
+    guint n_bytes);
+static void volume_meter_int24 (GstVolume * self, gpointer bytes,
+    guint n_bytes);
+static void volume_meter_int16 (GstVolume * self, gpointer bytes,
+    guint n_bytes);
+static void volume_meter_int8 (GstVolume * self, gpointer bytes,
+    guint n_bytes);
+
 
 /* helper functions */
 
@@ -171,6 +195,7 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
 
   self->process = NULL;
   self->process_controlled = NULL;
+  self->meter = NULL;
 
   format = GST_AUDIO_INFO_FORMAT (info);
 
@@ -186,6 +211,7 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
         self->process = volume_process_int32;
       }
       self->process_controlled = volume_process_controlled_int32_clamp;
+      self->meter = volume_meter_int32;
       break;
     case GST_AUDIO_FORMAT_S24:
       /* only clamp if the gain is greater than 1.0 */
@@ -195,6 +221,7 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
         self->process = volume_process_int24;
       }
       self->process_controlled = volume_process_controlled_int24_clamp;
+      self->meter = volume_meter_int24;
       break;
     case GST_AUDIO_FORMAT_S16:
       /* only clamp if the gain is greater than 1.0 */
@@ -204,6 +231,7 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
         self->process = volume_process_int16;
       }
       self->process_controlled = volume_process_controlled_int16_clamp;
+      self->meter = volume_meter_int16;
       break;
     case GST_AUDIO_FORMAT_S8:
       /* only clamp if the gain is greater than 1.0 */
@@ -213,14 +241,17 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
         self->process = volume_process_int8;
       }
       self->process_controlled = volume_process_controlled_int8_clamp;
+      self->meter = volume_meter_int8;
       break;
     case GST_AUDIO_FORMAT_F32:
       self->process = volume_process_float;
       self->process_controlled = volume_process_controlled_float;
+      self->meter = volume_meter_float;
       break;
     case GST_AUDIO_FORMAT_F64:
       self->process = volume_process_double;
       self->process_controlled = volume_process_controlled_double;
+      self->meter = volume_meter_double;
       break;
     default:
       break;
@@ -270,6 +301,9 @@ volume_update_volume (GstVolume * self, const GstAudioInfo * info,
    */
   passthrough &= !gst_object_has_active_control_bindings (GST_OBJECT (self));
 
+  /* level metering has to see every buffer */
+  passthrough &= !self->current_post_messages;
+
   GST_DEBUG_OBJECT (self, "set passthrough %d", passthrough);
 
   gst_base_transform_set_passthrough (GST_BASE_TRANSFORM (self), passthrough);
@@ -324,6 +358,40 @@ gst_volume_class_init (GstVolumeClass * klass)
           0.0, VOLUME_MAX_DOUBLE, DEFAULT_PROP_VOLUME,
           G_PARAM_READWRITE | GST_PARAM_CONTROLLABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstVolume:post-messages:
+   *
+   * Post "volume-level" element messages with per-channel peak and RMS
+   * levels, measured from the processed samples in the same pass that
+   * applies the volume. This saves a separate level element, and with it
+   * one full sweep over the data, in metering pipelines.
+   *
+   * The message contains the fields "timestamp", "stream-time",
+   * "running-time" and "duration" (all #G_TYPE_UINT64) describing the
+   * measured period, and "peak" and "rms" #GValueArray<!-- -->s with one
+   * #G_TYPE_DOUBLE in dB per channel.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_POST_MESSAGES,
+      g_param_spec_boolean ("post-messages", "Post Messages",
+          "Post level messages measured in the same pass as the volume",
+          DEFAULT_PROP_POST_MESSAGES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstVolume:interval:
+   *
+   * Interval of time between "volume-level" messages, in nanoseconds.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_INTERVAL,
+      g_param_spec_uint64 ("interval", "Interval",
+          "Interval of time between level messages (in nanoseconds)",
+          1, G_MAXUINT64, DEFAULT_PROP_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class, "Volume",
       "Filter/Effect/Audio",
       "Set volume on audio/raw streams", "Andy Wingo <wingo@pobox.com>");
@@ -345,6 +413,9 @@ gst_volume_init (GstVolume * self)
 {
   self->mute = DEFAULT_PROP_MUTE;
   self->volume = DEFAULT_PROP_VOLUME;
+  self->post_messages = DEFAULT_PROP_POST_MESSAGES;
+  self->interval = DEFAULT_PROP_INTERVAL;
+  self->message_ts = GST_CLOCK_TIME_NONE;
 
   self->tracklist = NULL;
   self->negotiated = FALSE;
@@ -640,6 +711,150 @@ volume_process_controlled_int8_clamp (GstVolume * self, gpointer bytes,
   }
 }
 
+/* level metering, accumulated in the same pass right after the gain was
+ * applied. Peaks and sums are kept as squares of the normalized sample
+ * values and only converted to dB when a message is posted. */
+
+#define DEFINE_METER_FUNC(name, type, scale)                            \
+static void                                                             \
+volume_meter_##name (GstVolume * self, gpointer bytes, guint n_bytes)   \
+{                                                                       \
+  const type *data = (const type *) bytes;                              \
+  guint channels = GST_AUDIO_FILTER_CHANNELS (self);                    \
+  guint i, j, num_frames = n_bytes / (sizeof (type) * channels);        \
+                                                                        \
+  for (i = 0; i < num_frames; i++) {                                    \
+    for (j = 0; j < channels; j++) {                                    \
+      gdouble v = *data++ * (1.0 / scale);                              \
+                                                                        \
+      v = v * v;                                                        \
+      self->sums[j] += v;                                               \
+      if (v > self->peak[j])                                            \
+        self->peak[j] = v;                                              \
+    }                                                                   \
+  }                                                                     \
+}
+
+DEFINE_METER_FUNC (double, gdouble, 1.0);
+DEFINE_METER_FUNC (float, gfloat, 1.0);
+DEFINE_METER_FUNC (int32, gint32, 2147483648.0);
+DEFINE_METER_FUNC (int16, gint16, 32768.0);
+DEFINE_METER_FUNC (int8, gint8, 128.0);
+
+#undef DEFINE_METER_FUNC
+
+static void
+volume_meter_int24 (GstVolume * self, gpointer bytes, guint n_bytes)
+{
+  gint8 *data = (gint8 *) bytes;        /* treat the data as a byte stream */
+  guint channels = GST_AUDIO_FILTER_CHANNELS (self);
+  guint i, j, num_frames = n_bytes / (sizeof (gint8) * 3 * channels);
+
+  for (i = 0; i < num_frames; i++) {
+    for (j = 0; j < channels; j++) {
+      gdouble v = ((gint32) get_unaligned_i24 (data)) * (1.0 / 8388608.0);
+
+      data += 3;
+      v = v * v;
+      self->sums[j] += v;
+      if (v > self->peak[j])
+        self->peak[j] = v;
+    }
+  }
+}
+
+static void
+volume_meter_reset (GstVolume * self, guint channels)
+{
+  guint i;
+
+  for (i = 0; i < channels; i++) {
+    self->peak[i] = 0.0;
+    self->sums[i] = 0.0;
+  }
+  self->meter_frames = 0;
+  self->message_ts = GST_CLOCK_TIME_NONE;
+}
+
+static GstMessage *
+volume_level_message_new (GstVolume * self)
+{
+  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (self);
+  GstAudioFilter *filter = GST_AUDIO_FILTER_CAST (self);
+  guint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
+  gint rate = GST_AUDIO_INFO_RATE (&filter->info);
+  GstClockTime duration, running_time, stream_time;
+  GValueArray *peak_arr, *rms_arr;
+  GValue va = { 0, };
+  GValue v = { 0, };
+  GstStructure *s;
+  guint i;
+
+  duration = gst_util_uint64_scale_int (self->meter_frames, GST_SECOND, rate);
+  running_time = gst_segment_to_running_time (&trans->segment, GST_FORMAT_TIME,
+      self->message_ts);
+  stream_time = gst_segment_to_stream_time (&trans->segment, GST_FORMAT_TIME,
+      self->message_ts);
+
+  s = gst_structure_new ("volume-level",
+      "timestamp", G_TYPE_UINT64, self->message_ts,
+      "stream-time", G_TYPE_UINT64, stream_time,
+      "running-time", G_TYPE_UINT64, running_time,
+      "duration", G_TYPE_UINT64, duration, NULL);
+
+  peak_arr = g_value_array_new (channels);
+  rms_arr = g_value_array_new (channels);
+  g_value_init (&v, G_TYPE_DOUBLE);
+
+  for (i = 0; i < channels; i++) {
+    g_value_set_double (&v, 10.0 * log10 (self->peak[i] + EPSILON));
+    g_value_array_append (peak_arr, &v);
+    g_value_set_double (&v,
+        10.0 * log10 (self->sums[i] / self->meter_frames + EPSILON));
+    g_value_array_append (rms_arr, &v);
+  }
+  g_value_unset (&v);
+
+  g_value_init (&va, G_TYPE_VALUE_ARRAY);
+  g_value_take_boxed (&va, peak_arr);
+  gst_structure_take_value (s, "peak", &va);
+
+  g_value_init (&va, G_TYPE_VALUE_ARRAY);
+  g_value_take_boxed (&va, rms_arr);
+  gst_structure_take_value (s, "rms", &va);
+
+  return gst_message_new_element (GST_OBJECT (self), s);
+}
+
+static void
+volume_do_metering (GstVolume * self, GstBuffer * buffer, gpointer data,
+    guint n_bytes)
+{
+  GstAudioFilter *filter = GST_AUDIO_FILTER_CAST (self);
+  gint rate = GST_AUDIO_INFO_RATE (&filter->info);
+  guint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
+  gint width = GST_AUDIO_FORMAT_INFO_WIDTH (filter->info.finfo) / 8;
+  guint64 frames_per_interval;
+
+  if (!GST_CLOCK_TIME_IS_VALID (self->message_ts))
+    self->message_ts = GST_BUFFER_TIMESTAMP (buffer);
+
+  self->meter (self, data, n_bytes);
+  self->meter_frames += n_bytes / (width * channels);
+
+  frames_per_interval =
+      gst_util_uint64_scale (self->interval, rate, GST_SECOND);
+  if (frames_per_interval == 0)
+    frames_per_interval = 1;
+
+  if (self->meter_frames >= frames_per_interval) {
+    if (GST_CLOCK_TIME_IS_VALID (self->message_ts))
+      gst_element_post_message (GST_ELEMENT (self),
+          volume_level_message_new (self));
+    volume_meter_reset (self, channels);
+  }
+}
+
 /* GstBaseTransform vmethod implementations */
 
 /* get notified of caps and plug in the correct process function */
@@ -654,8 +869,13 @@ volume_setup (GstAudioFilter * filter, const GstAudioInfo * info)
   GST_OBJECT_LOCK (self);
   volume = self->volume;
   mute = self->mute;
+  self->current_post_messages = self->post_messages;
   GST_OBJECT_UNLOCK (self);
 
+  self->peak = g_renew (gdouble, self->peak, GST_AUDIO_INFO_CHANNELS (info));
+  self->sums = g_renew (gdouble, self->sums, GST_AUDIO_INFO_CHANNELS (info));
+  volume_meter_reset (self, GST_AUDIO_INFO_CHANNELS (info));
+
   res = volume_update_volume (self, info, volume, mute);
   if (!res) {
     GST_ELEMENT_ERROR (self, CORE, NEGOTIATION,
@@ -679,6 +899,11 @@ volume_stop (GstBaseTransform * base)
   self->mutes = NULL;
   self->mutes_count = 0;
 
+  g_free (self->peak);
+  self->peak = NULL;
+  g_free (self->sums);
+  self->sums = NULL;
+
   return GST_CALL_PARENT_WITH_DEFAULT (GST_BASE_TRANSFORM_CLASS, stop, (base),
       TRUE);
 }
@@ -690,6 +915,7 @@ volume_before_transform (GstBaseTransform * base, GstBuffer * buffer)
   GstVolume *self = GST_VOLUME (base);
   gdouble volume;
   gboolean mute;
+  gboolean post_messages;
 
   timestamp = GST_BUFFER_TIMESTAMP (buffer);
   timestamp =
@@ -705,11 +931,14 @@ volume_before_transform (GstBaseTransform * base, GstBuffer * buffer)
   GST_OBJECT_LOCK (self);
   volume = self->volume;
   mute = self->mute;
+  post_messages = self->post_messages;
   GST_OBJECT_UNLOCK (self);
 
-  if ((volume != self->current_volume) || (mute != self->current_mute)) {
-    /* the volume or mute was updated, update our internal state before
-     * we continue processing. */
+  if ((volume != self->current_volume) || (mute != self->current_mute) ||
+      (post_messages != self->current_post_messages)) {
+    /* the volume, mute or metering was updated, update our internal state
+     * before we continue processing. */
+    self->current_post_messages = post_messages;
     volume_update_volume (self, GST_AUDIO_FILTER_INFO (self), volume, mute);
   }
 }
@@ -802,6 +1031,10 @@ volume_transform_ip (GstBaseTransform * base, GstBuffer * outbuf)
   }
 
 done:
+  /* meter the scaled samples while they are still hot in the cache */
+  if (self->current_post_messages && self->meter)
+    volume_do_metering (self, outbuf, map.data, map.size);
+
   gst_buffer_unmap (outbuf, &map);
 
   return GST_FLOW_OK;
@@ -832,6 +1065,16 @@ volume_set_property (GObject * object, guint prop_id, const GValue * value,
       self->volume = g_value_get_double (value);
       GST_OBJECT_UNLOCK (self);
       break;
+    case PROP_POST_MESSAGES:
+      GST_OBJECT_LOCK (self);
+      self->post_messages = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    case PROP_INTERVAL:
+      GST_OBJECT_LOCK (self);
+      self->interval = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -855,6 +1098,16 @@ volume_get_property (GObject * object, guint prop_id, GValue * value,
       g_value_set_double (value, self->volume);
       GST_OBJECT_UNLOCK (self);
       break;
+    case PROP_POST_MESSAGES:
+      GST_OBJECT_LOCK (self);
+      g_value_set_boolean (value, self->post_messages);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    case PROP_INTERVAL:
+      GST_OBJECT_LOCK (self);
+      g_value_set_uint64 (value, self->interval);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
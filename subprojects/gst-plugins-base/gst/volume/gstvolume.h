@@ -64,6 +64,18 @@ struct _GstVolume {
   guint mutes_count;
   gdouble *volumes;
   guint volumes_count;
+
+  /* fused level metering */
+  void (*meter)(GstVolume*, gpointer, guint);
+
+  gboolean post_messages;
+  gboolean current_post_messages;
+  guint64 interval;
+
+  gdouble *peak;                /* per-channel square of the peak sample */
+  gdouble *sums;                /* per-channel sum of squared samples */
+  guint64 meter_frames;         /* frames accumulated in this period */
+  GstClockTime message_ts;      /* buffer timestamp at period start */
 };
 
 GST_ELEMENT_REGISTER_DECLARE (volume);
@@ -506,6 +506,58 @@ GST_START_TEST (test_pull_with_timeout)
 
 GST_END_TEST;
 
+GST_START_TEST (test_try_pull_samples)
+{
+  GstElement *sink;
+  GstBuffer *buffer;
+  GstSample *samples[8];
+  guint i, n;
+
+  sink = setup_appsink ();
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  for (i = 0; i < 5; i++) {
+    buffer = gst_buffer_new_and_alloc (i + 1);
+    fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+  }
+
+  /* all queued buffers are returned in one batch, in order */
+  n = gst_app_sink_try_pull_samples (GST_APP_SINK (sink), samples,
+      G_N_ELEMENTS (samples), GST_SECOND / 20);
+  fail_unless_equals_int (n, 5);
+  for (i = 0; i < n; i++) {
+    buffer = gst_sample_get_buffer (samples[i]);
+    fail_unless (buffer != NULL);
+    fail_unless_equals_int (gst_buffer_get_size (buffer), i + 1);
+    gst_sample_unref (samples[i]);
+  }
+
+  /* the queue is empty now and the timeout expires */
+  n = gst_app_sink_try_pull_samples (GST_APP_SINK (sink), samples,
+      G_N_ELEMENTS (samples), GST_SECOND / 20);
+  fail_unless_equals_int (n, 0);
+
+  /* a batch smaller than the queue leaves the rest queued */
+  for (i = 0; i < 3; i++) {
+    buffer = gst_buffer_new_and_alloc (4);
+    fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+  }
+  n = gst_app_sink_try_pull_samples (GST_APP_SINK (sink), samples, 2, 0);
+  fail_unless_equals_int (n, 2);
+  for (i = 0; i < n; i++)
+    gst_sample_unref (samples[i]);
+  n = gst_app_sink_try_pull_samples (GST_APP_SINK (sink), samples,
+      G_N_ELEMENTS (samples), 0);
+  fail_unless_equals_int (n, 1);
+  gst_sample_unref (samples[0]);
+
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_appsink (sink);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_pull_preroll)
 {
   GstElement *sink = NULL;
@@ -1085,6 +1137,7 @@ appsink_suite (void)
   tcase_add_test (tc_chain, test_buffer_list_signal);
   tcase_add_test (tc_chain, test_segment);
   tcase_add_test (tc_chain, test_pull_with_timeout);
+  tcase_add_test (tc_chain, test_try_pull_samples);
   tcase_add_test (tc_chain, test_query_drain);
   tcase_add_test (tc_chain, test_pull_preroll);
   tcase_add_test (tc_chain, test_do_not_care_preroll);
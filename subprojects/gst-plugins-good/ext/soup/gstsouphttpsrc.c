@@ -2065,48 +2065,156 @@ _session_read_idle_cb (gpointer user_data)
   return FALSE;
 }
 
-static GstFlowReturn
-gst_soup_http_src_read_buffer (GstSoupHTTPSrc * src, GstBuffer ** outbuf)
+/* A read started on the session thread right after a buffer was produced, so
+ * that the connection keeps filling the next buffer while the streaming
+ * thread pushes the previous one downstream. Consumed or drained by the
+ * streaming thread on the next read or on stream teardown. */
+struct _GstSoupReadAhead
 {
   struct GstSoupReadResult res;
-  GstMapInfo mapinfo;
-  GstBaseSrc *bsrc;
-  GstFlowReturn ret;
+  GstBuffer *buffer;
+  GstMapInfo map;
+};
+
+static void
+gst_soup_http_src_read_ahead_free (GstSoupHTTPSrc * src)
+{
+  GstSoupReadAhead *ahead = src->read_ahead;
+
+  gst_buffer_unmap (ahead->buffer, &ahead->map);
+  gst_buffer_unref (ahead->buffer);
+  g_clear_error (&ahead->res.error);
+  g_free (ahead);
+  src->read_ahead = NULL;
+}
+
+static void
+gst_soup_http_src_read_ahead_start (GstSoupHTTPSrc * src)
+{
+  GstSoupReadAhead *ahead;
   GSource *source;
 
-  bsrc = GST_BASE_SRC_CAST (src);
+  ahead = g_new0 (GstSoupReadAhead, 1);
 
-  *outbuf = gst_soup_http_src_alloc_buffer (src);
-  if (!*outbuf) {
-    GST_WARNING_OBJECT (src, "Failed to allocate buffer");
-    return GST_FLOW_ERROR;
+  ahead->buffer = gst_soup_http_src_alloc_buffer (src);
+  if (ahead->buffer == NULL) {
+    g_free (ahead);
+    return;
   }
 
-  if (!gst_buffer_map (*outbuf, &mapinfo, GST_MAP_WRITE)) {
-    GST_WARNING_OBJECT (src, "Failed to map buffer");
-    return GST_FLOW_ERROR;
+  if (!gst_buffer_map (ahead->buffer, &ahead->map, GST_MAP_WRITE)) {
+    gst_buffer_unref (ahead->buffer);
+    g_free (ahead);
+    return;
   }
 
-  res.src = src;
-  res.buffer = mapinfo.data;
-  res.bufsize = mapinfo.size;
-  res.error = NULL;
-  res.nbytes = -1;
+  ahead->res.src = src;
+  ahead->res.buffer = ahead->map.data;
+  ahead->res.bufsize = ahead->map.size;
+  ahead->res.error = NULL;
+  ahead->res.nbytes = -1;
 
-  source = g_idle_source_new ();
+  src->read_ahead = ahead;
 
-  g_mutex_lock (&src->session_mutex);
-
-  g_source_set_callback (source, _session_read_idle_cb, &res, NULL);
+  source = g_idle_source_new ();
+  g_source_set_callback (source, _session_read_idle_cb, &ahead->res, NULL);
   /* invoke on libsoup thread */
   g_source_attach (source, g_main_loop_get_context (src->session->loop));
   g_source_unref (source);
+}
+
+/* Wait for a pending speculative read and hand its result over, or drop it
+ * when it is a leftover from a flush that has stopped again. Returns FALSE
+ * when the caller has to issue a read of its own. */
+static gboolean
+gst_soup_http_src_read_ahead_take (GstSoupHTTPSrc * src,
+    struct GstSoupReadResult *res, GstBuffer ** buffer, GstMapInfo * map)
+{
+  GstSoupReadAhead *ahead = src->read_ahead;
+
+  if (ahead == NULL)
+    return FALSE;
+
+  g_mutex_lock (&src->session_mutex);
+  while (!ahead->res.error && ahead->res.nbytes < 0)
+    g_cond_wait (&src->session_cond, &src->session_mutex);
+  g_mutex_unlock (&src->session_mutex);
+
+  if (g_error_matches (ahead->res.error, G_IO_ERROR, G_IO_ERROR_CANCELLED)
+      && !g_cancellable_is_cancelled (src->cancellable)) {
+    gst_soup_http_src_read_ahead_free (src);
+    return FALSE;
+  }
+
+  *res = ahead->res;
+  *buffer = ahead->buffer;
+  *map = ahead->map;
+  g_free (ahead);
+  src->read_ahead = NULL;
+
+  return TRUE;
+}
+
+static void
+gst_soup_http_src_read_ahead_drain (GstSoupHTTPSrc * src)
+{
+  GstSoupReadAhead *ahead = src->read_ahead;
+
+  if (ahead == NULL)
+    return;
 
-  /* wait for it */
-  while (!res.error && res.nbytes < 0)
+  g_mutex_lock (&src->session_mutex);
+  while (!ahead->res.error && ahead->res.nbytes < 0)
     g_cond_wait (&src->session_cond, &src->session_mutex);
   g_mutex_unlock (&src->session_mutex);
 
+  gst_soup_http_src_read_ahead_free (src);
+}
+
+static GstFlowReturn
+gst_soup_http_src_read_buffer (GstSoupHTTPSrc * src, GstBuffer ** outbuf)
+{
+  struct GstSoupReadResult res;
+  GstMapInfo mapinfo;
+  GstBaseSrc *bsrc;
+  GstFlowReturn ret;
+  GSource *source;
+
+  bsrc = GST_BASE_SRC_CAST (src);
+
+  if (!gst_soup_http_src_read_ahead_take (src, &res, outbuf, &mapinfo)) {
+    *outbuf = gst_soup_http_src_alloc_buffer (src);
+    if (!*outbuf) {
+      GST_WARNING_OBJECT (src, "Failed to allocate buffer");
+      return GST_FLOW_ERROR;
+    }
+
+    if (!gst_buffer_map (*outbuf, &mapinfo, GST_MAP_WRITE)) {
+      GST_WARNING_OBJECT (src, "Failed to map buffer");
+      return GST_FLOW_ERROR;
+    }
+
+    res.src = src;
+    res.buffer = mapinfo.data;
+    res.bufsize = mapinfo.size;
+    res.error = NULL;
+    res.nbytes = -1;
+
+    source = g_idle_source_new ();
+
+    g_mutex_lock (&src->session_mutex);
+
+    g_source_set_callback (source, _session_read_idle_cb, &res, NULL);
+    /* invoke on libsoup thread */
+    g_source_attach (source, g_main_loop_get_context (src->session->loop));
+    g_source_unref (source);
+
+    /* wait for it */
+    while (!res.error && res.nbytes < 0)
+      g_cond_wait (&src->session_cond, &src->session_mutex);
+    g_mutex_unlock (&src->session_mutex);
+  }
+
   GST_DEBUG_OBJECT (src, "Read %" G_GSSIZE_FORMAT " bytes from http input",
       res.nbytes);
 
@@ -2174,6 +2282,11 @@ gst_soup_http_src_read_buffer (GstSoupHTTPSrc * src, GstBuffer ** outbuf)
         GST_ERROR_OBJECT (src,
             "Read %" G_GSIZE_FORMAT " bytes after end of range", res.nbytes);
     }
+
+    /* start reading the next block already; it fills on the session thread
+     * while this buffer travels downstream */
+    if (src->msg != NULL)
+      gst_soup_http_src_read_ahead_start (src);
   } else {
     gst_buffer_unref (*outbuf);
     if (src->have_size && src->read_position < src->content_size) {
@@ -2212,6 +2325,9 @@ gst_soup_http_src_stream_clear (GstSoupHTTPSrc * src)
 {
   GSource *source;
 
+  /* let a speculative read finish before tearing the stream down */
+  gst_soup_http_src_read_ahead_drain (src);
+
   if (!src->input_stream)
     return;
 
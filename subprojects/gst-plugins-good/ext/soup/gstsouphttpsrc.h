@@ -47,6 +47,7 @@ typedef enum {
 
 /* opaque from here, implementation detail */
 typedef struct _GstSoupSession GstSoupSession;
+typedef struct _GstSoupReadAhead GstSoupReadAhead;
 
 struct _GstSoupHTTPSrc {
   GstPushSrc element;
@@ -95,6 +96,10 @@ struct _GstSoupHTTPSrc {
   GCancellable *cancellable;
   GInputStream *input_stream;
 
+  /* Speculative read in flight on the session thread while the previous
+   * buffer travels downstream; owned by the streaming thread */
+  GstSoupReadAhead *read_ahead;
+
   gint reduce_blocksize_count;
   gint increase_blocksize_count;
   guint minimum_blocksize;
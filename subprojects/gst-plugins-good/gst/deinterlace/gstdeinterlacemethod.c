@@ -374,6 +374,214 @@ get_line (LinesGetter * lg, gint field_offset, guint plane, gint line,
   return data;
 }
 
+static void
+gst_deinterlace_simple_method_deinterlace_packed_lines
+    (GstDeinterlaceSimpleMethod * self, GstVideoFrame * outframe,
+    LinesGetter * lg, guint cur_field_flags, gint frame_width, gint start,
+    gint end)
+{
+  GstDeinterlaceScanlineData scanlines;
+  gint i;
+
+#define LINE(x,i) (((guint8*)GST_VIDEO_FRAME_PLANE_DATA((x),0)) + i * \
+    GST_VIDEO_FRAME_PLANE_STRIDE((x),0))
+
+  for (i = start; i < end; i++) {
+    memset (&scanlines, 0, sizeof (scanlines));
+    scanlines.bottom_field = (cur_field_flags == PICTURE_INTERLACED_BOTTOM);
+
+    if (!((i & 1) ^ scanlines.bottom_field)) {
+      /* copying */
+      scanlines.tp = get_line (lg, -1, 0, i, -1);
+      scanlines.bp = get_line (lg, -1, 0, i, 1);
+
+      scanlines.tt0 = get_line (lg, 0, 0, i, -2);
+      scanlines.m0 = get_line (lg, 0, 0, i, 0);
+      scanlines.bb0 = get_line (lg, 0, 0, i, 2);
+
+      scanlines.t1 = get_line (lg, 1, 0, i, -1);
+      scanlines.b1 = get_line (lg, 1, 0, i, 1);
+
+      scanlines.tt2 = get_line (lg, 2, 0, i, -2);
+      scanlines.m2 = get_line (lg, 2, 0, i, 0);
+      scanlines.bb2 = get_line (lg, 2, 0, i, 2);
+
+      self->copy_scanline_packed (self, LINE (outframe, i), &scanlines,
+          frame_width);
+    } else {
+      /* interpolating */
+      scanlines.tp2 = get_line (lg, -2, 0, i, -1);
+      scanlines.bp2 = get_line (lg, -2, 0, i, 1);
+
+      scanlines.ttp = get_line (lg, -1, 0, i, -2);
+      scanlines.mp = get_line (lg, -1, 0, i, 0);
+      scanlines.bbp = get_line (lg, -1, 0, i, 2);
+
+      scanlines.t0 = get_line (lg, 0, 0, i, -1);
+      scanlines.b0 = get_line (lg, 0, 0, i, 1);
+
+      scanlines.tt1 = get_line (lg, 1, 0, i, -2);
+      scanlines.m1 = get_line (lg, 1, 0, i, 0);
+      scanlines.bb1 = get_line (lg, 1, 0, i, 2);
+
+      scanlines.t2 = get_line (lg, 2, 0, i, -1);
+      scanlines.b2 = get_line (lg, 2, 0, i, 1);
+
+      self->interpolate_scanline_packed (self, LINE (outframe, i), &scanlines,
+          frame_width);
+    }
+  }
+#undef LINE
+}
+
+static void
+gst_deinterlace_simple_method_deinterlace_planar_lines
+    (GstDeinterlaceSimpleMethod * self, GstVideoFrame * dest, LinesGetter * lg,
+    guint cur_field_flags, gint plane,
+    GstDeinterlaceSimpleMethodFunction copy_scanline,
+    GstDeinterlaceSimpleMethodFunction interpolate_scanline, gint frame_width,
+    gint start, gint end)
+{
+  GstDeinterlaceScanlineData scanlines;
+  gint i;
+
+#define LINE(x,i) (((guint8*)GST_VIDEO_FRAME_PLANE_DATA((x),plane)) + i * \
+    GST_VIDEO_FRAME_PLANE_STRIDE((x),plane))
+
+  for (i = start; i < end; i++) {
+    memset (&scanlines, 0, sizeof (scanlines));
+    scanlines.bottom_field = (cur_field_flags == PICTURE_INTERLACED_BOTTOM);
+
+    if (!((i & 1) ^ scanlines.bottom_field)) {
+      /* copying */
+      scanlines.tp = get_line (lg, -1, plane, i, -1);
+      scanlines.bp = get_line (lg, -1, plane, i, 1);
+
+      scanlines.tt0 = get_line (lg, 0, plane, i, -2);
+      scanlines.m0 = get_line (lg, 0, plane, i, 0);
+      scanlines.bb0 = get_line (lg, 0, plane, i, 2);
+
+      scanlines.t1 = get_line (lg, 1, plane, i, -1);
+      scanlines.b1 = get_line (lg, 1, plane, i, 1);
+
+      scanlines.tt2 = get_line (lg, 2, plane, i, -2);
+      scanlines.m2 = get_line (lg, 2, plane, i, 0);
+      scanlines.bb2 = get_line (lg, 2, plane, i, 2);
+
+      copy_scanline (self, LINE (dest, i), &scanlines, frame_width);
+    } else {
+      /* interpolating */
+      scanlines.tp2 = get_line (lg, -2, plane, i, -1);
+      scanlines.bp2 = get_line (lg, -2, plane, i, 1);
+
+      scanlines.ttp = get_line (lg, -1, plane, i, -2);
+      scanlines.mp = get_line (lg, -1, plane, i, 0);
+      scanlines.bbp = get_line (lg, -1, plane, i, 2);
+
+      scanlines.t0 = get_line (lg, 0, plane, i, -1);
+      scanlines.b0 = get_line (lg, 0, plane, i, 1);
+
+      scanlines.tt1 = get_line (lg, 1, plane, i, -2);
+      scanlines.m1 = get_line (lg, 1, plane, i, 0);
+      scanlines.bb1 = get_line (lg, 1, plane, i, 2);
+
+      scanlines.t2 = get_line (lg, 2, plane, i, -1);
+      scanlines.b2 = get_line (lg, 2, plane, i, 1);
+
+      interpolate_scanline (self, LINE (dest, i), &scanlines, frame_width);
+    }
+  }
+#undef LINE
+}
+
+/* with fewer lines than this, a slice is not worth a task switch */
+#define MIN_LINES_PER_SLICE 64
+#define MAX_SLICES 16
+
+typedef struct
+{
+  GstDeinterlaceSimpleMethod *self;
+  GstVideoFrame *outframe;
+  LinesGetter *lg;
+  guint cur_field_flags;
+  gint plane;                   /* -1 for packed formats */
+  GstDeinterlaceSimpleMethodFunction copy_scanline;
+  GstDeinterlaceSimpleMethodFunction interpolate_scanline;
+  gint frame_width;
+  gint start, end;
+} SliceTask;
+
+static void
+gst_deinterlace_simple_method_slice_func (SliceTask * task)
+{
+  if (task->plane < 0)
+    gst_deinterlace_simple_method_deinterlace_packed_lines (task->self,
+        task->outframe, task->lg, task->cur_field_flags, task->frame_width,
+        task->start, task->end);
+  else
+    gst_deinterlace_simple_method_deinterlace_planar_lines (task->self,
+        task->outframe, task->lg, task->cur_field_flags, task->plane,
+        task->copy_scanline, task->interpolate_scanline, task->frame_width,
+        task->start, task->end);
+}
+
+/* Every output line only depends on the (read-only) field history, so the
+ * frame can be cut into horizontal slices that are deinterlaced in parallel
+ * on the shared task pool. The caller's thread processes the last slice. */
+static void
+gst_deinterlace_simple_method_process_slices (GstDeinterlaceSimpleMethod * self,
+    GstVideoFrame * outframe, LinesGetter * lg, guint cur_field_flags,
+    gint plane, GstDeinterlaceSimpleMethodFunction copy_scanline,
+    GstDeinterlaceSimpleMethodFunction interpolate_scanline, gint frame_width,
+    gint frame_height)
+{
+  SliceTask tasks[MAX_SLICES];
+  gpointer handles[MAX_SLICES];
+  gint n_slices, lines_per_slice, i;
+
+  n_slices = MIN (g_get_num_processors (), MAX_SLICES);
+  n_slices = MIN (n_slices, frame_height / MIN_LINES_PER_SLICE);
+
+  if (n_slices < 2 || self->task_pool == NULL)
+    n_slices = 1;
+
+  /* fields come in line pairs, keep the slice boundaries on even lines */
+  lines_per_slice =
+      GST_ROUND_UP_2 ((frame_height + n_slices - 1) / n_slices);
+
+  for (i = 0; i < n_slices; i++) {
+    SliceTask *task = &tasks[i];
+
+    task->self = self;
+    task->outframe = outframe;
+    task->lg = lg;
+    task->cur_field_flags = cur_field_flags;
+    task->plane = plane;
+    task->copy_scanline = copy_scanline;
+    task->interpolate_scanline = interpolate_scanline;
+    task->frame_width = frame_width;
+    task->start = MIN (i * lines_per_slice, frame_height);
+    task->end = MIN ((i + 1) * lines_per_slice, frame_height);
+
+    if (i == n_slices - 1)
+      break;
+
+    handles[i] = gst_task_pool_push (self->task_pool,
+        (GstTaskPoolFunction) gst_deinterlace_simple_method_slice_func, task,
+        NULL);
+    /* no free thread, do it here like the last slice */
+    if (handles[i] == NULL)
+      gst_deinterlace_simple_method_slice_func (task);
+  }
+
+  gst_deinterlace_simple_method_slice_func (&tasks[n_slices - 1]);
+
+  for (i = 0; i < n_slices - 1; i++) {
+    if (handles[i] != NULL)
+      gst_task_pool_join (self->task_pool, handles[i]);
+  }
+}
+
 static void
 gst_deinterlace_simple_method_deinterlace_frame_packed (GstDeinterlaceMethod *
     method, const GstDeinterlaceField * history, guint history_count,
@@ -383,9 +591,7 @@ gst_deinterlace_simple_method_deinterlace_frame_packed (GstDeinterlaceMethod *
 #ifndef G_DISABLE_ASSERT
   GstDeinterlaceMethodClass *dm_class = GST_DEINTERLACE_METHOD_GET_CLASS (self);
 #endif
-  GstDeinterlaceScanlineData scanlines;
   guint cur_field_flags;
-  gint i;
   gint frame_height, frame_width;
   LinesGetter lg = { history, history_count, cur_field_idx };
   GstVideoFrame *framep, *frame0, *frame1, *frame2;
@@ -418,55 +624,8 @@ gst_deinterlace_simple_method_deinterlace_frame_packed (GstDeinterlaceMethod *
   if (frame2)
     frame_width = MIN (frame_width, GST_VIDEO_FRAME_PLANE_STRIDE (frame2, 0));
 
-#define LINE(x,i) (((guint8*)GST_VIDEO_FRAME_PLANE_DATA((x),0)) + i * \
-    GST_VIDEO_FRAME_PLANE_STRIDE((x),0))
-
-  for (i = 0; i < frame_height; i++) {
-    memset (&scanlines, 0, sizeof (scanlines));
-    scanlines.bottom_field = (cur_field_flags == PICTURE_INTERLACED_BOTTOM);
-
-    if (!((i & 1) ^ scanlines.bottom_field)) {
-      /* copying */
-      scanlines.tp = get_line (&lg, -1, 0, i, -1);
-      scanlines.bp = get_line (&lg, -1, 0, i, 1);
-
-      scanlines.tt0 = get_line (&lg, 0, 0, i, -2);
-      scanlines.m0 = get_line (&lg, 0, 0, i, 0);
-      scanlines.bb0 = get_line (&lg, 0, 0, i, 2);
-
-      scanlines.t1 = get_line (&lg, 1, 0, i, -1);
-      scanlines.b1 = get_line (&lg, 1, 0, i, 1);
-
-      scanlines.tt2 = get_line (&lg, 2, 0, i, -2);
-      scanlines.m2 = get_line (&lg, 2, 0, i, 0);
-      scanlines.bb2 = get_line (&lg, 2, 0, i, 2);
-
-      self->copy_scanline_packed (self, LINE (outframe, i), &scanlines,
-          frame_width);
-    } else {
-      /* interpolating */
-      scanlines.tp2 = get_line (&lg, -2, 0, i, -1);
-      scanlines.bp2 = get_line (&lg, -2, 0, i, 1);
-
-      scanlines.ttp = get_line (&lg, -1, 0, i, -2);
-      scanlines.mp = get_line (&lg, -1, 0, i, 0);
-      scanlines.bbp = get_line (&lg, -1, 0, i, 2);
-
-      scanlines.t0 = get_line (&lg, 0, 0, i, -1);
-      scanlines.b0 = get_line (&lg, 0, 0, i, 1);
-
-      scanlines.tt1 = get_line (&lg, 1, 0, i, -2);
-      scanlines.m1 = get_line (&lg, 1, 0, i, 0);
-      scanlines.bb1 = get_line (&lg, 1, 0, i, 2);
-
-      scanlines.t2 = get_line (&lg, 2, 0, i, -1);
-      scanlines.b2 = get_line (&lg, 2, 0, i, 1);
-
-      self->interpolate_scanline_packed (self, LINE (outframe, i), &scanlines,
-          frame_width);
-    }
-#undef LINE
-  }
+  gst_deinterlace_simple_method_process_slices (self, outframe, &lg,
+      cur_field_flags, -1, NULL, NULL, frame_width, frame_height);
 }
 
 static void
@@ -525,8 +684,6 @@ static void
     GstDeinterlaceSimpleMethodFunction copy_scanline,
     GstDeinterlaceSimpleMethodFunction interpolate_scanline)
 {
-  GstDeinterlaceScanlineData scanlines;
-  gint i;
   gint frame_height, frame_width;
 
   frame_height = GST_VIDEO_FRAME_COMP_HEIGHT (dest, plane);
@@ -536,53 +693,9 @@ static void
   g_assert (interpolate_scanline != NULL);
   g_assert (copy_scanline != NULL);
 
-#define LINE(x,i) (((guint8*)GST_VIDEO_FRAME_PLANE_DATA((x),plane)) + i * \
-    GST_VIDEO_FRAME_PLANE_STRIDE((x),plane))
-
-  for (i = 0; i < frame_height; i++) {
-    memset (&scanlines, 0, sizeof (scanlines));
-    scanlines.bottom_field = (cur_field_flags == PICTURE_INTERLACED_BOTTOM);
-
-    if (!((i & 1) ^ scanlines.bottom_field)) {
-      /* copying */
-      scanlines.tp = get_line (lg, -1, plane, i, -1);
-      scanlines.bp = get_line (lg, -1, plane, i, 1);
-
-      scanlines.tt0 = get_line (lg, 0, plane, i, -2);
-      scanlines.m0 = get_line (lg, 0, plane, i, 0);
-      scanlines.bb0 = get_line (lg, 0, plane, i, 2);
-
-      scanlines.t1 = get_line (lg, 1, plane, i, -1);
-      scanlines.b1 = get_line (lg, 1, plane, i, 1);
-
-      scanlines.tt2 = get_line (lg, 2, plane, i, -2);
-      scanlines.m2 = get_line (lg, 2, plane, i, 0);
-      scanlines.bb2 = get_line (lg, 2, plane, i, 2);
-
-      copy_scanline (self, LINE (dest, i), &scanlines, frame_width);
-    } else {
-      /* interpolating */
-      scanlines.tp2 = get_line (lg, -2, plane, i, -1);
-      scanlines.bp2 = get_line (lg, -2, plane, i, 1);
-
-      scanlines.ttp = get_line (lg, -1, plane, i, -2);
-      scanlines.mp = get_line (lg, -1, plane, i, 0);
-      scanlines.bbp = get_line (lg, -1, plane, i, 2);
-
-      scanlines.t0 = get_line (lg, 0, plane, i, -1);
-      scanlines.b0 = get_line (lg, 0, plane, i, 1);
-
-      scanlines.tt1 = get_line (lg, 1, plane, i, -2);
-      scanlines.m1 = get_line (lg, 1, plane, i, 0);
-      scanlines.bb1 = get_line (lg, 1, plane, i, 2);
-
-      scanlines.t2 = get_line (lg, 2, plane, i, -1);
-      scanlines.b2 = get_line (lg, 2, plane, i, 1);
-
-      interpolate_scanline (self, LINE (dest, i), &scanlines, frame_width);
-    }
-#undef LINE
-  }
+  gst_deinterlace_simple_method_process_slices (self, dest, lg,
+      cur_field_flags, plane, copy_scanline, interpolate_scanline, frame_width,
+      frame_height);
 }
 
 static void
@@ -748,11 +861,28 @@ gst_deinterlace_simple_method_setup (GstDeinterlaceMethod * method,
   }
 }
 
+static void
+gst_deinterlace_simple_method_finalize (GObject * object)
+{
+  GstDeinterlaceSimpleMethod *self = GST_DEINTERLACE_SIMPLE_METHOD (object);
+
+  if (self->task_pool) {
+    gst_task_pool_cleanup (self->task_pool);
+    gst_clear_object (&self->task_pool);
+  }
+
+  G_OBJECT_CLASS (gst_deinterlace_simple_method_parent_class)->finalize
+      (object);
+}
+
 static void
 gst_deinterlace_simple_method_class_init (GstDeinterlaceSimpleMethodClass
     * klass)
 {
   GstDeinterlaceMethodClass *dm_class = (GstDeinterlaceMethodClass *) klass;
+  GObjectClass *gobject_class = (GObjectClass *) klass;
+
+  gobject_class->finalize = gst_deinterlace_simple_method_finalize;
 
   dm_class->deinterlace_frame_ayuv =
       gst_deinterlace_simple_method_deinterlace_frame_packed;
@@ -854,4 +984,8 @@ gst_deinterlace_simple_method_class_init (GstDeinterlaceSimpleMethodClass
 static void
 gst_deinterlace_simple_method_init (GstDeinterlaceSimpleMethod * self)
 {
+  self->task_pool = gst_shared_task_pool_new ();
+  gst_shared_task_pool_set_max_threads (GST_SHARED_TASK_POOL (self->task_pool),
+      g_get_num_processors ());
+  gst_task_pool_prepare (self->task_pool, NULL);
 }
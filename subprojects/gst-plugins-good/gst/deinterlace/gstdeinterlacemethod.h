@@ -173,6 +173,9 @@ struct _GstDeinterlaceSimpleMethod {
 
   GstDeinterlaceSimpleMethodFunction interpolate_scanline_planar[3];
   GstDeinterlaceSimpleMethodFunction copy_scanline_planar[3];
+
+  /* pool used to process slices of a frame in parallel */
+  GstTaskPool *task_pool;
 };
 
 struct _GstDeinterlaceSimpleMethodClass {
@@ -216,12 +216,6 @@ typedef struct
   gdouble time;
 } GstFlvMuxIndexEntry;
 
-static void
-gst_flv_mux_index_entry_free (GstFlvMuxIndexEntry * entry)
-{
-  g_slice_free (GstFlvMuxIndexEntry, entry);
-}
-
 static GstBuffer *
 _gst_buffer_new_wrapped (gpointer mem, gsize size, GFreeFunc free_func)
 {
@@ -378,8 +372,8 @@ gst_flv_mux_reset (GstElement * element)
 {
   GstFlvMux *mux = GST_FLV_MUX (element);
 
-  g_list_foreach (mux->index, (GFunc) gst_flv_mux_index_entry_free, NULL);
-  g_list_free (mux->index);
+  if (mux->index)
+    g_array_free (mux->index, TRUE);
   mux->index = NULL;
   mux->byte_count = 0;
 
@@ -1644,13 +1638,17 @@ gst_flv_mux_update_index (GstFlvMux * mux, GstBuffer * buffer,
     return;
 
   if (GST_BUFFER_PTS_IS_VALID (buffer)) {
-    GstFlvMuxIndexEntry *entry = g_slice_new (GstFlvMuxIndexEntry);
+    GstFlvMuxIndexEntry entry;
     GstClockTime pts =
         gst_flv_mux_segment_to_running_time (&GST_AGGREGATOR_PAD
         (pad)->segment, GST_BUFFER_PTS (buffer));
-    entry->position = mux->byte_count;
-    entry->time = gst_guint64_to_gdouble (pts) / GST_SECOND;
-    mux->index = g_list_prepend (mux->index, entry);
+
+    if (!mux->index)
+      mux->index =
+          g_array_sized_new (FALSE, FALSE, sizeof (GstFlvMuxIndexEntry), 512);
+    entry.position = mux->byte_count;
+    entry.time = gst_guint64_to_gdouble (pts) / GST_SECOND;
+    g_array_append_val (mux->index, entry);
   }
 }
 
@@ -1777,7 +1775,6 @@ gst_flv_mux_rewrite_header (GstFlvMux * mux)
   GstEvent *event;
   guint8 *data;
   gdouble d;
-  GList *l;
   guint32 index_len, allocate_size;
   guint32 i, index_skip;
   GstSegment segment;
@@ -1818,14 +1815,13 @@ gst_flv_mux_rewrite_header (GstFlvMux * mux)
   tmp = gst_flv_mux_create_number_script_value ("filesize", d);
   rewrite = gst_buffer_append (rewrite, tmp);
 
-  if (!mux->index) {
+  if (!mux->index || mux->index->len == 0) {
     /* no index, so push buffer and return */
     return gst_flv_mux_push (mux, rewrite);
   }
 
   /* rewrite the index */
-  mux->index = g_list_reverse (mux->index);
-  index_len = g_list_length (mux->index);
+  index_len = mux->index->len;
 
   /* We write at most MAX_INDEX_ENTRIES elements */
   if (index_len > MAX_INDEX_ENTRIES) {
@@ -1852,8 +1848,9 @@ gst_flv_mux_rewrite_header (GstFlvMux * mux)
   data += 28;
 
   /* the keyframes' times */
-  for (i = 0, l = mux->index; l; l = l->next, i++) {
-    GstFlvMuxIndexEntry *entry = l->data;
+  for (i = 0; i < mux->index->len; i++) {
+    GstFlvMuxIndexEntry *entry =
+        &g_array_index (mux->index, GstFlvMuxIndexEntry, i);
 
     if (i % index_skip != 0)
       continue;
@@ -1869,8 +1866,9 @@ gst_flv_mux_rewrite_header (GstFlvMux * mux)
   data += 20;
 
   /* the keyframes' file positions */
-  for (i = 0, l = mux->index; l; l = l->next, i++) {
-    GstFlvMuxIndexEntry *entry = l->data;
+  for (i = 0; i < mux->index->len; i++) {
+    GstFlvMuxIndexEntry *entry =
+        &g_array_index (mux->index, GstFlvMuxIndexEntry, i);
 
     if (i % index_skip != 0)
       continue;
@@ -99,7 +99,7 @@ struct _GstFlvMux {
 
   GstTagList *tags;
   gboolean new_tags;
-  GList *index;
+  GArray *index;
   guint64 byte_count;
   GstClockTime duration;
   GstClockTime first_timestamp;
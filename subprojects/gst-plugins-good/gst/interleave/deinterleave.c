@@ -103,6 +103,11 @@ MAKE_FUNC (16);
 MAKE_FUNC (32);
 MAKE_FUNC (64);
 
+/* Amount of interleaved input data to deinterleave into all the output
+ * buffers before moving on; one tile's worth of input stays in cache for
+ * every channel instead of being re-read per channel */
+#define DEINTERLEAVE_TILE_BYTES (64 * 1024)
+
 static void
 deinterleave_24 (guint8 * out, guint8 * in, guint stride, guint nframes)
 {
@@ -893,19 +898,45 @@ gst_deinterleave_process (GstDeinterleave * self, GstBuffer * buf)
     goto done;
   }
 
-  /* deinterleave */
+  /* deinterleave in tiles of frames; a full-buffer pass per channel would
+   * read the whole interleaved input once per channel, which gets very
+   * cache-unfriendly with high channel counts */
+  {
+    GstMapInfo *write_info = g_new (GstMapInfo, channels);
+    guint bps = GST_AUDIO_INFO_WIDTH (&self->audio_info) / 8;
+    guint tile_frames, f;
+
+    tile_frames = MAX (1, DEINTERLEAVE_TILE_BYTES / (channels * bps));
+
+    for (i = 0; i < channels; i++) {
+      if (buffers_out[i])
+        gst_buffer_map (buffers_out[i], &write_info[i], GST_MAP_WRITE);
+    }
+
+    for (f = 0; f < nframes; f += tile_frames) {
+      guint todo = MIN (tile_frames, nframes - f);
+
+      in = (guint8 *) read_info.data + f * channels * bps;
+      for (i = 0; i < channels; i++) {
+        if (!buffers_out[i])
+          continue;
+        out = (guint8 *) write_info[i].data + f * bps;
+        self->func (out, in + i * bps, channels, todo);
+      }
+    }
+
+    for (i = 0; i < channels; i++) {
+      if (buffers_out[i])
+        gst_buffer_unmap (buffers_out[i], &write_info[i]);
+    }
+    g_free (write_info);
+  }
+
+  /* push the deinterleaved buffers */
   for (srcs = self->srcpads, i = 0; srcs; srcs = srcs->next, i++) {
     GstPad *pad = (GstPad *) srcs->data;
-    GstMapInfo write_info;
 
-    in = (guint8 *) read_info.data;
-    in += i * (GST_AUDIO_INFO_WIDTH (&self->audio_info) / 8);
     if (buffers_out[i]) {
-      gst_buffer_map (buffers_out[i], &write_info, GST_MAP_WRITE);
-      out = (guint8 *) write_info.data;
-      self->func (out, in, channels, nframes);
-      gst_buffer_unmap (buffers_out[i], &write_info);
-
       ret = gst_pad_push (pad, buffers_out[i]);
       buffers_out[i] = NULL;
       if (ret == GST_FLOW_OK)
@@ -964,18 +964,20 @@ gst_qtdemux_find_index_linear (GstQTDemux * qtdemux, QtDemuxStream * str,
     index = gst_qtdemux_find_index (qtdemux, str, media_time);
     sample = str->samples + index;
   } else {
-    while (index < str->n_samples - 1) {
-      if (!qtdemux_parse_samples (qtdemux, str, index + 1))
+    /* the target lies beyond the parsed range; decode timestamps increase
+     * monotonically, so extend the parsed range in batches and then bisect
+     * in it instead of inspecting every sample on the way */
+    while (str->stbl_index < (gint64) str->n_samples - 1) {
+      guint32 next = MIN (str->stbl_index + 512, (gint64) str->n_samples - 1);
+
+      if (!qtdemux_parse_samples (qtdemux, str, next))
         goto parse_failed;
 
-      sample = str->samples + index + 1;
-      if (mov_time < sample->timestamp) {
-        sample = str->samples + index;
+      if (mov_time <= str->samples[next].timestamp)
         break;
-      }
-
-      index++;
     }
+    index = gst_qtdemux_find_index (qtdemux, str, media_time);
+    sample = str->samples + index;
   }
 
   /* sample->timestamp is now <= media_time, need to find the corresponding
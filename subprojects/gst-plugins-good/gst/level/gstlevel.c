@@ -357,30 +357,45 @@ gst_level_calculate_##TYPE (gpointer data, guint num, guint channels,         \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
   register guint j;                                                           \
-  gdouble squaresum = 0.0;           /* square sum of the input samples */    \
-  register gdouble square = 0.0;     /* Square */                             \
-  register gdouble peaksquare = 0.0; /* Peak Square Sample */                 \
+  gdouble sq0 = 0.0, sq1 = 0.0, sq2 = 0.0, sq3 = 0.0; /* partial sums */      \
+  gdouble pk0 = 0.0, pk1 = 0.0, pk2 = 0.0, pk3 = 0.0; /* partial peaks */     \
+  register gdouble square;                                                    \
   gdouble normalizer;                /* divisor to get a [-1.0, 1.0] range */ \
                                                                               \
   /* *NCS = 0.0; Normalized Cumulative Square */                              \
   /* *NPS = 0.0; Normalized Peak Square */                                    \
                                                                               \
-  for (j = 0; j < num; j += channels) {                                       \
+  /* four independent accumulators break the dependency chain between    */   \
+  /* iterations and let the compiler use SIMD for contiguous samples     */   \
+  for (j = 0; j + 3 * channels < num; j += 4 * channels) {                    \
     square = ((gdouble) in[j]) * in[j];                                       \
-    if (square > peaksquare) peaksquare = square;                             \
-    squaresum += square;                                                      \
+    if (square > pk0) pk0 = square;                                           \
+    sq0 += square;                                                            \
+    square = ((gdouble) in[j + channels]) * in[j + channels];                 \
+    if (square > pk1) pk1 = square;                                           \
+    sq1 += square;                                                            \
+    square = ((gdouble) in[j + 2 * channels]) * in[j + 2 * channels];         \
+    if (square > pk2) pk2 = square;                                           \
+    sq2 += square;                                                            \
+    square = ((gdouble) in[j + 3 * channels]) * in[j + 3 * channels];         \
+    if (square > pk3) pk3 = square;                                           \
+    sq3 += square;                                                            \
+  }                                                                           \
+  for (; j < num; j += channels) {                                            \
+    square = ((gdouble) in[j]) * in[j];                                       \
+    if (square > pk0) pk0 = square;                                           \
+    sq0 += square;                                                            \
   }                                                                           \
                                                                               \
   normalizer = (gdouble) (G_GINT64_CONSTANT(1) << (RESOLUTION * 2));          \
-  *NCS = squaresum / normalizer;                                              \
-  *NPS = peaksquare / normalizer;                                             \
+  *NCS = ((sq0 + sq1) + (sq2 + sq3)) / normalizer;                            \
+  *NPS = MAX (MAX (pk0, pk1), MAX (pk2, pk3)) / normalizer;                   \
 }
 
 DEFINE_INT_LEVEL_CALCULATOR (gint32, 31);
 DEFINE_INT_LEVEL_CALCULATOR (gint16, 15);
 DEFINE_INT_LEVEL_CALCULATOR (gint8, 7);
 
-/* FIXME: use orc to calculate squaresums? */
 #define DEFINE_FLOAT_LEVEL_CALCULATOR(TYPE)                                   \
 static void inline                                                            \
 gst_level_calculate_##TYPE (gpointer data, guint num, guint channels,         \
@@ -388,22 +403,37 @@ gst_level_calculate_##TYPE (gpointer data, guint num, guint channels,         \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
   register guint j;                                                           \
-  gdouble squaresum = 0.0;           /* square sum of the input samples */    \
-  register gdouble square = 0.0;     /* Square */                             \
-  register gdouble peaksquare = 0.0; /* Peak Square Sample */                 \
+  gdouble sq0 = 0.0, sq1 = 0.0, sq2 = 0.0, sq3 = 0.0; /* partial sums */      \
+  gdouble pk0 = 0.0, pk1 = 0.0, pk2 = 0.0, pk3 = 0.0; /* partial peaks */     \
+  register gdouble square;                                                    \
                                                                               \
   /* *NCS = 0.0; Normalized Cumulative Square */                              \
   /* *NPS = 0.0; Normalized Peak Square */                                    \
                                                                               \
-  /* orc_level_squaresum_f64(&squaresum,in,num); */                           \
-  for (j = 0; j < num; j += channels) {                                       \
+  /* four independent accumulators break the dependency chain between    */   \
+  /* iterations and let the compiler use SIMD for contiguous samples     */   \
+  for (j = 0; j + 3 * channels < num; j += 4 * channels) {                    \
+    square = ((gdouble) in[j]) * in[j];                                       \
+    if (square > pk0) pk0 = square;                                           \
+    sq0 += square;                                                            \
+    square = ((gdouble) in[j + channels]) * in[j + channels];                 \
+    if (square > pk1) pk1 = square;                                           \
+    sq1 += square;                                                            \
+    square = ((gdouble) in[j + 2 * channels]) * in[j + 2 * channels];         \
+    if (square > pk2) pk2 = square;                                           \
+    sq2 += square;                                                            \
+    square = ((gdouble) in[j + 3 * channels]) * in[j + 3 * channels];         \
+    if (square > pk3) pk3 = square;                                           \
+    sq3 += square;                                                            \
+  }                                                                           \
+  for (; j < num; j += channels) {                                            \
     square = ((gdouble) in[j]) * in[j];                                       \
-    if (square > peaksquare) peaksquare = square;                             \
-    squaresum += square;                                                      \
+    if (square > pk0) pk0 = square;                                           \
+    sq0 += square;                                                            \
   }                                                                           \
                                                                               \
-  *NCS = squaresum;                                                           \
-  *NPS = peaksquare;                                                          \
+  *NCS = (sq0 + sq1) + (sq2 + sq3);                                           \
+  *NPS = MAX (MAX (pk0, pk1), MAX (pk2, pk3));                                \
 }
 
 DEFINE_FLOAT_LEVEL_CALCULATOR (gfloat);
@@ -332,6 +332,11 @@ gst_matroska_demux_reset (GstElement * element)
     demux->clusters = NULL;
   }
 
+  if (demux->scanned_cluster_index) {
+    g_array_unref (demux->scanned_cluster_index);
+    demux->scanned_cluster_index = NULL;
+  }
+
   g_list_foreach (demux->seek_parsed,
       (GFunc) gst_matroska_read_common_free_parsed_el, NULL);
   g_list_free (demux->seek_parsed);
@@ -2534,6 +2539,43 @@ gst_matroska_demux_scan_back_for_keyframe_cluster (GstMatroskaDemux * demux,
   return FALSE;
 }
 
+/* granularity of the scanned cluster index; clusters closer in time than
+ * this to an already remembered one are not worth an extra entry */
+#define SCANNED_CLUSTER_GRANULARITY (10 * GST_SECOND)
+
+/* remember a cluster found while scanning, so later bisections can start
+ * from a much narrower window */
+static void
+gst_matroska_demux_remember_scanned_cluster (GstMatroskaDemux * demux,
+    GstClockTime time, guint64 offset)
+{
+  GstMatroskaIndex entry = { 0, };
+  GArray *index;
+  guint i;
+
+  if (!GST_CLOCK_TIME_IS_VALID (time))
+    return;
+
+  if (G_UNLIKELY (demux->scanned_cluster_index == NULL))
+    demux->scanned_cluster_index =
+        g_array_sized_new (FALSE, FALSE, sizeof (GstMatroskaIndex), 16);
+  index = demux->scanned_cluster_index;
+
+  for (i = 0; i < index->len; i++) {
+    GstMatroskaIndex *idx = &g_array_index (index, GstMatroskaIndex, i);
+
+    if (idx->time + SCANNED_CLUSTER_GRANULARITY > time) {
+      if (time + SCANNED_CLUSTER_GRANULARITY > idx->time)
+        return;
+      break;
+    }
+  }
+
+  entry.time = time;
+  entry.pos = offset;
+  g_array_insert_val (index, i, entry);
+}
+
 /* bisect and scan through file for cluster starting before @time,
  * returns fake index entry with corresponding info on cluster */
 static GstMatroskaIndex *
@@ -2578,6 +2620,34 @@ gst_matroska_demux_search_pos (GstMatroskaDemux * demux, GstClockTime time)
   otime = MAX (otime, atime);
   opos = MAX (opos, apos);
 
+  /* narrow down the window with clusters remembered from earlier scans */
+  if (demux->scanned_cluster_index != NULL && time != GST_CLOCK_TIME_NONE) {
+    guint i;
+
+    for (i = 0; i < demux->scanned_cluster_index->len; i++) {
+      GstMatroskaIndex *idx =
+          &g_array_index (demux->scanned_cluster_index, GstMatroskaIndex, i);
+
+      if (idx->time <= time) {
+        if (idx->time > atime) {
+          atime = idx->time;
+          apos = idx->pos;
+        }
+      } else {
+        if ((gint64) idx->pos < opos) {
+          otime = idx->time;
+          opos = idx->pos;
+        }
+        break;
+      }
+    }
+
+    /* keep the invariants intact, the remembered cluster may lie beyond
+     * the last known cluster */
+    otime = MAX (otime, atime);
+    opos = MAX (opos, apos);
+  }
+
   maxpos = gst_matroska_read_common_get_length (&demux->common);
 
   /* invariants;
@@ -2663,6 +2733,8 @@ retry:
       GST_DEBUG_OBJECT (demux, "found cluster at offset %" G_GINT64_FORMAT
           " with time %" GST_TIME_FORMAT, cluster_offset,
           GST_TIME_ARGS (cluster_time));
+      gst_matroska_demux_remember_scanned_cluster (demux, cluster_time,
+          cluster_offset);
       if (time == GST_CLOCK_TIME_NONE) {
         GST_DEBUG_OBJECT (demux, "found last cluster");
         prev_cluster_time = cluster_time;
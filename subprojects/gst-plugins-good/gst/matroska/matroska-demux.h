@@ -76,6 +76,11 @@ typedef struct _GstMatroskaDemux {
   /* cluster positions (optional) */
   GArray                  *clusters;
 
+  /* clusters found while scanning for a seek position, used to narrow
+   * down later bisections (GstMatroskaIndex, sorted by time, pos is the
+   * absolute cluster offset) */
+  GArray                  *scanned_cluster_index;
+
   /* keeping track of playback position */
   GstClockTime             last_stop_end;
   GstClockTime             stream_start_time;
@@ -703,6 +703,7 @@ gst_matroska_mux_reset (GstElement * element)
 
   /* reset indexes */
   mux->num_indexes = 0;
+  mux->index_size = 0;
   g_free (mux->index);
   mux->index = NULL;
 
@@ -4180,9 +4181,11 @@ gst_matroska_mux_write_data (GstMatroskaMux * mux, GstMatroskaPad * collect_pad,
             >= mux->min_index_interval)) {
       GstMatroskaIndex *idx;
 
-      if (mux->num_indexes % 32 == 0) {
-        mux->index = g_renew (GstMatroskaIndex, mux->index,
-            mux->num_indexes + 32);
+      /* grow geometrically, long recordings collect a lot of entries and
+       * constant-sized growth would copy the whole index over and over */
+      if (mux->num_indexes == mux->index_size) {
+        mux->index_size = mux->index_size ? 2 * mux->index_size : 512;
+        mux->index = g_renew (GstMatroskaIndex, mux->index, mux->index_size);
       }
       idx = &mux->index[mux->num_indexes++];
 
@@ -106,6 +106,7 @@ struct _GstMatroskaMux {
   /* a cue (index) table */
   GstMatroskaIndex *index;
   guint          num_indexes;
+  guint          index_size;
   GstClockTimeDiff min_index_interval;
 
   /* timescale in the file */
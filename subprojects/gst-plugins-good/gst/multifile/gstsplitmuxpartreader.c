@@ -1022,12 +1022,25 @@ check_if_pads_collected (GstSplitMuxPartReader * reader)
   if (reader->prep_state == PART_STATE_PREPARING_COLLECT_STREAMS) {
     /* Check we have all pads and each pad has seen a buffer */
     if (reader->no_more_pads && splitmux_part_is_prerolled_locked (reader)) {
-      GST_DEBUG_OBJECT (reader,
-          "no more pads - file %s. Measuring stream length", reader->path);
-      reader->prep_state = PART_STATE_PREPARING_MEASURE_STREAMS;
-      gst_element_call_async (GST_ELEMENT_CAST (reader),
-          (GstElementCallAsyncFunc) gst_splitmux_part_reader_measure_streams,
-          NULL, NULL);
+      if (reader->duration_known) {
+        /* The duration was supplied up front, no need to play the file
+         * out to EOS to measure the end timestamp */
+        GST_DEBUG_OBJECT (reader,
+            "no more pads - file %s. Duration %" GST_TIME_FORMAT
+            " already known, skipping measuring", reader->path,
+            GST_TIME_ARGS (reader->duration));
+        reader->prep_state = PART_STATE_PREPARING_RESET_FOR_READY;
+        gst_element_call_async (GST_ELEMENT_CAST (reader),
+            (GstElementCallAsyncFunc)
+            gst_splitmux_part_reader_finish_measuring_streams, NULL, NULL);
+      } else {
+        GST_DEBUG_OBJECT (reader,
+            "no more pads - file %s. Measuring stream length", reader->path);
+        reader->prep_state = PART_STATE_PREPARING_MEASURE_STREAMS;
+        gst_element_call_async (GST_ELEMENT_CAST (reader),
+            (GstElementCallAsyncFunc) gst_splitmux_part_reader_measure_streams,
+            NULL, NULL);
+      }
     }
   }
 }
@@ -1037,25 +1050,30 @@ no_more_pads (GstElement * element, GstSplitMuxPartReader * reader)
 {
   GstClockTime duration = GST_CLOCK_TIME_NONE;
   GList *cur;
-  /* Query the minimum duration of any pad in this piece and store it.
+  /* Query the minimum duration of any pad in this piece and store it,
+   * unless the duration was already supplied externally.
    * FIXME: Only consider audio and video */
   SPLITMUX_PART_LOCK (reader);
-  for (cur = g_list_first (reader->pads); cur != NULL; cur = g_list_next (cur)) {
-    GstPad *target = GST_PAD_CAST (cur->data);
-    if (target) {
-      gint64 cur_duration;
-      if (gst_pad_peer_query_duration (target, GST_FORMAT_TIME, &cur_duration)) {
-        GST_INFO_OBJECT (reader,
-            "file %s pad %" GST_PTR_FORMAT " duration %" GST_TIME_FORMAT,
-            reader->path, target, GST_TIME_ARGS (cur_duration));
-        if (cur_duration < duration)
-          duration = cur_duration;
+  if (!reader->duration_known) {
+    for (cur = g_list_first (reader->pads); cur != NULL;
+        cur = g_list_next (cur)) {
+      GstPad *target = GST_PAD_CAST (cur->data);
+      if (target) {
+        gint64 cur_duration;
+        if (gst_pad_peer_query_duration (target, GST_FORMAT_TIME,
+                &cur_duration)) {
+          GST_INFO_OBJECT (reader,
+              "file %s pad %" GST_PTR_FORMAT " duration %" GST_TIME_FORMAT,
+              reader->path, target, GST_TIME_ARGS (cur_duration));
+          if (cur_duration < duration)
+            duration = cur_duration;
+        }
       }
     }
+    GST_INFO_OBJECT (reader, "file %s duration %" GST_TIME_FORMAT,
+        reader->path, GST_TIME_ARGS (duration));
+    reader->duration = (GstClockTime) duration;
   }
-  GST_INFO_OBJECT (reader, "file %s duration %" GST_TIME_FORMAT,
-      reader->path, GST_TIME_ARGS (duration));
-  reader->duration = (GstClockTime) duration;
 
   reader->no_more_pads = TRUE;
 
@@ -1287,10 +1305,17 @@ gst_splitmux_part_reader_get_end_offset (GstSplitMuxPartReader * reader)
   GstClockTime ret = GST_CLOCK_TIME_NONE;
 
   SPLITMUX_PART_LOCK (reader);
-  for (cur = g_list_first (reader->pads); cur != NULL; cur = g_list_next (cur)) {
-    GstSplitMuxPartPad *part_pad = SPLITMUX_PART_PAD_CAST (cur->data);
-    if (!part_pad->is_sparse && part_pad->max_ts < ret)
-      ret = part_pad->max_ts;
+  if (reader->duration_known) {
+    /* End timestamps were never measured, derive the end of this part
+     * from the externally supplied duration */
+    ret = reader->start_offset + reader->duration;
+  } else {
+    for (cur = g_list_first (reader->pads); cur != NULL;
+        cur = g_list_next (cur)) {
+      GstSplitMuxPartPad *part_pad = SPLITMUX_PART_PAD_CAST (cur->data);
+      if (!part_pad->is_sparse && part_pad->max_ts < ret)
+        ret = part_pad->max_ts;
+    }
   }
 
   SPLITMUX_PART_UNLOCK (reader);
@@ -1334,6 +1359,20 @@ gst_splitmux_part_reader_get_duration (GstSplitMuxPartReader * reader)
   return dur;
 }
 
+/* Set a duration that is already known for this part, so that preparing
+ * it doesn't need to play the file out to EOS to measure the length */
+void
+gst_splitmux_part_reader_set_duration (GstSplitMuxPartReader * reader,
+    GstClockTime duration)
+{
+  SPLITMUX_PART_LOCK (reader);
+  reader->duration = duration;
+  reader->duration_known = GST_CLOCK_TIME_IS_VALID (duration);
+  GST_INFO_OBJECT (reader, "file %s duration now %" GST_TIME_FORMAT,
+      reader->path, GST_TIME_ARGS (duration));
+  SPLITMUX_PART_UNLOCK (reader);
+}
+
 GstPad *
 gst_splitmux_part_reader_lookup_pad (GstSplitMuxPartReader * reader,
     GstPad * target)
@@ -72,6 +72,8 @@ struct _GstSplitMuxPartReader
   gboolean no_more_pads;
 
   GstClockTime duration;
+  /* TRUE if the duration was supplied externally instead of measured */
+  gboolean duration_known;
   GstClockTime start_offset;
   GstClockTime ts_offset;
 
@@ -113,6 +115,7 @@ void gst_splitmux_part_reader_set_start_offset (GstSplitMuxPartReader *part, Gst
 GstClockTime gst_splitmux_part_reader_get_start_offset (GstSplitMuxPartReader *part);
 GstClockTime gst_splitmux_part_reader_get_end_offset (GstSplitMuxPartReader *part);
 GstClockTime gst_splitmux_part_reader_get_duration (GstSplitMuxPartReader * reader);
+void gst_splitmux_part_reader_set_duration (GstSplitMuxPartReader * reader, GstClockTime duration);
 
 GstPad *gst_splitmux_part_reader_lookup_pad (GstSplitMuxPartReader *reader, GstPad *target);
 GstFlowReturn gst_splitmux_part_reader_pop (GstSplitMuxPartReader *reader, GstPad *part_pad, GstDataQueueItem ** item);
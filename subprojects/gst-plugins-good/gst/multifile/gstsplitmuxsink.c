@@ -2077,8 +2077,15 @@ start_next_fragment (GstSplitMuxSink * splitmux, MqStreamCtx * ctx)
       if (g_object_get_qdata ((GObject *) sink, EOS_FROM_US)) {
         if (GPOINTER_TO_INT (g_object_get_qdata ((GObject *) sink,
                     EOS_FROM_US)) == 2) {
-          _lock_and_set_to_null (muxer, splitmux);
-          _lock_and_set_to_null (sink, splitmux);
+          /* Tear the old elements down on a helper thread like bus_handler()
+           * does; going to NULL closes the finished file, which can block on
+           * disk flushes and would stall the start of this fragment */
+          gst_element_call_async (muxer,
+              (GstElementCallAsyncFunc) _lock_and_set_to_null,
+              gst_object_ref (splitmux), gst_object_unref);
+          gst_element_call_async (sink,
+              (GstElementCallAsyncFunc) _lock_and_set_to_null,
+              gst_object_ref (splitmux), gst_object_unref);
         } else {
           g_object_set_qdata ((GObject *) sink, EOS_FROM_US,
               GINT_TO_POINTER (2));
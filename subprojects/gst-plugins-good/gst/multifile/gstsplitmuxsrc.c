@@ -66,11 +66,27 @@ enum
 enum
 {
   SIGNAL_FORMAT_LOCATION,
+  SIGNAL_ADD_FRAGMENT,
   SIGNAL_LAST
 };
 
 static guint signals[SIGNAL_LAST];
 
+/* A fragment that was supplied up front via the add-fragment signal,
+ * together with its duration (or GST_CLOCK_TIME_NONE if not known) */
+typedef struct _SplitMuxSrcFragment
+{
+  gchar *path;
+  GstClockTime duration;
+} SplitMuxSrcFragment;
+
+static void
+splitmux_src_fragment_free (SplitMuxSrcFragment * frag)
+{
+  g_free (frag->path);
+  g_free (frag);
+}
+
 static GstStaticPadTemplate video_src_template =
 GST_STATIC_PAD_TEMPLATE ("video",
     GST_PAD_SRC,
@@ -103,6 +119,8 @@ static void gst_splitmux_src_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 static void gst_splitmux_src_dispose (GObject * object);
 static void gst_splitmux_src_finalize (GObject * object);
+static gboolean gst_splitmux_src_add_fragment (GstSplitMuxSrc * splitmux,
+    const gchar * location, GstClockTime duration);
 static gboolean gst_splitmux_src_start (GstSplitMuxSrc * splitmux);
 static gboolean gst_splitmux_src_stop (GstSplitMuxSrc * splitmux);
 static void splitmux_src_pad_constructed (GObject * pad);
@@ -248,6 +266,34 @@ gst_splitmux_src_class_init (GstSplitMuxSrcClass * klass)
   signals[SIGNAL_FORMAT_LOCATION] =
       g_signal_new ("format-location", G_TYPE_FROM_CLASS (klass),
       G_SIGNAL_RUN_LAST, 0, NULL, NULL, NULL, G_TYPE_STRV, 0);
+
+  /**
+   * GstSplitMuxSrc::add-fragment:
+   * @splitmux: the #GstSplitMuxSrc
+   * @location: path of the file to play
+   * @duration: duration of the file, or %GST_CLOCK_TIME_NONE if not known
+   *
+   * Add a file to the set of files to play, in playback order. When a
+   * fragment list is provided this way, it is used instead of the
+   * "location" glob or the #GstSplitMuxSrc::format-location signal.
+   * Fragments with a known duration are not scanned to measure their
+   * length when preparing, which makes startup on large recordings
+   * considerably cheaper.
+   *
+   * This signal must be emitted before the element starts, and the
+   * fragment list is kept until the element is disposed.
+   *
+   * Returns: %TRUE if the fragment was added
+   *
+   * Since: 1.24
+   */
+  signals[SIGNAL_ADD_FRAGMENT] =
+      g_signal_new ("add-fragment", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST | G_SIGNAL_ACTION,
+      G_STRUCT_OFFSET (GstSplitMuxSrcClass, add_fragment), NULL, NULL,
+      NULL, G_TYPE_BOOLEAN, 2, G_TYPE_STRING, G_TYPE_UINT64);
+
+  klass->add_fragment = GST_DEBUG_FUNCPTR (gst_splitmux_src_add_fragment);
 }
 
 static void
@@ -256,6 +302,9 @@ gst_splitmux_src_init (GstSplitMuxSrc * splitmux)
   g_mutex_init (&splitmux->lock);
   g_rw_lock_init (&splitmux->pads_rwlock);
   splitmux->total_duration = GST_CLOCK_TIME_NONE;
+  splitmux->fragments =
+      g_ptr_array_new_with_free_func ((GDestroyNotify)
+      splitmux_src_fragment_free);
   gst_segment_init (&splitmux->play_segment, GST_FORMAT_TIME);
 }
 
@@ -286,6 +335,7 @@ gst_splitmux_src_finalize (GObject * object)
   GstSplitMuxSrc *splitmux = GST_SPLITMUX_SRC (object);
   g_mutex_clear (&splitmux->lock);
   g_rw_lock_clear (&splitmux->pads_rwlock);
+  g_ptr_array_unref (splitmux->fragments);
   g_free (splitmux->location);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -897,6 +947,36 @@ gst_splitmux_src_prepare_next_part (GstSplitMuxSrc * splitmux)
   return TRUE;
 }
 
+static gboolean
+gst_splitmux_src_add_fragment (GstSplitMuxSrc * splitmux,
+    const gchar * location, GstClockTime duration)
+{
+  SplitMuxSrcFragment *frag;
+
+  g_return_val_if_fail (location != NULL, FALSE);
+
+  SPLITMUX_SRC_LOCK (splitmux);
+  if (splitmux->running) {
+    GST_WARNING_OBJECT (splitmux,
+        "Can't add fragments while the element is running");
+    SPLITMUX_SRC_UNLOCK (splitmux);
+    return FALSE;
+  }
+
+  frag = g_new0 (SplitMuxSrcFragment, 1);
+  frag->path = g_strdup (location);
+  frag->duration = duration;
+
+  GST_DEBUG_OBJECT (splitmux,
+      "Adding fragment %s duration %" GST_TIME_FORMAT, frag->path,
+      GST_TIME_ARGS (frag->duration));
+
+  g_ptr_array_add (splitmux->fragments, frag);
+  SPLITMUX_SRC_UNLOCK (splitmux);
+
+  return TRUE;
+}
+
 static gboolean
 gst_splitmux_src_start (GstSplitMuxSrc * splitmux)
 {
@@ -904,7 +984,8 @@ gst_splitmux_src_start (GstSplitMuxSrc * splitmux)
   GError *err = NULL;
   gchar *basename = NULL;
   gchar *dirname = NULL;
-  gchar **files;
+  gchar **files = NULL;
+  GstClockTime *frag_durations = NULL;
   guint i;
 
   SPLITMUX_SRC_LOCK (splitmux);
@@ -917,7 +998,24 @@ gst_splitmux_src_start (GstSplitMuxSrc * splitmux)
 
   GST_DEBUG_OBJECT (splitmux, "Starting");
 
-  g_signal_emit (splitmux, signals[SIGNAL_FORMAT_LOCATION], 0, &files);
+  SPLITMUX_SRC_LOCK (splitmux);
+  if (splitmux->fragments->len > 0) {
+    /* The fragment list was supplied up front via the add-fragment
+     * signal, use it instead of globbing for files */
+    files = g_new0 (gchar *, splitmux->fragments->len + 1);
+    frag_durations = g_new (GstClockTime, splitmux->fragments->len);
+    for (i = 0; i < splitmux->fragments->len; i++) {
+      SplitMuxSrcFragment *frag =
+          g_ptr_array_index (splitmux->fragments, i);
+
+      files[i] = g_strdup (frag->path);
+      frag_durations[i] = frag->duration;
+    }
+  }
+  SPLITMUX_SRC_UNLOCK (splitmux);
+
+  if (files == NULL)
+    g_signal_emit (splitmux, signals[SIGNAL_FORMAT_LOCATION], 0, &files);
 
   if (files == NULL || *files == NULL) {
     GST_OBJECT_LOCK (splitmux);
@@ -948,6 +1046,11 @@ gst_splitmux_src_start (GstSplitMuxSrc * splitmux)
     splitmux->parts[i] = gst_splitmux_part_create (splitmux, files[i]);
     if (splitmux->parts[i] == NULL)
       break;
+    /* When the application supplied the fragment durations, preparing
+     * doesn't need to scan each file to measure its length */
+    if (frag_durations != NULL && GST_CLOCK_TIME_IS_VALID (frag_durations[i]))
+      gst_splitmux_part_reader_set_duration (splitmux->parts[i],
+          frag_durations[i]);
   }
 
   /* Store how many parts we actually created */
@@ -974,6 +1077,7 @@ done:
   if (err != NULL)
     g_error_free (err);
   g_strfreev (files);
+  g_free (frag_durations);
   g_free (basename);
   g_free (dirname);
 
@@ -49,6 +49,8 @@ struct _GstSplitMuxSrc
 
   gchar       *location;  /* OBJECT_LOCK */
 
+  GPtrArray   *fragments; /* SPLITMUX_SRC_LOCK; SplitMuxSrcFragment */
+
   GstSplitMuxPartReader **parts;
   guint        num_parts;
   guint        num_prepared_parts;
@@ -72,6 +74,9 @@ struct _GstSplitMuxSrc
 struct _GstSplitMuxSrcClass
 {
   GstBinClass parent_class;
+
+  gboolean (*add_fragment) (GstSplitMuxSrc *splitmux,
+      const gchar *location, GstClockTime duration);
 };
 
 GType splitmux_src_pad_get_type (void);
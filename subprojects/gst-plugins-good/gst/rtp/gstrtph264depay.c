@@ -908,6 +908,25 @@ gst_rtp_h264_complete_au (GstRtpH264Depay * rtph264depay,
   GST_DEBUG_OBJECT (rtph264depay, "taking completed AU");
   outsize = gst_adapter_available (rtph264depay->picture_adapter);
 
+  if (rtph264depay->allocator == NULL) {
+    /* no downstream allocator to fill, so don't copy the NAL data a second
+     * time; string the queued NALs together into one buffer instead */
+    list = gst_adapter_take_buffer_list (rtph264depay->picture_adapter,
+        outsize);
+
+    n_bufs = gst_buffer_list_length (list);
+    outbuf = gst_buffer_copy (gst_buffer_list_get (list, 0));
+    for (b = 1; b < n_bufs; ++b) {
+      GstBuffer *buf = gst_buffer_list_get (list, b);
+
+      gst_rtp_copy_video_meta (rtph264depay, outbuf, buf);
+      outbuf = gst_buffer_append (outbuf, gst_buffer_ref (buf));
+    }
+    gst_buffer_list_unref (list);
+
+    goto done;
+  }
+
   outbuf = gst_rtp_h264_depay_allocate_output_buffer (rtph264depay, outsize);
 
   if (outbuf == NULL)
@@ -942,6 +961,7 @@ gst_rtp_h264_complete_au (GstRtpH264Depay * rtph264depay,
   gst_buffer_list_unref (list);
   gst_buffer_unmap (outbuf, &outmap);
 
+done:
   *out_timestamp = rtph264depay->last_ts;
   *out_keyframe = rtph264depay->last_keyframe;
 
@@ -398,6 +398,7 @@ struct _GstRtpJitterBufferPrivate
   /* for sync */
   GstSegment segment;
   GstClockID clock_id;
+  GstClockID cached_clock_id;
   GstClockTime timer_timeout;
   guint16 timer_seqnum;
   /* the latency of the upstream peer, we have to take this into account when
@@ -1214,6 +1215,8 @@ gst_rtp_jitter_buffer_finalize (GObject * object)
 
   g_object_unref (priv->timers);
   g_object_unref (priv->rtx_stats_timers);
+  if (priv->cached_clock_id != NULL)
+    gst_clock_id_unref (priv->cached_clock_id);
   g_mutex_clear (&priv->jbuf_lock);
   g_cond_clear (&priv->jbuf_queue);
   g_cond_clear (&priv->jbuf_timer);
@@ -4433,8 +4436,22 @@ wait_next_timeout (GstRtpJitterBuffer * jitterbuffer)
           GST_TIME_FORMAT " with sync time %" GST_TIME_FORMAT, timer->seqnum,
           GST_TIME_ARGS (get_pts_timeout (timer)), GST_TIME_ARGS (sync_time));
 
-      /* create an entry for the clock */
-      id = priv->clock_id = gst_clock_new_single_shot_id (clock, sync_time);
+      /* create an entry for the clock, reusing the cached entry when
+       * possible to avoid an allocation per wakeup */
+      if (G_LIKELY (priv->cached_clock_id != NULL
+              && gst_clock_id_uses_clock (priv->cached_clock_id, clock))) {
+        if (!gst_clock_single_shot_id_reinit (clock, priv->cached_clock_id,
+                sync_time)) {
+          gst_clock_id_unref (priv->cached_clock_id);
+          priv->cached_clock_id =
+              gst_clock_new_single_shot_id (clock, sync_time);
+        }
+      } else {
+        if (priv->cached_clock_id != NULL)
+          gst_clock_id_unref (priv->cached_clock_id);
+        priv->cached_clock_id = gst_clock_new_single_shot_id (clock, sync_time);
+      }
+      id = priv->clock_id = priv->cached_clock_id;
       priv->timer_timeout = timer->timeout;
       priv->timer_seqnum = timer->seqnum;
       GST_OBJECT_UNLOCK (jitterbuffer);
@@ -4450,7 +4467,6 @@ wait_next_timeout (GstRtpJitterBuffer * jitterbuffer)
 
       if (!priv->timer_running) {
         g_queue_clear_full (&events, (GDestroyNotify) gst_event_unref);
-        gst_clock_id_unref (id);
         priv->clock_id = NULL;
         break;
       }
@@ -4464,8 +4480,8 @@ wait_next_timeout (GstRtpJitterBuffer * jitterbuffer)
         GST_DEBUG_OBJECT (jitterbuffer, "sync unscheduled");
       }
 
-      /* and free the entry */
-      gst_clock_id_unref (id);
+      /* and release the entry, the cached reference stays around for the
+       * next wait */
       priv->clock_id = NULL;
     } else {
       push_rtx_events_unlocked (jitterbuffer, &events);
@@ -363,14 +363,15 @@ gst_rtp_pt_demux_get_caps (GstRtpPtDemux * rtpdemux, guint pt)
 static void
 gst_rtp_pt_demux_clear_pt_map (GstRtpPtDemux * rtpdemux)
 {
-  GSList *walk;
+  guint i;
 
   GST_OBJECT_LOCK (rtpdemux);
   GST_DEBUG_OBJECT (rtpdemux, "clearing pt map");
-  for (walk = rtpdemux->srcpads; walk; walk = g_slist_next (walk)) {
-    GstRtpPtDemuxPad *pad = walk->data;
+  for (i = 0; i < G_N_ELEMENTS (rtpdemux->srcpads); i++) {
+    GstRtpPtDemuxPad *pad = rtpdemux->srcpads[i];
 
-    pad->newcaps = TRUE;
+    if (pad)
+      pad->newcaps = TRUE;
   }
   GST_OBJECT_UNLOCK (rtpdemux);
 }
@@ -378,17 +379,12 @@ gst_rtp_pt_demux_clear_pt_map (GstRtpPtDemux * rtpdemux)
 static gboolean
 need_caps_for_pt (GstRtpPtDemux * rtpdemux, guint8 pt)
 {
-  GSList *walk;
+  GstRtpPtDemuxPad *pad;
   gboolean ret = FALSE;
 
   GST_OBJECT_LOCK (rtpdemux);
-  for (walk = rtpdemux->srcpads; walk; walk = g_slist_next (walk)) {
-    GstRtpPtDemuxPad *pad = walk->data;
-
-    if (pad->pt == pt) {
-      ret = pad->newcaps;
-    }
-  }
+  if (pt < G_N_ELEMENTS (rtpdemux->srcpads) && (pad = rtpdemux->srcpads[pt]))
+    ret = pad->newcaps;
   GST_OBJECT_UNLOCK (rtpdemux);
 
   return ret;
@@ -398,17 +394,11 @@ need_caps_for_pt (GstRtpPtDemux * rtpdemux, guint8 pt)
 static void
 clear_newcaps_for_pt (GstRtpPtDemux * rtpdemux, guint8 pt)
 {
-  GSList *walk;
+  GstRtpPtDemuxPad *pad;
 
   GST_OBJECT_LOCK (rtpdemux);
-  for (walk = rtpdemux->srcpads; walk; walk = g_slist_next (walk)) {
-    GstRtpPtDemuxPad *pad = walk->data;
-
-    if (pad->pt == pt) {
-      pad->newcaps = FALSE;
-      break;
-    }
-  }
+  if (pt < G_N_ELEMENTS (rtpdemux->srcpads) && (pad = rtpdemux->srcpads[pt]))
+    pad->newcaps = FALSE;
   GST_OBJECT_UNLOCK (rtpdemux);
 }
 
@@ -499,7 +489,7 @@ gst_rtp_pt_demux_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
     rtpdemuxpad->pad = srcpad;
     gst_object_ref (srcpad);
     GST_OBJECT_LOCK (rtpdemux);
-    rtpdemux->srcpads = g_slist_append (rtpdemux->srcpads, rtpdemuxpad);
+    rtpdemux->srcpads[pt] = rtpdemuxpad;
     GST_OBJECT_UNLOCK (rtpdemux);
 
     gst_pad_set_active (srcpad, TRUE);
@@ -607,17 +597,11 @@ static GstPad *
 find_pad_for_pt (GstRtpPtDemux * rtpdemux, guint8 pt)
 {
   GstPad *respad = NULL;
-  GSList *walk;
+  GstRtpPtDemuxPad *pad;
 
   GST_OBJECT_LOCK (rtpdemux);
-  for (walk = rtpdemux->srcpads; walk; walk = g_slist_next (walk)) {
-    GstRtpPtDemuxPad *pad = walk->data;
-
-    if (pad->pt == pt) {
-      respad = gst_object_ref (pad->pad);
-      break;
-    }
-  }
+  if (pt < G_N_ELEMENTS (rtpdemux->srcpads) && (pad = rtpdemux->srcpads[pt]))
+    respad = gst_object_ref (pad->pad);
   GST_OBJECT_UNLOCK (rtpdemux);
 
   return respad;
@@ -685,13 +669,13 @@ gst_rtp_pt_demux_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
     case GST_EVENT_CUSTOM_BOTH_OOB:
       s = gst_event_get_structure (event);
       if (s && !gst_structure_has_field (s, "payload")) {
-        GSList *walk;
+        guint i;
 
         GST_OBJECT_LOCK (demux);
-        for (walk = demux->srcpads; walk; walk = g_slist_next (walk)) {
-          GstRtpPtDemuxPad *dpad = (GstRtpPtDemuxPad *) walk->data;
+        for (i = 0; i < G_N_ELEMENTS (demux->srcpads); i++) {
+          GstRtpPtDemuxPad *dpad = demux->srcpads[i];
 
-          if (dpad->pad == pad) {
+          if (dpad && dpad->pad == pad) {
             GstStructure *ws;
 
             event =
@@ -718,7 +702,7 @@ gst_rtp_pt_demux_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
 static gboolean
 gst_rtp_pt_demux_setup (GstRtpPtDemux * ptdemux)
 {
-  ptdemux->srcpads = NULL;
+  memset (ptdemux->srcpads, 0, sizeof (ptdemux->srcpads));
   ptdemux->last_pt = 0xFFFF;
 
   return TRUE;
@@ -730,22 +714,24 @@ gst_rtp_pt_demux_setup (GstRtpPtDemux * ptdemux)
 static void
 gst_rtp_pt_demux_release (GstRtpPtDemux * ptdemux)
 {
-  GSList *tmppads;
-  GSList *walk;
+  GstRtpPtDemuxPad *tmppads[G_N_ELEMENTS (ptdemux->srcpads)];
+  guint i;
 
   GST_OBJECT_LOCK (ptdemux);
-  tmppads = ptdemux->srcpads;
-  ptdemux->srcpads = NULL;
+  memcpy (tmppads, ptdemux->srcpads, sizeof (tmppads));
+  memset (ptdemux->srcpads, 0, sizeof (ptdemux->srcpads));
   GST_OBJECT_UNLOCK (ptdemux);
 
-  for (walk = tmppads; walk; walk = g_slist_next (walk)) {
-    GstRtpPtDemuxPad *pad = walk->data;
+  for (i = 0; i < G_N_ELEMENTS (tmppads); i++) {
+    GstRtpPtDemuxPad *pad = tmppads[i];
+
+    if (pad == NULL)
+      continue;
 
     gst_pad_set_active (pad->pad, FALSE);
     gst_element_remove_pad (GST_ELEMENT_CAST (ptdemux), pad->pad);
     g_slice_free (GstRtpPtDemuxPad, pad);
   }
-  g_slist_free (tmppads);
 }
 
 static GstStateChangeReturn
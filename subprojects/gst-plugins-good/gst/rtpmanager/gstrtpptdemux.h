@@ -38,7 +38,8 @@ struct _GstRtpPtDemux
 
   GstPad *sink;       /*< the sink pad */
   guint16 last_pt;    /*< pt of the last packet 0xFFFF if none */
-  GSList *srcpads;    /*< a linked list of GstRtpPtDemuxPad objects */
+  GstRtpPtDemuxPad *srcpads[128]; /*< pad state indexed by payload type,
+                                   *  protected by the object lock */
   GValue ignored_pts; /*< a GstValueArray of payload types that will not have pads created for */
 };
 
@@ -41,6 +41,7 @@
 #endif
 
 #include <gst/gst.h>
+#include <gst/base/gstqueuearray.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -166,10 +167,60 @@ typedef struct
 } BufferQueueItem;
 
 static void
-buffer_queue_item_free (BufferQueueItem * item)
+buffer_queue_item_clear (BufferQueueItem * item)
 {
   gst_buffer_unref (item->buffer);
-  g_slice_free (BufferQueueItem, item);
+}
+
+static void
+buffer_queue_drop_head (GstQueueArray * queue)
+{
+  BufferQueueItem *item = gst_queue_array_pop_head_struct (queue);
+
+  gst_buffer_unref (item->buffer);
+}
+
+/* Must be called with lock. The history holds packets in send order, so
+ * when the stored seqnums are consecutive (the usual case) the requested
+ * one sits exactly seqnum - head->seqnum entries in; fall back to a
+ * binary search when upstream left gaps. */
+static BufferQueueItem *
+buffer_queue_lookup_seqnum (GstQueueArray * queue, guint16 seqnum)
+{
+  BufferQueueItem *item;
+  guint len, lo, hi, idx;
+
+  len = gst_queue_array_get_length (queue);
+  if (len == 0)
+    return NULL;
+
+  item = gst_queue_array_peek_head_struct (queue);
+  idx = (guint16) (seqnum - item->seqnum);
+  if (idx < len) {
+    item = gst_queue_array_peek_nth_struct (queue, idx);
+    if (item->seqnum == seqnum)
+      return item;
+  }
+
+  lo = 0;
+  hi = len;
+  while (lo < hi) {
+    gint cmp;
+
+    idx = lo + (hi - lo) / 2;
+    item = gst_queue_array_peek_nth_struct (queue, idx);
+    /* gst_rtp_buffer_compare_seqnum returns positive when the stored
+     * seqnum comes before the requested one */
+    cmp = gst_rtp_buffer_compare_seqnum (item->seqnum, seqnum);
+    if (cmp == 0)
+      return item;
+    else if (cmp > 0)
+      lo = idx + 1;
+    else
+      hi = idx;
+  }
+
+  return NULL;
 }
 
 typedef struct
@@ -179,7 +230,7 @@ typedef struct
   gint clock_rate;
 
   /* history of rtp packets */
-  GSequence *queue;
+  GstQueueArray *queue;
 } SSRCRtxData;
 
 static SSRCRtxData *
@@ -189,7 +240,11 @@ ssrc_rtx_data_new (guint32 rtx_ssrc)
 
   data->rtx_ssrc = rtx_ssrc;
   data->next_seqnum = data->seqnum_base = g_random_int_range (0, G_MAXUINT16);
-  data->queue = g_sequence_new ((GDestroyNotify) buffer_queue_item_free);
+  data->queue =
+      gst_queue_array_new_for_struct (sizeof (BufferQueueItem),
+      DEFAULT_MAX_SIZE_PACKETS);
+  gst_queue_array_set_clear_func (data->queue,
+      (GDestroyNotify) buffer_queue_item_clear);
 
   return data;
 }
@@ -197,7 +252,7 @@ ssrc_rtx_data_new (guint32 rtx_ssrc)
 static void
 ssrc_rtx_data_free (SSRCRtxData * data)
 {
-  g_sequence_free (data->queue);
+  gst_queue_array_free (data->queue);
   g_slice_free (SSRCRtxData, data);
 }
 
@@ -675,7 +730,6 @@ gst_rtp_rtx_buffer_new (GstRtpRtxSend * rtx, GstBuffer * buffer)
   GstRTPBuffer new_rtp = GST_RTP_BUFFER_INIT;
   GstBuffer *new_buffer = gst_buffer_new ();
   GstMapInfo map;
-  guint payload_len = 0;
   SSRCRtxData *data;
   guint32 ssrc;
   guint16 seqnum;
@@ -708,17 +762,19 @@ gst_rtp_rtx_buffer_new (GstRtpRtxSend * rtx, GstBuffer * buffer)
     gst_buffer_append_memory (new_buffer, mem);
   }
 
-  /* copy payload and add OSN just before */
-  payload_len = 2 + rtp.size[2];
-  mem = gst_allocator_alloc (NULL, payload_len, NULL);
+  /* add OSN just before the payload, which is shared with the stored
+   * packet instead of copied; nobody writes to it downstream */
+  mem = gst_allocator_alloc (NULL, 2, NULL);
 
   gst_memory_map (mem, &map, GST_MAP_WRITE);
   GST_WRITE_UINT16_BE (map.data, gst_rtp_buffer_get_seq (&rtp));
-  if (rtp.size[2])
-    memcpy (map.data + 2, rtp.data[2], rtp.size[2]);
   gst_memory_unmap (mem, &map);
   gst_buffer_append_memory (new_buffer, mem);
 
+  if (rtp.size[2])
+    gst_buffer_copy_into (new_buffer, buffer, GST_BUFFER_COPY_MEMORY,
+        rtp.size[0] + rtp.size[1], rtp.size[2]);
+
   /* everything needed is copied */
   gst_rtp_buffer_unmap (&rtp);
 
@@ -740,16 +796,6 @@ gst_rtp_rtx_buffer_new (GstRtpRtxSend * rtx, GstBuffer * buffer)
   return new_buffer;
 }
 
-static gint
-buffer_queue_items_cmp (BufferQueueItem * a, BufferQueueItem * b,
-    gpointer user_data)
-{
-  /* gst_rtp_buffer_compare_seqnum returns the opposite of what we want,
-   * it returns negative when seqnum1 > seqnum2 and we want negative
-   * when b > a, i.e. a is smaller, so it comes first in the sequence */
-  return gst_rtp_buffer_compare_seqnum (b->seqnum, a->seqnum);
-}
-
 static gboolean
 gst_rtp_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
 {
@@ -782,29 +828,21 @@ gst_rtp_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
         /* check if request is for us */
         if (g_hash_table_contains (rtx->ssrc_data, GUINT_TO_POINTER (ssrc))) {
           SSRCRtxData *data;
-          GSequenceIter *iter;
-          BufferQueueItem search_item;
+          BufferQueueItem *item;
 
           /* update statistics */
           ++rtx->num_rtx_requests;
 
           data = gst_rtp_rtx_send_get_ssrc_data (rtx, ssrc);
 
-          search_item.seqnum = seqnum;
-          iter = g_sequence_lookup (data->queue, &search_item,
-              (GCompareDataFunc) buffer_queue_items_cmp, NULL);
-          if (iter) {
-            BufferQueueItem *item = g_sequence_get (iter);
+          item = buffer_queue_lookup_seqnum (data->queue, seqnum);
+          if (item) {
             GST_LOG_OBJECT (rtx, "found %u", item->seqnum);
             rtx_buf = gst_rtp_rtx_buffer_new (rtx, item->buffer);
           }
 #ifndef GST_DISABLE_DEBUG
           else {
-            BufferQueueItem *item = NULL;
-
-            iter = g_sequence_get_begin_iter (data->queue);
-            if (!g_sequence_iter_is_end (iter))
-              item = g_sequence_get (iter);
+            item = gst_queue_array_peek_head_struct (data->queue);
 
             if (item && seqnum < item->seqnum) {
               GST_DEBUG_OBJECT (rtx, "requested seqnum %u has already been "
@@ -981,14 +1019,12 @@ gst_rtp_rtx_send_get_ts_diff (SSRCRtxData * data)
   BufferQueueItem *high_buf, *low_buf;
   guint32 result;
 
-  high_buf =
-      g_sequence_get (g_sequence_iter_prev (g_sequence_get_end_iter
-          (data->queue)));
-  low_buf = g_sequence_get (g_sequence_get_begin_iter (data->queue));
-
-  if (!high_buf || !low_buf || high_buf == low_buf)
+  if (gst_queue_array_get_length (data->queue) < 2)
     return 0;
 
+  high_buf = gst_queue_array_peek_tail_struct (data->queue);
+  low_buf = gst_queue_array_peek_head_struct (data->queue);
+
   if (data->clock_rate) {
     high_ts = high_buf->timestamp;
     low_ts = low_buf->timestamp;
@@ -1014,7 +1050,7 @@ static void
 process_buffer (GstRtpRtxSend * rtx, GstBuffer * buffer)
 {
   GstRTPBuffer rtp = GST_RTP_BUFFER_INIT;
-  BufferQueueItem *item;
+  BufferQueueItem item;
   SSRCRtxData *data;
   guint16 seqnum;
   guint8 payload_type;
@@ -1042,20 +1078,19 @@ process_buffer (GstRtpRtxSend * rtx, GstBuffer * buffer)
     }
 
     /* add current rtp buffer to queue history */
-    item = g_slice_new0 (BufferQueueItem);
-    item->seqnum = seqnum;
-    item->timestamp = rtptime;
-    item->buffer = gst_buffer_ref (buffer);
-    g_sequence_append (data->queue, item);
+    item.seqnum = seqnum;
+    item.timestamp = rtptime;
+    item.buffer = gst_buffer_ref (buffer);
+    gst_queue_array_push_tail_struct (data->queue, &item);
 
     /* remove oldest packets from history if they are too many */
     if (rtx->max_size_packets) {
-      while (g_sequence_get_length (data->queue) > rtx->max_size_packets)
-        g_sequence_remove (g_sequence_get_begin_iter (data->queue));
+      while (gst_queue_array_get_length (data->queue) > rtx->max_size_packets)
+        buffer_queue_drop_head (data->queue);
     }
     if (rtx->max_size_time) {
       while (gst_rtp_rtx_send_get_ts_diff (data) > rtx->max_size_time)
-        g_sequence_remove (g_sequence_get_begin_iter (data->queue));
+        buffer_queue_drop_head (data->queue);
     }
   }
 }
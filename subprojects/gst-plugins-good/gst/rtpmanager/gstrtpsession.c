@@ -265,6 +265,7 @@ struct _GstRtpSessionPrivate
 
   /* thread for sending out RTCP */
   GstClockID id;
+  GstClockID cached_id;
   gboolean stop_thread;
   GThread *thread;
   gboolean thread_stopped;
@@ -937,6 +938,8 @@ gst_rtp_session_finalize (GObject * object)
   g_hash_table_destroy (rtpsession->priv->ptmap);
   g_mutex_clear (&rtpsession->priv->lock);
   g_cond_clear (&rtpsession->priv->cond);
+  if (rtpsession->priv->cached_id)
+    gst_clock_id_unref (rtpsession->priv->cached_id);
   g_object_unref (rtpsession->priv->sysclock);
   g_object_unref (rtpsession->priv->session);
   if (rtpsession->priv->last_twcc_stats)
@@ -1220,14 +1223,24 @@ rtcp_thread (GstRtpSession * rtpsession)
     if (next_timeout == GST_CLOCK_TIME_NONE)
       break;
 
-    id = rtpsession->priv->id =
-        gst_clock_new_single_shot_id (sysclock, next_timeout);
+    /* reuse the same clock entry for every iteration instead of allocating
+     * a new one per report interval */
+    if (rtpsession->priv->cached_id
+        && gst_clock_id_uses_clock (rtpsession->priv->cached_id, sysclock)) {
+      gst_clock_single_shot_id_reinit (sysclock, rtpsession->priv->cached_id,
+          next_timeout);
+    } else {
+      if (rtpsession->priv->cached_id)
+        gst_clock_id_unref (rtpsession->priv->cached_id);
+      rtpsession->priv->cached_id =
+          gst_clock_new_single_shot_id (sysclock, next_timeout);
+    }
+    id = rtpsession->priv->id = rtpsession->priv->cached_id;
     GST_RTP_SESSION_UNLOCK (rtpsession);
 
     res = gst_clock_id_wait (id, NULL);
 
     GST_RTP_SESSION_LOCK (rtpsession);
-    gst_clock_id_unref (id);
     rtpsession->priv->id = NULL;
 
     if (rtpsession->priv->stop_thread)
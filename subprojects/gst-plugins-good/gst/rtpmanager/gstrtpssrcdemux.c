@@ -163,15 +163,18 @@ typedef struct
 static GstRtpSsrcDemuxPads *
 find_demux_pads_for_ssrc (GstRtpSsrcDemux * demux, guint32 ssrc)
 {
-  GSList *walk;
+  GstRtpSsrcDemuxPads *dpads;
 
-  for (walk = demux->srcpads; walk; walk = g_slist_next (walk)) {
-    GstRtpSsrcDemuxPads *pad = (GstRtpSsrcDemuxPads *) walk->data;
+  /* flows are bursty per SSRC, the previous match is usually the next one */
+  if (demux->last_dpads != NULL && demux->last_ssrc == ssrc)
+    return demux->last_dpads;
 
-    if (pad->ssrc == ssrc)
-      return pad;
+  dpads = g_hash_table_lookup (demux->srcpads, GUINT_TO_POINTER (ssrc));
+  if (dpads != NULL) {
+    demux->last_ssrc = ssrc;
+    demux->last_dpads = dpads;
   }
-  return NULL;
+  return dpads;
 }
 
 /* returns a reference to the pad if found, %NULL otherwise */
@@ -345,7 +348,7 @@ find_or_create_demux_pad_for_ssrc (GstRtpSsrcDemux * demux, guint32 ssrc,
   dpads->rtcp_pad = rtcp_pad;
 
   GST_OBJECT_LOCK (demux);
-  demux->srcpads = g_slist_prepend (demux->srcpads, dpads);
+  g_hash_table_insert (demux->srcpads, GUINT_TO_POINTER (ssrc), dpads);
   GST_OBJECT_UNLOCK (demux);
 
   gst_pad_set_query_function (rtp_pad, gst_rtp_ssrc_demux_src_query);
@@ -532,6 +535,8 @@ gst_rtp_ssrc_demux_init (GstRtpSsrcDemux * demux)
 
   demux->max_streams = DEFAULT_MAX_STREAMS;
 
+  demux->srcpads = g_hash_table_new (NULL, NULL);
+
   g_rec_mutex_init (&demux->padlock);
 }
 
@@ -550,9 +555,14 @@ gst_rtp_ssrc_demux_pads_free (GstRtpSsrcDemuxPads * dpads)
 static void
 gst_rtp_ssrc_demux_reset (GstRtpSsrcDemux * demux)
 {
-  g_slist_free_full (demux->srcpads,
-      (GDestroyNotify) gst_rtp_ssrc_demux_pads_free);
-  demux->srcpads = NULL;
+  GHashTableIter iter;
+  gpointer dpads;
+
+  g_hash_table_iter_init (&iter, demux->srcpads);
+  while (g_hash_table_iter_next (&iter, NULL, &dpads))
+    gst_rtp_ssrc_demux_pads_free (dpads);
+  g_hash_table_remove_all (demux->srcpads);
+  demux->last_dpads = NULL;
 }
 
 static void
@@ -573,6 +583,7 @@ gst_rtp_ssrc_demux_finalize (GObject * object)
   GstRtpSsrcDemux *demux;
 
   demux = GST_RTP_SSRC_DEMUX (object);
+  g_hash_table_unref (demux->srcpads);
   g_rec_mutex_clear (&demux->padlock);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -592,7 +603,9 @@ gst_rtp_ssrc_demux_clear_ssrc (GstRtpSsrcDemux * demux, guint32 ssrc)
 
   GST_DEBUG_OBJECT (demux, "clearing pad for SSRC %08x", ssrc);
 
-  demux->srcpads = g_slist_remove (demux->srcpads, dpads);
+  g_hash_table_remove (demux->srcpads, GUINT_TO_POINTER (ssrc));
+  if (demux->last_dpads == dpads)
+    demux->last_dpads = NULL;
   GST_OBJECT_UNLOCK (demux);
 
   g_signal_emit (G_OBJECT (demux),
@@ -623,7 +636,8 @@ static gboolean
 forward_event (GstPad * pad, gpointer user_data)
 {
   struct ForwardEventData *fdata = user_data;
-  GSList *walk = NULL;
+  GHashTableIter iter;
+  gpointer value;
   GstEvent *newevent = NULL;
 
   /* special case for EOS */
@@ -634,8 +648,9 @@ forward_event (GstPad * pad, gpointer user_data)
     return FALSE;
 
   GST_OBJECT_LOCK (fdata->demux);
-  for (walk = fdata->demux->srcpads; walk; walk = walk->next) {
-    GstRtpSsrcDemuxPads *dpads = (GstRtpSsrcDemuxPads *) walk->data;
+  g_hash_table_iter_init (&iter, fdata->demux->srcpads);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstRtpSsrcDemuxPads *dpads = (GstRtpSsrcDemuxPads *) value;
 
     if (pad == dpads->rtp_pad || pad == dpads->rtcp_pad) {
       newevent = add_ssrc_and_ref (fdata->event, dpads->ssrc);
@@ -841,10 +856,12 @@ create_failed:
 static GstRtpSsrcDemuxPads *
 find_demux_pad_for_pad (GstRtpSsrcDemux * demux, GstPad * pad)
 {
-  GSList *walk;
+  GHashTableIter iter;
+  gpointer value;
 
-  for (walk = demux->srcpads; walk; walk = g_slist_next (walk)) {
-    GstRtpSsrcDemuxPads *dpads = (GstRtpSsrcDemuxPads *) walk->data;
+  g_hash_table_iter_init (&iter, demux->srcpads);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstRtpSsrcDemuxPads *dpads = (GstRtpSsrcDemuxPads *) value;
     if (dpads->rtp_pad == pad || dpads->rtcp_pad == pad) {
       return dpads;
     }
@@ -893,13 +910,15 @@ gst_rtp_ssrc_demux_iterate_internal_links_src (GstPad * pad, GstObject * parent)
   GstRtpSsrcDemux *demux;
   GstPad *otherpad = NULL;
   GstIterator *it = NULL;
-  GSList *current;
+  GHashTableIter iter;
+  gpointer value;
 
   demux = GST_RTP_SSRC_DEMUX (parent);
 
   GST_OBJECT_LOCK (demux);
-  for (current = demux->srcpads; current; current = g_slist_next (current)) {
-    GstRtpSsrcDemuxPads *dpads = (GstRtpSsrcDemuxPads *) current->data;
+  g_hash_table_iter_init (&iter, demux->srcpads);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstRtpSsrcDemuxPads *dpads = (GstRtpSsrcDemuxPads *) value;
 
     if (pad == dpads->rtp_pad) {
       otherpad = demux->rtp_sink;
@@ -39,7 +39,11 @@ struct _GstRtpSsrcDemux
   GstPad *rtcp_sink;
 
   GRecMutex padlock;
-  GSList *srcpads;
+  GHashTable *srcpads;          /* ssrc -> GstRtpSsrcDemuxPads, protected
+                                 * by the object lock */
+  /* one-entry lookup cache, protected by the object lock */
+  guint32 last_ssrc;
+  gpointer last_dpads;
   guint max_streams;
 };
 
@@ -1089,6 +1089,49 @@ rtp_jitter_buffer_insert (RTPJitterBuffer * jbuf, RTPJitterBufferItem * item,
 
   seqnum = item->seqnum;
 
+  /* Late packets (retransmissions, heavily reordered bonded links) sort
+   * close to the head of a possibly long queue, so walking backwards from
+   * the tail would traverse nearly every queued packet. Walk from whichever
+   * end is nearer in sequence number space instead. */
+  if (list && list != jbuf->packets.head) {
+    RTPJitterBufferItem *hitem = (RTPJitterBufferItem *) jbuf->packets.head;
+    RTPJitterBufferItem *titem = (RTPJitterBufferItem *) list;
+
+    if (hitem->seqnum != -1 && titem->seqnum != -1 &&
+        -gst_rtp_buffer_compare_seqnum (seqnum, hitem->seqnum) <
+        gst_rtp_buffer_compare_seqnum (seqnum, titem->seqnum)) {
+      GList *prev = NULL;
+
+      /* skip events and strictly smaller seqnum buffers and insert before
+       * the first larger packet. This gives the same ordering as the
+       * backward walk below, including placing the packet after any events
+       * that directly follow smaller packets. */
+      for (list = jbuf->packets.head; list; list = g_list_next (list)) {
+        RTPJitterBufferItem *qitem = (RTPJitterBufferItem *) list;
+        gint gap;
+
+        if (qitem->seqnum == -1) {
+          prev = list;
+          continue;
+        }
+
+        gap = gst_rtp_buffer_compare_seqnum (seqnum, qitem->seqnum);
+
+        /* we hit a packet with the same seqnum, notify a duplicate */
+        if (G_UNLIKELY (gap == 0))
+          goto duplicate;
+
+        /* qseq > seqnum, insert before this packet */
+        if (gap > 0)
+          break;
+
+        prev = list;
+      }
+      list = prev;
+      goto append;
+    }
+  }
+
   /* loop the list to skip strictly larger seqnum buffers */
   for (; list; list = g_list_previous (list)) {
     guint16 qseq;
@@ -1190,6 +1190,7 @@ rtp_session_reset (RTPSession * sess)
   g_return_if_fail (RTP_IS_SESSION (sess));
 
   /* remove all sources */
+  sess->last_source = NULL;
   g_hash_table_remove_all (sess->ssrcs[sess->mask_idx]);
   sess->total_sources = 0;
   sess->stats.sender_sources = 0;
@@ -1869,8 +1870,18 @@ add_source (RTPSession * sess, RTPSource * src)
 static RTPSource *
 find_source (RTPSession * sess, guint32 ssrc)
 {
-  return g_hash_table_lookup (sess->ssrcs[sess->mask_idx],
+  RTPSource *source = sess->last_source;
+
+  /* packets from one stream usually arrive back-to-back, remember the last
+   * match so repeated lookups for the same SSRC skip the hash table */
+  if (source != NULL && source->ssrc == ssrc)
+    return source;
+
+  source = g_hash_table_lookup (sess->ssrcs[sess->mask_idx],
       GINT_TO_POINTER (ssrc));
+  sess->last_source = source;
+
+  return source;
 }
 
 /* must be called with the session lock, the returned source needs to be
@@ -4697,6 +4708,7 @@ rtp_session_on_timeout (RTPSession * sess, GstClockTime current_time,
   g_hash_table_destroy (table_copy);
 
   /* Now remove the marked sources */
+  sess->last_source = NULL;
   g_hash_table_foreach_remove (sess->ssrcs[sess->mask_idx],
       (GHRFunc) remove_closing_sources, &data);
 
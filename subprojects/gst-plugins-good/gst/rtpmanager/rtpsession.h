@@ -267,6 +267,8 @@ struct _RTPSession {
   guint32       mask_idx;
   guint32       mask;
   GHashTable   *ssrcs[32];
+  RTPSource    *last_source;  /* last source found, owned by the hash table,
+                               * protected by the session lock */
   guint         total_sources;
 
   guint16       generation;
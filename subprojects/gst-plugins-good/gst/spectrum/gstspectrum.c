@@ -218,10 +218,11 @@ gst_spectrum_alloc_channel_data (GstSpectrum * spectrum)
   GST_DEBUG_OBJECT (spectrum, "allocating data for %d channels",
       spectrum->num_channels);
 
+  spectrum->fft_ctx = gst_fft_f32_new (nfft, FALSE);
+
   spectrum->channel_data = g_new (GstSpectrumChannel, spectrum->num_channels);
   for (i = 0; i < spectrum->num_channels; i++) {
     cd = &spectrum->channel_data[i];
-    cd->fft_ctx = gst_fft_f32_new (nfft, FALSE);
     cd->input = g_new0 (gfloat, nfft);
     cd->input_tmp = g_new0 (gfloat, nfft);
     cd->freqdata = g_new0 (GstFFTF32Complex, bands);
@@ -242,8 +243,6 @@ gst_spectrum_free_channel_data (GstSpectrum * spectrum)
 
     for (i = 0; i < spectrum->num_channels; i++) {
       cd = &spectrum->channel_data[i];
-      if (cd->fft_ctx)
-        gst_fft_f32_free (cd->fft_ctx);
       g_free (cd->input);
       g_free (cd->input_tmp);
       g_free (cd->freqdata);
@@ -253,6 +252,11 @@ gst_spectrum_free_channel_data (GstSpectrum * spectrum)
     g_free (spectrum->channel_data);
     spectrum->channel_data = NULL;
   }
+
+  if (spectrum->fft_ctx) {
+    gst_fft_f32_free (spectrum->fft_ctx);
+    spectrum->fft_ctx = NULL;
+  }
 }
 
 static void
@@ -725,7 +729,7 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
   gfloat *spect_magnitude = cd->spect_magnitude;
   gfloat *spect_phase = cd->spect_phase;
   GstFFTF32Complex *freqdata = cd->freqdata;
-  GstFFTF32 *fft_ctx = cd->fft_ctx;
+  GstFFTF32 *fft_ctx = spectrum->fft_ctx;
 
   for (i = 0; i < nfft; i++)
     input_tmp[i] = input[(input_pos + i) % nfft];
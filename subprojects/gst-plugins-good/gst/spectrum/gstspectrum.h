@@ -47,7 +47,6 @@ struct _GstSpectrumChannel
   GstFFTF32Complex *freqdata;
   gfloat *spect_magnitude;      /* accumulated mangitude and phase */
   gfloat *spect_phase;          /* will be scaled by num_fft before sending */
-  GstFFTF32 *fft_ctx;
 };
 
 struct _GstSpectrum
@@ -73,6 +72,8 @@ struct _GstSpectrum
   /* <private> */
   GstSpectrumChannel *channel_data;
   guint num_channels;
+  GstFFTF32 *fft_ctx;           /* same plan for all channels, the FFTs
+                                 * run one after another */
 
   guint input_pos;
   guint64 error_per_interval;
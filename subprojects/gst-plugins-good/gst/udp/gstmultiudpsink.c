@@ -492,22 +492,20 @@ name_resolve:
   }
 }
 
-/* call with client lock held */
 static void
 gst_udp_client_unref (GstUDPClient * client)
 {
-  if (--client->ref_count == 0) {
+  if (g_atomic_int_dec_and_test (&client->ref_count)) {
     g_object_unref (client->addr);
     g_free (client->host);
     g_slice_free (GstUDPClient, client);
   }
 }
 
-/* call with client lock held */
 static inline GstUDPClient *
 gst_udp_client_ref (GstUDPClient * client)
 {
-  ++client->ref_count;
+  g_atomic_int_inc (&client->ref_count);
   return client;
 }
 
@@ -847,11 +845,14 @@ gst_multiudpsink_render_buffers (GstMultiUDPSink * sink, GstBuffer ** buffers,
       client->packets_sent++;
       sink->bytes_served += bytes_sent;
     }
-    gst_udp_client_unref (client);
   }
 
   g_mutex_unlock (&sink->client_lock);
 
+  /* the refcount is atomic, no need to hold the lock for the release */
+  for (i = 0; i < num_addr; ++i)
+    gst_udp_client_unref (clients[i]);
+
 out:
 
   for (i = 0; i < mem; ++i)
@@ -869,10 +870,8 @@ cancelled:
   {
     GST_INFO_OBJECT (sink, "cancelled");
 
-    g_mutex_lock (&sink->client_lock);
     for (i = 0; i < num_addr; ++i)
       gst_udp_client_unref (clients[i]);
-    g_mutex_unlock (&sink->client_lock);
     goto out;
   }
 }
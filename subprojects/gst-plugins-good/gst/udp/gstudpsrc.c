@@ -989,16 +989,14 @@ retry:
     saddr = NULL;
   }
 
-  do {
-    gint64 timeout;
+  /* Only poll the socket when a timeout was requested; the receive below
+   * blocks until data or cancellation, so without a timeout the poll would
+   * just be an extra syscall per packet */
+  while (udpsrc->timeout) {
+    gint64 timeout = udpsrc->timeout / 1000;
 
     try_again = FALSE;
 
-    if (udpsrc->timeout)
-      timeout = udpsrc->timeout / 1000;
-    else
-      timeout = -1;
-
     GST_LOG_OBJECT (udpsrc, "doing select, timeout %" G_GINT64_FORMAT, timeout);
 
     if (!g_socket_condition_timed_wait (udpsrc->used_socket, G_IO_IN | G_IO_PRI,
@@ -1019,7 +1017,10 @@ retry:
 
       try_again = TRUE;
     }
-  } while (G_UNLIKELY (try_again));
+
+    if (G_LIKELY (!try_again))
+      break;
+  }
 
   res =
       g_socket_receive_message (udpsrc->used_socket, p_saddr, ivec, 2,
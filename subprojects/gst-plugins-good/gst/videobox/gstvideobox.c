@@ -2423,6 +2423,10 @@ static GstCaps *gst_video_box_transform_caps (GstBaseTransform * trans,
     GstPadDirection direction, GstCaps * from, GstCaps * filter);
 static void gst_video_box_before_transform (GstBaseTransform * trans,
     GstBuffer * in);
+static gboolean gst_video_box_decide_allocation (GstBaseTransform * trans,
+    GstQuery * query);
+static GstFlowReturn gst_video_box_transform_ip (GstBaseTransform * trans,
+    GstBuffer * buf);
 static gboolean gst_video_box_src_event (GstBaseTransform * trans,
     GstEvent * event);
 
@@ -2521,6 +2525,10 @@ gst_video_box_class_init (GstVideoBoxClass * klass)
       GST_DEBUG_FUNCPTR (gst_video_box_before_transform);
   trans_class->transform_caps =
       GST_DEBUG_FUNCPTR (gst_video_box_transform_caps);
+  trans_class->decide_allocation =
+      GST_DEBUG_FUNCPTR (gst_video_box_decide_allocation);
+  trans_class->transform_ip = GST_DEBUG_FUNCPTR (gst_video_box_transform_ip);
+  trans_class->transform_ip_on_passthrough = FALSE;
   trans_class->src_event = GST_DEBUG_FUNCPTR (gst_video_box_src_event);
 
   vfilter_class->set_info = GST_DEBUG_FUNCPTR (gst_video_box_set_info);
@@ -3185,6 +3193,77 @@ gst_video_box_set_info (GstVideoFilter * vfilter, GstCaps * in,
   return ret;
 }
 
+/* Must be called with the mutex. A crop-only transform leaves the pixels
+ * alone, so it can be signalled to downstream with a crop meta instead of
+ * copying the remaining region */
+static gboolean
+gst_video_box_is_pure_crop (GstVideoBox * video_box)
+{
+  return video_box->in_format == video_box->out_format &&
+      video_box->in_sdtv == video_box->out_sdtv &&
+      video_box->border_left == 0 && video_box->border_right == 0 &&
+      video_box->border_top == 0 && video_box->border_bottom == 0 &&
+      video_box->alpha == 1.0;
+}
+
+static gboolean
+gst_video_box_decide_allocation (GstBaseTransform * trans, GstQuery * query)
+{
+  GstVideoBox *video_box = GST_VIDEO_BOX (trans);
+  gboolean use_crop_meta;
+
+  use_crop_meta = (gst_query_find_allocation_meta (query,
+          GST_VIDEO_CROP_META_API_TYPE, NULL) &&
+      gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL));
+
+  g_mutex_lock (&video_box->mutex);
+  if (use_crop_meta && gst_video_box_is_pure_crop (video_box)) {
+    GST_INFO_OBJECT (video_box, "signalling crop in-place using crop meta");
+    gst_base_transform_set_in_place (trans, TRUE);
+  } else {
+    GST_INFO_OBJECT (video_box, "copying the boxed frame");
+    gst_base_transform_set_in_place (trans, FALSE);
+  }
+  g_mutex_unlock (&video_box->mutex);
+
+  return GST_BASE_TRANSFORM_CLASS (parent_class)->decide_allocation (trans,
+      query);
+}
+
+static GstFlowReturn
+gst_video_box_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
+{
+  GstVideoBox *video_box = GST_VIDEO_BOX (trans);
+  GstVideoMeta *video_meta;
+  GstVideoCropMeta *crop_meta;
+
+  GST_LOG_OBJECT (trans, "Transforming in-place");
+
+  g_mutex_lock (&video_box->mutex);
+
+  /* The video meta is required since we are going to make the caps
+   * width/height smaller, which would not result in a usable GstVideoInfo
+   * for mapping the buffer. */
+  video_meta = gst_buffer_get_video_meta (buf);
+  if (!video_meta) {
+    video_meta = gst_buffer_add_video_meta (buf, GST_VIDEO_FRAME_FLAG_NONE,
+        video_box->in_format, video_box->in_width, video_box->in_height);
+  }
+
+  crop_meta = gst_buffer_get_video_crop_meta (buf);
+  if (!crop_meta)
+    crop_meta = gst_buffer_add_video_crop_meta (buf);
+
+  crop_meta->x += video_box->crop_left;
+  crop_meta->y += video_box->crop_top;
+  crop_meta->width = video_box->out_width;
+  crop_meta->height = video_box->out_height;
+
+  g_mutex_unlock (&video_box->mutex);
+
+  return GST_FLOW_OK;
+}
+
 static gboolean
 gst_video_box_src_event (GstBaseTransform * trans, GstEvent * event)
 {
@@ -2066,7 +2066,7 @@ iterate_adapter:
       if (avail > 0 && flushing) {
         if (avail >= wav->blockalign && wav->blockalign > 0) {
           avail -= (avail % wav->blockalign);
-          buf = gst_adapter_take_buffer (wav->adapter, avail);
+          buf = gst_adapter_take_buffer_fast (wav->adapter, avail);
         } else {
           return GST_FLOW_OK;
         }
@@ -2074,7 +2074,9 @@ iterate_adapter:
         return GST_FLOW_OK;
       }
     } else {
-      buf = gst_adapter_take_buffer (wav->adapter, desired);
+      /* don't collapse the queued buffers into one allocation; downstream
+       * either writes them out as they are or merges them on first map */
+      buf = gst_adapter_take_buffer_fast (wav->adapter, desired);
     }
   } else {
     if ((res = gst_pad_pull_range (wav->sinkpad, wav->offset,
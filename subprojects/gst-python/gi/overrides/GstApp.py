@@ -0,0 +1,31 @@
+from ..module import get_introspection_module
+
+import gi
+gi.require_version('Gst', '1.0')
+
+from gi.repository import Gst  # noqa
+
+GstApp = get_introspection_module('GstApp')
+__all__ = []
+
+
+def __appsink_pull_sample_list(self, max_samples=0):
+    '''
+    Pull all samples currently queued in the sink, waiting for the first
+    one. Draining the queue in one call amortizes the per-call binding
+    overhead when samples arrive faster than Python consumes them.
+
+    @max_samples: maximum number of samples to return, 0 means no limit
+    @returns: a list of Gst.Sample, empty on EOS
+    '''
+    samples = []
+    sample = self.pull_sample()
+    while sample is not None:
+        samples.append(sample)
+        if max_samples and len(samples) >= max_samples:
+            break
+        sample = self.try_pull_sample(0)
+    return samples
+
+
+GstApp.AppSink.pull_sample_list = __appsink_pull_sample_list
@@ -37,6 +37,55 @@
 
 #include "rtsp-sdp.h"
 
+/* Cached SDP media sections for a stream, attached to the stream object.
+ * The sections only depend on the stream caps, the configured profiles and
+ * the connection info, so during a DESCRIBE storm on a shared media they
+ * can be copied into each client's SDP instead of being rebuilt from the
+ * caps every time */
+typedef struct
+{
+  GstCaps *caps;
+  gchar *server_ip;
+  gboolean is_ipv6;
+  GstRTSPProfile profiles;
+  GPtrArray *medias;            /* GstSDPMedia */
+} SdpStreamCache;
+
+G_LOCK_DEFINE_STATIC (sdp_stream_cache);
+
+static void
+sdp_stream_cache_free (SdpStreamCache * cache)
+{
+  gst_caps_unref (cache->caps);
+  g_free (cache->server_ip);
+  g_ptr_array_unref (cache->medias);
+  g_free (cache);
+}
+
+static GQuark
+sdp_stream_cache_quark (void)
+{
+  static GQuark quark = 0;
+
+  if (g_once_init_enter (&quark)) {
+    GQuark q = g_quark_from_static_string ("gst-rtsp-server.sdp-stream-cache");
+    g_once_init_leave (&quark, q);
+  }
+  return quark;
+}
+
+/* appends a deep copy of @media to @sdp */
+static void
+sdp_message_add_media_copy (GstSDPMessage * sdp, const GstSDPMedia * media)
+{
+  GstSDPMedia *copy;
+
+  gst_sdp_media_copy (media, &copy);
+  /* this takes the contents of the copy, leaving an empty shell */
+  gst_sdp_message_add_media (sdp, copy);
+  gst_sdp_media_free (copy);
+}
+
 static gboolean
 get_info_from_tags (GstPad * pad, GstEvent ** event, gpointer user_data)
 {
@@ -627,6 +676,9 @@ gst_rtsp_sdp_from_stream (GstSDPMessage * sdp, GstSDPInfo * info,
   GstRTSPProfile profiles;
   guint mask;
   gboolean res;
+  SdpStreamCache *cache;
+  GstSDPMessage *scratch;
+  guint i, n_medias;
 
   caps = gst_rtsp_stream_get_caps (stream);
 
@@ -635,18 +687,64 @@ gst_rtsp_sdp_from_stream (GstSDPMessage * sdp, GstSDPInfo * info,
     return FALSE;
   }
 
-  /* make a new media for each profile */
   profiles = gst_rtsp_stream_get_profiles (stream);
+
+  /* try the cached media sections first */
+  G_LOCK (sdp_stream_cache);
+  cache = g_object_get_qdata (G_OBJECT (stream), sdp_stream_cache_quark ());
+  if (cache && cache->profiles == profiles && cache->is_ipv6 == info->is_ipv6
+      && g_strcmp0 (cache->server_ip, info->server_ip) == 0
+      && gst_caps_is_equal (cache->caps, caps)) {
+    GST_DEBUG ("stream %p: using cached SDP media sections", stream);
+    for (i = 0; i < cache->medias->len; i++)
+      sdp_message_add_media_copy (sdp, g_ptr_array_index (cache->medias, i));
+    G_UNLOCK (sdp_stream_cache);
+    gst_caps_unref (caps);
+    return TRUE;
+  }
+  G_UNLOCK (sdp_stream_cache);
+
+  /* build into a scratch message so the result can be cached. Make a new
+   * media for each profile */
+  gst_sdp_message_new (&scratch);
   mask = 1;
   res = TRUE;
   while (res && (profiles >= mask)) {
     GstRTSPProfile prof = profiles & mask;
 
     if (prof)
-      res = gst_rtsp_sdp_make_media (sdp, info, stream, caps, prof);
+      res = gst_rtsp_sdp_make_media (scratch, info, stream, caps, prof);
 
     mask <<= 1;
   }
+
+  if (res) {
+    n_medias = gst_sdp_message_medias_len (scratch);
+
+    cache = g_new0 (SdpStreamCache, 1);
+    cache->caps = gst_caps_ref (caps);
+    cache->server_ip = g_strdup (info->server_ip);
+    cache->is_ipv6 = info->is_ipv6;
+    cache->profiles = profiles;
+    cache->medias = g_ptr_array_new_full (n_medias,
+        (GDestroyNotify) gst_sdp_media_free);
+
+    for (i = 0; i < n_medias; i++) {
+      const GstSDPMedia *media = gst_sdp_message_get_media (scratch, i);
+      GstSDPMedia *copy;
+
+      sdp_message_add_media_copy (sdp, media);
+      gst_sdp_media_copy (media, &copy);
+      g_ptr_array_add (cache->medias, copy);
+    }
+
+    G_LOCK (sdp_stream_cache);
+    g_object_set_qdata_full (G_OBJECT (stream), sdp_stream_cache_quark (),
+        cache, (GDestroyNotify) sdp_stream_cache_free);
+    G_UNLOCK (sdp_stream_cache);
+  }
+
+  gst_sdp_message_free (scratch);
   gst_caps_unref (caps);
 
   return res;
@@ -51,6 +51,13 @@ struct _GstRTSPSessionPoolPrivate
   guint max_sessions;
   GHashTable *sessions;
   guint sessions_cookie;
+
+  /* Monotonic time (usec) before which no session can expire, computed
+   * while walking the sessions. Keepalives only push expiry times further
+   * out, so the bound stays valid until it elapses or a session is added.
+   * -1 means unknown and the next check has to walk all sessions,
+   * G_MAXINT64 means no session will ever time out */
+  gint64 earliest_expiry;
 };
 
 #define DEFAULT_MAX_SESSIONS 0
@@ -135,6 +142,7 @@ gst_rtsp_session_pool_init (GstRTSPSessionPool * pool)
   priv->sessions = g_hash_table_new_full (g_str_hash, g_str_equal,
       NULL, g_object_unref);
   priv->max_sessions = DEFAULT_MAX_SESSIONS;
+  priv->earliest_expiry = -1;
 }
 
 static GstRTSPFilterResult
@@ -394,6 +402,8 @@ gst_rtsp_session_pool_create (GstRTSPSessionPool * pool)
       g_hash_table_insert (priv->sessions,
           (gchar *) gst_rtsp_session_get_sessionid (result), result);
       priv->sessions_cookie++;
+      /* the new session may expire before the cached bound */
+      priv->earliest_expiry = -1;
     }
     g_mutex_unlock (&priv->lock);
 
@@ -516,11 +526,18 @@ gst_rtsp_session_pool_cleanup (GstRTSPSessionPool * pool)
   data.removed = NULL;
 
   g_mutex_lock (&priv->lock);
+  /* nothing can have expired before the cached bound, skip the walk */
+  if (priv->earliest_expiry >= 0
+      && data.now_monotonic_time < priv->earliest_expiry) {
+    g_mutex_unlock (&priv->lock);
+    return 0;
+  }
   result =
       g_hash_table_foreach_remove (priv->sessions, (GHRFunc) cleanup_func,
       &data);
   if (result > 0)
     priv->sessions_cookie++;
+  priv->earliest_expiry = -1;
   g_mutex_unlock (&priv->lock);
 
   for (walk = data.removed; walk; walk = walk->next) {
@@ -685,7 +702,24 @@ gst_pool_source_prepare (GSource * source, gint * timeout)
   priv = psrc->pool->priv;
 
   g_mutex_lock (&priv->lock);
-  g_hash_table_foreach (priv->sessions, (GHFunc) collect_timeout, psrc);
+  if (priv->earliest_expiry >= 0) {
+    /* the cached bound is still valid, no need to walk all sessions */
+    if (priv->earliest_expiry != G_MAXINT64) {
+      gint64 now_monotonic_time = g_get_monotonic_time ();
+
+      if (now_monotonic_time < priv->earliest_expiry)
+        psrc->timeout = (priv->earliest_expiry - now_monotonic_time) / 1000;
+      else
+        psrc->timeout = 0;
+    }
+  } else {
+    g_hash_table_foreach (priv->sessions, (GHFunc) collect_timeout, psrc);
+    if (psrc->timeout == -1)
+      priv->earliest_expiry = G_MAXINT64;
+    else
+      priv->earliest_expiry =
+          g_get_monotonic_time () + (gint64) psrc->timeout * 1000;
+  }
   g_mutex_unlock (&priv->lock);
 
   if (timeout)
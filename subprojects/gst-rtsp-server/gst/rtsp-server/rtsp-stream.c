@@ -2629,6 +2629,11 @@ ensure_cached_transports (GstRTSPStream * stream)
   }
 }
 
+/* Maximum number of queued packets merged into a single buffer list when
+ * draining the backlog. The watch serializes a whole list into one writev(),
+ * so a deep backlog drains in a few system calls instead of one per packet */
+#define BACKLOG_BATCH_LIMIT 16
+
 /* Must be called *without* priv->lock */
 static void
 check_transport_backlog (GstRTSPStream * stream, GstRTSPStreamTransport * trans)
@@ -2653,6 +2658,47 @@ check_transport_backlog (GstRTSPStream * stream, GstRTSPStreamTransport * trans)
 
       g_assert (popped == TRUE);
 
+      /* Coalesce consecutive packets of the same type so they go out in
+       * one write. Back pressure was checked above and all merged packets
+       * share the popped packet's channel */
+      while (!gst_rtsp_stream_transport_backlog_is_empty (trans)) {
+        GstBuffer *next_buffer = NULL;
+        GstBufferList *next_list = NULL;
+        gboolean next_is_rtp;
+
+        next_is_rtp = gst_rtsp_stream_transport_backlog_peek_is_rtp (trans);
+        if (next_is_rtp != is_rtp)
+          break;
+
+        if (buffer_list == NULL) {
+          buffer_list = gst_buffer_list_new_sized (BACKLOG_BATCH_LIMIT);
+          gst_buffer_list_add (buffer_list, buffer);
+          buffer = NULL;
+        } else if (gst_buffer_list_length (buffer_list) >= BACKLOG_BATCH_LIMIT) {
+          break;
+        } else {
+          /* the list may still be shared with other transports */
+          buffer_list = gst_buffer_list_make_writable (buffer_list);
+        }
+
+        popped =
+            gst_rtsp_stream_transport_backlog_pop (trans, &next_buffer,
+            &next_list, &next_is_rtp);
+
+        g_assert (popped == TRUE);
+
+        if (next_buffer) {
+          gst_buffer_list_add (buffer_list, next_buffer);
+        } else if (next_list) {
+          guint i, len = gst_buffer_list_length (next_list);
+
+          for (i = 0; i < len; i++)
+            gst_buffer_list_add (buffer_list,
+                gst_buffer_ref (gst_buffer_list_get (next_list, i)));
+          gst_buffer_list_unref (next_list);
+        }
+      }
+
       send_ret = push_data (stream, trans, buffer, buffer_list, is_rtp);
 
       gst_clear_buffer (&buffer);
@@ -2715,6 +2761,12 @@ send_tcp_message (GstRTSPStream * stream, gint idx)
   if (transports)
     g_ptr_array_ref (transports);
 
+  /* Distribute and send without the stream lock, so a slow client only
+   * contends on its own backlog lock and cannot stall the fan-out to the
+   * other transports. Ordering is preserved as this is the only thread
+   * pulling from the appsinks */
+  g_mutex_unlock (&priv->lock);
+
   if (transports) {
     gint index;
 
@@ -2722,28 +2774,29 @@ send_tcp_message (GstRTSPStream * stream, gint idx)
       GstRTSPStreamTransport *tr = g_ptr_array_index (transports, index);
       GstBuffer *buf_ref = NULL;
       GstBufferList *buflist_ref = NULL;
-
-      gst_rtsp_stream_transport_lock_backlog (tr);
+      gboolean pushed;
 
       if (buffer)
         buf_ref = gst_buffer_ref (buffer);
       if (buffer_list)
         buflist_ref = gst_buffer_list_ref (buffer_list);
 
-      if (!gst_rtsp_stream_transport_backlog_push (tr,
-              buf_ref, buflist_ref, is_rtp)) {
+      gst_rtsp_stream_transport_lock_backlog (tr);
+      pushed = gst_rtsp_stream_transport_backlog_push (tr,
+          buf_ref, buflist_ref, is_rtp);
+      gst_rtsp_stream_transport_unlock_backlog (tr);
+
+      if (!pushed) {
         GST_ERROR_OBJECT (stream,
             "Dropping slow transport %" GST_PTR_FORMAT, tr);
+        g_mutex_lock (&priv->lock);
         update_transport (stream, tr, FALSE);
+        g_mutex_unlock (&priv->lock);
       }
-
-      gst_rtsp_stream_transport_unlock_backlog (tr);
     }
   }
   gst_sample_unref (sample);
 
-  g_mutex_unlock (&priv->lock);
-
   if (transports) {
     gint index;
 
@@ -1122,6 +1122,8 @@ gst_deinit (void)
 
   _priv_gst_registry_cleanup ();
   _priv_gst_allocator_cleanup ();
+  _priv_gst_event_cleanup ();
+  _priv_gst_query_cleanup ();
 
   /* We want to destroy tracers as late as possible for the leaks tracer
    * but still need to keep the caps system alive as it may have to use
@@ -112,6 +112,11 @@ G_GNUC_INTERNAL  gboolean _priv_plugin_deps_env_vars_changed (GstPlugin * plugin
 
 G_GNUC_INTERNAL  gboolean _priv_plugin_deps_files_changed (GstPlugin * plugin);
 
+/* lazily merged memory spans (gstallocator.c) */
+G_GNUC_INTERNAL
+GstMemory * _priv_gst_merged_memory_new (GstMemory ** parts, guint n_parts,
+    gsize size);
+
 /* init functions called from gst_init(). */
 G_GNUC_INTERNAL  void  _priv_gst_quarks_initialize (void);
 G_GNUC_INTERNAL  void  _priv_gst_mini_object_initialize (void);
@@ -139,6 +144,8 @@ G_GNUC_INTERNAL  void  _priv_gst_plugin_feature_rank_initialize (void);
 
 /* cleanup functions called from gst_deinit(). */
 G_GNUC_INTERNAL  void  _priv_gst_allocator_cleanup (void);
+G_GNUC_INTERNAL  void  _priv_gst_event_cleanup (void);
+G_GNUC_INTERNAL  void  _priv_gst_query_cleanup (void);
 G_GNUC_INTERNAL  void  _priv_gst_caps_features_cleanup (void);
 G_GNUC_INTERNAL  void  _priv_gst_caps_cleanup (void);
 G_GNUC_INTERNAL  void  _priv_gst_debug_cleanup (void);
@@ -208,11 +215,24 @@ gboolean		priv_gst_registry_binary_read_cache	(GstRegistry * registry, const cha
 G_GNUC_INTERNAL
 gboolean		priv_gst_registry_binary_write_cache	(GstRegistry * registry, GList * plugins, const char *location);
 
+/* TRUE while loading from an mmapped cache that stays resident, so
+ * chunk loaders may keep pointers into the map for lazy parsing */
+G_GNUC_INTERNAL extern gboolean _priv_gst_registry_binary_cache_resident;
+
+G_GNUC_INTERNAL
+void		priv_gst_registry_binary_cleanup_cache	(void);
 
 G_GNUC_INTERNAL
 void      __gst_element_factory_add_static_pad_template (GstElementFactory    * elementfactory,
                                                          GstStaticPadTemplate * templ);
 
+G_GNUC_INTERNAL
+void      __gst_element_factory_set_meta_data_str       (GstElementFactory    * elementfactory,
+                                                         const gchar          * str);
+
+G_GNUC_INTERNAL
+GstStructure * __gst_element_factory_ensure_metadata    (GstElementFactory    * elementfactory);
+
 G_GNUC_INTERNAL
 void      __gst_element_factory_add_interface           (GstElementFactory    * elementfactory,
                                                          const gchar          * interfacename);
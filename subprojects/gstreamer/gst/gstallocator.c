@@ -47,6 +47,7 @@
 
 #include "gst_private.h"
 #include "gstmemory.h"
+#include "gstatomicqueue.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_allocator_debug);
 #define GST_CAT_DEFAULT gst_allocator_debug
@@ -72,6 +73,7 @@ gsize gst_memory_alignment = 0;
 static GstAllocator *_default_allocator;
 
 static GstAllocator *_sysmem_allocator;
+static GstAllocator *_arena_allocator;
 
 /* registered allocators */
 static GRWLock lock;
@@ -596,6 +598,471 @@ gst_allocator_sysmem_init (GstAllocatorSysmem * allocator)
   alloc->mem_is_span = (GstMemoryIsSpanFunction) _sysmem_is_span;
 }
 
+/* per-thread arena memory implementation.
+ *
+ * Memory headers and data are carved from thread-local blocks with a
+ * simple pointer bump. A block is released when the owning thread moves
+ * to a new block and all memories carved from it are freed; released
+ * blocks are recycled through a small lock-free magazine so steady-state
+ * allocation never hits the system allocator. */
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+/* carve requests larger than this get a dedicated block */
+#define ARENA_MAX_CARVE  (ARENA_BLOCK_SIZE / 4)
+/* round carve sizes up so the next GstMemoryArena header, whose refcount
+ * is accessed atomically, stays naturally aligned within the block */
+#define ARENA_ALIGN(s) \
+    (((s) + (G_ALIGNOF (GstMemoryArena) - 1)) & \
+    ~((gsize) G_ALIGNOF (GstMemoryArena) - 1))
+/* number of retired blocks kept for refill */
+#define ARENA_MAGAZINE_DEPTH 16
+
+typedef struct
+{
+  gint refcount;                /* one ref per carved memory, one for the owning thread */
+  gsize size;                   /* usable bytes following the header */
+  gsize offset;                 /* bump pointer, only touched by the owning thread */
+} GstArenaBlock;
+
+#define ARENA_BLOCK_DATA(b) ((guint8 *)(b) + sizeof (GstArenaBlock))
+
+typedef struct
+{
+  GstMemory mem;
+
+  GstArenaBlock *block;
+  guint8 *data;
+} GstMemoryArena;
+
+typedef struct
+{
+  GstAllocator parent;
+} GstAllocatorArena;
+
+typedef struct
+{
+  GstAllocatorClass parent_class;
+} GstAllocatorArenaClass;
+
+static GType gst_allocator_arena_get_type (void);
+G_DEFINE_TYPE (GstAllocatorArena, gst_allocator_arena, GST_TYPE_ALLOCATOR);
+
+/* recycled GstArenaBlock, shared between all threads */
+static GstAtomicQueue *_arena_magazine;
+
+static void _arena_block_unref (GstArenaBlock * block);
+
+static GPrivate _arena_current =
+G_PRIVATE_INIT ((GDestroyNotify) _arena_block_unref);
+
+static GstArenaBlock *
+_arena_block_new (gsize size)
+{
+  GstArenaBlock *block;
+
+  if (size == ARENA_BLOCK_SIZE && _arena_magazine &&
+      (block = gst_atomic_queue_pop (_arena_magazine))) {
+    block->refcount = 1;
+    block->offset = 0;
+    return block;
+  }
+
+  block = g_malloc (sizeof (GstArenaBlock) + size);
+  block->refcount = 1;
+  block->size = size;
+  block->offset = 0;
+
+  return block;
+}
+
+static void
+_arena_block_unref (GstArenaBlock * block)
+{
+  if (g_atomic_int_dec_and_test (&block->refcount)) {
+    if (block->size == ARENA_BLOCK_SIZE && _arena_magazine &&
+        gst_atomic_queue_length (_arena_magazine) < ARENA_MAGAZINE_DEPTH)
+      gst_atomic_queue_push (_arena_magazine, block);
+    else
+      g_free (block);
+  }
+}
+
+/* carve raw space for a header plus @maxsize data bytes from the
+ * thread-local block; the caller still needs to call gst_memory_init() */
+static GstMemoryArena *
+_arena_carve_raw (gsize maxsize)
+{
+  GstArenaBlock *block;
+  GstMemoryArena *mem;
+  gsize needed;
+
+  needed = ARENA_ALIGN (sizeof (GstMemoryArena) + maxsize);
+
+  if (G_LIKELY (needed <= ARENA_MAX_CARVE)) {
+    block = g_private_get (&_arena_current);
+    if (G_UNLIKELY (block == NULL || block->offset + needed > block->size)) {
+      if (block)
+        _arena_block_unref (block);
+      block = _arena_block_new (ARENA_BLOCK_SIZE);
+      g_private_set (&_arena_current, block);
+    }
+    mem = (GstMemoryArena *) (ARENA_BLOCK_DATA (block) + block->offset);
+    block->offset += needed;
+    g_atomic_int_inc (&block->refcount);
+  } else {
+    /* too large to share a block, give it a dedicated one; the block ref
+     * is owned by the memory */
+    block = _arena_block_new (needed);
+    block->offset = needed;
+    mem = (GstMemoryArena *) ARENA_BLOCK_DATA (block);
+  }
+
+  mem->block = block;
+  mem->data = (guint8 *) mem + sizeof (GstMemoryArena);
+
+  return mem;
+}
+
+/* carve and initialize a memory with its own data area */
+static GstMemoryArena *
+_arena_carve (GstMemoryFlags flags, gsize maxsize, gsize align, gsize offset,
+    gsize size)
+{
+  GstMemoryArena *mem;
+  gsize aoffset, padding;
+  guint8 *data;
+
+  /* ensure configured alignment */
+  align |= gst_memory_alignment;
+  /* allocate more to compensate for alignment */
+  maxsize += align;
+
+  mem = _arena_carve_raw (maxsize);
+  data = mem->data;
+
+  /* do alignment */
+  if ((aoffset = ((guintptr) data & align))) {
+    aoffset = (align + 1) - aoffset;
+    data += aoffset;
+    maxsize -= aoffset;
+  }
+
+  if (offset && (flags & GST_MEMORY_FLAG_ZERO_PREFIXED))
+    memset (data, 0, offset);
+
+  padding = maxsize - (offset + size);
+  if (padding && (flags & GST_MEMORY_FLAG_ZERO_PADDED))
+    memset (data + offset + size, 0, padding);
+
+  gst_memory_init (GST_MEMORY_CAST (mem), flags, _arena_allocator, NULL,
+      maxsize, align, offset, size);
+
+  mem->data = data;
+
+  return mem;
+}
+
+static gpointer
+_arena_map (GstMemoryArena * mem, gsize maxsize, GstMapFlags flags)
+{
+  return mem->data;
+}
+
+static gboolean
+_arena_unmap (GstMemoryArena * mem)
+{
+  return TRUE;
+}
+
+static GstMemoryArena *
+_arena_copy (GstMemoryArena * mem, gssize offset, gsize size)
+{
+  GstMemoryArena *copy;
+
+  if (size == -1)
+    size = mem->mem.size > offset ? mem->mem.size - offset : 0;
+
+  copy = _arena_carve (0, size, mem->mem.align, 0, size);
+  GST_CAT_DEBUG (GST_CAT_PERFORMANCE,
+      "memcpy %" G_GSIZE_FORMAT " memory %p -> %p", size, mem, copy);
+  memcpy (copy->data, mem->data + mem->mem.offset + offset, size);
+
+  return copy;
+}
+
+static GstMemoryArena *
+_arena_share (GstMemoryArena * mem, gssize offset, gsize size)
+{
+  GstMemoryArena *sub;
+  GstMemory *parent;
+
+  /* find the real parent */
+  if ((parent = mem->mem.parent) == NULL)
+    parent = (GstMemory *) mem;
+
+  if (size == -1)
+    size = mem->mem.size - offset;
+
+  /* only a header is carved, the data stays in the parent block */
+  sub = _arena_carve_raw (0);
+
+  gst_memory_init (GST_MEMORY_CAST (sub),
+      GST_MINI_OBJECT_FLAGS (parent) | GST_MINI_OBJECT_FLAG_LOCK_READONLY,
+      _arena_allocator, parent, mem->mem.maxsize, mem->mem.align,
+      mem->mem.offset + offset, size);
+  sub->data = mem->data;
+
+  return sub;
+}
+
+static gboolean
+_arena_is_span (GstMemoryArena * mem1, GstMemoryArena * mem2, gsize * offset)
+{
+  if (offset) {
+    GstMemoryArena *parent;
+
+    parent = (GstMemoryArena *) mem1->mem.parent;
+
+    *offset = mem1->mem.offset - parent->mem.offset;
+  }
+
+  /* and memory is contiguous */
+  return mem1->data + mem1->mem.offset + mem1->mem.size ==
+      mem2->data + mem2->mem.offset;
+}
+
+static GstMemory *
+_arena_alloc (GstAllocator * allocator, gsize size,
+    GstAllocationParams * params)
+{
+  gsize maxsize = size + params->prefix + params->padding;
+
+  return (GstMemory *) _arena_carve (params->flags,
+      maxsize, params->align, params->prefix, size);
+}
+
+static void
+_arena_free (GstAllocator * allocator, GstMemory * mem)
+{
+  GstMemoryArena *amem = (GstMemoryArena *) mem;
+
+#ifdef USE_POISONING
+  /* just poison the structs, not all the data */
+  memset (mem, 0xff, sizeof (GstMemoryArena));
+#endif
+
+  _arena_block_unref (amem->block);
+}
+
+static void
+gst_allocator_arena_class_init (GstAllocatorArenaClass * klass)
+{
+  GstAllocatorClass *allocator_class;
+
+  allocator_class = (GstAllocatorClass *) klass;
+
+  allocator_class->alloc = _arena_alloc;
+  allocator_class->free = _arena_free;
+}
+
+static void
+gst_allocator_arena_init (GstAllocatorArena * allocator)
+{
+  GstAllocator *alloc = GST_ALLOCATOR_CAST (allocator);
+
+  GST_CAT_DEBUG (GST_CAT_MEMORY, "init arena allocator %p", allocator);
+
+  alloc->mem_type = GST_ALLOCATOR_ARENA;
+  alloc->mem_map = (GstMemoryMapFunction) _arena_map;
+  alloc->mem_unmap = (GstMemoryUnmapFunction) _arena_unmap;
+  alloc->mem_copy = (GstMemoryCopyFunction) _arena_copy;
+  alloc->mem_share = (GstMemoryShareFunction) _arena_share;
+  alloc->mem_is_span = (GstMemoryIsSpanFunction) _arena_is_span;
+}
+
+/* merged memory implementation.
+ *
+ * A contiguous read-only view over several memory objects that defers the
+ * actual flattening until someone maps it. Buffers that are merged and then
+ * pushed along without ever being mapped never pay for the memcpy. The part
+ * memories are kept exclusively locked until the copy is made, so nobody can
+ * make them writable behind our back. */
+
+typedef struct
+{
+  GstMemory mem;
+
+  GMutex lock;
+  guint8 *data;                 /* materialized copy, lazily created */
+  GstMemory **parts;
+  guint n_parts;
+} GstMemoryMerged;
+
+typedef struct
+{
+  GstAllocator parent;
+} GstAllocatorMerged;
+
+typedef struct
+{
+  GstAllocatorClass parent_class;
+} GstAllocatorMergedClass;
+
+static GType gst_allocator_merged_get_type (void);
+G_DEFINE_TYPE (GstAllocatorMerged, gst_allocator_merged, GST_TYPE_ALLOCATOR);
+
+static GstAllocator *_merged_allocator;
+
+/* flatten the parts into a private copy and release them */
+static gboolean
+_merged_materialize (GstMemoryMerged * mem)
+{
+  guint8 *data, *ptr;
+  gsize left;
+  guint i;
+
+  g_mutex_lock (&mem->lock);
+  if (mem->data != NULL)
+    goto done;
+
+  data = g_malloc (mem->mem.maxsize);
+  ptr = data;
+  left = mem->mem.maxsize;
+
+  for (i = 0; i < mem->n_parts && left > 0; i++) {
+    GstMapInfo sinfo;
+    gsize tocopy;
+
+    if (!gst_memory_map (mem->parts[i], &sinfo, GST_MAP_READ)) {
+      GST_CAT_ERROR (GST_CAT_MEMORY, "failed to map part %u of merged "
+          "memory %p readable", i, mem);
+      g_free (data);
+      g_mutex_unlock (&mem->lock);
+      return FALSE;
+    }
+    tocopy = MIN (sinfo.size, left);
+    GST_CAT_DEBUG (GST_CAT_PERFORMANCE,
+        "memcpy %" G_GSIZE_FORMAT " bytes for merge %p from memory %p",
+        tocopy, mem, mem->parts[i]);
+    memcpy (ptr, sinfo.data, tocopy);
+    left -= tocopy;
+    ptr += tocopy;
+    gst_memory_unmap (mem->parts[i], &sinfo);
+  }
+  mem->data = data;
+
+  /* the parts are no longer needed, let them go */
+  for (i = 0; i < mem->n_parts; i++) {
+    gst_memory_unlock (mem->parts[i], GST_LOCK_FLAG_EXCLUSIVE);
+    gst_memory_unref (mem->parts[i]);
+  }
+  g_free (mem->parts);
+  mem->parts = NULL;
+  mem->n_parts = 0;
+
+done:
+  g_mutex_unlock (&mem->lock);
+
+  return TRUE;
+}
+
+static gpointer
+_merged_map (GstMemoryMerged * mem, gsize maxsize, GstMapFlags flags)
+{
+  if (!_merged_materialize (mem))
+    return NULL;
+
+  return mem->data;
+}
+
+static void
+_merged_unmap (GstMemoryMerged * mem)
+{
+}
+
+static GstMemory *
+_merged_alloc (GstAllocator * allocator, gsize size,
+    GstAllocationParams * params)
+{
+  g_warning ("Use _priv_gst_merged_memory_new() to create merged memory");
+  return NULL;
+}
+
+static void
+_merged_free (GstAllocator * allocator, GstMemory * mem)
+{
+  GstMemoryMerged *mmem = (GstMemoryMerged *) mem;
+  guint i;
+
+  for (i = 0; i < mmem->n_parts; i++) {
+    gst_memory_unlock (mmem->parts[i], GST_LOCK_FLAG_EXCLUSIVE);
+    gst_memory_unref (mmem->parts[i]);
+  }
+  g_free (mmem->parts);
+  g_free (mmem->data);
+  g_mutex_clear (&mmem->lock);
+  g_free (mmem);
+}
+
+static void
+gst_allocator_merged_class_init (GstAllocatorMergedClass * klass)
+{
+  GstAllocatorClass *allocator_class;
+
+  allocator_class = (GstAllocatorClass *) klass;
+
+  allocator_class->alloc = _merged_alloc;
+  allocator_class->free = _merged_free;
+}
+
+static void
+gst_allocator_merged_init (GstAllocatorMerged * allocator)
+{
+  GstAllocator *alloc = GST_ALLOCATOR_CAST (allocator);
+
+  GST_CAT_DEBUG (GST_CAT_MEMORY, "init merged allocator %p", allocator);
+
+  alloc->mem_type = "MergedMemory";
+  alloc->mem_map = (GstMemoryMapFunction) _merged_map;
+  alloc->mem_unmap = (GstMemoryUnmapFunction) _merged_unmap;
+  /* mem_copy and mem_is_span are the mapping fallbacks; sharing would leak
+   * writability of the parts to the child so it is not allowed */
+}
+
+/**
+ * _priv_gst_merged_memory_new: (skip)
+ * @parts: (array length=n_parts): memory objects to merge
+ * @n_parts: number of elements in @parts
+ * @size: total size of the merged view
+ *
+ * Creates a contiguous view of @parts that is only flattened into one
+ * block when it is first mapped. Takes an additional ref and an exclusive
+ * lock on each part until that happens.
+ */
+GstMemory *
+_priv_gst_merged_memory_new (GstMemory ** parts, guint n_parts, gsize size)
+{
+  GstMemoryMerged *mem;
+  guint i;
+
+  mem = g_new0 (GstMemoryMerged, 1);
+  g_mutex_init (&mem->lock);
+  mem->parts = g_new (GstMemory *, n_parts);
+  mem->n_parts = n_parts;
+  for (i = 0; i < n_parts; i++) {
+    mem->parts[i] = gst_memory_ref (parts[i]);
+    gst_memory_lock (mem->parts[i], GST_LOCK_FLAG_EXCLUSIVE);
+  }
+
+  gst_memory_init (GST_MEMORY_CAST (mem), GST_MEMORY_FLAG_NO_SHARE,
+      _merged_allocator, NULL, size, 0, 0, size);
+
+  GST_CAT_DEBUG (GST_CAT_MEMORY, "new merged memory %p of %u parts, size %"
+      G_GSIZE_FORMAT, mem, n_parts, size);
+
+  return GST_MEMORY_CAST (mem);
+}
+
 void
 _priv_gst_allocator_initialize (void)
 {
@@ -621,6 +1088,18 @@ _priv_gst_allocator_initialize (void)
       gst_object_ref (_sysmem_allocator));
 
   _default_allocator = gst_object_ref (_sysmem_allocator);
+
+  _arena_magazine = gst_atomic_queue_new (ARENA_MAGAZINE_DEPTH);
+
+  _arena_allocator = g_object_new (gst_allocator_arena_get_type (), NULL);
+  gst_object_ref_sink (_arena_allocator);
+
+  gst_allocator_register (GST_ALLOCATOR_ARENA,
+      gst_object_ref (_arena_allocator));
+
+  /* not registered, only created through _priv_gst_merged_memory_new() */
+  _merged_allocator = g_object_new (gst_allocator_merged_get_type (), NULL);
+  gst_object_ref_sink (_merged_allocator);
 }
 
 void
@@ -632,6 +1111,20 @@ _priv_gst_allocator_cleanup (void)
   gst_object_unref (_default_allocator);
   _default_allocator = NULL;
 
+  if (_arena_allocator) {
+    GstArenaBlock *block;
+
+    gst_object_unref (_arena_allocator);
+    _arena_allocator = NULL;
+
+    while ((block = gst_atomic_queue_pop (_arena_magazine)))
+      g_free (block);
+    gst_atomic_queue_unref (_arena_magazine);
+    _arena_magazine = NULL;
+  }
+
+  gst_clear_object (&_merged_allocator);
+
   g_clear_pointer (&allocators, g_hash_table_unref);
 }
 
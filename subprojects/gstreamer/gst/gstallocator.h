@@ -62,6 +62,18 @@ GST_API gsize gst_memory_alignment;
  */
 #define GST_ALLOCATOR_SYSMEM   "SystemMemory"
 
+/**
+ * GST_ALLOCATOR_ARENA:
+ *
+ * The allocator name for the per-thread arena memory allocator. Memory
+ * headers and data are carved from thread-local blocks with a pointer
+ * bump, which avoids allocator lock contention when many streaming
+ * threads allocate small buffers at high rates.
+ *
+ * Since: 1.24
+ */
+#define GST_ALLOCATOR_ARENA    "ArenaMemory"
+
 /**
  * GstAllocationParams:
  * @flags: flags to control allocation
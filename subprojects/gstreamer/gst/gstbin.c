@@ -161,6 +161,9 @@ struct _GstBinPrivate
 
   guint32 structure_cookie;
 
+  /* monotonic counter for gst_bin_get_topology_cookie(), never 0 */
+  guint32 topology_cookie;
+
 #if 0
   /* cached index */
   GstIndex *index;
@@ -172,6 +175,10 @@ struct _GstBinPrivate
   gboolean posted_eos;
   gboolean posted_playing;
   GstElementFlags suppressed_flags;
+
+  /* change the state of independent children concurrently */
+  gboolean parallel_state_changes;
+  GstTaskPool *state_change_pool;
 };
 
 typedef struct
@@ -246,12 +253,14 @@ enum
 
 #define DEFAULT_ASYNC_HANDLING	FALSE
 #define DEFAULT_MESSAGE_FORWARD	FALSE
+#define DEFAULT_PARALLEL_STATE_CHANGES	FALSE
 
 enum
 {
   PROP_0,
   PROP_ASYNC_HANDLING,
   PROP_MESSAGE_FORWARD,
+  PROP_PARALLEL_STATE_CHANGES,
   PROP_LAST
 };
 
@@ -445,6 +454,27 @@ gst_bin_class_init (GstBinClass * klass)
           "Forwards all children messages",
           DEFAULT_MESSAGE_FORWARD, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstBin:parallel-state-changes:
+   *
+   * If set to %TRUE, children that have no dataflow link between them will
+   * change state concurrently on a task pool instead of one after another.
+   * Children are still grouped in topologically sorted batches, so an
+   * element never changes state before the elements downstream of it, just
+   * like with sequential state changes.
+   *
+   * This can reduce startup time considerably for large pipelines where
+   * element activation is dominated by per-element work such as opening
+   * devices or allocating buffers.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_PARALLEL_STATE_CHANGES,
+      g_param_spec_boolean ("parallel-state-changes", "Parallel State Changes",
+          "Change the state of independent children concurrently",
+          DEFAULT_PARALLEL_STATE_CHANGES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gobject_class->dispose = gst_bin_dispose;
 
   gst_element_class_set_static_metadata (gstelement_class, "Generic bin",
@@ -503,7 +533,9 @@ gst_bin_init (GstBin * bin)
   bin->priv = gst_bin_get_instance_private (bin);
   bin->priv->asynchandling = DEFAULT_ASYNC_HANDLING;
   bin->priv->structure_cookie = 0;
+  bin->priv->topology_cookie = 1;
   bin->priv->message_forward = DEFAULT_MESSAGE_FORWARD;
+  bin->priv->parallel_state_changes = DEFAULT_PARALLEL_STATE_CHANGES;
 }
 
 static void
@@ -516,6 +548,11 @@ gst_bin_dispose (GObject * object)
 
   GST_CAT_DEBUG_OBJECT (GST_CAT_REFCOUNTING, object, "%p dispose", object);
 
+  if (bin->priv->state_change_pool) {
+    gst_task_pool_cleanup (bin->priv->state_change_pool);
+    gst_clear_object (&bin->priv->state_change_pool);
+  }
+
   GST_OBJECT_LOCK (object);
   gst_object_replace ((GstObject **) child_bus_p, NULL);
   gst_object_replace ((GstObject **) provided_clock_p, NULL);
@@ -567,6 +604,11 @@ gst_bin_set_property (GObject * object, guint prop_id,
       gstbin->priv->message_forward = g_value_get_boolean (value);
       GST_OBJECT_UNLOCK (gstbin);
       break;
+    case PROP_PARALLEL_STATE_CHANGES:
+      GST_OBJECT_LOCK (gstbin);
+      gstbin->priv->parallel_state_changes = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (gstbin);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -592,6 +634,11 @@ gst_bin_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value, gstbin->priv->message_forward);
       GST_OBJECT_UNLOCK (gstbin);
       break;
+    case PROP_PARALLEL_STATE_CHANGES:
+      GST_OBJECT_LOCK (gstbin);
+      g_value_set_boolean (value, gstbin->priv->parallel_state_changes);
+      GST_OBJECT_UNLOCK (gstbin);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1218,6 +1265,8 @@ gst_bin_add_func (GstBin * bin, GstElement * element)
   bin->children = g_list_prepend (bin->children, element);
   bin->numchildren++;
   bin->children_cookie++;
+  if (G_UNLIKELY (++bin->priv->topology_cookie == 0))
+    bin->priv->topology_cookie = 1;
   if (!GST_BIN_IS_NO_RESYNC (bin))
     bin->priv->structure_cookie++;
 
@@ -1441,6 +1490,41 @@ gst_bin_get_suppressed_flags (GstBin * bin)
   return res;
 }
 
+/**
+ * gst_bin_get_topology_cookie:
+ * @bin: a #GstBin
+ *
+ * Gets a counter that changes whenever the topology of @bin changes: when
+ * an element is added to or removed from @bin or any bin inside it, and
+ * when pads of the direct children of a bin are linked or unlinked.
+ *
+ * Monitoring applications that periodically export the pipeline graph, for
+ * example with gst_debug_bin_to_dot_data(), can compare the cookie against
+ * the one from the previous snapshot and skip the full graph walk when
+ * nothing changed. The returned value is never 0, so 0 can be used as the
+ * "no snapshot yet" value.
+ *
+ * Note that the cookie only tracks the topology; caps, properties and
+ * states can change without affecting it.
+ *
+ * Returns: the current topology cookie of @bin.
+ *
+ * Since: 1.24
+ */
+guint32
+gst_bin_get_topology_cookie (GstBin * bin)
+{
+  guint32 res;
+
+  g_return_val_if_fail (GST_IS_BIN (bin), 0);
+
+  GST_OBJECT_LOCK (bin);
+  res = bin->priv->topology_cookie;
+  GST_OBJECT_UNLOCK (bin);
+
+  return res;
+}
+
 /* signal vfunc, will be called when a new element was added */
 static void
 gst_bin_deep_element_added_func (GstBin * bin, GstBin * sub_bin,
@@ -1448,6 +1532,11 @@ gst_bin_deep_element_added_func (GstBin * bin, GstBin * sub_bin,
 {
   GstBin *parent_bin;
 
+  GST_OBJECT_LOCK (bin);
+  if (G_UNLIKELY (++bin->priv->topology_cookie == 0))
+    bin->priv->topology_cookie = 1;
+  GST_OBJECT_UNLOCK (bin);
+
   parent_bin = (GstBin *) gst_object_get_parent (GST_OBJECT_CAST (bin));
   if (parent_bin == NULL) {
     GST_LOG_OBJECT (bin, "no parent, reached top-level");
@@ -1471,6 +1560,11 @@ gst_bin_deep_element_removed_func (GstBin * bin, GstBin * sub_bin,
 {
   GstBin *parent_bin;
 
+  GST_OBJECT_LOCK (bin);
+  if (G_UNLIKELY (++bin->priv->topology_cookie == 0))
+    bin->priv->topology_cookie = 1;
+  GST_OBJECT_UNLOCK (bin);
+
   parent_bin = (GstBin *) gst_object_get_parent (GST_OBJECT_CAST (bin));
   if (parent_bin == NULL) {
     GST_LOG_OBJECT (bin, "no parent, reached top-level");
@@ -1633,6 +1727,8 @@ gst_bin_remove_func (GstBin * bin, GstElement * element)
    * so that others can detect a change in the children list. */
   bin->numchildren--;
   bin->children_cookie++;
+  if (G_UNLIKELY (++bin->priv->topology_cookie == 0))
+    bin->priv->topology_cookie = 1;
   if (!GST_BIN_IS_NO_RESYNC (bin))
     bin->priv->structure_cookie++;
 
@@ -2816,6 +2912,284 @@ reset_state (const GValue * data, gpointer user_data)
         gst_element_state_get_name (state));
 }
 
+/* one child state change dispatched on the task pool when
+ * #GstBin:parallel-state-changes is enabled */
+typedef struct
+{
+  GstBin *bin;
+  GstElement *element;
+  GstClockTime base_time;
+  GstClockTime start_time;
+  GstState current;
+  GstState next;
+  GstStateChangeReturn ret;
+} BinParallelStateData;
+
+static void
+bin_parallel_state_func (BinParallelStateData * data)
+{
+  data->ret = gst_bin_element_set_state (data->bin, data->element,
+      data->base_time, data->start_time, data->current, data->next);
+}
+
+/* get the pool used to dispatch parallel child state changes, creating it
+ * on first use */
+static GstTaskPool *
+bin_get_state_change_pool (GstBin * bin)
+{
+  GstTaskPool *pool;
+
+  GST_OBJECT_LOCK (bin);
+  if (bin->priv->state_change_pool == NULL) {
+    pool = gst_shared_task_pool_new ();
+    gst_shared_task_pool_set_max_threads (GST_SHARED_TASK_POOL (pool),
+        g_get_num_processors ());
+    gst_task_pool_prepare (pool, NULL);
+    bin->priv->state_change_pool = pool;
+  }
+  pool = gst_object_ref (bin->priv->state_change_pool);
+  GST_OBJECT_UNLOCK (bin);
+
+  return pool;
+}
+
+/* assign @element to a dependency wave: one higher than the highest wave of
+ * the already assigned elements directly downstream of it. The elements of
+ * one wave have no dataflow link between them and can change state
+ * concurrently. Peers outside the bin or not yet sorted are simply missing
+ * from @wave_index and don't constrain the element. */
+static guint
+bin_parallel_find_wave (GstElement * element, GHashTable * wave_index)
+{
+  GList *pads;
+  guint wave = 0;
+
+  GST_OBJECT_LOCK (element);
+  for (pads = element->srcpads; pads; pads = g_list_next (pads)) {
+    GstPad *pad = GST_PAD_CAST (pads->data);
+    GstPad *peer;
+
+    if ((peer = gst_pad_get_peer (pad))) {
+      GstElement *peer_element;
+
+      if ((peer_element = gst_pad_get_parent_element (peer))) {
+        gpointer value;
+
+        if (g_hash_table_lookup_extended (wave_index, peer_element, NULL,
+                &value))
+          wave = MAX (wave, GPOINTER_TO_UINT (value) + 1);
+        gst_object_unref (peer_element);
+      }
+      gst_object_unref (peer);
+    }
+  }
+  GST_OBJECT_UNLOCK (element);
+
+  return wave;
+}
+
+/* change the state of all children like the sequential loop in
+ * gst_bin_change_state_func() does, but group the sorted children into
+ * waves of mutually independent elements and dispatch each wave
+ * concurrently on a task pool. Waves are processed in sorted order, so the
+ * sink-to-source ordering guarantees of the sorted iterator are kept for
+ * elements that depend on each other.
+ *
+ * Called with the STATE_LOCK of the bin. */
+static GstStateChangeReturn
+gst_bin_change_children_state_parallel (GstBin * bin, GstIterator * it,
+    GstState current, GstState next, gboolean * have_async,
+    gboolean * have_no_preroll)
+{
+  GstElement *element = GST_ELEMENT_CAST (bin);
+  GstStateChangeReturn result = GST_STATE_CHANGE_SUCCESS;
+  GstClockTime base_time, start_time;
+  GstTaskPool *pool;
+  GPtrArray *waves;             /* GPtrArray of GPtrArray of GstElement */
+  GHashTable *wave_index;       /* element -> wave number */
+  guint32 cookie;
+  GValue data = { 0, };
+  gboolean done;
+  guint i, j;
+
+  pool = bin_get_state_change_pool (bin);
+
+restart:
+  /* take base_time */
+  base_time = gst_element_get_base_time (element);
+  start_time = gst_element_get_start_time (element);
+
+  *have_no_preroll = FALSE;
+
+  waves = g_ptr_array_new_with_free_func ((GDestroyNotify) g_ptr_array_unref);
+  wave_index = g_hash_table_new (NULL, NULL);
+
+  GST_OBJECT_LOCK (bin);
+  cookie = bin->priv->structure_cookie;
+  GST_OBJECT_UNLOCK (bin);
+
+  /* collect the children in state change order and group them in waves */
+  done = FALSE;
+  while (!done) {
+    switch (gst_iterator_next (it, &data)) {
+      case GST_ITERATOR_OK:
+      {
+        GstElement *child = g_value_get_object (&data);
+        guint wave = bin_parallel_find_wave (child, wave_index);
+        GPtrArray *batch;
+
+        if (wave == waves->len) {
+          g_ptr_array_add (waves,
+              g_ptr_array_new_with_free_func ((GDestroyNotify)
+                  gst_object_unref));
+        }
+        batch = g_ptr_array_index (waves, wave);
+
+        g_hash_table_insert (wave_index, child, GUINT_TO_POINTER (wave));
+        g_ptr_array_add (batch, gst_object_ref (child));
+        g_value_reset (&data);
+        break;
+      }
+      case GST_ITERATOR_RESYNC:
+        GST_CAT_DEBUG_OBJECT (GST_CAT_STATES, element, "iterator doing resync");
+        gst_iterator_resync (it);
+        goto flush_restart;
+      default:
+      case GST_ITERATOR_DONE:
+        GST_CAT_DEBUG_OBJECT (GST_CAT_STATES, element, "iterator done");
+        done = TRUE;
+        break;
+    }
+  }
+
+  for (i = 0; i < waves->len; i++) {
+    GPtrArray *batch = g_ptr_array_index (waves, i);
+    BinParallelStateData *jobs;
+    gpointer *handles;
+
+    GST_CAT_DEBUG_OBJECT (GST_CAT_STATES, element,
+        "changing state of wave %u with %u children", i, batch->len);
+
+    jobs = g_new (BinParallelStateData, batch->len);
+    handles = g_new (gpointer, batch->len);
+
+    for (j = 0; j < batch->len; j++) {
+      jobs[j].bin = bin;
+      jobs[j].element = g_ptr_array_index (batch, j);
+      jobs[j].base_time = base_time;
+      jobs[j].start_time = start_time;
+      jobs[j].current = current;
+      jobs[j].next = next;
+      jobs[j].ret = GST_STATE_CHANGE_FAILURE;
+      handles[j] = NULL;
+
+      if (batch->len == 1) {
+        /* nothing to win by jumping threads for a wave of one */
+        bin_parallel_state_func (&jobs[j]);
+      } else if ((handles[j] = gst_task_pool_push (pool,
+                  (GstTaskPoolFunction) bin_parallel_state_func, &jobs[j],
+                  NULL)) == NULL) {
+        bin_parallel_state_func (&jobs[j]);
+      }
+    }
+
+    /* wait for the whole wave before starting the next one */
+    for (j = 0; j < batch->len; j++)
+      gst_task_pool_join (pool, handles[j]);
+
+    for (j = 0; j < batch->len; j++) {
+      GstElement *child = jobs[j].element;
+
+      switch (jobs[j].ret) {
+        case GST_STATE_CHANGE_SUCCESS:
+          GST_CAT_INFO_OBJECT (GST_CAT_STATES, element,
+              "child '%s' changed state to %d(%s) successfully",
+              GST_ELEMENT_NAME (child), next,
+              gst_element_state_get_name (next));
+          break;
+        case GST_STATE_CHANGE_ASYNC:
+          GST_CAT_INFO_OBJECT (GST_CAT_STATES, element,
+              "child '%s' is changing state asynchronously to %s",
+              GST_ELEMENT_NAME (child), gst_element_state_get_name (next));
+          *have_async = TRUE;
+          break;
+        case GST_STATE_CHANGE_FAILURE:{
+          GstObject *parent;
+
+          GST_CAT_INFO_OBJECT (GST_CAT_STATES, element,
+              "child '%s' failed to go to state %d(%s)",
+              GST_ELEMENT_NAME (child),
+              next, gst_element_state_get_name (next));
+
+          /* Only fail if the child is still inside
+           * this bin. It might've been removed already
+           * because of the error by the bin subclass
+           * to ignore the error.  */
+          parent = gst_object_get_parent (GST_OBJECT_CAST (child));
+          if (parent == GST_OBJECT_CAST (element)) {
+            /* element is still in bin, really error now */
+            gst_object_unref (parent);
+            result = GST_STATE_CHANGE_FAILURE;
+            break;
+          }
+          /* child removed from bin, the structure cookie changed and we
+           * will redo the state change below */
+          GST_CAT_INFO_OBJECT (GST_CAT_STATES, element,
+              "child '%s' was removed from the bin", GST_ELEMENT_NAME (child));
+
+          if (parent)
+            gst_object_unref (parent);
+
+          break;
+        }
+        case GST_STATE_CHANGE_NO_PREROLL:
+          GST_CAT_INFO_OBJECT (GST_CAT_STATES, element,
+              "child '%s' changed state to %d(%s) successfully without preroll",
+              GST_ELEMENT_NAME (child), next,
+              gst_element_state_get_name (next));
+          *have_no_preroll = TRUE;
+          break;
+        default:
+          g_assert_not_reached ();
+          break;
+      }
+    }
+
+    g_free (jobs);
+    g_free (handles);
+
+    if (G_UNLIKELY (result == GST_STATE_CHANGE_FAILURE))
+      break;
+
+    /* elements added or removed while the wave was busy, redo the state
+     * change just like a sorted iterator resync */
+    GST_OBJECT_LOCK (bin);
+    if (G_UNLIKELY (cookie != bin->priv->structure_cookie)) {
+      GST_OBJECT_UNLOCK (bin);
+      GST_CAT_DEBUG_OBJECT (GST_CAT_STATES, element,
+          "structure changed during wave, restarting");
+      gst_iterator_resync (it);
+      goto flush_restart;
+    }
+    GST_OBJECT_UNLOCK (bin);
+  }
+
+  g_ptr_array_unref (waves);
+  g_hash_table_unref (wave_index);
+  if (G_IS_VALUE (&data))
+    g_value_unset (&data);
+  gst_object_unref (pool);
+
+  return result;
+
+flush_restart:
+  {
+    g_ptr_array_unref (waves);
+    g_hash_table_unref (wave_index);
+    goto restart;
+  }
+}
+
 static GstStateChangeReturn
 gst_bin_change_state_func (GstElement * element, GstStateChange transition)
 {
@@ -2827,6 +3201,7 @@ gst_bin_change_state_func (GstElement * element, GstStateChange transition)
   GstClockTime base_time, start_time;
   GstIterator *it;
   gboolean done;
+  gboolean parallel;
   GValue data = { 0, };
 
   /* we don't need to take the STATE_LOCK, it is already taken */
@@ -2910,6 +3285,19 @@ gst_bin_change_state_func (GstElement * element, GstStateChange transition)
    * even after a resync when the async element is gone */
   have_async = FALSE;
 
+  GST_OBJECT_LOCK (bin);
+  parallel = bin->priv->parallel_state_changes && bin->numchildren > 1;
+  GST_OBJECT_UNLOCK (bin);
+
+  if (parallel) {
+    have_no_preroll = FALSE;
+    ret = gst_bin_change_children_state_parallel (bin, it, current, next,
+        &have_async, &have_no_preroll);
+    if (G_UNLIKELY (ret == GST_STATE_CHANGE_FAILURE))
+      goto undo;
+    goto chain_up;
+  }
+
 restart:
   /* take base_time */
   base_time = gst_element_get_base_time (element);
@@ -3000,6 +3388,7 @@ restart:
     }
   }
 
+chain_up:
   ret = GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
   if (G_UNLIKELY (ret == GST_STATE_CHANGE_FAILURE))
     goto done;
@@ -3017,7 +3406,9 @@ restart:
   }
 
 done:
-  g_value_unset (&data);
+  /* data is never initialized when the children were changed in parallel */
+  if (G_IS_VALUE (&data))
+    g_value_unset (&data);
   gst_iterator_free (it);
 
   GST_OBJECT_LOCK (bin);
@@ -3962,6 +4353,8 @@ gst_bin_handle_message_func (GstBin * bin, GstMessage * message)
          * need to resync by updating the structure_cookie. */
         bin_remove_messages (bin, GST_MESSAGE_SRC (message),
             GST_MESSAGE_STRUCTURE_CHANGE);
+        if (G_UNLIKELY (++bin->priv->topology_cookie == 0))
+          bin->priv->topology_cookie = 1;
         if (!GST_BIN_IS_NO_RESYNC (bin))
           bin->priv->structure_cookie++;
       }
@@ -325,6 +325,11 @@ void            gst_bin_set_suppressed_flags (GstBin * bin, GstElementFlags flag
 GST_API
 GstElementFlags gst_bin_get_suppressed_flags (GstBin * bin);
 
+/* topology change detection */
+
+GST_API
+guint32         gst_bin_get_topology_cookie  (GstBin * bin);
+
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GstBin, gst_object_unref)
 
 G_END_DECLS
@@ -126,6 +126,7 @@
 #ifdef HAVE_STDLIB_H
 #include <stdlib.h>
 #endif
+#include <string.h>
 
 #include "gstbuffer.h"
 #include "gstbufferpool.h"
@@ -153,6 +154,14 @@ GType _gst_buffer_type = 0;
 #define GST_BUFFER_META(b)         (((GstBufferImpl *)(b))->item)
 #define GST_BUFFER_TAIL_META(b)    (((GstBufferImpl *)(b))->tail_item)
 
+/* size of the per-buffer area that metas are allocated from before falling
+ * back to the slice allocator; enough for the handful of metas that video
+ * buffers typically carry */
+#define META_ARENA_SIZE            384
+/* metas contain pointers, 64 bit integers and doubles */
+#define META_ARENA_ALIGN(s)        (((s) + (sizeof (guint64) - 1)) & \
+                                       ~(sizeof (guint64) - 1))
+
 typedef struct
 {
   GstBuffer buffer;
@@ -166,12 +175,76 @@ typedef struct
   /* memory of the buffer when allocated from 1 chunk */
   GstMemory *bufmem;
 
-  /* FIXME, make metadata allocation more efficient by using part of the
-   * GstBufferImpl */
   GstMetaItem *item;
   GstMetaItem *tail_item;
+
+  /* metas are carved out of @arena while there is room, so adding the usual
+   * few metas needs no extra allocations */
+  guint16 arena_used;
+  guint16 arena_live;
+  guint64 arena[META_ARENA_SIZE / sizeof (guint64)];
 } GstBufferImpl;
 
+/* allocate a meta item from the embedded arena when it fits, from the slice
+ * allocator otherwise */
+static GstMetaItem *
+_meta_item_alloc (GstBuffer * buffer, gsize size, gboolean zero)
+{
+  GstBufferImpl *impl = (GstBufferImpl *) buffer;
+  gsize asize = META_ARENA_ALIGN (size);
+
+  if (asize <= META_ARENA_SIZE - impl->arena_used) {
+    guint8 *item = (guint8 *) impl->arena + impl->arena_used;
+
+    impl->arena_used += asize;
+    impl->arena_live++;
+    if (zero)
+      memset (item, 0, size);
+    return (GstMetaItem *) item;
+  }
+  if (zero)
+    return g_slice_alloc0 (size);
+  return g_slice_alloc (size);
+}
+
+static inline gboolean
+_meta_item_in_arena (GstBuffer * buffer, GstMetaItem * item)
+{
+  guint8 *arena = (guint8 *) ((GstBufferImpl *) buffer)->arena;
+
+  return (guint8 *) item >= arena && (guint8 *) item < arena + META_ARENA_SIZE;
+}
+
+/* free a meta item that was already unlinked from the meta list */
+static void
+_meta_item_free (GstBuffer * buffer, GstMetaItem * item, gsize size)
+{
+  GstBufferImpl *impl = (GstBufferImpl *) buffer;
+
+  if (_meta_item_in_arena (buffer, item)) {
+    if (--impl->arena_live == 0) {
+      impl->arena_used = 0;
+    } else {
+      GstMetaItem *walk;
+      gsize used = 0;
+
+      /* reclaim trailing space; interior holes are reclaimed once the items
+       * after them are gone too. The list is at most a handful of items */
+      for (walk = GST_BUFFER_META (buffer); walk; walk = walk->next) {
+        if (_meta_item_in_arena (buffer, walk)) {
+          gsize end = ((guint8 *) walk - (guint8 *) impl->arena) +
+              META_ARENA_ALIGN (ITEM_SIZE (walk->meta.info));
+
+          used = MAX (used, end);
+        }
+      }
+      impl->arena_used = used;
+    }
+  } else {
+    g_slice_free1 (size, item);
+  }
+}
+
 static gint64 meta_seq;         /* 0 *//* ATOMIC */
 
 /* TODO: use GLib's once https://gitlab.gnome.org/GNOME/glib/issues/1076 lands */
@@ -261,40 +334,11 @@ _actual_merged_memory (GstBuffer * buffer, guint idx, guint length)
       result = gst_memory_copy (parent, poffset, size);
     }
   } else {
-    gsize i, tocopy, left;
-    GstMapInfo sinfo, dinfo;
-    guint8 *ptr;
-
-    result = gst_allocator_alloc (NULL, size, NULL);
-    if (result == NULL || !gst_memory_map (result, &dinfo, GST_MAP_WRITE)) {
-      GST_CAT_ERROR (GST_CAT_BUFFER, "Failed to map memory writable");
-      if (result)
-        gst_memory_unref (result);
-      return NULL;
-    }
-
-    ptr = dinfo.data;
-    left = size;
-
-    for (i = idx; i < (idx + length) && left > 0; i++) {
-      if (!gst_memory_map (mem[i], &sinfo, GST_MAP_READ)) {
-        GST_CAT_ERROR (GST_CAT_BUFFER,
-            "buffer %p, idx %u, length %u failed to map readable", buffer,
-            idx, length);
-        gst_memory_unmap (result, &dinfo);
-        gst_memory_unref (result);
-        return NULL;
-      }
-      tocopy = MIN (sinfo.size, left);
-      GST_CAT_DEBUG (GST_CAT_PERFORMANCE,
-          "memcpy %" G_GSIZE_FORMAT " bytes for merge %p from memory %p",
-          tocopy, result, mem[i]);
-      memcpy (ptr, (guint8 *) sinfo.data, tocopy);
-      left -= tocopy;
-      ptr += tocopy;
-      gst_memory_unmap (mem[i], &sinfo);
-    }
-    gst_memory_unmap (result, &dinfo);
+    /* not a natural span of one parent, create a lazy view that only
+     * flattens the memories when somebody actually maps it */
+    GST_CAT_DEBUG (GST_CAT_PERFORMANCE, "deferred merge of %u memories for "
+        "buffer %p", length, buffer);
+    result = _priv_gst_merged_memory_new (mem + idx, length, size);
   }
 
   return result;
@@ -798,8 +842,10 @@ _gst_buffer_free (GstBuffer * buffer)
       info->free_func (meta, buffer);
 
     next = walk->next;
-    /* and free the slice */
-    g_slice_free1 (ITEM_SIZE (info), walk);
+    /* free the slice unless it lives in the arena, which goes away together
+     * with the buffer */
+    if (!_meta_item_in_arena (buffer, walk))
+      g_slice_free1 (ITEM_SIZE (info), walk);
   }
 
   /* get the size, when unreffing the memory, we could also unref the buffer
@@ -845,6 +891,8 @@ gst_buffer_init (GstBufferImpl * buffer, gsize size)
 
   GST_BUFFER_MEM_LEN (buffer) = 0;
   GST_BUFFER_META (buffer) = NULL;
+  buffer->arena_used = 0;
+  buffer->arena_live = 0;
 }
 
 /**
@@ -2304,16 +2352,13 @@ gst_buffer_add_meta (GstBuffer * buffer, const GstMetaInfo * info,
   g_return_val_if_fail (info != NULL, NULL);
   g_return_val_if_fail (gst_buffer_is_writable (buffer), NULL);
 
-  /* create a new slice */
+  /* create a new item, from the arena when possible */
   size = ITEM_SIZE (info);
   /* We warn in gst_meta_register() about metas without
    * init function but let's play safe here and prevent
    * uninitialized memory
    */
-  if (!info->init_func)
-    item = g_slice_alloc0 (size);
-  else
-    item = g_slice_alloc (size);
+  item = _meta_item_alloc (buffer, size, info->init_func == NULL);
   result = &item->meta;
   result->info = info;
   result->flags = GST_META_FLAG_NONE;
@@ -2341,7 +2386,7 @@ gst_buffer_add_meta (GstBuffer * buffer, const GstMetaInfo * info,
 
 init_failed:
   {
-    g_slice_free1 (size, item);
+    _meta_item_free (buffer, item, size);
     return NULL;
   }
 }
@@ -2391,8 +2436,8 @@ gst_buffer_remove_meta (GstBuffer * buffer, GstMeta * meta)
       if (info->free_func)
         info->free_func (m, buffer);
 
-      /* and free the slice */
-      g_slice_free1 (ITEM_SIZE (info), walk);
+      /* and free the item */
+      _meta_item_free (buffer, walk, ITEM_SIZE (info));
       break;
     }
     prev = walk;
@@ -2539,8 +2584,8 @@ gst_buffer_foreach_meta (GstBuffer * buffer, GstBufferForeachMetaFunc func,
       if (info->free_func)
         info->free_func (m, buffer);
 
-      /* and free the slice */
-      g_slice_free1 (ITEM_SIZE (info), walk);
+      /* and free the item */
+      _meta_item_free (buffer, walk, ITEM_SIZE (info));
     } else {
       prev = walk;
     }
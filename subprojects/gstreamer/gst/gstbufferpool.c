@@ -64,26 +64,13 @@
 #include "gst_private.h"
 #include "glib-compat-private.h"
 
-#include <errno.h>
-#ifdef HAVE_UNISTD_H
-#  include <unistd.h>
-#endif
-#include <sys/types.h>
-
 #include "gstatomicqueue.h"
-#include "gstpoll.h"
 #include "gstinfo.h"
 #include "gstquark.h"
 #include "gstvalue.h"
 
 #include "gstbufferpool.h"
 
-#ifdef G_OS_WIN32
-#  ifndef EWOULDBLOCK
-#  define EWOULDBLOCK EAGAIN    /* This is just to placate gcc */
-#  endif
-#endif /* G_OS_WIN32 */
-
 GST_DEBUG_CATEGORY_STATIC (gst_buffer_pool_debug);
 #define GST_CAT_DEFAULT gst_buffer_pool_debug
 
@@ -93,7 +80,12 @@ GST_DEBUG_CATEGORY_STATIC (gst_buffer_pool_debug);
 struct _GstBufferPoolPrivate
 {
   GstAtomicQueue *queue;
-  GstPoll *poll;
+
+  /* only used when a thread has to wait for a buffer to be released, the
+   * common acquire/release cycle stays on the lock-free queue */
+  GMutex empty_lock;
+  GCond empty_cond;
+  gint n_waiting;
 
   GRecMutex rec_lock;
 
@@ -159,7 +151,9 @@ gst_buffer_pool_init (GstBufferPool * pool)
 
   g_rec_mutex_init (&priv->rec_lock);
 
-  priv->poll = gst_poll_new_timer ();
+  g_mutex_init (&priv->empty_lock);
+  g_cond_init (&priv->empty_cond);
+  priv->n_waiting = 0;
   priv->queue = gst_atomic_queue_new (16);
   pool->flushing = 1;
   priv->active = FALSE;
@@ -171,10 +165,6 @@ gst_buffer_pool_init (GstBufferPool * pool)
   gst_allocation_params_init (&priv->params);
   gst_buffer_pool_config_set_allocator (priv->config, priv->allocator,
       &priv->params);
-  /* 1 control write for flushing - the flush token */
-  gst_poll_write_control (priv->poll);
-  /* 1 control write for marking that we are not waiting for poll - the wait token */
-  gst_poll_write_control (priv->poll);
 
   GST_DEBUG_OBJECT (pool, "created");
 }
@@ -208,7 +198,8 @@ gst_buffer_pool_finalize (GObject * object)
   GST_DEBUG_OBJECT (pool, "%p finalize", pool);
 
   gst_atomic_queue_unref (priv->queue);
-  gst_poll_free (priv->poll);
+  g_mutex_clear (&priv->empty_lock);
+  g_cond_clear (&priv->empty_cond);
   gst_structure_free (priv->config);
   g_rec_mutex_clear (&priv->rec_lock);
 
@@ -399,6 +390,21 @@ do_free_buffer (GstBufferPool * pool, GstBuffer * buffer)
     pclass->free_buffer (pool, buffer);
 }
 
+/* wake up threads that wait for a released buffer. Only takes the lock and
+ * signals when somebody registered as waiting, so the common acquire/release
+ * cycle completes without any syscall or lock. */
+static void
+maybe_wake_waiters (GstBufferPool * pool)
+{
+  GstBufferPoolPrivate *priv = pool->priv;
+
+  if (G_UNLIKELY (g_atomic_int_get (&priv->n_waiting) > 0)) {
+    g_mutex_lock (&priv->empty_lock);
+    g_cond_signal (&priv->empty_cond);
+    g_mutex_unlock (&priv->empty_lock);
+  }
+}
+
 /* must be called with the lock */
 static gboolean
 default_stop (GstBufferPool * pool)
@@ -407,20 +413,9 @@ default_stop (GstBufferPool * pool)
   GstBuffer *buffer;
 
   /* clear the pool */
-  while ((buffer = gst_atomic_queue_pop (priv->queue))) {
-    while (!gst_poll_read_control (priv->poll)) {
-      if (errno == EWOULDBLOCK) {
-        /* We put the buffer into the queue but did not finish writing control
-         * yet, let's wait a bit and retry */
-        g_thread_yield ();
-        continue;
-      } else {
-        /* Critical error but GstPoll already complained */
-        break;
-      }
-    }
+  while ((buffer = gst_atomic_queue_pop (priv->queue)))
     do_free_buffer (pool, buffer);
-  }
+
   return priv->cur_buffers == 0;
 }
 
@@ -459,8 +454,10 @@ do_set_flushing (GstBufferPool * pool, gboolean flushing)
 
   if (flushing) {
     g_atomic_int_set (&pool->flushing, 1);
-    /* Write the flush token to wake up any waiters */
-    gst_poll_write_control (priv->poll);
+    /* wake up any waiters so they can see that we are flushing */
+    g_mutex_lock (&priv->empty_lock);
+    g_cond_broadcast (&priv->empty_cond);
+    g_mutex_unlock (&priv->empty_lock);
 
     if (pclass->flush_start)
       pclass->flush_start (pool);
@@ -468,19 +465,6 @@ do_set_flushing (GstBufferPool * pool, gboolean flushing)
     if (pclass->flush_stop)
       pclass->flush_stop (pool);
 
-    while (!gst_poll_read_control (priv->poll)) {
-      if (errno == EWOULDBLOCK) {
-        /* This should not really happen unless flushing and unflushing
-         * happens on different threads. Let's wait a bit to get back flush
-         * token from the thread that was setting it to flushing */
-        g_thread_yield ();
-        continue;
-      } else {
-        /* Critical error but GstPoll already complained */
-        break;
-      }
-    }
-
     g_atomic_int_set (&pool->flushing, 0);
   }
 }
@@ -581,6 +565,91 @@ stop_failed:
   }
 }
 
+/**
+ * gst_buffer_pool_prewarm:
+ * @pool: a #GstBufferPool
+ *
+ * Allocates all buffers that the configuration of @pool allows for and
+ * touches every page of their memory before releasing them into the pool
+ * again. Later gst_buffer_pool_acquire_buffer() calls then neither
+ * allocate nor fault pages in, which keeps allocation and page fault
+ * latency out of the first buffers of a stream.
+ *
+ * For pools without a maximum number of buffers only the already
+ * allocated buffers are pre-faulted.
+ *
+ * The pool must be active, see gst_buffer_pool_set_active().
+ *
+ * Returns: %TRUE when all buffers could be allocated and pre-faulted
+ *
+ * Since: 1.24
+ */
+gboolean
+gst_buffer_pool_prewarm (GstBufferPool * pool)
+{
+  GstBufferPoolPrivate *priv;
+  GstBufferPoolClass *pclass;
+  GQueue warmed = G_QUEUE_INIT;
+  GstBuffer *buffer;
+  gboolean res = TRUE;
+
+  g_return_val_if_fail (GST_IS_BUFFER_POOL (pool), FALSE);
+
+  priv = pool->priv;
+  pclass = GST_BUFFER_POOL_GET_CLASS (pool);
+
+  GST_BUFFER_POOL_LOCK (pool);
+  if (!priv->active)
+    goto inactive;
+
+  /* take out the buffers that are already pooled */
+  while ((buffer = gst_atomic_queue_pop (priv->queue)))
+    g_queue_push_tail (&warmed, buffer);
+
+  /* and allocate whatever else the configuration allows for */
+  if (priv->max_buffers > 0) {
+    GstFlowReturn result;
+
+    while ((result = do_alloc_buffer (pool, &buffer, NULL)) == GST_FLOW_OK)
+      g_queue_push_tail (&warmed, buffer);
+
+    if (result != GST_FLOW_EOS) {
+      GST_WARNING_OBJECT (pool, "failed to allocate buffer");
+      res = FALSE;
+    }
+  }
+
+  GST_DEBUG_OBJECT (pool, "pre-faulting %u buffers", warmed.length);
+
+  /* fault all pages in and release the buffers into the pool */
+  while ((buffer = g_queue_pop_head (&warmed))) {
+    GstMapInfo info;
+
+    if (gst_buffer_map (buffer, &info, GST_MAP_WRITE)) {
+      volatile guint8 *data = info.data;
+      gsize i;
+
+      for (i = 0; i < info.size; i += 4096)
+        data[i] = data[i];
+      gst_buffer_unmap (buffer, &info);
+    }
+
+    if (G_LIKELY (pclass->release_buffer))
+      pclass->release_buffer (pool, buffer);
+  }
+  GST_BUFFER_POOL_UNLOCK (pool);
+
+  return res;
+
+  /* ERRORS */
+inactive:
+  {
+    GST_WARNING_OBJECT (pool, "pool is not active");
+    GST_BUFFER_POOL_UNLOCK (pool);
+    return FALSE;
+  }
+}
+
 /**
  * gst_buffer_pool_is_active:
  * @pool: a #GstBufferPool
@@ -1119,17 +1188,6 @@ default_acquire_buffer (GstBufferPool * pool, GstBuffer ** buffer,
     /* try to get a buffer from the queue */
     *buffer = gst_atomic_queue_pop (priv->queue);
     if (G_LIKELY (*buffer)) {
-      while (!gst_poll_read_control (priv->poll)) {
-        if (errno == EWOULDBLOCK) {
-          /* We put the buffer into the queue but did not finish writing control
-           * yet, let's wait a bit and retry */
-          g_thread_yield ();
-          continue;
-        } else {
-          /* Critical error but GstPoll already complained */
-          break;
-        }
-      }
       result = GST_FLOW_OK;
       GST_LOG_OBJECT (pool, "acquired buffer %p", *buffer);
       break;
@@ -1152,35 +1210,21 @@ default_acquire_buffer (GstBufferPool * pool, GstBuffer ** buffer,
       break;
     }
 
-    /* now we release the control socket, we wait for a buffer release or
-     * flushing */
-    if (!gst_poll_read_control (pool->priv->poll)) {
-      if (errno == EWOULDBLOCK) {
-        /* This means that we have two threads trying to allocate buffers
-         * already, and the other one already got the wait token. This
-         * means that we only have to wait for the poll now and not write the
-         * token afterwards: we will be woken up once the other thread is
-         * woken up and that one will write the wait token it removed */
-        GST_LOG_OBJECT (pool, "waiting for free buffers or flushing");
-        gst_poll_wait (priv->poll, GST_CLOCK_TIME_NONE);
-      } else {
-        /* This is a critical error, GstPoll already gave a warning */
-        result = GST_FLOW_ERROR;
-        break;
-      }
-    } else {
-      /* We're the first thread waiting, we got the wait token and have to
-       * write it again later
-       * OR
-       * We're a second thread and just consumed the flush token and block all
-       * other threads, in which case we must not wait and give it back
-       * immediately */
-      if (!GST_BUFFER_POOL_IS_FLUSHING (pool)) {
-        GST_LOG_OBJECT (pool, "waiting for free buffers or flushing");
-        gst_poll_wait (priv->poll, GST_CLOCK_TIME_NONE);
-      }
-      gst_poll_write_control (pool->priv->poll);
+    /* now wait for a buffer release or flushing. Register as waiting first
+     * and then check the queue and the allocation counter again: a release
+     * or discard that happened in between sees our waiting count and will
+     * signal, so we can't miss a wakeup. The woken thread retries the whole
+     * acquire. */
+    g_mutex_lock (&priv->empty_lock);
+    g_atomic_int_inc (&priv->n_waiting);
+    if (gst_atomic_queue_length (priv->queue) == 0
+        && (guint) g_atomic_int_get (&priv->cur_buffers) >= priv->max_buffers
+        && !GST_BUFFER_POOL_IS_FLUSHING (pool)) {
+      GST_LOG_OBJECT (pool, "waiting for free buffers or flushing");
+      g_cond_wait (&priv->empty_cond, &priv->empty_lock);
     }
+    g_atomic_int_add (&priv->n_waiting, -1);
+    g_mutex_unlock (&priv->empty_lock);
   }
 
   return result;
@@ -1326,7 +1370,7 @@ default_release_buffer (GstBufferPool * pool, GstBuffer * buffer)
 
   /* keep it around in our queue */
   gst_atomic_queue_push (pool->priv->queue, buffer);
-  gst_poll_write_control (pool->priv->poll);
+  maybe_wake_waiters (pool);
 
   return;
 
@@ -1352,7 +1396,8 @@ not_writable:
 discard:
   {
     do_free_buffer (pool, buffer);
-    gst_poll_write_control (pool->priv->poll);
+    /* waiters can now allocate a new buffer */
+    maybe_wake_waiters (pool);
     return;
   }
 }
@@ -285,6 +285,9 @@ gboolean         gst_buffer_pool_set_active      (GstBufferPool *pool, gboolean
 GST_API
 gboolean         gst_buffer_pool_is_active       (GstBufferPool *pool);
 
+GST_API
+gboolean         gst_buffer_pool_prewarm         (GstBufferPool *pool);
+
 GST_API
 gboolean         gst_buffer_pool_set_config      (GstBufferPool *pool, GstStructure *config);
 
@@ -137,11 +137,17 @@ sync_handler_unref (SyncHandler * handler)
   g_free (handler);
 }
 
+/* maximum number of messages handled per watch dispatch */
+#define GST_BUS_SOURCE_DISPATCH_BATCH 8
+
 struct _GstBusPrivate
 {
   GstAtomicQueue *queue;
   GMutex queue_lock;
 
+  /* mask of message types accepted at post time, atomic */
+  gint post_filter;
+
   SyncHandler *sync_handler;
 
   guint num_signal_watchers;
@@ -252,6 +258,7 @@ gst_bus_init (GstBus * bus)
   bus->priv->enable_async = DEFAULT_ENABLE_ASYNC;
   g_mutex_init (&bus->priv->queue_lock);
   bus->priv->queue = gst_atomic_queue_new (32);
+  bus->priv->post_filter = GST_MESSAGE_ANY;
 
   GST_DEBUG_OBJECT (bus, "created");
 }
@@ -338,6 +345,15 @@ gst_bus_post (GstBus * bus, GstMessage * message)
   GST_DEBUG_OBJECT (bus, "[msg %p] posting on bus %" GST_PTR_FORMAT, message,
       message);
 
+  /* drop uninteresting messages before touching any lock */
+  if (G_UNLIKELY ((GST_MESSAGE_TYPE (message) &
+              (GstMessageType) g_atomic_int_get (&bus->priv->post_filter)) ==
+          0)) {
+    GST_DEBUG_OBJECT (bus, "[msg %p] filtered at post time", message);
+    gst_message_unref (message);
+    return TRUE;
+  }
+
   /* check we didn't accidentally add a public flag that maps to same value */
   g_assert (!GST_MINI_OBJECT_FLAG_IS_SET (message,
           GST_MESSAGE_FLAG_ASYNC_DELIVERY));
@@ -498,6 +514,50 @@ gst_bus_set_flushing (GstBus * bus, gboolean flushing)
   g_list_free_full (message_list, (GDestroyNotify) gst_message_unref);
 }
 
+/**
+ * gst_bus_set_post_filter:
+ * @bus: a #GstBus
+ * @types: message types to accept at post time
+ *
+ * Only let messages matching @types onto the bus. Messages of other
+ * types are dropped in gst_bus_post() before the sync handler runs and
+ * before any queueing or main-loop wakeup happens, which keeps
+ * high-frequency message traffic from elements off the application
+ * main loop entirely.
+ *
+ * The default is #GST_MESSAGE_ANY. Use with care: dropping messages
+ * like %GST_MESSAGE_ERROR or %GST_MESSAGE_ASYNC_DONE will break the
+ * usual application logic around them.
+ *
+ * Since: 1.24
+ */
+void
+gst_bus_set_post_filter (GstBus * bus, GstMessageType types)
+{
+  g_return_if_fail (GST_IS_BUS (bus));
+
+  g_atomic_int_set (&bus->priv->post_filter, (gint) types);
+}
+
+/**
+ * gst_bus_get_post_filter:
+ * @bus: a #GstBus
+ *
+ * Gets the message types accepted at post time, see
+ * gst_bus_set_post_filter().
+ *
+ * Returns: the configured message type mask
+ *
+ * Since: 1.24
+ */
+GstMessageType
+gst_bus_get_post_filter (GstBus * bus)
+{
+  g_return_val_if_fail (GST_IS_BUS (bus), GST_MESSAGE_ANY);
+
+  return (GstMessageType) g_atomic_int_get (&bus->priv->post_filter);
+}
+
 /**
  * gst_bus_timed_pop_filtered:
  * @bus: a #GstBus to pop from
@@ -797,6 +857,7 @@ gst_bus_source_dispatch (GSource * source, GSourceFunc callback,
   GstBusSource *bsource = (GstBusSource *) source;
   GstMessage *message;
   gboolean keep;
+  guint batch;
   GstBus *bus;
 
   g_return_val_if_fail (bsource != NULL, FALSE);
@@ -815,13 +876,23 @@ gst_bus_source_dispatch (GSource * source, GSourceFunc callback,
   if (!handler)
     goto no_handler;
 
-  GST_DEBUG_OBJECT (bus, "source %p calling dispatch with %" GST_PTR_FORMAT,
-      source, message);
+  /* dispatch a small batch of messages per invocation: flooded buses
+   * would otherwise pay a full main-loop iteration per message. The
+   * batch is bounded so other sources are not starved. */
+  batch = GST_BUS_SOURCE_DISPATCH_BATCH;
+  do {
+    GST_DEBUG_OBJECT (bus, "source %p calling dispatch with %" GST_PTR_FORMAT,
+        source, message);
 
-  keep = handler (bus, message, user_data);
-  gst_message_unref (message);
+    keep = handler (bus, message, user_data);
+    gst_message_unref (message);
+    message = NULL;
+
+    GST_DEBUG_OBJECT (bus, "source %p handler returns %d", source, keep);
+  } while (keep && --batch > 0 && (message = gst_bus_pop (bus)) != NULL);
 
-  GST_DEBUG_OBJECT (bus, "source %p handler returns %d", source, keep);
+  if (message != NULL)
+    gst_message_unref (message);
 
   return keep;
 
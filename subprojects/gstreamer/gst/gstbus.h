@@ -185,6 +185,12 @@ GstMessage *            gst_bus_timed_pop_filtered      (GstBus * bus, GstClockT
 GST_API
 void                    gst_bus_set_flushing            (GstBus * bus, gboolean flushing);
 
+GST_API
+void                    gst_bus_set_post_filter         (GstBus * bus, GstMessageType types);
+
+GST_API
+GstMessageType          gst_bus_get_post_filter         (GstBus * bus);
+
 /* synchronous dispatching */
 
 GST_API
@@ -125,6 +125,107 @@ typedef struct _GstCapsImpl
 /* lock to protect multiple invocations of static caps to caps conversion */
 G_LOCK_DEFINE_STATIC (static_caps_lock);
 
+/* small cache of recent intersection results, keyed on the caps pointer
+ * pair. Negotiation storms (accept-caps / query-caps on dynamic
+ * pipelines) intersect the same caps objects over and over; holding a
+ * ref on the cached operands keeps them unwritable so pointer equality
+ * implies equal contents. */
+#define CAPS_INTERSECT_CACHE_SIZE 16    /* must be a power of two */
+
+typedef struct
+{
+  GstCaps *caps1;
+  GstCaps *caps2;
+  GstCaps *result;
+  GstCapsIntersectMode mode;
+} CapsIntersectCacheEntry;
+
+static CapsIntersectCacheEntry caps_intersect_cache[CAPS_INTERSECT_CACHE_SIZE];
+G_LOCK_DEFINE_STATIC (caps_intersect_cache_lock);
+
+#define CAPS_INTERSECT_CACHE_IDX(caps1, caps2) \
+    ((((guintptr) (caps1) >> 4) ^ ((guintptr) (caps2) >> 8)) & \
+     (CAPS_INTERSECT_CACHE_SIZE - 1))
+
+static GstCaps *
+caps_intersect_cache_lookup (GstCaps * caps1, GstCaps * caps2,
+    GstCapsIntersectMode mode)
+{
+  CapsIntersectCacheEntry *entry;
+  GstCaps *result = NULL;
+
+  G_LOCK (caps_intersect_cache_lock);
+  entry = &caps_intersect_cache[CAPS_INTERSECT_CACHE_IDX (caps1, caps2)];
+  if (entry->caps1 == caps1 && entry->caps2 == caps2 && entry->mode == mode)
+    result = gst_caps_ref (entry->result);
+  G_UNLOCK (caps_intersect_cache_lock);
+
+  /* callers expect a writable result from an intersection, so hand out a
+   * copy of the cached caps instead of sharing them; copy outside of the
+   * lock, the transient ref keeps the entry alive */
+  if (result) {
+    GstCaps *copy = gst_caps_copy (result);
+
+    gst_caps_unref (result);
+    result = copy;
+  }
+
+  return result;
+}
+
+static void
+caps_intersect_cache_store (GstCaps * caps1, GstCaps * caps2,
+    GstCapsIntersectMode mode, GstCaps * result)
+{
+  CapsIntersectCacheEntry *entry;
+  CapsIntersectCacheEntry old;
+
+  /* don't cache writable caps: taking a ref would make them unwritable
+   * for a caller that still owns them exclusively, and they could be
+   * modified in place, invalidating the pointer keyed entry */
+  if (GST_MINI_OBJECT_REFCOUNT_VALUE (caps1) == 1 ||
+      GST_MINI_OBJECT_REFCOUNT_VALUE (caps2) == 1)
+    return;
+
+  /* cache a private copy of the result: taking a ref on the freshly
+   * computed caps would make them unwritable for the caller */
+  result = gst_caps_copy (result);
+
+  G_LOCK (caps_intersect_cache_lock);
+  entry = &caps_intersect_cache[CAPS_INTERSECT_CACHE_IDX (caps1, caps2)];
+  old = *entry;
+  entry->caps1 = gst_caps_ref (caps1);
+  entry->caps2 = gst_caps_ref (caps2);
+  entry->result = result;
+  entry->mode = mode;
+  G_UNLOCK (caps_intersect_cache_lock);
+
+  if (old.caps1) {
+    gst_caps_unref (old.caps1);
+    gst_caps_unref (old.caps2);
+    gst_caps_unref (old.result);
+  }
+}
+
+static void
+caps_intersect_cache_clear (void)
+{
+  guint i;
+
+  G_LOCK (caps_intersect_cache_lock);
+  for (i = 0; i < CAPS_INTERSECT_CACHE_SIZE; i++) {
+    CapsIntersectCacheEntry *entry = &caps_intersect_cache[i];
+
+    if (entry->caps1) {
+      gst_caps_unref (entry->caps1);
+      gst_caps_unref (entry->caps2);
+      gst_caps_unref (entry->result);
+      memset (entry, 0, sizeof (*entry));
+    }
+  }
+  G_UNLOCK (caps_intersect_cache_lock);
+}
+
 static void gst_caps_transform_to_string (const GValue * src_value,
     GValue * dest_value);
 static gboolean gst_caps_from_string_inplace (GstCaps * caps,
@@ -151,6 +252,7 @@ _priv_gst_caps_initialize (void)
 void
 _priv_gst_caps_cleanup (void)
 {
+  caps_intersect_cache_clear ();
   gst_caps_unref (_gst_caps_any);
   _gst_caps_any = NULL;
   gst_caps_unref (_gst_caps_none);
@@ -1755,6 +1857,8 @@ GstCaps *
 gst_caps_intersect_full (GstCaps * caps1, GstCaps * caps2,
     GstCapsIntersectMode mode)
 {
+  GstCaps *result;
+
   g_return_val_if_fail (GST_IS_CAPS (caps1), NULL);
   g_return_val_if_fail (GST_IS_CAPS (caps2), NULL);
 
@@ -1774,15 +1878,28 @@ gst_caps_intersect_full (GstCaps * caps1, GstCaps * caps2,
   if (G_UNLIKELY (CAPS_IS_ANY (caps2)))
     return gst_caps_ref (caps1);
 
+  if ((result = caps_intersect_cache_lookup (caps1, caps2, mode))) {
+    GST_CAT_LOG (GST_CAT_PERFORMANCE,
+        "cached intersection %" GST_PTR_FORMAT " of %" GST_PTR_FORMAT
+        " and %" GST_PTR_FORMAT, result, caps1, caps2);
+    return result;
+  }
+
   switch (mode) {
     case GST_CAPS_INTERSECT_FIRST:
-      return gst_caps_intersect_first (caps1, caps2);
+      result = gst_caps_intersect_first (caps1, caps2);
+      break;
     default:
       g_warning ("Unknown caps intersect mode: %d", mode);
       /* fallthrough */
     case GST_CAPS_INTERSECT_ZIG_ZAG:
-      return gst_caps_intersect_zig_zag (caps1, caps2);
+      result = gst_caps_intersect_zig_zag (caps1, caps2);
+      break;
   }
+
+  caps_intersect_cache_store (caps1, caps2, mode, result);
+
+  return result;
 }
 
 /**
@@ -832,6 +832,44 @@ gst_debug_bin_to_dot_data (GstBin * bin, GstDebugGraphDetails details)
   return g_string_free (str, FALSE);
 }
 
+/**
+ * gst_debug_bin_to_dot_data_if_changed:
+ * @bin: the top-level pipeline that should be analyzed
+ * @details: type of #GstDebugGraphDetails to use
+ * @cookie: (inout): the topology cookie stored by the previous call, pass a
+ *     pointer to 0 to force the first snapshot
+ *
+ * Variant of gst_debug_bin_to_dot_data() for periodic monitoring. The graph
+ * is only generated when the topology of @bin changed since the call that
+ * stored @cookie, see gst_bin_get_topology_cookie(); otherwise %NULL is
+ * returned without walking the pipeline. For a pipeline in steady state this
+ * makes the snapshot cost independent of the number of elements.
+ *
+ * Returns: (transfer full) (nullable): a string containing the pipeline in
+ * graphviz dot format, or %NULL when the topology did not change.
+ *
+ * Since: 1.24
+ */
+gchar *
+gst_debug_bin_to_dot_data_if_changed (GstBin * bin,
+    GstDebugGraphDetails details, guint32 * cookie)
+{
+  guint32 current;
+
+  g_return_val_if_fail (GST_IS_BIN (bin), NULL);
+  g_return_val_if_fail (cookie != NULL, NULL);
+
+  /* read the cookie before walking the graph so that a topology change
+   * racing with the dump makes the next call dump again */
+  current = gst_bin_get_topology_cookie (bin);
+  if (*cookie == current)
+    return NULL;
+
+  *cookie = current;
+
+  return gst_debug_bin_to_dot_data (bin, details);
+}
+
 /**
  * gst_debug_bin_to_dot_file:
  * @bin: the top-level pipeline that should be analyzed
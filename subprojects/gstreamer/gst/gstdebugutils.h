@@ -64,6 +64,9 @@ typedef enum {
 GST_API
 gchar * gst_debug_bin_to_dot_data (GstBin *bin, GstDebugGraphDetails details);
 
+GST_API
+gchar * gst_debug_bin_to_dot_data_if_changed (GstBin *bin, GstDebugGraphDetails details, guint32 *cookie);
+
 GST_API
 void gst_debug_bin_to_dot_file (GstBin *bin, GstDebugGraphDetails details, const gchar *file_name);
 
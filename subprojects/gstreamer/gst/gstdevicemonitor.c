@@ -473,6 +473,22 @@ gst_device_monitor_get_devices (GstDeviceMonitor * monitor)
   return devices.head;
 }
 
+struct ProviderStart
+{
+  GstDeviceProvider *provider;
+  gboolean started;
+};
+
+static gpointer
+provider_start_func (gpointer data)
+{
+  struct ProviderStart *ps = data;
+
+  ps->started = gst_device_provider_start (ps->provider);
+
+  return NULL;
+}
+
 /**
  * gst_device_monitor_start:
  * @monitor: A #GstDeviceMonitor
@@ -481,6 +497,11 @@ gst_device_monitor_get_devices (GstDeviceMonitor * monitor)
  * %GST_MESSAGE_DEVICE_ADDED and %GST_MESSAGE_DEVICE_REMOVED messages
  * will be emitted on the bus when the list of devices changes.
  *
+ * The providers are started in parallel, so the time spent in this function
+ * is bounded by the slowest provider rather than by the sum of all of them,
+ * and %GST_MESSAGE_DEVICE_ADDED messages for the initial devices of each
+ * provider are posted as soon as that provider has finished probing.
+ *
  * Returns: %TRUE if the device monitoring could be started, i.e. at least a
  *     single device provider was started successfully.
  *
@@ -490,10 +511,9 @@ gst_device_monitor_get_devices (GstDeviceMonitor * monitor)
 gboolean
 gst_device_monitor_start (GstDeviceMonitor * monitor)
 {
-  guint i;
-  GQueue pending = G_QUEUE_INIT;
+  guint i, n_pending;
+  struct ProviderStart *pending;
   GList *started = NULL;
-  GstDeviceProvider *provider;
 
   g_return_val_if_fail (GST_IS_DEVICE_MONITOR (monitor), FALSE);
 
@@ -520,24 +540,50 @@ gst_device_monitor_start (GstDeviceMonitor * monitor)
 
   gst_bus_set_flushing (monitor->priv->bus, FALSE);
 
-  for (i = 0; i < monitor->priv->providers->len; i++) {
-    GstDeviceProvider *provider;
+  n_pending = monitor->priv->providers->len;
+  pending = g_new0 (struct ProviderStart, n_pending);
 
-    provider = g_ptr_array_index (monitor->priv->providers, i);
-    g_queue_push_tail (&pending, gst_object_ref (provider));
+  for (i = 0; i < n_pending; i++) {
+    pending[i].provider =
+        gst_object_ref (g_ptr_array_index (monitor->priv->providers, i));
   }
 
-  while ((provider = g_queue_pop_head (&pending))) {
-    GST_OBJECT_UNLOCK (monitor);
+  GST_OBJECT_UNLOCK (monitor);
 
-    if (gst_device_provider_start (provider)) {
-      started = g_list_prepend (started, provider);
-    } else {
-      gst_object_unref (provider);
+  /* Start all providers in parallel: hardware probing is typically I/O
+   * bound, so serializing it makes the application wait for the sum of
+   * all probe times. Each provider posts its initial devices on its bus
+   * as soon as its own start completes. */
+  if (n_pending > 1) {
+    GThread **threads = g_new0 (GThread *, n_pending);
+
+    for (i = 0; i < n_pending; i++) {
+      threads[i] = g_thread_try_new ("dev-prov-start", provider_start_func,
+          &pending[i], NULL);
+      /* fall back to starting in-line if thread creation failed */
+      if (threads[i] == NULL)
+        provider_start_func (&pending[i]);
     }
 
-    GST_OBJECT_LOCK (monitor);
+    for (i = 0; i < n_pending; i++) {
+      if (threads[i])
+        g_thread_join (threads[i]);
+    }
+
+    g_free (threads);
+  } else {
+    provider_start_func (&pending[0]);
+  }
+
+  for (i = 0; i < n_pending; i++) {
+    if (pending[i].started)
+      started = g_list_prepend (started, pending[i].provider);
+    else
+      gst_object_unref (pending[i].provider);
   }
+  g_free (pending);
+
+  GST_OBJECT_LOCK (monitor);
 
   if (started) {
     monitor->priv->started_providers = started;
@@ -155,6 +155,7 @@ gst_element_factory_cleanup (GstElementFactory * factory)
     gst_structure_free ((GstStructure *) factory->metadata);
     factory->metadata = NULL;
   }
+  factory->_gst_reserved[0] = NULL;
   if (factory->type) {
     factory->type = G_TYPE_INVALID;
   }
@@ -857,6 +858,46 @@ gst_element_factory_get_element_type (GstElementFactory * factory)
   return factory->type;
 }
 
+/* set the serialized metadata string for lazy deserialization. @str is
+ * not copied, it must stay valid for the lifetime of the factory; the
+ * binary registry guarantees this by keeping the cache mmapped. */
+void
+__gst_element_factory_set_meta_data_str (GstElementFactory * factory,
+    const gchar * str)
+{
+  factory->_gst_reserved[0] = (gpointer) str;
+}
+
+/* get the metadata structure, deserializing the cached string on first
+ * use. Returns NULL when the factory has no metadata. */
+GstStructure *
+__gst_element_factory_ensure_metadata (GstElementFactory * factory)
+{
+  const gchar *str;
+  GstStructure *metadata;
+
+  if (G_LIKELY (factory->metadata != NULL))
+    return (GstStructure *) factory->metadata;
+
+  if ((str = factory->_gst_reserved[0]) == NULL)
+    return NULL;
+
+  metadata = gst_structure_from_string (str, NULL);
+  if (G_UNLIKELY (metadata == NULL)) {
+    GST_ERROR_OBJECT (factory,
+        "Error deserializing structure for metadata '%s'", str);
+    factory->_gst_reserved[0] = NULL;
+    return NULL;
+  }
+
+  /* concurrent callers may both deserialize, only one result is kept */
+  if (!g_atomic_pointer_compare_and_exchange (&factory->metadata,
+          (gpointer) NULL, (gpointer) metadata))
+    gst_structure_free (metadata);
+
+  return (GstStructure *) factory->metadata;
+}
+
 /**
  * gst_element_factory_get_metadata:
  * @factory: a #GstElementFactory
@@ -873,7 +914,8 @@ gst_element_factory_get_metadata (GstElementFactory * factory,
 {
   g_return_val_if_fail (GST_IS_ELEMENT_FACTORY (factory), NULL);
 
-  return gst_structure_get_string ((GstStructure *) factory->metadata, key);
+  return gst_structure_get_string (__gst_element_factory_ensure_metadata
+      (factory), key);
 }
 
 /**
@@ -895,7 +937,7 @@ gst_element_factory_get_metadata_keys (GstElementFactory * factory)
 
   g_return_val_if_fail (GST_IS_ELEMENT_FACTORY (factory), NULL);
 
-  metadata = (GstStructure *) factory->metadata;
+  metadata = __gst_element_factory_ensure_metadata (factory);
   if (metadata == NULL)
     return NULL;
 
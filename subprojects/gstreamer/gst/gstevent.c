@@ -81,6 +81,7 @@
 #include "gstutils.h"
 #include "gstquark.h"
 #include "gstvalue.h"
+#include "gstatomicqueue.h"
 
 GType _gst_event_type = 0;
 
@@ -94,6 +95,25 @@ typedef struct
 
 #define GST_EVENT_STRUCTURE(e)  (((GstEventImpl *)(e))->structure)
 
+/* number of freed event headers kept around for recycling; segment, gap and
+ * qos events on live pipelines come and go at buffer rate */
+#define EVENT_POOL_DEPTH 64
+
+static GstAtomicQueue *_event_pool;
+
+static inline GstEventImpl *
+_gst_event_impl_alloc (void)
+{
+  GstEventImpl *event;
+
+  if (_event_pool && (event = gst_atomic_queue_pop (_event_pool))) {
+    memset (event, 0, sizeof (GstEventImpl));
+    return event;
+  }
+
+  return g_slice_new0 (GstEventImpl);
+}
+
 typedef struct
 {
   const gint type;
@@ -147,6 +167,8 @@ _priv_gst_event_initialize (void)
 
   _gst_event_type = gst_event_get_type ();
 
+  _event_pool = gst_atomic_queue_new (EVENT_POOL_DEPTH);
+
   g_type_class_ref (gst_seek_flags_get_type ());
   g_type_class_ref (gst_seek_type_get_type ());
 
@@ -155,6 +177,19 @@ _priv_gst_event_initialize (void)
   }
 }
 
+void
+_priv_gst_event_cleanup (void)
+{
+  if (_event_pool) {
+    GstEventImpl *event;
+
+    while ((event = gst_atomic_queue_pop (_event_pool)))
+      g_slice_free1 (sizeof (GstEventImpl), event);
+    gst_atomic_queue_unref (_event_pool);
+    _event_pool = NULL;
+  }
+}
+
 /**
  * gst_event_type_get_name:
  * @type: the event type
@@ -259,9 +294,13 @@ _gst_event_free (GstEvent * event)
   }
 #ifdef USE_POISONING
   memset (event, 0xff, sizeof (GstEventImpl));
-#endif
-
   g_slice_free1 (sizeof (GstEventImpl), event);
+#else
+  if (_event_pool && gst_atomic_queue_length (_event_pool) < EVENT_POOL_DEPTH)
+    gst_atomic_queue_push (_event_pool, event);
+  else
+    g_slice_free1 (sizeof (GstEventImpl), event);
+#endif
 }
 
 static void gst_event_init (GstEventImpl * event, GstEventType type);
@@ -272,7 +311,7 @@ _gst_event_copy (GstEvent * event)
   GstEventImpl *copy;
   GstStructure *s;
 
-  copy = g_slice_new0 (GstEventImpl);
+  copy = _gst_event_impl_alloc ();
 
   gst_event_init (copy, GST_EVENT_TYPE (event));
 
@@ -332,7 +371,7 @@ gst_event_new_custom (GstEventType type, GstStructure * structure)
 {
   GstEventImpl *event;
 
-  event = g_slice_new0 (GstEventImpl);
+  event = _gst_event_impl_alloc ();
 
   GST_CAT_DEBUG (GST_CAT_EVENT, "creating new event %p %s %d", event,
       gst_event_type_get_name (type), type);
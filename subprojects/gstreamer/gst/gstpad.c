@@ -136,6 +136,10 @@ struct _GstPadPrivate
 {
   guint events_cookie;
   GArray *events;
+  /* presence filter over the stored sticky event types. A clear bit
+   * guarantees absence, a set bit may be stale (cleared lazily on
+   * rebuild), so lookups of missing types can return without scanning */
+  guint64 events_mask;
   guint last_cookie;
 
   gint using;
@@ -448,6 +452,7 @@ remove_events (GstPad * pad)
 
   GST_OBJECT_FLAG_UNSET (pad, GST_PAD_FLAG_PENDING_EVENTS);
   g_array_set_size (events, 0);
+  pad->priv->events_mask = 0;
   pad->priv->events_cookie++;
 
   if (notify) {
@@ -462,6 +467,27 @@ remove_events (GstPad * pad)
 
 #define _to_sticky_order(t) gst_event_type_to_sticky_ordering(t)
 
+#define PAD_EVENT_MASK_BIT(type) \
+    (G_GUINT64_CONSTANT (1) << ((((guint) (type)) >> GST_EVENT_NUM_SHIFT) & 63))
+
+/* should be called with object lock */
+static void
+events_mask_rebuild (GstPad * pad)
+{
+  guint i, len;
+  GArray *events = pad->priv->events;
+  guint64 mask = 0;
+
+  len = events->len;
+  for (i = 0; i < len; i++) {
+    PadEvent *ev = &g_array_index (events, PadEvent, i);
+
+    if (ev->event != NULL)
+      mask |= PAD_EVENT_MASK_BIT (GST_EVENT_TYPE (ev->event));
+  }
+  pad->priv->events_mask = mask;
+}
+
 /* should be called with object lock */
 static PadEvent *
 find_event_by_type (GstPad * pad, GstEventType type, guint idx)
@@ -471,6 +497,10 @@ find_event_by_type (GstPad * pad, GstEventType type, guint idx)
   PadEvent *ev;
   guint last_sticky_order = _to_sticky_order (type);
 
+  /* a clear presence bit guarantees the type is not stored */
+  if (G_LIKELY ((pad->priv->events_mask & PAD_EVENT_MASK_BIT (type)) == 0))
+    return NULL;
+
   events = pad->priv->events;
   len = events->len;
 
@@ -544,6 +574,7 @@ remove_event_by_type (GstPad * pad, GstEventType type)
     g_array_remove_index (events, i);
     len--;
     pad->priv->events_cookie++;
+    events_mask_rebuild (pad);
     continue;
 
   next:
@@ -631,6 +662,7 @@ restart:
         g_array_remove_index (events, i);
         len--;
         cookie = ++pad->priv->events_cookie;
+        events_mask_rebuild (pad);
         continue;
       } else {
         /* function gave a new event for us */
@@ -1398,7 +1430,7 @@ cleanup_hook (GstPad * pad, GHook * hook)
     }
   }
   g_hook_destroy_link (&pad->probes, hook);
-  pad->num_probes--;
+  g_atomic_int_add (&pad->num_probes, -1);
 }
 
 /**
@@ -1461,7 +1493,7 @@ gst_pad_add_probe (GstPad * pad, GstPadProbeType mask,
 
   /* add the probe */
   g_hook_append (&pad->probes, hook);
-  pad->num_probes++;
+  g_atomic_int_inc (&pad->num_probes);
   /* incremenent cookie so that the new hook gets called */
   pad->priv->probe_list_cookie++;
 
@@ -3741,7 +3773,7 @@ already_called:
 /* a probe that does not take or return any data */
 #define PROBE_NO_DATA(pad,mask,label,defaultval)                \
   G_STMT_START {						\
-    if (G_UNLIKELY (pad->num_probes)) {				\
+    if (G_UNLIKELY (g_atomic_int_get (&pad->num_probes))) {	\
       GstFlowReturn pval = defaultval;				\
       /* pass NULL as the data item */                          \
       GstPadProbeInfo info = { mask, 0, NULL, 0, 0 };		\
@@ -3754,7 +3786,7 @@ already_called:
 
 #define PROBE_FULL(pad,mask,data,offs,size,label,handleable,handle_label) \
   G_STMT_START {							\
-    if (G_UNLIKELY (pad->num_probes)) {					\
+    if (G_UNLIKELY (g_atomic_int_get (&pad->num_probes))) {		\
       /* pass the data item */						\
       GstPadProbeInfo info = { mask, 0, data, offs, size };		\
       info.ABI.abi.flow_ret = GST_FLOW_OK;				\
@@ -4411,6 +4443,22 @@ gst_pad_chain_data_unchecked (GstPad * pad, GstPadProbeType type, void *data)
 
   GST_PAD_STREAM_LOCK (pad);
 
+  /* lock-free fast path: when no probes are installed we only need to
+   * check a few pad flags, which the slow path re-validates under the
+   * object lock. Probe installation atomically bumps num_probes before
+   * the probe can block, so probe-less pads pay a single relaxed load
+   * here instead of the object lock. */
+  if (G_LIKELY (g_atomic_int_get (&pad->num_probes) == 0) &&
+      G_LIKELY (!GST_PAD_IS_FLUSHING (pad) && !GST_PAD_IS_EOS (pad) &&
+          GST_PAD_MODE (pad) == GST_PAD_MODE_PUSH)) {
+    if (G_LIKELY ((parent = GST_OBJECT_PARENT (pad))))
+      gst_object_ref (parent);
+    else if (G_UNLIKELY (GST_PAD_NEEDS_PARENT (pad)))
+      goto slow_path;
+    goto do_chain;
+  }
+
+slow_path:
   GST_OBJECT_LOCK (pad);
   if (G_UNLIKELY (GST_PAD_IS_FLUSHING (pad)))
     goto flushing;
@@ -4445,6 +4493,7 @@ gst_pad_chain_data_unchecked (GstPad * pad, GstPadProbeType type, void *data)
   ACQUIRE_PARENT (pad, parent, no_parent);
   GST_OBJECT_UNLOCK (pad);
 
+do_chain:
   /* NOTE: we read the chainfunc unlocked.
    * we cannot hold the lock for the pad so we might send
    * the data to the wrong function. This is not really a
@@ -5380,6 +5429,9 @@ store_sticky_event (GstPad * pad, GstEvent * event)
     res = TRUE;
   }
 
+  if (res)
+    pad->priv->events_mask |= PAD_EVENT_MASK_BIT (type);
+
   if (res) {
     pad->priv->events_cookie++;
     GST_OBJECT_FLAG_SET (pad, GST_PAD_FLAG_PENDING_EVENTS);
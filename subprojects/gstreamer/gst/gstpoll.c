@@ -83,6 +83,12 @@
 #endif
 #include <sys/time.h>
 #include <sys/socket.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+/* A kernel-side persistent fd set: registrations survive across waits and
+ * a wakeup only reports the ready fds instead of scanning all of them. */
+#define GST_POLL_USE_EPOLL 1
+#endif
 #endif
 
 #ifdef G_OS_WIN32
@@ -124,6 +130,7 @@ typedef enum
   GST_POLL_MODE_PSELECT,
   GST_POLL_MODE_POLL,
   GST_POLL_MODE_PPOLL,
+  GST_POLL_MODE_EPOLL,
   GST_POLL_MODE_WINDOWS
 } GstPollMode;
 
@@ -142,6 +149,13 @@ struct _GstPoll
 #ifndef G_OS_WIN32
   GstPollFD control_read_fd;
   GstPollFD control_write_fd;
+#ifdef GST_POLL_USE_EPOLL
+  /* epoll instance, or -1 when unavailable. The registered set mirrors what
+   * was last synced into the kernel so that a rebuild only has to issue
+   * ctl calls for the fds that actually changed. */
+  gint epfd;
+  GArray *epoll_registered;
+#endif
 #else
   GArray *active_fds_ignored;
   GArray *events;
@@ -440,6 +454,13 @@ choose_mode (GstPoll * set, GstClockTime timeout)
   GstPollMode mode;
 
   if (set->mode == GST_POLL_MODE_AUTO) {
+#ifdef GST_POLL_USE_EPOLL
+    /* epoll_wait() only has millisecond timeout granularity, so it is only
+     * used for indefinite waits; timed waits keep the ns-precision ppoll
+     * path below. */
+    if (set->epfd >= 0 && timeout == GST_CLOCK_TIME_NONE)
+      return GST_POLL_MODE_EPOLL;
+#endif
 #ifdef HAVE_PPOLL
     mode = GST_POLL_MODE_PPOLL;
 #elif defined(HAVE_POLL)
@@ -464,6 +485,96 @@ choose_mode (GstPoll * set, GstClockTime timeout)
 }
 
 #ifndef G_OS_WIN32
+#ifdef GST_POLL_USE_EPOLL
+static inline guint32
+pollfd_events_to_epoll (gint events)
+{
+  guint32 ev = 0;
+
+  if (events & POLLIN)
+    ev |= EPOLLIN;
+  if (events & POLLOUT)
+    ev |= EPOLLOUT;
+  if (events & POLLPRI)
+    ev |= EPOLLPRI;
+
+  return ev;
+}
+
+static inline gint
+epoll_events_to_pollfd (guint32 ev)
+{
+  gint events = 0;
+
+  if (ev & EPOLLIN)
+    events |= POLLIN;
+  if (ev & EPOLLOUT)
+    events |= POLLOUT;
+  if (ev & EPOLLPRI)
+    events |= POLLPRI;
+  if (ev & EPOLLERR)
+    events |= POLLERR;
+  if (ev & EPOLLHUP)
+    events |= POLLHUP;
+
+  return events;
+}
+
+/* Sync the fd set registered in the kernel with set->fds, only issuing ctl
+ * calls for the fds that were added, removed or changed since the last
+ * rebuild. Must be called with the lock held. */
+static void
+gst_poll_epoll_rebuild (GstPoll * set)
+{
+  struct epoll_event ev = { 0, };
+  guint i, j;
+
+  for (i = 0; i < set->epoll_registered->len; i++) {
+    struct pollfd *rfd =
+        &g_array_index (set->epoll_registered, struct pollfd, i);
+    struct pollfd *pfd = NULL;
+
+    for (j = 0; j < set->fds->len; j++) {
+      pfd = &g_array_index (set->fds, struct pollfd, j);
+      if (pfd->fd == rfd->fd)
+        break;
+      pfd = NULL;
+    }
+
+    if (pfd == NULL) {
+      /* removal can legitimately fail when the fd was already closed */
+      epoll_ctl (set->epfd, EPOLL_CTL_DEL, rfd->fd, NULL);
+    } else if (pfd->events != rfd->events) {
+      ev.events = pollfd_events_to_epoll (pfd->events);
+      ev.data.fd = pfd->fd;
+      epoll_ctl (set->epfd, EPOLL_CTL_MOD, pfd->fd, &ev);
+    }
+  }
+
+  for (i = 0; i < set->fds->len; i++) {
+    struct pollfd *pfd = &g_array_index (set->fds, struct pollfd, i);
+    gboolean found = FALSE;
+
+    for (j = 0; j < set->epoll_registered->len && !found; j++)
+      found = g_array_index (set->epoll_registered, struct pollfd, j).fd ==
+          pfd->fd;
+
+    if (!found) {
+      ev.events = pollfd_events_to_epoll (pfd->events);
+      ev.data.fd = pfd->fd;
+      if (epoll_ctl (set->epfd, EPOLL_CTL_ADD, pfd->fd, &ev) < 0 &&
+          errno != EEXIST)
+        GST_WARNING ("%p: can't register fd %d: %s", set, pfd->fd,
+            g_strerror (errno));
+    }
+  }
+
+  g_array_set_size (set->epoll_registered, set->fds->len);
+  memcpy (set->epoll_registered->data, set->fds->data,
+      set->fds->len * sizeof (struct pollfd));
+}
+#endif /* GST_POLL_USE_EPOLL */
+
 static gint
 pollfd_to_fd_set (GstPoll * set, fd_set * readfds, fd_set * writefds,
     fd_set * errorfds)
@@ -686,6 +797,10 @@ gst_poll_new (gboolean controllable)
   nset->active_fds = g_array_new (FALSE, FALSE, sizeof (struct pollfd));
   nset->control_read_fd.fd = -1;
   nset->control_write_fd.fd = -1;
+#ifdef GST_POLL_USE_EPOLL
+  nset->epfd = epoll_create1 (EPOLL_CLOEXEC);
+  nset->epoll_registered = g_array_new (FALSE, FALSE, sizeof (struct pollfd));
+#endif
   {
     gint control_sock[2];
 
@@ -776,6 +891,11 @@ gst_poll_free (GstPoll * set)
     close (set->control_write_fd.fd);
   if (set->control_read_fd.fd >= 0)
     close (set->control_read_fd.fd);
+#ifdef GST_POLL_USE_EPOLL
+  if (set->epfd >= 0)
+    close (set->epfd);
+  g_array_free (set->epoll_registered, TRUE);
+#endif
 #else
   CloseHandle (set->wakeup_event);
 
@@ -1440,6 +1560,10 @@ gst_poll_wait (GstPoll * set, GstClockTime timeout)
       g_array_set_size (set->active_fds, set->fds->len);
       memcpy (set->active_fds->data, set->fds->data,
           set->fds->len * sizeof (struct pollfd));
+#ifdef GST_POLL_USE_EPOLL
+      if (set->epfd >= 0)
+        gst_poll_epoll_rebuild (set);
+#endif
 #else
       if (!gst_poll_prepare_winsock_active_sets (set))
         goto winsock_error;
@@ -1451,6 +1575,37 @@ gst_poll_wait (GstPoll * set, GstClockTime timeout)
       case GST_POLL_MODE_AUTO:
         g_assert_not_reached ();
         break;
+      case GST_POLL_MODE_EPOLL:
+      {
+#ifdef GST_POLL_USE_EPOLL
+        struct epoll_event events[64];
+
+        res = epoll_wait (set->epfd, events, G_N_ELEMENTS (events), -1);
+
+        if (res >= 0) {
+          gint idx;
+          guint i;
+
+          g_mutex_lock (&set->lock);
+          for (idx = 0; idx < (gint) set->active_fds->len; idx++)
+            g_array_index (set->active_fds, struct pollfd, idx).revents = 0;
+          for (i = 0; i < (guint) res; i++) {
+            GstPollFD pollfd = GST_POLL_FD_INIT;
+
+            pollfd.fd = events[i].data.fd;
+            idx = find_index (set->active_fds, &pollfd);
+            if (idx >= 0)
+              g_array_index (set->active_fds, struct pollfd, idx).revents =
+                  epoll_events_to_pollfd (events[i].events);
+          }
+          g_mutex_unlock (&set->lock);
+        }
+#else
+        g_assert_not_reached ();
+        errno = ENOSYS;
+#endif
+        break;
+      }
       case GST_POLL_MODE_PPOLL:
       {
 #ifdef HAVE_PPOLL
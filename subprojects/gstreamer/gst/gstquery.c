@@ -55,6 +55,7 @@
 
 #define GST_DISABLE_MINIOBJECT_INLINE_FUNCTIONS
 #include "gst_private.h"
+#include <string.h>             /* memset */
 #include "gstinfo.h"
 #include "gstquery.h"
 #include "gstvalue.h"
@@ -62,6 +63,7 @@
 #include "gstquark.h"
 #include "gsturi.h"
 #include "gstbufferpool.h"
+#include "gstatomicqueue.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_query_debug);
 #define GST_CAT_DEFAULT gst_query_debug
@@ -77,6 +79,24 @@ typedef struct
 
 #define GST_QUERY_STRUCTURE(q)  (((GstQueryImpl *)(q))->structure)
 
+/* number of freed query headers kept around for recycling */
+#define QUERY_POOL_DEPTH 64
+
+static GstAtomicQueue *_query_pool;
+
+static inline GstQueryImpl *
+_gst_query_impl_alloc (void)
+{
+  GstQueryImpl *query;
+
+  if (_query_pool && (query = gst_atomic_queue_pop (_query_pool))) {
+    memset (query, 0, sizeof (GstQueryImpl));
+    return query;
+  }
+
+  return g_slice_new0 (GstQueryImpl);
+}
+
 
 typedef struct
 {
@@ -119,6 +139,8 @@ _priv_gst_query_initialize (void)
 
   _gst_query_type = gst_query_get_type ();
 
+  _query_pool = gst_atomic_queue_new (QUERY_POOL_DEPTH);
+
   GST_DEBUG_CATEGORY_INIT (gst_query_debug, "query", 0, "query system");
 
   for (i = 0; query_quarks[i].name; i++) {
@@ -126,6 +148,19 @@ _priv_gst_query_initialize (void)
   }
 }
 
+void
+_priv_gst_query_cleanup (void)
+{
+  if (_query_pool) {
+    GstQueryImpl *query;
+
+    while ((query = gst_atomic_queue_pop (_query_pool)))
+      g_slice_free1 (sizeof (GstQueryImpl), query);
+    gst_atomic_queue_unref (_query_pool);
+    _query_pool = NULL;
+  }
+}
+
 /**
  * gst_query_type_get_name:
  * @type: the query type
@@ -198,9 +233,13 @@ _gst_query_free (GstQuery * query)
   }
 #ifdef USE_POISONING
   memset (query, 0xff, sizeof (GstQueryImpl));
-#endif
-
   g_slice_free1 (sizeof (GstQueryImpl), query);
+#else
+  if (_query_pool && gst_atomic_queue_length (_query_pool) < QUERY_POOL_DEPTH)
+    gst_atomic_queue_push (_query_pool, query);
+  else
+    g_slice_free1 (sizeof (GstQueryImpl), query);
+#endif
 }
 
 static GstQuery *
@@ -674,7 +713,7 @@ gst_query_new_custom (GstQueryType type, GstStructure * structure)
 {
   GstQueryImpl *query;
 
-  query = g_slice_new0 (GstQueryImpl);
+  query = _gst_query_impl_alloc ();
 
   GST_DEBUG ("creating new query %p %s", query, gst_query_type_get_name (type));
 
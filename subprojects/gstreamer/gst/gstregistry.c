@@ -1511,6 +1511,9 @@ _priv_gst_registry_cleanup (void)
   /* unref outside of the lock because we can. */
   if (registry)
     gst_object_unref (registry);
+
+  /* all features are gone now, the resident cache maps can go too */
+  priv_gst_registry_binary_cleanup_cache ();
 }
 
 /**
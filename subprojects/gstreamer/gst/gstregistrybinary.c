@@ -560,6 +560,24 @@ fail:
   return -1;
 }
 
+/* The most recently loaded caches are kept mmapped for the lifetime of
+ * the process (released in priv_gst_registry_binary_cleanup_cache()):
+ * lazily materialized feature fields keep pointing into the map, and the
+ * resident index pages are shared between processes anyway. */
+G_LOCK_DEFINE_STATIC (resident_caches);
+static GSList *resident_caches = NULL;
+
+gboolean _priv_gst_registry_binary_cache_resident = FALSE;
+
+void
+priv_gst_registry_binary_cleanup_cache (void)
+{
+  G_LOCK (resident_caches);
+  g_slist_free_full (resident_caches, (GDestroyNotify) g_mapped_file_unref);
+  resident_caches = NULL;
+  G_UNLOCK (resident_caches);
+}
+
 /**
  * gst_registry_binary_read_cache:
  * @registry: a #GstRegistry
@@ -579,6 +597,7 @@ priv_gst_registry_binary_read_cache (GstRegistry * registry,
   gsize size;
   GError *err = NULL;
   gboolean res = FALSE;
+  gboolean retain = FALSE;
   guint32 filter_env_hash = 0;
   gint check_magic_result;
 #ifndef GST_DISABLE_GST_DEBUG
@@ -652,6 +671,11 @@ priv_gst_registry_binary_read_cache (GstRegistry * registry,
     goto done;
   }
 
+  /* when mmapped, the cache stays resident and chunk loaders may keep
+   * pointers into it instead of deserializing eagerly */
+  _priv_gst_registry_binary_cache_resident = (mapped != NULL);
+  retain = (mapped != NULL);
+
   /* check if there are plugins in the file */
   if (G_UNLIKELY (!(((gsize) in + sizeof (GstRegistryChunkPluginElement)) <
               (gsize) contents + size))) {
@@ -689,8 +713,17 @@ Error:
 #ifndef GST_DISABLE_GST_DEBUG
   g_timer_destroy (timer);
 #endif
+  _priv_gst_registry_binary_cache_resident = FALSE;
   if (mapped) {
-    g_mapped_file_unref (mapped);
+    if (retain) {
+      /* keep the map alive even on partial failure, already loaded
+       * features may point into it */
+      G_LOCK (resident_caches);
+      resident_caches = g_slist_prepend (resident_caches, mapped);
+      G_UNLOCK (resident_caches);
+    } else {
+      g_mapped_file_unref (mapped);
+    }
   } else {
     g_free (contents);
   }
@@ -300,9 +300,11 @@ gst_registry_chunks_save_feature (GList ** list, GstPluginFeature * feature)
       }
     }
 
-    /* pack element metadata strings */
+    /* pack element metadata strings, materializing lazily loaded
+     * metadata first */
     gst_registry_chunks_save_string (list,
-        gst_structure_to_string (factory->metadata));
+        gst_structure_to_string (__gst_element_factory_ensure_metadata
+            (factory)));
   } else if (GST_IS_TYPE_FIND_FACTORY (feature)) {
     GstRegistryChunkTypeFindFactory *tff;
     GstTypeFindFactory *factory = GST_TYPE_FIND_FACTORY (feature);
@@ -615,12 +617,17 @@ gst_registry_chunks_load_feature (GstRegistry * registry, gchar ** in,
     /* unpack element factory strings */
     unpack_string_nocopy (*in, meta_data_str, end, fail);
     if (meta_data_str && *meta_data_str) {
-      factory->metadata = gst_structure_from_string (meta_data_str, NULL);
-      if (!factory->metadata) {
-        GST_ERROR
-            ("Error when trying to deserialize structure for metadata '%s'",
-            meta_data_str);
-        goto fail;
+      if (_priv_gst_registry_binary_cache_resident) {
+        /* the cache stays mmapped, deserialize on first use */
+        __gst_element_factory_set_meta_data_str (factory, meta_data_str);
+      } else {
+        factory->metadata = gst_structure_from_string (meta_data_str, NULL);
+        if (!factory->metadata) {
+          GST_ERROR
+              ("Error when trying to deserialize structure for metadata '%s'",
+              meta_data_str);
+          goto fail;
+        }
       }
     }
     n = ef->npadtemplates;
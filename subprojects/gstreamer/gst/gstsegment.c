@@ -865,6 +865,71 @@ gst_segment_to_running_time (const GstSegment * segment, GstFormat format,
   return -1;
 }
 
+/**
+ * gst_segment_to_running_time_batch:
+ * @segment: a #GstSegment structure.
+ * @format: the format of the segment.
+ * @positions: (array length=n_positions): the positions in the segment
+ * @running_times: (array length=n_positions) (out caller-allocates): result
+ *     running-times
+ * @n_positions: the number of positions to translate
+ *
+ * Translate an array of @positions to the total running time using the
+ * currently configured segment, as gst_segment_to_running_time() would do
+ * for each of them. Positions outside of the segment are translated to -1.
+ *
+ * Compared to calling gst_segment_to_running_time() in a loop, the segment
+ * invariants are computed only once and, for the common case of a forward
+ * segment with rate 1.0, the translation reduces to a tight loop over the
+ * array. This is useful for elements that convert the timestamps of all
+ * buffers in a buffer list at once.
+ *
+ * Since: 1.24
+ */
+void
+gst_segment_to_running_time_batch (const GstSegment * segment,
+    GstFormat format, const guint64 * positions, guint64 * running_times,
+    guint n_positions)
+{
+  guint64 seg_start, start, stop, base;
+  guint i;
+
+  g_return_if_fail (segment != NULL);
+  g_return_if_fail (segment->format == format);
+  g_return_if_fail (positions != NULL);
+  g_return_if_fail (running_times != NULL);
+
+  if (G_LIKELY (segment->rate == 1.0)) {
+    /* hoist the segment fields out of the loop, the loop body is then
+     * free of loads that the compiler cannot prove invariant and can be
+     * vectorized */
+    seg_start = segment->start;
+    start = seg_start + segment->offset;
+    stop = segment->stop;
+    base = segment->base;
+
+    for (i = 0; i < n_positions; i++) {
+      guint64 position = positions[i];
+
+      if (G_UNLIKELY (position == -1 || position < seg_start ||
+              (stop != -1 && position > stop)))
+        running_times[i] = -1;
+      else if (G_UNLIKELY (position < start))
+        /* in the offset corrected part of the segment, only positive when
+         * the base is big enough */
+        running_times[i] =
+            (base >= start - position) ? base - (start - position) : -1;
+      else
+        running_times[i] = position - start + base;
+    }
+  } else {
+    /* negative or scaled rates are not worth a fast path */
+    for (i = 0; i < n_positions; i++)
+      running_times[i] =
+          gst_segment_to_running_time (segment, format, positions[i]);
+  }
+}
+
 /**
  * gst_segment_clip:
  * @segment: a #GstSegment structure.
@@ -318,6 +318,11 @@ GST_API
 gint         gst_segment_to_running_time_full (const GstSegment *segment, GstFormat format, guint64 position,
                                                guint64 * running_time);
 
+GST_API
+void         gst_segment_to_running_time_batch (const GstSegment *segment, GstFormat format,
+                                                const guint64 *positions, guint64 *running_times,
+                                                guint n_positions);
+
 GST_DEPRECATED_FOR(gst_segment_position_from_running_time)
 guint64      gst_segment_to_position         (const GstSegment *segment, GstFormat format, guint64 running_time);
 
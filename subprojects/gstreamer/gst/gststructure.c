@@ -171,9 +171,18 @@ typedef struct
    *  else it's a pointer to the arr field. */
   GstStructureField *fields;
 
+  /* field positions sorted by quark for O(log n) lookup, only kept for
+   * structures with more than GST_STRUCTURE_INDEX_THRESHOLD fields.
+   * Maintained on mutation, so lookups on shared structures stay
+   * read-only. NULL otherwise. */
+  guint *index;
+
   GstStructureField arr[1];
 } GstStructureImpl;
 
+/* small structures are faster to scan linearly than to binary-search */
+#define GST_STRUCTURE_INDEX_THRESHOLD 8
+
 #define GST_STRUCTURE_REFCOUNT(s) (((GstStructureImpl*)(s))->parent_refcount)
 #define GST_STRUCTURE_LEN(s) (((GstStructureImpl*)(s))->fields_len)
 
@@ -190,6 +199,60 @@ typedef struct
 #define IS_TAGLIST(structure) \
     (structure->name == GST_QUARK (TAGLIST))
 
+/* Looks for @field_id in the sorted index. Returns TRUE and the position
+ * when found, otherwise FALSE and the position where it would be inserted.
+ * Only valid when the index exists. */
+static gboolean
+_structure_index_search (const GstStructureImpl * impl, GQuark field_id,
+    guint * pos)
+{
+  guint lo = 0, hi = impl->fields_len;
+
+  while (lo < hi) {
+    guint mid = (lo + hi) / 2;
+    GQuark q = impl->fields[impl->index[mid]].name;
+
+    if (q < field_id) {
+      lo = mid + 1;
+    } else if (q > field_id) {
+      hi = mid;
+    } else {
+      *pos = mid;
+      return TRUE;
+    }
+  }
+  *pos = lo;
+  return FALSE;
+}
+
+static void
+_structure_index_insert (GstStructureImpl * impl, guint field_idx)
+{
+  guint pos;
+
+  if (G_UNLIKELY (_structure_index_search (impl,
+              impl->fields[field_idx].name, &pos)))
+    g_assert_not_reached ();
+
+  memmove (&impl->index[pos + 1], &impl->index[pos],
+      (impl->fields_len - pos) * sizeof (guint));
+  impl->index[pos] = field_idx;
+}
+
+static void
+_structure_index_rebuild (GstStructureImpl * impl)
+{
+  guint i, len = impl->fields_len;
+
+  impl->index = g_new (guint, impl->fields_alloc);
+
+  impl->fields_len = 0;
+  for (i = 0; i < len; i++) {
+    _structure_index_insert (impl, i);
+    impl->fields_len++;
+  }
+}
+
 /* Replacement for g_array_append_val */
 static void
 _structure_append_val (GstStructure * s, GstStructureField * val)
@@ -213,11 +276,20 @@ _structure_append_val (GstStructure * s, GstStructureField * val)
           impl->fields_len * sizeof (GstStructureField));
       GST_CAT_LOG (GST_CAT_PERFORMANCE, "Exceeding pre-allocated array");
     }
+    if (impl->index != NULL)
+      impl->index = g_renew (guint, impl->index, want_alloc);
     impl->fields_alloc = want_alloc;
   }
 
   /* Finally set value */
-  impl->fields[impl->fields_len++] = *val;
+  impl->fields[impl->fields_len] = *val;
+
+  if (G_UNLIKELY (impl->fields_len >= GST_STRUCTURE_INDEX_THRESHOLD)) {
+    if (impl->index == NULL)
+      _structure_index_rebuild (impl);
+    _structure_index_insert (impl, impl->fields_len);
+  }
+  impl->fields_len++;
 }
 
 /* Replacement for g_array_remove_index */
@@ -230,6 +302,25 @@ _structure_remove_index (GstStructure * s, guint idx)
   if (idx >= impl->fields_len)
     return;
 
+  if (impl->index != NULL) {
+    if (impl->fields_len - 1 <= GST_STRUCTURE_INDEX_THRESHOLD) {
+      g_clear_pointer (&impl->index, g_free);
+    } else {
+      guint i, pos;
+
+      if (G_UNLIKELY (!_structure_index_search (impl,
+                  impl->fields[idx].name, &pos)))
+        g_assert_not_reached ();
+
+      memmove (&impl->index[pos], &impl->index[pos + 1],
+          (impl->fields_len - pos - 1) * sizeof (guint));
+      for (i = 0; i < impl->fields_len - 1; i++) {
+        if (impl->index[i] > idx)
+          impl->index[i]--;
+      }
+    }
+  }
+
   /* Shift everything if it's not the last item */
   if (idx != impl->fields_len)
     memmove (&impl->fields[idx],
@@ -540,6 +631,7 @@ gst_structure_free (GstStructure * structure)
   }
   if (GST_STRUCTURE_IS_USING_DYNAMIC_ARRAY (structure))
     g_free (((GstStructureImpl *) structure)->fields);
+  g_free (((GstStructureImpl *) structure)->index);
 
 #ifdef USE_POISONING
   memset (structure, 0xff, sizeof (GstStructure));
@@ -1010,9 +1102,6 @@ gst_structure_set_field (GstStructure * structure, GstStructureField * field)
 {
   GstStructureField *f;
   GType field_value_type;
-  guint i, len;
-
-  len = GST_STRUCTURE_LEN (structure);
 
   field_value_type = G_VALUE_TYPE (&field->value);
   if (field_value_type == G_TYPE_STRING) {
@@ -1063,14 +1152,11 @@ gst_structure_set_field (GstStructure * structure, GstStructureField * field)
     }
   }
 
-  for (i = 0; i < len; i++) {
-    f = GST_STRUCTURE_FIELD (structure, i);
-
-    if (G_UNLIKELY (f->name == field->name)) {
-      g_value_unset (&f->value);
-      memcpy (f, field, sizeof (GstStructureField));
-      return;
-    }
+  f = gst_structure_id_get_field (structure, field->name);
+  if (G_UNLIKELY (f != NULL)) {
+    g_value_unset (&f->value);
+    memcpy (f, field, sizeof (GstStructureField));
+    return;
   }
 
   _structure_append_val (structure, field);
@@ -1081,9 +1167,19 @@ gst_structure_set_field (GstStructure * structure, GstStructureField * field)
 static GstStructureField *
 gst_structure_id_get_field (const GstStructure * structure, GQuark field_id)
 {
+  const GstStructureImpl *impl = (const GstStructureImpl *) structure;
   GstStructureField *field;
   guint i, len;
 
+  if (impl->index != NULL) {
+    guint pos;
+
+    if (_structure_index_search (impl, field_id, &pos))
+      return GST_STRUCTURE_FIELD (structure, impl->index[pos]);
+
+    return NULL;
+  }
+
   len = GST_STRUCTURE_LEN (structure);
 
   for (i = 0; i < len; i++) {
@@ -447,6 +447,11 @@ struct _GstSystemClockPrivate
 
   GstClockType clock_type;
 
+  GstClockTime coarse_granularity;
+#if defined HAVE_POSIX_TIMERS && defined HAVE_CLOCK_GETTIME && defined CLOCK_MONOTONIC_COARSE
+  clockid_t coarse_clock_id;
+#endif
+
 #ifdef G_OS_WIN32
   LARGE_INTEGER frequency;
 #endif                          /* G_OS_WIN32 */
@@ -465,10 +470,13 @@ struct _GstSystemClockPrivate
 #define DEFAULT_CLOCK_TYPE GST_CLOCK_TYPE_MONOTONIC
 #endif
 
+#define DEFAULT_COARSE_GRANULARITY 0
+
 enum
 {
   PROP_0,
   PROP_CLOCK_TYPE,
+  PROP_COARSE_GRANULARITY,
   /* FILL ME */
 };
 
@@ -526,6 +534,29 @@ gst_system_clock_class_init (GstSystemClockClass * klass)
           GST_TYPE_CLOCK_TYPE, DEFAULT_CLOCK_TYPE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstSystemClock:coarse-granularity:
+   *
+   * The maximum amount of inaccuracy, in nanoseconds, that is acceptable
+   * when querying the clock time. When set to a non-zero value the clock
+   * may answer time queries from a coarse kernel clock that is served
+   * directly from the vDSO without a system call, as long as that clock is
+   * updated at least every coarse-granularity nanoseconds. A value of 0
+   * (the default) always uses the full resolution clock.
+   *
+   * Note that, as with #GstSystemClock:clock-type, changing this property
+   * on a clock that is in use can cause a small observed jump in the
+   * reported time.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_COARSE_GRANULARITY,
+      g_param_spec_uint64 ("coarse-granularity", "Coarse granularity",
+          "Maximum clock query inaccuracy that allows use of a coarse "
+          "syscall-free clock (0 = always use the full resolution clock)",
+          0, G_MAXUINT64, DEFAULT_COARSE_GRANULARITY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstclock_class->get_internal_time = gst_system_clock_get_internal_time;
   gstclock_class->get_resolution = gst_system_clock_get_resolution;
   gstclock_class->wait = gst_system_clock_id_wait_jitter;
@@ -547,6 +578,10 @@ gst_system_clock_init (GstSystemClock * clock)
   clock->priv = priv = gst_system_clock_get_instance_private (clock);
 
   priv->clock_type = DEFAULT_CLOCK_TYPE;
+  priv->coarse_granularity = DEFAULT_COARSE_GRANULARITY;
+#if defined HAVE_POSIX_TIMERS && defined HAVE_CLOCK_GETTIME && defined CLOCK_MONOTONIC_COARSE
+  priv->coarse_clock_id = (clockid_t) - 1;
+#endif
 
   priv->entries = NULL;
   g_cond_init (&priv->entries_changed);
@@ -627,6 +662,46 @@ gst_system_clock_dispose (GObject * object)
   }
 }
 
+/* Select the coarse clock id matching the configured clock type, but only
+ * when its actual update granularity is good enough for what was asked.
+ * The coarse posix clocks are served from the vDSO without entering the
+ * kernel, at the cost of only being updated once per kernel tick. */
+static void
+gst_system_clock_update_coarse_id (GstSystemClock * sysclock)
+{
+#if defined HAVE_POSIX_TIMERS && defined HAVE_CLOCK_GETTIME && defined CLOCK_MONOTONIC_COARSE
+  GstSystemClockPrivate *priv = sysclock->priv;
+  clockid_t coarse_id = (clockid_t) - 1;
+  struct timespec ts;
+
+  if (priv->coarse_granularity > 0) {
+    switch (priv->clock_type) {
+      case GST_CLOCK_TYPE_MONOTONIC:
+        coarse_id = CLOCK_MONOTONIC_COARSE;
+        break;
+#ifdef CLOCK_REALTIME_COARSE
+      case GST_CLOCK_TYPE_REALTIME:
+        coarse_id = CLOCK_REALTIME_COARSE;
+        break;
+#endif
+      default:
+        break;
+    }
+  }
+
+  if (coarse_id != (clockid_t) - 1 &&
+      (clock_getres (coarse_id, &ts) != 0 ||
+          GST_TIMESPEC_TO_TIME (ts) > priv->coarse_granularity)) {
+    GST_CAT_DEBUG_OBJECT (GST_CAT_CLOCK, sysclock,
+        "coarse clock resolution not within granularity %" GST_TIME_FORMAT,
+        GST_TIME_ARGS (priv->coarse_granularity));
+    coarse_id = (clockid_t) - 1;
+  }
+
+  priv->coarse_clock_id = coarse_id;
+#endif
+}
+
 static void
 gst_system_clock_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
@@ -638,6 +713,14 @@ gst_system_clock_set_property (GObject * object, guint prop_id,
       sysclock->priv->clock_type = (GstClockType) g_value_get_enum (value);
       GST_CAT_DEBUG_OBJECT (GST_CAT_CLOCK, sysclock, "clock-type set to %d",
           sysclock->priv->clock_type);
+      gst_system_clock_update_coarse_id (sysclock);
+      break;
+    case PROP_COARSE_GRANULARITY:
+      sysclock->priv->coarse_granularity = g_value_get_uint64 (value);
+      GST_CAT_DEBUG_OBJECT (GST_CAT_CLOCK, sysclock,
+          "coarse-granularity set to %" GST_TIME_FORMAT,
+          GST_TIME_ARGS (sysclock->priv->coarse_granularity));
+      gst_system_clock_update_coarse_id (sysclock);
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -655,6 +738,9 @@ gst_system_clock_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_CLOCK_TYPE:
       g_value_set_enum (value, sysclock->priv->clock_type);
       break;
+    case PROP_COARSE_GRANULARITY:
+      g_value_set_uint64 (value, sysclock->priv->coarse_granularity);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -933,7 +1019,12 @@ gst_system_clock_get_internal_time (GstClock * clock)
   clockid_t ptype;
   struct timespec ts;
 
-  ptype = clock_type_to_posix_id (sysclock->priv->clock_type);
+#ifdef CLOCK_MONOTONIC_COARSE
+  if (G_UNLIKELY (sysclock->priv->coarse_clock_id != (clockid_t) - 1))
+    ptype = sysclock->priv->coarse_clock_id;
+  else
+#endif
+    ptype = clock_type_to_posix_id (sysclock->priv->clock_type);
 
   if (G_UNLIKELY (clock_gettime (ptype, &ts)))
     return GST_CLOCK_TIME_NONE;
@@ -1014,7 +1105,12 @@ gst_system_clock_get_resolution (GstClock * clock)
     clockid_t ptype;
   struct timespec ts;
 
-  ptype = clock_type_to_posix_id (sysclock->priv->clock_type);
+#ifdef CLOCK_MONOTONIC_COARSE
+  if (G_UNLIKELY (sysclock->priv->coarse_clock_id != (clockid_t) - 1))
+    ptype = sysclock->priv->coarse_clock_id;
+  else
+#endif
+    ptype = clock_type_to_posix_id (sysclock->priv->clock_type);
 
   if (G_UNLIKELY (clock_getres (ptype, &ts)))
     return GST_CLOCK_TIME_NONE;
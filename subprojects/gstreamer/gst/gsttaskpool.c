@@ -547,3 +547,353 @@ gst_shared_task_pool_new (void)
 
   return pool;
 }
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+/* work-stealing task pool: a fixed set of workers, each with its own
+ * deque. The owner pushes and pops at the head, idle workers steal from
+ * the tail of the other queues, so hot tasks stay on the worker that
+ * produced them and the queues only contend when stealing is needed. */
+
+typedef struct
+{
+  GMutex lock;
+  GQueue queue;                 /* of SharedTaskData */
+} WsWorkerQueue;
+
+typedef struct
+{
+  GstWorkStealingTaskPool *pool;
+  guint index;
+} WsWorkerCtx;
+
+struct _GstWorkStealingTaskPoolPrivate
+{
+  guint num_workers;
+  guint64 cpu_mask;             /* 0 means no affinity is applied */
+
+  gboolean running;
+  gint pending;                 /* tasks pushed but not yet popped */
+
+  GThread **threads;
+  WsWorkerQueue *queues;
+
+  GMutex wait_lock;
+  GCond wait_cond;
+
+  guint next_worker;            /* round-robin for pushes from outside */
+};
+
+/* the WsWorkerCtx of the worker owning the calling thread, NULL for
+ * non-worker threads. The context carries the owning pool so a push into
+ * a different work-stealing pool does not use the index of this one. */
+static GPrivate ws_worker_ctx;
+
+#define GST_WORK_STEALING_TASK_POOL_CAST(pool) ((GstWorkStealingTaskPool*)(pool))
+
+G_DEFINE_TYPE_WITH_PRIVATE (GstWorkStealingTaskPool, gst_work_stealing_task_pool,
+    GST_TYPE_TASK_POOL);
+
+static void
+ws_apply_affinity (GstWorkStealingTaskPoolPrivate * priv)
+{
+#ifdef __linux__
+  cpu_set_t set;
+  guint cpu;
+
+  if (priv->cpu_mask == 0)
+    return;
+
+  CPU_ZERO (&set);
+  for (cpu = 0; cpu < 64; cpu++) {
+    if (priv->cpu_mask & (G_GUINT64_CONSTANT (1) << cpu))
+      CPU_SET (cpu, &set);
+  }
+
+  if (pthread_setaffinity_np (pthread_self (), sizeof (set), &set) != 0)
+    GST_WARNING ("failed to set worker CPU affinity mask 0x%"
+        G_GINT64_MODIFIER "x", priv->cpu_mask);
+#endif
+}
+
+static gpointer
+ws_worker_thread (WsWorkerCtx * ctx)
+{
+  GstWorkStealingTaskPool *pool = ctx->pool;
+  GstWorkStealingTaskPoolPrivate *priv = pool->priv;
+  WsWorkerQueue *own = &priv->queues[ctx->index];
+
+  g_private_set (&ws_worker_ctx, ctx);
+  ws_apply_affinity (priv);
+
+  while (TRUE) {
+    SharedTaskData *tdata;
+    guint i;
+
+    /* own queue first, newest item for cache warmth */
+    g_mutex_lock (&own->lock);
+    tdata = g_queue_pop_head (&own->queue);
+    g_mutex_unlock (&own->lock);
+
+    /* then steal the oldest item from the other workers */
+    for (i = 1; tdata == NULL && i < priv->num_workers; i++) {
+      WsWorkerQueue *victim =
+          &priv->queues[(ctx->index + i) % priv->num_workers];
+
+      g_mutex_lock (&victim->lock);
+      tdata = g_queue_pop_tail (&victim->queue);
+      g_mutex_unlock (&victim->lock);
+    }
+
+    if (tdata == NULL) {
+      gboolean running;
+
+      g_mutex_lock (&priv->wait_lock);
+      while (priv->running && g_atomic_int_get (&priv->pending) == 0)
+        g_cond_wait (&priv->wait_cond, &priv->wait_lock);
+      running = priv->running;
+      g_mutex_unlock (&priv->wait_lock);
+
+      /* drain remaining tasks before shutting down */
+      if (!running && g_atomic_int_get (&priv->pending) == 0)
+        break;
+
+      continue;
+    }
+
+    g_atomic_int_add (&priv->pending, -1);
+
+    /* runs the task, signals joiners and drops the queue ref */
+    shared_func (tdata, GST_TASK_POOL_CAST (pool));
+  }
+
+  g_slice_free (WsWorkerCtx, ctx);
+
+  return NULL;
+}
+
+static void
+ws_prepare (GstTaskPool * pool, GError ** error)
+{
+  GstWorkStealingTaskPool *ws = GST_WORK_STEALING_TASK_POOL_CAST (pool);
+  GstWorkStealingTaskPoolPrivate *priv = ws->priv;
+  guint i;
+
+  GST_OBJECT_LOCK (pool);
+  if (priv->threads != NULL)
+    goto done;
+
+  priv->queues = g_new0 (WsWorkerQueue, priv->num_workers);
+  for (i = 0; i < priv->num_workers; i++) {
+    g_mutex_init (&priv->queues[i].lock);
+    g_queue_init (&priv->queues[i].queue);
+  }
+
+  priv->running = TRUE;
+  priv->threads = g_new0 (GThread *, priv->num_workers);
+  for (i = 0; i < priv->num_workers; i++) {
+    WsWorkerCtx *ctx = g_slice_new (WsWorkerCtx);
+    gchar *name = g_strdup_printf ("ws-pool-%u", i);
+
+    ctx->pool = ws;
+    ctx->index = i;
+    priv->threads[i] =
+        g_thread_try_new (name, (GThreadFunc) ws_worker_thread, ctx, error);
+    g_free (name);
+
+    if (priv->threads[i] == NULL) {
+      g_slice_free (WsWorkerCtx, ctx);
+      priv->num_workers = i;
+      break;
+    }
+  }
+
+done:
+  GST_OBJECT_UNLOCK (pool);
+}
+
+static void
+ws_cleanup (GstTaskPool * pool)
+{
+  GstWorkStealingTaskPool *ws = GST_WORK_STEALING_TASK_POOL_CAST (pool);
+  GstWorkStealingTaskPoolPrivate *priv = ws->priv;
+  GThread **threads;
+  guint i, num;
+
+  GST_OBJECT_LOCK (pool);
+  threads = priv->threads;
+  priv->threads = NULL;
+  num = priv->num_workers;
+  GST_OBJECT_UNLOCK (pool);
+
+  if (threads == NULL)
+    return;
+
+  g_mutex_lock (&priv->wait_lock);
+  priv->running = FALSE;
+  g_cond_broadcast (&priv->wait_cond);
+  g_mutex_unlock (&priv->wait_lock);
+
+  /* workers drain their queues before exiting */
+  for (i = 0; i < num; i++)
+    g_thread_join (threads[i]);
+  g_free (threads);
+
+  for (i = 0; i < num; i++)
+    g_mutex_clear (&priv->queues[i].lock);
+  g_free (priv->queues);
+  priv->queues = NULL;
+}
+
+static gpointer
+ws_push (GstTaskPool * pool, GstTaskPoolFunction func, gpointer user_data,
+    GError ** error)
+{
+  GstWorkStealingTaskPool *ws = GST_WORK_STEALING_TASK_POOL_CAST (pool);
+  GstWorkStealingTaskPoolPrivate *priv = ws->priv;
+  SharedTaskData *ret = NULL;
+  WsWorkerQueue *q;
+  WsWorkerCtx *ctx;
+
+  GST_OBJECT_LOCK (pool);
+  if (priv->threads == NULL) {
+    GST_OBJECT_UNLOCK (pool);
+    g_set_error_literal (error, GST_CORE_ERROR, GST_CORE_ERROR_FAILED,
+        "No thread pool");
+    return NULL;
+  }
+
+  ret = g_slice_new (SharedTaskData);
+  ret->done = FALSE;
+  ret->func = func;
+  ret->user_data = user_data;
+  g_atomic_int_set (&ret->refcount, 1);
+  g_cond_init (&ret->done_cond);
+  g_mutex_init (&ret->done_lock);
+
+  /* tasks pushed from a worker of this pool stay on its queue until
+   * stolen; pushes from other threads, including workers of other
+   * pools, are distributed round-robin */
+  ctx = g_private_get (&ws_worker_ctx);
+  if (ctx != NULL && ctx->pool == ws)
+    q = &priv->queues[ctx->index];
+  else
+    q = &priv->queues[priv->next_worker++ % priv->num_workers];
+  GST_OBJECT_UNLOCK (pool);
+
+  g_mutex_lock (&q->lock);
+  g_queue_push_head (&q->queue, shared_task_data_ref (ret));
+  g_mutex_unlock (&q->lock);
+
+  g_mutex_lock (&priv->wait_lock);
+  g_atomic_int_inc (&priv->pending);
+  g_cond_signal (&priv->wait_cond);
+  g_mutex_unlock (&priv->wait_lock);
+
+  return ret;
+}
+
+static void
+gst_work_stealing_task_pool_class_init (GstWorkStealingTaskPoolClass * klass)
+{
+  GstTaskPoolClass *taskpoolclass = GST_TASK_POOL_CLASS (klass);
+
+  taskpoolclass->prepare = ws_prepare;
+  taskpoolclass->cleanup = ws_cleanup;
+  taskpoolclass->push = ws_push;
+  taskpoolclass->join = shared_join;
+  taskpoolclass->dispose_handle = shared_dispose_handle;
+}
+
+static void
+gst_work_stealing_task_pool_init (GstWorkStealingTaskPool * pool)
+{
+  GstWorkStealingTaskPoolPrivate *priv;
+
+  priv = pool->priv =
+      gst_work_stealing_task_pool_get_instance_private (pool);
+  priv->num_workers = MAX (g_get_num_processors (), 1);
+  g_mutex_init (&priv->wait_lock);
+  g_cond_init (&priv->wait_cond);
+}
+
+/**
+ * gst_work_stealing_task_pool_new:
+ * @num_workers: number of worker threads, 0 for one per processor
+ *
+ * Create a new work-stealing task pool. The pool runs tasks on a fixed
+ * set of worker threads with one task deque per worker; idle workers
+ * steal from the other queues. This keeps the thread count bounded for
+ * pipelines with many cooperatively scheduled tasks.
+ *
+ * As with #GstSharedTaskPool, do not use this pool for potentially
+ * inter-dependent tasks such as pad tasks of a leaf source that blocks
+ * waiting for another task in the same pool.
+ *
+ * Returns: (transfer full): a new #GstWorkStealingTaskPool.
+ * gst_object_unref() after usage.
+ *
+ * Since: 1.24
+ */
+GstTaskPool *
+gst_work_stealing_task_pool_new (guint num_workers)
+{
+  GstTaskPool *pool;
+
+  pool = g_object_new (GST_TYPE_WORK_STEALING_TASK_POOL, NULL);
+
+  if (num_workers != 0)
+    GST_WORK_STEALING_TASK_POOL_CAST (pool)->priv->num_workers = num_workers;
+
+  /* clear floating flag */
+  gst_object_ref_sink (pool);
+
+  return pool;
+}
+
+/**
+ * gst_work_stealing_task_pool_set_affinity_mask:
+ * @pool: a #GstWorkStealingTaskPool
+ * @cpu_mask: bitmask of processors the workers may run on, 0 for no
+ *            affinity
+ *
+ * Restrict the worker threads of @pool to the processors in @cpu_mask.
+ * Must be called before gst_task_pool_prepare(); the mask is applied
+ * when the workers start. Only implemented on Linux, a no-op elsewhere.
+ *
+ * Since: 1.24
+ */
+void
+gst_work_stealing_task_pool_set_affinity_mask (GstWorkStealingTaskPool * pool,
+    guint64 cpu_mask)
+{
+  g_return_if_fail (GST_IS_WORK_STEALING_TASK_POOL (pool));
+
+  GST_OBJECT_LOCK (pool);
+  pool->priv->cpu_mask = cpu_mask;
+  GST_OBJECT_UNLOCK (pool);
+}
+
+/**
+ * gst_work_stealing_task_pool_get_affinity_mask:
+ * @pool: a #GstWorkStealingTaskPool
+ *
+ * Returns: the configured worker CPU affinity mask, 0 when unset
+ *
+ * Since: 1.24
+ */
+guint64
+gst_work_stealing_task_pool_get_affinity_mask (GstWorkStealingTaskPool * pool)
+{
+  guint64 ret;
+
+  g_return_val_if_fail (GST_IS_WORK_STEALING_TASK_POOL (pool), 0);
+
+  GST_OBJECT_LOCK (pool);
+  ret = pool->priv->cpu_mask;
+  GST_OBJECT_UNLOCK (pool);
+
+  return ret;
+}
@@ -839,15 +839,48 @@ gst_util_uint64_scale_int_ceil (guint64 val, gint num, gint denom)
  * overflow at some point. Use gst_util_seqnum_compare() to make sure
  * you handle wraparound correctly.
  */
+static gint seqnum_counter = 1;
+
 guint32
 gst_util_seqnum_next (void)
 {
-  static gint counter = 1;
-  gint ret = g_atomic_int_add (&counter, 1);
+  gint ret = g_atomic_int_add (&seqnum_counter, 1);
 
   /* Make sure we don't return 0 */
   if (G_UNLIKELY (ret == GST_SEQNUM_INVALID))
-    ret = g_atomic_int_add (&counter, 1);
+    ret = g_atomic_int_add (&seqnum_counter, 1);
+
+  return ret;
+}
+
+/**
+ * gst_util_seqnum_next_n:
+ * @num: the number of sequence numbers to reserve
+ *
+ * Reserve @num consecutive sequence numbers with a single atomic operation
+ * and return the first of them. This is cheaper than calling
+ * gst_util_seqnum_next() @num times when tagging a batch of events or
+ * messages, for example when processing a buffer list.
+ *
+ * None of the returned sequence numbers is %GST_SEQNUM_INVALID (which is 0).
+ *
+ * Returns: the first of @num consecutive 32-bit unsigned integers, which
+ * might overflow at some point. Use gst_util_seqnum_compare() to make sure
+ * you handle wraparound correctly.
+ *
+ * Since: 1.24
+ */
+guint32
+gst_util_seqnum_next_n (guint num)
+{
+  guint32 ret;
+
+  g_return_val_if_fail (num > 0 && num < G_MAXINT32, GST_SEQNUM_INVALID);
+
+  do {
+    ret = g_atomic_int_add (&seqnum_counter, num);
+    /* retry when the reserved range would wrap over 0 */
+  } while (G_UNLIKELY ((guint32) (GST_SEQNUM_INVALID - ret) < num));
 
   return ret;
 }
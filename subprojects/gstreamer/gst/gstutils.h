@@ -114,6 +114,9 @@ guint64         gst_util_uint64_scale_int_ceil  (guint64 val, gint num, gint den
 GST_API
 guint32         gst_util_seqnum_next            (void);
 
+GST_API
+guint32         gst_util_seqnum_next_n          (guint num);
+
 GST_API
 gint32          gst_util_seqnum_compare         (guint32 s1, guint32 s2);
 
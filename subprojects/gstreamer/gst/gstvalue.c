@@ -6550,6 +6550,20 @@ gst_value_init_and_copy (GValue * dest, const GValue * src)
     return;
   }
 
+  /* Values that live entirely inside the GValue (no pointers to owned
+   * memory) can be copied with a plain struct assignment, skipping the
+   * g_value_init()/g_value_copy() table dispatch. These types make up the
+   * bulk of caps fields, so this shows up in caps copying profiles. */
+  if (type == G_TYPE_INT || type == G_TYPE_BOOLEAN || type == G_TYPE_UINT
+      || type == G_TYPE_INT64 || type == G_TYPE_UINT64
+      || type == G_TYPE_DOUBLE || type == G_TYPE_FLOAT
+      || type == GST_TYPE_FRACTION || type == GST_TYPE_INT_RANGE
+      || type == GST_TYPE_DOUBLE_RANGE || type == GST_TYPE_BITMASK
+      || type == GST_TYPE_FLAG_SET) {
+    *dest = *src;
+    return;
+  }
+
   g_value_init (dest, type);
   g_value_copy (src, dest);
 }
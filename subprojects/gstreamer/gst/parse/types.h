@@ -38,6 +38,8 @@ struct _graph_t {
   GError **error;
   GstParseContext *ctx; /* may be NULL */
   GstParseFlags flags;
+  GHashTable *factories; /* factory name -> loaded GstElementFactory,
+                          * valid for the duration of one parse */
 };
 
 
@@ -170,6 +170,13 @@ struct _GstAdapter
   guint64 distance_from_discont;
 
   GstMapInfo info;
+
+  /* state of the scatter-gather map */
+  GstMemory **range_mems;
+  GstMapInfo *range_infos;      /* the mappings, used for unmapping */
+  GstMapInfo *range_views;      /* trimmed views handed to the caller */
+  guint n_ranges;
+  guint ranges_alloc;
 };
 
 struct _GstAdapterClass
@@ -228,6 +235,9 @@ gst_adapter_finalize (GObject * object)
   GstAdapter *adapter = GST_ADAPTER (object);
 
   g_free (adapter->assembled_data);
+  g_free (adapter->range_mems);
+  g_free (adapter->range_infos);
+  g_free (adapter->range_views);
 
   gst_queue_array_free (adapter->bufqueue);
 
@@ -261,6 +271,8 @@ gst_adapter_clear (GstAdapter * adapter)
 
   if (adapter->info.memory)
     gst_adapter_unmap (adapter);
+  if (adapter->n_ranges > 0)
+    gst_adapter_unmap_ranges (adapter);
 
   while ((obj = gst_queue_array_pop_head (adapter->bufqueue)))
     gst_mini_object_unref (obj);
@@ -575,6 +587,148 @@ gst_adapter_unmap (GstAdapter * adapter)
   }
 }
 
+/* add one mapped memory to the scatter-gather state, growing the arrays
+ * when needed. @skip and @size trim the view handed to the caller. */
+static void
+gst_adapter_add_range (GstAdapter * adapter, GstMemory * mem,
+    const GstMapInfo * info, gsize skip, gsize size)
+{
+  GstMapInfo view;
+
+  if (G_UNLIKELY (adapter->n_ranges == adapter->ranges_alloc)) {
+    adapter->ranges_alloc = MAX (adapter->ranges_alloc * 2, 16);
+    adapter->range_mems = g_renew (GstMemory *, adapter->range_mems,
+        adapter->ranges_alloc);
+    adapter->range_infos = g_renew (GstMapInfo, adapter->range_infos,
+        adapter->ranges_alloc);
+    adapter->range_views = g_renew (GstMapInfo, adapter->range_views,
+        adapter->ranges_alloc);
+  }
+
+  view = *info;
+  view.data += skip;
+  view.size = size;
+
+  adapter->range_mems[adapter->n_ranges] = gst_memory_ref (mem);
+  adapter->range_infos[adapter->n_ranges] = *info;
+  adapter->range_views[adapter->n_ranges] = view;
+  adapter->n_ranges++;
+}
+
+/**
+ * gst_adapter_map_ranges:
+ * @adapter: a #GstAdapter
+ * @offset: the bytes offset in the adapter to start from
+ * @size: the number of bytes to map
+ * @n_ranges: (out): number of entries in the returned array
+ *
+ * Maps @size bytes starting at @offset as a scatter-gather list of
+ * memory ranges, without assembling them into one contiguous allocation.
+ * Each entry of the returned array describes one contiguous region;
+ * together the regions cover exactly @size bytes in order. Only the
+ * @data and @size fields of the entries should be used.
+ *
+ * Unlike gst_adapter_map(), no copying takes place when the requested
+ * range spans buffers or memories, which makes this function suitable
+ * for parsers that scan large windows of the adapter repeatedly.
+ *
+ * The returned array is valid until the next function is called on the
+ * adapter. Use gst_adapter_unmap_ranges() to release the memory ranges
+ * again.
+ *
+ * Returns %NULL if @offset + @size bytes are not available.
+ *
+ * Returns: (transfer none) (array length=n_ranges) (nullable): an array
+ *     of memory ranges covering the requested bytes, or %NULL
+ *
+ * Since: 1.24
+ */
+const GstMapInfo *
+gst_adapter_map_ranges (GstAdapter * adapter, gsize offset, gsize size,
+    guint * n_ranges)
+{
+  GstBuffer *buf;
+  gsize skip, left;
+  guint idx, len;
+
+  g_return_val_if_fail (GST_IS_ADAPTER (adapter), NULL);
+  g_return_val_if_fail (size > 0, NULL);
+  g_return_val_if_fail (n_ranges != NULL, NULL);
+
+  if (adapter->n_ranges > 0)
+    gst_adapter_unmap_ranges (adapter);
+
+  if (G_UNLIKELY (offset + size > adapter->size))
+    return NULL;
+
+  skip = offset + adapter->skip;
+  left = size;
+
+  idx = 0;
+  len = gst_queue_array_get_length (adapter->bufqueue);
+
+  while (left > 0 && idx < len) {
+    guint i, n_mem;
+
+    buf = gst_queue_array_peek_nth (adapter->bufqueue, idx++);
+    n_mem = gst_buffer_n_memory (buf);
+
+    for (i = 0; i < n_mem && left > 0; i++) {
+      GstMemory *mem = gst_buffer_peek_memory (buf, i);
+      GstMapInfo info;
+      gsize msize, take;
+
+      msize = gst_memory_get_sizes (mem, NULL, NULL);
+      if (skip >= msize) {
+        skip -= msize;
+        continue;
+      }
+      if (!gst_memory_map (mem, &info, GST_MAP_READ))
+        goto map_failed;
+
+      take = MIN (info.size - skip, left);
+      gst_adapter_add_range (adapter, mem, &info, skip, take);
+      left -= take;
+      skip = 0;
+    }
+  }
+
+  *n_ranges = adapter->n_ranges;
+
+  return adapter->range_views;
+
+  /* ERRORS */
+map_failed:
+  {
+    GST_LOG_OBJECT (adapter, "failure mapping memory, releasing ranges");
+    gst_adapter_unmap_ranges (adapter);
+    return NULL;
+  }
+}
+
+/**
+ * gst_adapter_unmap_ranges:
+ * @adapter: a #GstAdapter
+ *
+ * Releases the memory ranges obtained with the last
+ * gst_adapter_map_ranges().
+ *
+ * Since: 1.24
+ */
+void
+gst_adapter_unmap_ranges (GstAdapter * adapter)
+{
+  guint i;
+
+  g_return_if_fail (GST_IS_ADAPTER (adapter));
+
+  for (i = 0; i < adapter->n_ranges; i++) {
+    gst_memory_unmap (adapter->range_mems[i], &adapter->range_infos[i]);
+    gst_memory_unref (adapter->range_mems[i]);
+  }
+  adapter->n_ranges = 0;
+}
+
 /**
  * gst_adapter_copy: (skip)
  * @adapter: a #GstAdapter
@@ -635,6 +789,8 @@ gst_adapter_flush_unchecked (GstAdapter * adapter, gsize flush)
 
   if (adapter->info.memory)
     gst_adapter_unmap (adapter);
+  if (adapter->n_ranges > 0)
+    gst_adapter_unmap_ranges (adapter);
 
   /* clear state */
   adapter->size -= flush;
@@ -1791,3 +1947,98 @@ gst_adapter_masked_scan_uint32 (GstAdapter * adapter, guint32 mask,
   return gst_adapter_masked_scan_uint32_peek (adapter, mask, pattern, offset,
       size, NULL);
 }
+
+/**
+ * gst_adapter_memchr:
+ * @adapter: a #GstAdapter
+ * @value: the byte to scan for
+ * @offset: offset into the adapter data from which to start scanning
+ * @size: number of bytes to scan from offset
+ *
+ * Scan for the first occurrence of @value in the adapter data, starting
+ * from offset @offset. The scan walks the buffers in place and uses the
+ * C runtime memchr() on each contiguous region, so no data is copied or
+ * assembled.
+ *
+ * It is an error to call this function without making sure that there is
+ * enough data (offset+size bytes) in the adapter.
+ *
+ * Returns: offset of the first occurrence, or -1 if @value was not found.
+ *
+ * Since: 1.24
+ */
+gssize
+gst_adapter_memchr (GstAdapter * adapter, guint8 value, gsize offset,
+    gsize size)
+{
+  gsize skip, bsize;
+  GstMapInfo info;
+  guint8 *bdata, *found;
+  GstBuffer *buf;
+  guint idx;
+
+  g_return_val_if_fail (size > 0, -1);
+  g_return_val_if_fail (offset + size <= adapter->size, -1);
+
+  skip = offset + adapter->skip;
+
+  /* first step, do skipping and position on the first buffer */
+  /* optimistically assume scanning continues sequentially */
+  if (adapter->scan_entry_idx != G_MAXUINT && (adapter->scan_offset <= skip)) {
+    idx = adapter->scan_entry_idx;
+    skip -= adapter->scan_offset;
+  } else {
+    idx = 0;
+    adapter->scan_offset = 0;
+    adapter->scan_entry_idx = G_MAXUINT;
+  }
+  buf = gst_queue_array_peek_nth (adapter->bufqueue, idx++);
+  bsize = gst_buffer_get_size (buf);
+  while (G_UNLIKELY (skip >= bsize)) {
+    skip -= bsize;
+    adapter->scan_offset += bsize;
+    adapter->scan_entry_idx = idx;
+    buf = gst_queue_array_peek_nth (adapter->bufqueue, idx++);
+    bsize = gst_buffer_get_size (buf);
+  }
+  /* get the data now */
+  if (!gst_buffer_map (buf, &info, GST_MAP_READ))
+    return -1;
+
+  bdata = (guint8 *) info.data + skip;
+  bsize = info.size - skip;
+  skip = 0;
+
+  /* now find data */
+  do {
+    bsize = MIN (bsize, size);
+    found = memchr (bdata, value, bsize);
+    if (found != NULL) {
+      gssize ret = offset + skip + (found - bdata);
+
+      gst_buffer_unmap (buf, &info);
+      return ret;
+    }
+    size -= bsize;
+    if (size == 0)
+      break;
+
+    /* nothing found yet, go to next buffer */
+    skip += bsize;
+    adapter->scan_offset += info.size;
+    adapter->scan_entry_idx = idx;
+    gst_buffer_unmap (buf, &info);
+    buf = gst_queue_array_peek_nth (adapter->bufqueue, idx++);
+
+    if (!gst_buffer_map (buf, &info, GST_MAP_READ))
+      return -1;
+
+    bsize = info.size;
+    bdata = info.data;
+  } while (TRUE);
+
+  gst_buffer_unmap (buf, &info);
+
+  /* nothing found */
+  return -1;
+}
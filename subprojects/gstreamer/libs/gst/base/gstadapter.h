@@ -66,6 +66,12 @@ gconstpointer           gst_adapter_map                 (GstAdapter *adapter, gs
 GST_BASE_API
 void                    gst_adapter_unmap               (GstAdapter *adapter);
 
+GST_BASE_API
+const GstMapInfo *      gst_adapter_map_ranges          (GstAdapter *adapter, gsize offset,
+                                                         gsize size, guint *n_ranges);
+GST_BASE_API
+void                    gst_adapter_unmap_ranges        (GstAdapter *adapter);
+
 GST_BASE_API
 void                    gst_adapter_copy                (GstAdapter *adapter, gpointer dest,
                                                          gsize offset, gsize size);
@@ -141,6 +147,9 @@ gssize                  gst_adapter_masked_scan_uint32  (GstAdapter * adapter, g
 GST_BASE_API
 gssize                  gst_adapter_masked_scan_uint32_peek  (GstAdapter * adapter, guint32 mask,
                                                          guint32 pattern, gsize offset, gsize size, guint32 * value);
+GST_BASE_API
+gssize                  gst_adapter_memchr              (GstAdapter * adapter, guint8 value,
+                                                         gsize offset, gsize size);
 
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GstAdapter, gst_object_unref)
 
@@ -185,16 +185,21 @@ GST_DEBUG_CATEGORY_STATIC (aggregator_debug);
 #define PAD_WAIT_EVENT(pad)   G_STMT_START {                            \
   GST_LOG_OBJECT (pad, "Waiting for buffer to be consumed thread %p",   \
         g_thread_self());                                               \
+  ((GstAggregatorPad *)pad)->priv->num_waiting++;                       \
   g_cond_wait(&(((GstAggregatorPad* )pad)->priv->event_cond),           \
       (&((GstAggregatorPad*)pad)->priv->lock));                         \
+  ((GstAggregatorPad *)pad)->priv->num_waiting--;                       \
   GST_LOG_OBJECT (pad, "DONE Waiting for buffer to be consumed on thread %p", \
         g_thread_self());                                               \
   } G_STMT_END
 
+/* only does the (potentially syscalling) broadcast when someone is actually
+ * waiting, which keeps the per-buffer consumed signalling cheap */
 #define PAD_BROADCAST_EVENT(pad) G_STMT_START {                        \
   GST_LOG_OBJECT (pad, "Signaling buffer consumed from thread %p",     \
         g_thread_self());                                              \
-  g_cond_broadcast(&(((GstAggregatorPad* )pad)->priv->event_cond));    \
+  if (((GstAggregatorPad *)pad)->priv->num_waiting > 0)                \
+    g_cond_broadcast(&(((GstAggregatorPad* )pad)->priv->event_cond));  \
   } G_STMT_END
 
 
@@ -233,17 +238,23 @@ GST_DEBUG_CATEGORY_STATIC (aggregator_debug);
 #define SRC_WAIT(self) G_STMT_START {                               \
   GST_LOG_OBJECT (self, "Waiting for src on thread %p",             \
         g_thread_self());                                           \
+  self->priv->src_waiting++;                                        \
   g_cond_wait(&(self->priv->src_cond), &(self->priv->src_lock));    \
+  self->priv->src_waiting--;                                        \
   GST_LOG_OBJECT (self, "DONE Waiting for src on thread %p",        \
         g_thread_self());                                           \
   } G_STMT_END
 
+/* the srcpad task either waits on the cond or on the clock, so only
+ * broadcast when it is actually in SRC_WAIT; that avoids one wakeup
+ * syscall for every single queued buffer on the sink pads */
 #define SRC_BROADCAST(self) G_STMT_START {                          \
     GST_LOG_OBJECT (self, "Signaling src from thread %p",           \
         g_thread_self());                                           \
     if (self->priv->aggregate_id)                                   \
       gst_clock_id_unschedule (self->priv->aggregate_id);           \
-    g_cond_broadcast(&(self->priv->src_cond));                      \
+    if (self->priv->src_waiting > 0)                                \
+      g_cond_broadcast(&(self->priv->src_cond));                    \
   } G_STMT_END
 
 struct _GstAggregatorPadPrivate
@@ -279,6 +290,8 @@ struct _GstAggregatorPadPrivate
 
   GMutex lock;
   GCond event_cond;
+  /* number of threads inside PAD_WAIT_EVENT */
+  guint num_waiting;
   /* This lock prevents a flush start processing happening while
    * the chain function is also happening.
    */
@@ -395,6 +408,7 @@ struct _GstAggregatorPrivate
   gboolean selected_samples_called_or_warned;   /* protected by src_lock */
   GMutex src_lock;
   GCond src_cond;
+  guint src_waiting;            /* threads inside SRC_WAIT, protected by src_lock */
 
   gboolean first_buffer;        /* protected by object lock */
   GstAggregatorStartTimeSelection start_time_selection;
@@ -832,8 +846,8 @@ gst_aggregator_wait_and_check (GstAggregator * self, gboolean * timeout)
 
   SRC_LOCK (self);
 
-  latency = gst_aggregator_get_latency_unlocked (self);
-
+  /* optimistic busy path: when all pads are live and have data queued we
+   * can aggregate right away, without looking at latency or the clock */
   if (gst_aggregator_check_pads_ready (self, &have_event_or_query)) {
     GST_DEBUG_OBJECT (self, "all pads have data");
     SRC_UNLOCK (self);
@@ -856,8 +870,25 @@ gst_aggregator_wait_and_check (GstAggregator * self, gboolean * timeout)
     return FALSE;
   }
 
+  latency = gst_aggregator_get_latency_unlocked (self);
   start = gst_aggregator_get_next_time (self);
 
+  /* querying the latency above may have temporarily released the SRC_LOCK,
+   * in which case pads may have become ready or queued an event without us
+   * noticing; check once more before committing to a wait */
+  if (gst_aggregator_check_pads_ready (self, &have_event_or_query)) {
+    GST_DEBUG_OBJECT (self, "all pads have data");
+    SRC_UNLOCK (self);
+
+    return TRUE;
+  }
+
+  if (have_event_or_query) {
+    GST_DEBUG_OBJECT (self, "Have serialized event or query to handle first");
+    SRC_UNLOCK (self);
+    return FALSE;
+  }
+
   /* If we're not live, or if we use the running time
    * of the first buffer as start time, we wait until
    * all pads have buffers.
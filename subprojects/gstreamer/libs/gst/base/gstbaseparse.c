@@ -337,6 +337,15 @@ struct _GstBaseParsePrivate
   /* When we need to skip more data than we have currently */
   guint skip;
 
+  /* number of output frames to collect into one buffer list push,
+   * 0 or 1 disables batching */
+  guint batch_frames;
+  /* output frames collected so far for the next batched push */
+  GstBufferList *batch;
+
+  /* input verified as properly framed; fast passthrough */
+  gboolean bypass;
+
   /* Tag handling (stream tags only, global tags are passed through as-is) */
   GstTagList *upstream_tags;
   GstTagList *parser_tags;
@@ -474,6 +483,7 @@ static GstFlowReturn gst_base_parse_start_fragment (GstBaseParse * parse);
 static GstFlowReturn gst_base_parse_finish_fragment (GstBaseParse * parse,
     gboolean prev_head);
 static GstFlowReturn gst_base_parse_send_buffers (GstBaseParse * parse);
+static GstFlowReturn gst_base_parse_push_batch (GstBaseParse * parse);
 
 static inline GstFlowReturn gst_base_parse_check_sync (GstBaseParse * parse);
 
@@ -839,6 +849,8 @@ gst_base_parse_reset (GstBaseParse * parse)
   parse->priv->next_dts = 0;
   parse->priv->syncable = TRUE;
   parse->priv->passthrough = FALSE;
+  parse->priv->bypass = FALSE;
+  parse->priv->batch_frames = 0;
   parse->priv->pts_interpolate = TRUE;
   parse->priv->infer_ts = TRUE;
   parse->priv->has_timing_info = FALSE;
@@ -876,6 +888,11 @@ gst_base_parse_reset (GstBaseParse * parse)
     parse->priv->cache = NULL;
   }
 
+  if (parse->priv->batch) {
+    gst_buffer_list_unref (parse->priv->batch);
+    parse->priv->batch = NULL;
+  }
+
   g_slist_foreach (parse->priv->pending_seeks, (GFunc) g_free, NULL);
   g_slist_free (parse->priv->pending_seeks);
   parse->priv->pending_seeks = NULL;
@@ -2334,6 +2351,31 @@ gst_base_parse_handle_buffer (GstBaseParse * parse, GstBuffer * buffer,
   return ret;
 }
 
+/* gst_base_parse_push_batch:
+ * @parse: #GstBaseParse
+ *
+ * Pushes the output frames collected so far downstream as one buffer list.
+ */
+static GstFlowReturn
+gst_base_parse_push_batch (GstBaseParse * parse)
+{
+  GstBufferList *list;
+  GstFlowReturn ret;
+
+  list = parse->priv->batch;
+  if (list == NULL)
+    return GST_FLOW_OK;
+
+  parse->priv->batch = NULL;
+
+  GST_LOG_OBJECT (parse, "pushing batch of %u frames now..",
+      gst_buffer_list_length (list));
+  ret = gst_pad_push_list (parse->srcpad, list);
+  GST_LOG_OBJECT (parse, "batch pushed, flow %s", gst_flow_get_name (ret));
+
+  return ret;
+}
+
 /* gst_base_parse_push_pending_events:
  * @parse: #GstBaseParse
  *
@@ -2346,6 +2388,9 @@ gst_base_parse_push_pending_events (GstBaseParse * parse)
     GList *r = g_list_reverse (parse->priv->pending_events);
     GList *l;
 
+    /* collected output frames precede these events in the stream */
+    gst_base_parse_push_batch (parse);
+
     parse->priv->pending_events = NULL;
     for (l = r; l != NULL; l = l->next) {
       gst_pad_push_event (parse->srcpad, GST_EVENT_CAST (l->data));
@@ -2602,10 +2647,25 @@ gst_base_parse_push_frame (GstBaseParse * parse, GstBaseParseFrame * frame)
     ret = GST_FLOW_OK;
   } else if (ret == GST_FLOW_OK) {
     if (parse->segment.rate > 0.0) {
-      GST_LOG_OBJECT (parse, "pushing frame (%" G_GSIZE_FORMAT " bytes) now..",
-          size);
-      ret = gst_pad_push (parse->srcpad, buffer);
-      GST_LOG_OBJECT (parse, "frame pushed, flow %s", gst_flow_get_name (ret));
+      if (parse->priv->batch_frames > 1 &&
+          parse->priv->pad_mode == GST_PAD_MODE_PUSH &&
+          !parse->priv->passthrough) {
+        if (parse->priv->batch == NULL)
+          parse->priv->batch =
+              gst_buffer_list_new_sized (parse->priv->batch_frames);
+        gst_buffer_list_add (parse->priv->batch, buffer);
+        GST_LOG_OBJECT (parse, "frame (%" G_GSIZE_FORMAT " bytes) batched",
+            size);
+        if (gst_buffer_list_length (parse->priv->batch) >=
+            parse->priv->batch_frames)
+          ret = gst_base_parse_push_batch (parse);
+      } else {
+        GST_LOG_OBJECT (parse,
+            "pushing frame (%" G_GSIZE_FORMAT " bytes) now..", size);
+        ret = gst_pad_push (parse->srcpad, buffer);
+        GST_LOG_OBJECT (parse, "frame pushed, flow %s",
+            gst_flow_get_name (ret));
+      }
     } else if (!parse->priv->disable_passthrough && parse->priv->passthrough) {
 
       /* in backwards playback mode, if on passthrough we need to push buffers
@@ -3225,6 +3285,33 @@ gst_base_parse_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
             && parse->priv->passthrough)) {
       GstBaseParseFrame frame;
 
+      /* input was verified as properly framed; after the first frame has
+       * gone through the full machinery (caps, initial events, media check),
+       * short-circuit per-frame processing and push input through directly */
+      if (parse->priv->bypass && parse->priv->framecount > 0 &&
+          parse->segment.rate > 0.0 &&
+          !parse->priv->pending_events && !parse->priv->tags_changed &&
+          gst_pad_has_current_caps (parse->srcpad)) {
+        GstClockTime pts = GST_BUFFER_PTS (buffer);
+        GstClockTime duration = GST_BUFFER_DURATION (buffer);
+
+        parse->priv->framecount++;
+        parse->priv->bytecount += gst_buffer_get_size (buffer);
+        if (GST_CLOCK_TIME_IS_VALID (duration))
+          parse->priv->acc_duration += duration;
+
+        ret = gst_pad_push (parse->srcpad, buffer);
+
+        /* update current running segment position */
+        if (ret == GST_FLOW_OK && GST_CLOCK_TIME_IS_VALID (pts)) {
+          if (GST_CLOCK_TIME_IS_VALID (duration))
+            pts += duration;
+          if (parse->segment.position < pts)
+            parse->segment.position = pts;
+        }
+        return ret;
+      }
+
       gst_base_parse_frame_init (&frame);
       frame.buffer = gst_buffer_make_writable (buffer);
       ret = gst_base_parse_push_frame (parse, &frame);
@@ -3330,6 +3417,15 @@ gst_base_parse_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   }
 
 done:
+  /* push out a partially collected batch; batching only amortizes push
+   * overhead within one round of input processing */
+  if (G_UNLIKELY (parse->priv->batch != NULL)) {
+    GstFlowReturn bret = gst_base_parse_push_batch (parse);
+
+    if (ret == GST_FLOW_OK)
+      ret = bret;
+  }
+
   GST_LOG_OBJECT (parse, "chain leaving");
   return ret;
 }
@@ -4041,6 +4137,54 @@ gst_base_parse_set_passthrough (GstBaseParse * parse, gboolean passthrough)
   GST_INFO_OBJECT (parse, "passthrough: %s", (passthrough) ? "yes" : "no");
 }
 
+/**
+ * gst_base_parse_set_bypass:
+ * @parse: a #GstBaseParse
+ * @bypass: %TRUE if verified input buffers may bypass frame processing
+ *
+ * Set if the subclass has verified that incoming buffers are already
+ * properly framed (for example one access unit per buffer, as delivered
+ * by a demuxer). In that case, and when in passthrough mode operating
+ * in push mode with forward playback, all buffers after the first one
+ * are pushed downstream directly, bypassing the per-frame processing
+ * entirely. While bypassing, #GstBaseParseClass::pre_push_frame is not
+ * invoked and no segment clipping, timestamp interpolation or bitrate
+ * tag updates are performed; only elementary frame statistics are
+ * maintained.
+ *
+ * Since: 1.24
+ */
+void
+gst_base_parse_set_bypass (GstBaseParse * parse, gboolean bypass)
+{
+  parse->priv->bypass = bypass;
+  GST_INFO_OBJECT (parse, "bypass: %s", (bypass) ? "yes" : "no");
+}
+
+/**
+ * gst_base_parse_set_batch_frames:
+ * @parse: a #GstBaseParse
+ * @batch_frames: maximum number of output frames per push, 0 or 1
+ *   disables batching
+ *
+ * Configures output batching. When set to two or more, output frames
+ * are collected into a #GstBufferList and pushed downstream with a
+ * single gst_pad_push_list(), which reduces the per-frame push overhead
+ * for parsers that finish many small frames per input buffer. A
+ * partially collected batch is flushed whenever serialized events need
+ * to be pushed and at the end of each round of input processing, so no
+ * additional latency is introduced. This only applies when operating
+ * in push mode, with forward playback and not in passthrough mode.
+ *
+ * Since: 1.24
+ */
+void
+gst_base_parse_set_batch_frames (GstBaseParse * parse, guint batch_frames)
+{
+  parse->priv->batch_frames = batch_frames;
+  GST_INFO_OBJECT (parse, "batch_frames: %u", batch_frames);
+}
+
 /**
  * gst_base_parse_set_pts_interpolation:
  * @parse: a #GstBaseParse
@@ -341,6 +341,12 @@ GST_BASE_API
 void            gst_base_parse_set_passthrough (GstBaseParse * parse,
                                                 gboolean       passthrough);
 GST_BASE_API
+void            gst_base_parse_set_bypass      (GstBaseParse * parse,
+                                                gboolean       bypass);
+GST_BASE_API
+void            gst_base_parse_set_batch_frames (GstBaseParse * parse,
+                                                 guint          batch_frames);
+GST_BASE_API
 void            gst_base_parse_set_pts_interpolation (GstBaseParse * parse,
                                                       gboolean pts_interpolate);
 GST_BASE_API
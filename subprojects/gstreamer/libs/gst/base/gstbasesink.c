@@ -175,6 +175,7 @@ typedef struct
 struct _GstBaseSinkPrivate
 {
   gint qos_enabled;             /* ATOMIC */
+  gint stats_mode;              /* ATOMIC, GstBaseSinkStatsMode */
   gboolean async_enabled;
   GstClockTimeDiff ts_offset;
   GstClockTime render_delay;
@@ -201,7 +202,7 @@ struct _GstBaseSinkPrivate
 
   /* running averages go here these are done on running time */
   GstClockTime avg_pt, avg_in_diff;
-  gdouble avg_rate;             /* average with infinite window */
+  guint64 avg_rate;             /* Q16.16, average with infinite window */
 
   /* number of rendered and dropped frames */
   guint64 rendered;
@@ -291,6 +292,13 @@ struct _GstBaseSinkPrivate
 #define UPDATE_RUNNING_AVG_P(avg,val) DO_RUNNING_AVG(avg,val,16)
 #define UPDATE_RUNNING_AVG_N(avg,val) DO_RUNNING_AVG(avg,val,4)
 
+/* the average rate is kept in Q16.16 fixed point so that the render loop
+ * does not need floating point math. G_MAXUINT64 means no average yet. */
+#define RATE_Q16_ONE          (G_GUINT64_CONSTANT (1) << 16)
+#define RATE_Q16_INVALID      G_MAXUINT64
+#define RATE_Q16_TO_DOUBLE(r) ((r) == RATE_Q16_INVALID ? -1.0 : \
+                               gst_guint64_to_gdouble (r) / 65536.0)
+
 /* BaseSink properties */
 
 #define DEFAULT_CAN_ACTIVATE_PULL FALSE /* fixme: enable me */
@@ -308,6 +316,7 @@ struct _GstBaseSinkPrivate
 #define DEFAULT_MAX_BITRATE         0
 #define DEFAULT_DROP_OUT_OF_SEGMENT TRUE
 #define DEFAULT_PROCESSING_DEADLINE (20 * GST_MSECOND)
+#define DEFAULT_STATS_MODE          GST_BASE_SINK_STATS_FULL
 
 enum
 {
@@ -325,6 +334,7 @@ enum
   PROP_MAX_BITRATE,
   PROP_PROCESSING_DEADLINE,
   PROP_STATS,
+  PROP_STATS_MODE,
   PROP_LAST
 };
 
@@ -371,6 +381,25 @@ gst_base_sink_get_instance_private (GstBaseSink * self)
   return (G_STRUCT_MEMBER_P (self, private_offset));
 }
 
+GType
+gst_base_sink_stats_mode_get_type (void)
+{
+  static GType gtype = 0;
+
+  if (g_once_init_enter (&gtype)) {
+    static const GEnumValue values[] = {
+      {GST_BASE_SINK_STATS_OFF, "GST_BASE_SINK_STATS_OFF", "off"},
+      {GST_BASE_SINK_STATS_COARSE, "GST_BASE_SINK_STATS_COARSE", "coarse"},
+      {GST_BASE_SINK_STATS_FULL, "GST_BASE_SINK_STATS_FULL", "full"},
+      {0, NULL, NULL}
+    };
+    GType new_type = g_enum_register_static ("GstBaseSinkStatsMode", values);
+
+    g_once_init_leave (&gtype, new_type);
+  }
+  return gtype;
+}
+
 static void gst_base_sink_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
 static void gst_base_sink_get_property (GObject * object, guint prop_id,
@@ -592,6 +621,26 @@ gst_base_sink_class_init (GstBaseSinkClass * klass)
           "Sink Statistics", GST_TYPE_STRUCTURE,
           G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstBaseSink:stats-mode:
+   *
+   * Controls how much per-buffer statistics bookkeeping the sink performs.
+   * In "off" mode only the bookkeeping needed for the synchronisation
+   * decision is done; the running averages are not updated, no QoS
+   * observations are collected and position queries fall back to the last
+   * segment position. In "coarse" mode the frame counters and the average
+   * inter frame spacing are maintained but no QoS observations are
+   * collected, which means no QoS events are sent upstream. "full" keeps
+   * the historic behaviour.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS_MODE,
+      g_param_spec_enum ("stats-mode", "Stats Mode",
+          "Amount of per-buffer statistics bookkeeping to perform",
+          gst_base_sink_stats_mode_get_type (), DEFAULT_STATS_MODE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_base_sink_change_state);
   gstelement_class->send_event = GST_DEBUG_FUNCPTR (gst_base_sink_send_event);
@@ -714,6 +763,7 @@ gst_base_sink_init (GstBaseSink * basesink, gpointer g_class)
   basesink->sync = DEFAULT_SYNC;
   basesink->max_lateness = DEFAULT_MAX_LATENESS;
   g_atomic_int_set (&priv->qos_enabled, DEFAULT_QOS);
+  g_atomic_int_set (&priv->stats_mode, DEFAULT_STATS_MODE);
   priv->async_enabled = DEFAULT_ASYNC;
   priv->ts_offset = DEFAULT_TS_OFFSET;
   priv->render_delay = DEFAULT_RENDER_DELAY;
@@ -914,6 +964,49 @@ gst_base_sink_is_qos_enabled (GstBaseSink * sink)
   return res;
 }
 
+/**
+ * gst_base_sink_set_stats_mode:
+ * @sink: the sink
+ * @mode: the new stats mode
+ *
+ * Configures how much per-buffer statistics bookkeeping @sink performs.
+ * See #GstBaseSink:stats-mode for the meaning of the modes. Note that
+ * Quality-of-Service events are only generated in
+ * %GST_BASE_SINK_STATS_FULL mode.
+ *
+ * Since: 1.24
+ */
+void
+gst_base_sink_set_stats_mode (GstBaseSink * sink, GstBaseSinkStatsMode mode)
+{
+  g_return_if_fail (GST_IS_BASE_SINK (sink));
+
+  g_atomic_int_set (&sink->priv->stats_mode, mode);
+}
+
+/**
+ * gst_base_sink_get_stats_mode:
+ * @sink: the sink
+ *
+ * Gets the currently configured amount of per-buffer statistics
+ * bookkeeping, see gst_base_sink_set_stats_mode().
+ *
+ * Returns: the currently configured #GstBaseSinkStatsMode.
+ *
+ * Since: 1.24
+ */
+GstBaseSinkStatsMode
+gst_base_sink_get_stats_mode (GstBaseSink * sink)
+{
+  GstBaseSinkStatsMode res;
+
+  g_return_val_if_fail (GST_IS_BASE_SINK (sink), DEFAULT_STATS_MODE);
+
+  res = g_atomic_int_get (&sink->priv->stats_mode);
+
+  return res;
+}
+
 /**
  * gst_base_sink_set_async_enabled:
  * @sink: the sink
@@ -1598,6 +1691,9 @@ gst_base_sink_set_property (GObject * object, guint prop_id,
     case PROP_PROCESSING_DEADLINE:
       gst_base_sink_set_processing_deadline (sink, g_value_get_uint64 (value));
       break;
+    case PROP_STATS_MODE:
+      gst_base_sink_set_stats_mode (sink, g_value_get_enum (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1650,6 +1746,9 @@ gst_base_sink_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_STATS:
       g_value_take_boxed (value, gst_base_sink_get_stats (sink));
       break;
+    case PROP_STATS_MODE:
+      g_value_set_enum (value, gst_base_sink_get_stats_mode (sink));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2710,9 +2809,10 @@ do_step:
   /* save sync time for eos when the previous object needed sync */
   priv->eos_rtime = (do_sync ? rnext : GST_CLOCK_TIME_NONE);
 
-  /* calculate inter frame spacing */
+  /* calculate inter frame spacing, skipped entirely in stats-mode=off */
   if (G_UNLIKELY (GST_CLOCK_TIME_IS_VALID (priv->prev_rstart) &&
-          priv->prev_rstart < rstart)) {
+          priv->prev_rstart < rstart &&
+          g_atomic_int_get (&priv->stats_mode) != GST_BASE_SINK_STATS_OFF)) {
     GstClockTime in_diff;
 
     in_diff = rstart - priv->prev_rstart;
@@ -2755,11 +2855,15 @@ again:
   }
 
   /* After rendering we store the position of the last buffer so that we can use
-   * it to report the position. We need to take the lock here. */
-  GST_OBJECT_LOCK (basesink);
-  priv->current_sstart = sstart;
-  priv->current_sstop = (GST_CLOCK_TIME_IS_VALID (sstop) ? sstop : sstart);
-  GST_OBJECT_UNLOCK (basesink);
+   * it to report the position. We need to take the lock here. In stats-mode=off
+   * we skip the lock round-trip and position queries fall back to the last
+   * segment position. */
+  if (g_atomic_int_get (&priv->stats_mode) != GST_BASE_SINK_STATS_OFF) {
+    GST_OBJECT_LOCK (basesink);
+    priv->current_sstart = sstart;
+    priv->current_sstop = (GST_CLOCK_TIME_IS_VALID (sstop) ? sstop : sstart);
+    GST_OBJECT_UNLOCK (basesink);
+  }
 
   if (!do_sync)
     goto done;
@@ -2937,7 +3041,7 @@ gst_base_sink_perform_qos (GstBaseSink * sink, gboolean dropped)
   GstClockTimeDiff jitter;
   GstClockTime pt, entered, left;
   GstClockTime duration;
-  gdouble rate;
+  guint64 rate;
 
   priv = sink->priv;
 
@@ -2951,6 +3055,10 @@ gst_base_sink_perform_qos (GstBaseSink * sink, gboolean dropped)
       !GST_CLOCK_TIME_IS_VALID (start))
     return;
 
+  /* QoS observations are only collected in full stats mode */
+  if (g_atomic_int_get (&priv->stats_mode) != GST_BASE_SINK_STATS_FULL)
+    return;
+
   stop = priv->current_rstop;
   jitter = priv->current_jitter;
 
@@ -2995,7 +3103,7 @@ gst_base_sink_perform_qos (GstBaseSink * sink, gboolean dropped)
 
   GST_CAT_DEBUG_OBJECT (GST_CAT_QOS, sink,
       "avg_pt: %" GST_TIME_FORMAT ", avg_rate: %g",
-      GST_TIME_ARGS (priv->avg_pt), priv->avg_rate);
+      GST_TIME_ARGS (priv->avg_pt), RATE_Q16_TO_DOUBLE (priv->avg_rate));
 
   /* collect running averages. for first observations, we copy the
    * values */
@@ -3005,18 +3113,16 @@ gst_base_sink_perform_qos (GstBaseSink * sink, gboolean dropped)
     priv->avg_pt = UPDATE_RUNNING_AVG (priv->avg_pt, pt);
 
   if (duration != -1 && duration != 0) {
-    rate =
-        gst_guint64_to_gdouble (priv->avg_pt) /
-        gst_guint64_to_gdouble (duration);
+    rate = gst_util_uint64_scale (priv->avg_pt, RATE_Q16_ONE, duration);
   } else {
-    rate = 1.0;
+    rate = RATE_Q16_ONE;
   }
 
   if (GST_CLOCK_TIME_IS_VALID (priv->last_left)) {
-    if (dropped || priv->avg_rate < 0.0) {
+    if (dropped || priv->avg_rate == RATE_Q16_INVALID) {
       priv->avg_rate = rate;
     } else {
-      if (rate > 1.0)
+      if (rate > RATE_Q16_ONE)
         priv->avg_rate = UPDATE_RUNNING_AVG_N (priv->avg_rate, rate);
       else
         priv->avg_rate = UPDATE_RUNNING_AVG_P (priv->avg_rate, rate);
@@ -3025,10 +3131,11 @@ gst_base_sink_perform_qos (GstBaseSink * sink, gboolean dropped)
 
   GST_CAT_DEBUG_OBJECT (GST_CAT_QOS, sink,
       "updated: avg_pt: %" GST_TIME_FORMAT
-      ", avg_rate: %g", GST_TIME_ARGS (priv->avg_pt), priv->avg_rate);
+      ", avg_rate: %g", GST_TIME_ARGS (priv->avg_pt),
+      RATE_Q16_TO_DOUBLE (priv->avg_rate));
 
 
-  if (priv->avg_rate >= 0.0) {
+  if (priv->avg_rate != RATE_Q16_INVALID) {
     GstQOSType type;
     GstClockTimeDiff diff;
 
@@ -3051,8 +3158,8 @@ gst_base_sink_perform_qos (GstBaseSink * sink, gboolean dropped)
         type = GST_QOS_TYPE_UNDERFLOW;
     }
 
-    gst_base_sink_send_qos (sink, type, priv->avg_rate, priv->current_rstart,
-        diff);
+    gst_base_sink_send_qos (sink, type, RATE_Q16_TO_DOUBLE (priv->avg_rate),
+        priv->current_rstart, diff);
   }
 
   /* record when this buffer will leave us */
@@ -3072,7 +3179,7 @@ gst_base_sink_reset_qos (GstBaseSink * sink)
   priv->earliest_in_time = GST_CLOCK_TIME_NONE;
   priv->last_left = GST_CLOCK_TIME_NONE;
   priv->avg_pt = GST_CLOCK_TIME_NONE;
-  priv->avg_rate = -1.0;
+  priv->avg_rate = RATE_Q16_INVALID;
   priv->avg_in_diff = GST_CLOCK_TIME_NONE;
   priv->rendered = 0;
   priv->dropped = 0;
@@ -4047,8 +4154,8 @@ dropped:
       qos_msg =
           gst_message_new_qos (GST_OBJECT_CAST (basesink), basesink->sync,
           priv->current_rstart, priv->current_sstart, timestamp, duration);
-      gst_message_set_qos_values (qos_msg, priv->current_jitter, priv->avg_rate,
-          1000000);
+      gst_message_set_qos_values (qos_msg, priv->current_jitter,
+          RATE_Q16_TO_DOUBLE (priv->avg_rate), 1000000);
       gst_message_set_qos_stats (qos_msg, GST_FORMAT_BUFFERS, priv->rendered,
           priv->dropped);
       gst_element_post_message (GST_ELEMENT_CAST (basesink), qos_msg);
@@ -5910,7 +6017,7 @@ gst_base_sink_get_stats (GstBaseSink * sink)
   g_return_val_if_fail (sink != NULL, NULL);
   priv = sink->priv;
   return gst_structure_new ("application/x-gst-base-sink-stats",
-      "average-rate", G_TYPE_DOUBLE, priv->avg_rate,
+      "average-rate", G_TYPE_DOUBLE, RATE_Q16_TO_DOUBLE (priv->avg_rate),
       "dropped", G_TYPE_UINT64, priv->dropped,
       "rendered", G_TYPE_UINT64, priv->rendered, NULL);
 }
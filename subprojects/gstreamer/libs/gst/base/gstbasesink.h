@@ -338,6 +338,35 @@ GstFlowReturn   gst_base_sink_wait              (GstBaseSink *sink, GstClockTime
 GST_BASE_API
 GstStructure 	*gst_base_sink_get_stats (GstBaseSink * sink);
 
+/**
+ * GstBaseSinkStatsMode:
+ * @GST_BASE_SINK_STATS_OFF: only do the bookkeeping that is needed for the
+ *     synchronisation decision itself.
+ * @GST_BASE_SINK_STATS_COARSE: additionally keep the frame counters and the
+ *     average inter frame spacing, but collect no QoS observations.
+ * @GST_BASE_SINK_STATS_FULL: collect all statistics and QoS observations
+ *     for every buffer.
+ *
+ * The amount of per-buffer statistics bookkeeping performed by the sink.
+ *
+ * Since: 1.24
+ */
+typedef enum
+{
+  GST_BASE_SINK_STATS_OFF,
+  GST_BASE_SINK_STATS_COARSE,
+  GST_BASE_SINK_STATS_FULL
+} GstBaseSinkStatsMode;
+
+GST_BASE_API
+GType           gst_base_sink_stats_mode_get_type (void);
+
+GST_BASE_API
+void            gst_base_sink_set_stats_mode    (GstBaseSink *sink, GstBaseSinkStatsMode mode);
+
+GST_BASE_API
+GstBaseSinkStatsMode gst_base_sink_get_stats_mode (GstBaseSink *sink);
+
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GstBaseSink, gst_object_unref)
 
 G_END_DECLS
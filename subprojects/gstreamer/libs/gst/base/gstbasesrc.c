@@ -189,6 +189,7 @@ enum
 #define DEFAULT_BLOCKSIZE       4096
 #define DEFAULT_NUM_BUFFERS     -1
 #define DEFAULT_DO_TIMESTAMP    FALSE
+#define DEFAULT_READAHEAD       0
 
 enum
 {
@@ -198,7 +199,8 @@ enum
 #ifndef GST_REMOVE_DEPRECATED
   PROP_TYPEFIND,
 #endif
-  PROP_DO_TIMESTAMP
+  PROP_DO_TIMESTAMP,
+  PROP_READAHEAD
 };
 
 /* The basesrc implementation need to respect the following locking order:
@@ -261,6 +263,12 @@ struct _GstBaseSrcPrivate
 
   /* for _submit_buffer_list() */
   GstBufferList *pending_bufferlist;
+
+  /* pull mode readahead cache */
+  guint readahead;              /* OBJECT_LOCK */
+  GstBuffer *cached_buffer;     /* OBJECT_LOCK */
+  guint64 cached_offset;        /* OBJECT_LOCK */
+  guint64 expected_offset;      /* OBJECT_LOCK */
 };
 
 #define BASE_SRC_HAS_PENDING_BUFFER_LIST(src) \
@@ -403,6 +411,23 @@ gst_base_src_class_init (GstBaseSrcClass * klass)
       g_param_spec_boolean ("do-timestamp", "Do timestamp",
           "Apply current stream time to buffers", DEFAULT_DO_TIMESTAMP,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstBaseSrc:readahead:
+   *
+   * Number of bytes to read beyond a pull mode request when requests arrive
+   * in a sequential pattern. The extra data is cached and used to serve
+   * following requests without calling the subclass again, which helps
+   * pull-based demuxers on high-latency storage such as network filesystems.
+   *
+   * Only used by random-access sources, 0 disables readahead.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_READAHEAD,
+      g_param_spec_uint ("readahead", "Readahead",
+          "Number of bytes to read ahead of sequential pull mode requests "
+          "(0 = disabled)", 0, G_MAXUINT, DEFAULT_READAHEAD,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_base_src_change_state);
@@ -469,6 +494,8 @@ gst_base_src_init (GstBaseSrc * basesrc, gpointer g_class)
   /* we operate in BYTES by default */
   gst_base_src_set_format (basesrc, GST_FORMAT_BYTES);
   basesrc->priv->do_timestamp = DEFAULT_DO_TIMESTAMP;
+  basesrc->priv->readahead = DEFAULT_READAHEAD;
+  basesrc->priv->expected_offset = G_MAXUINT64;
   g_atomic_int_set (&basesrc->priv->have_events, FALSE);
 
   g_cond_init (&basesrc->priv->async_cond);
@@ -2204,6 +2231,11 @@ gst_base_src_set_property (GObject * object, guint prop_id,
     case PROP_DO_TIMESTAMP:
       gst_base_src_set_do_timestamp (src, g_value_get_boolean (value));
       break;
+    case PROP_READAHEAD:
+      GST_OBJECT_LOCK (src);
+      src->priv->readahead = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (src);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2233,6 +2265,11 @@ gst_base_src_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_DO_TIMESTAMP:
       g_value_set_boolean (value, gst_base_src_get_do_timestamp (src));
       break;
+    case PROP_READAHEAD:
+      GST_OBJECT_LOCK (src);
+      g_value_set_uint (value, src->priv->readahead);
+      GST_OBJECT_UNLOCK (src);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2527,6 +2564,67 @@ unexpected_length:
   }
 }
 
+/* drop the pull mode readahead cache */
+static void
+gst_base_src_clear_readahead (GstBaseSrc * src)
+{
+  GST_OBJECT_LOCK (src);
+  gst_buffer_replace (&src->priv->cached_buffer, NULL);
+  src->priv->expected_offset = G_MAXUINT64;
+  GST_OBJECT_UNLOCK (src);
+}
+
+/* Try to serve a range from the readahead cache. Returns a buffer sharing
+ * the memory of the cached buffer, no data is copied. */
+static gboolean
+gst_base_src_get_cached_range (GstBaseSrc * src, guint64 offset, guint length,
+    GstBuffer ** buf)
+{
+  gboolean res = FALSE;
+
+  GST_OBJECT_LOCK (src);
+  if (src->priv->cached_buffer) {
+    guint64 cached_offset = src->priv->cached_offset;
+    gsize cached_size = gst_buffer_get_size (src->priv->cached_buffer);
+
+    if (offset >= cached_offset && length <= cached_size &&
+        offset - cached_offset <= cached_size - length) {
+      *buf = gst_buffer_copy_region (src->priv->cached_buffer,
+          GST_BUFFER_COPY_ALL, offset - cached_offset, length);
+      src->priv->expected_offset = offset + length;
+      res = TRUE;
+    }
+  }
+  GST_OBJECT_UNLOCK (src);
+
+  return res;
+}
+
+/* Figure out how much to read for a pull mode request; requests that follow
+ * a sequential pattern on a random-access source are extended by the
+ * configured readahead so that the following requests can be served from
+ * the cached data. */
+static guint
+gst_base_src_get_create_length (GstBaseSrc * src, guint64 offset, guint length)
+{
+  guint res = length;
+
+  GST_OBJECT_LOCK (src);
+  if (src->priv->readahead > 0 && src->random_access &&
+      offset == src->priv->expected_offset) {
+    res = MAX (length, src->priv->readahead);
+    /* don't read past the end of the stream when the size is known */
+    if (src->segment.format == GST_FORMAT_BYTES &&
+        src->segment.duration != -1 && offset <= src->segment.duration)
+      res = MIN ((guint64) res, src->segment.duration - offset);
+    res = MAX (res, length);
+  }
+  src->priv->expected_offset = offset + length;
+  GST_OBJECT_UNLOCK (src);
+
+  return res;
+}
+
 /* must be called with LIVE_LOCK */
 static GstFlowReturn
 gst_base_src_get_range (GstBaseSrc * src, guint64 offset, guint length,
@@ -2588,9 +2686,46 @@ again:
   res_buf = in_buf = *buf;
   own_res_buf = (*buf == NULL);
 
-  GST_LIVE_UNLOCK (src);
-  ret = bclass->create (src, offset, length, &res_buf);
-  GST_LIVE_LOCK (src);
+  if (in_buf == NULL
+      && gst_base_src_get_cached_range (src, offset, length, &res_buf)) {
+    GST_LOG_OBJECT (src, "serving offset %" G_GUINT64_FORMAT " length %u "
+        "from the readahead cache", offset, length);
+    ret = GST_FLOW_OK;
+  } else {
+    guint create_length = length;
+
+    if (in_buf == NULL)
+      create_length = gst_base_src_get_create_length (src, offset, length);
+
+    if (create_length > length) {
+      GstBuffer *full = NULL;
+
+      GST_LIVE_UNLOCK (src);
+      ret = bclass->create (src, offset, create_length, &full);
+      GST_LIVE_LOCK (src);
+
+      if (ret == GST_FLOW_OK && full != NULL
+          && gst_buffer_get_size (full) > length) {
+        /* keep the whole read around for the next requests and hand out the
+         * requested part of it */
+        GST_OBJECT_LOCK (src);
+        src->priv->cached_offset = offset;
+        gst_buffer_replace (&src->priv->cached_buffer, full);
+        GST_OBJECT_UNLOCK (src);
+
+        res_buf = gst_buffer_copy_region (full, GST_BUFFER_COPY_ALL, 0,
+            length);
+        gst_buffer_unref (full);
+      } else {
+        /* short read or a buffer list was submitted, use as-is */
+        res_buf = full;
+      }
+    } else {
+      GST_LIVE_UNLOCK (src);
+      ret = bclass->create (src, offset, length, &res_buf);
+      GST_LIVE_LOCK (src);
+    }
+  }
 
   /* As we released the LIVE_LOCK, the state may have changed */
   if (src->is_live) {
@@ -3765,6 +3900,8 @@ gst_base_src_stop (GstBaseSrc * basesrc)
     basesrc->priv->pending_bufferlist = NULL;
   }
 
+  gst_base_src_clear_readahead (basesrc);
+
   gst_base_src_set_allocation (basesrc, NULL, NULL, NULL);
 
   return result;
@@ -278,6 +278,8 @@ static GstFlowReturn gst_base_transform_getrange (GstPad * pad,
     GstObject * parent, guint64 offset, guint length, GstBuffer ** buffer);
 static GstFlowReturn gst_base_transform_chain (GstPad * pad, GstObject * parent,
     GstBuffer * buffer);
+static GstFlowReturn gst_base_transform_chain_list (GstPad * pad,
+    GstObject * parent, GstBufferList * list);
 static GstCaps *gst_base_transform_default_transform_caps (GstBaseTransform *
     trans, GstPadDirection direction, GstCaps * caps, GstCaps * filter);
 static GstCaps *gst_base_transform_default_fixate_caps (GstBaseTransform *
@@ -390,6 +392,8 @@ gst_base_transform_init (GstBaseTransform * trans,
       GST_DEBUG_FUNCPTR (gst_base_transform_sink_event));
   gst_pad_set_chain_function (trans->sinkpad,
       GST_DEBUG_FUNCPTR (gst_base_transform_chain));
+  gst_pad_set_chain_list_function (trans->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_base_transform_chain_list));
   gst_pad_set_activatemode_function (trans->sinkpad,
       GST_DEBUG_FUNCPTR (gst_base_transform_sink_activate_mode));
   gst_pad_set_query_function (trans->sinkpad,
@@ -1426,6 +1430,20 @@ gst_base_transform_reconfigure_unlocked (GstBaseTransform * trans)
     if (incaps == NULL)
       goto done;
 
+    /* A passthrough element cannot change caps on its own, so the only thing
+     * a reconfigure can mean for it is that downstream no longer accepts the
+     * current caps. Probe that with a single accept-caps query instead of
+     * re-running the whole negotiation; reconfigures that were caused by
+     * latency or allocation changes then propagate through passthrough
+     * chains without any caps query traffic. */
+    if (gst_base_transform_is_passthrough (trans)
+        && gst_pad_peer_query_accept_caps (trans->srcpad, incaps)) {
+      GST_DEBUG_OBJECT (trans,
+          "passthrough caps still accepted downstream, keeping configuration");
+      gst_caps_unref (incaps);
+      goto done;
+    }
+
     /* if we need to reconfigure we pretend new caps arrived. This
      * will reconfigure the transform with the new output format. */
     if (!gst_base_transform_setcaps (trans, trans->sinkpad, incaps)) {
@@ -2313,10 +2331,13 @@ pull_error:
  * getrange() function - we have data, feed it to the sub-class
  * and then iterate, pushing buffers it generates until it either
  * wants more data or returns an error */
+/* process one input buffer, generating any number of output buffers.
+ * When @outputs is NULL the outputs are pushed on the srcpad directly,
+ * otherwise they are collected in @outputs for a single list push. */
 static GstFlowReturn
-gst_base_transform_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
+gst_base_transform_handle_buffer (GstBaseTransform * trans, GstBuffer * buffer,
+    GstBufferList * outputs)
 {
-  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (parent);
   GstBaseTransformClass *klass = GST_BASE_TRANSFORM_GET_CLASS (trans);
   GstBaseTransformPrivate *priv = trans->priv;
   GstFlowReturn ret;
@@ -2388,7 +2409,12 @@ gst_base_transform_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
         }
         priv->processed++;
 
-        ret = gst_pad_push (trans->srcpad, outbuf);
+        if (outputs != NULL) {
+          gst_buffer_list_add (outputs, outbuf);
+          ret = GST_FLOW_OK;
+        } else {
+          ret = gst_pad_push (trans->srcpad, outbuf);
+        }
       } else {
         GST_DEBUG_OBJECT (trans, "we got return %s", gst_flow_get_name (ret));
         gst_buffer_unref (outbuf);
@@ -2407,6 +2433,46 @@ done:
   return ret;
 }
 
+static GstFlowReturn
+gst_base_transform_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
+{
+  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (parent);
+
+  return gst_base_transform_handle_buffer (trans, buffer, NULL);
+}
+
+static GstFlowReturn
+gst_base_transform_chain_list (GstPad * pad, GstObject * parent,
+    GstBufferList * list)
+{
+  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (parent);
+  GstBufferList *outputs;
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint i, len;
+
+  len = gst_buffer_list_length (list);
+
+  GST_DEBUG_OBJECT (trans, "chaining buffer list with %u buffers", len);
+
+  /* collect the outputs of the whole list and push them in one go, so
+   * downstream pays the sticky-event and probe checks only once */
+  outputs = gst_buffer_list_new_sized (len);
+
+  for (i = 0; i < len && ret == GST_FLOW_OK; i++) {
+    GstBuffer *buffer = gst_buffer_ref (gst_buffer_list_get (list, i));
+
+    ret = gst_base_transform_handle_buffer (trans, buffer, outputs);
+  }
+  gst_buffer_list_unref (list);
+
+  if (ret == GST_FLOW_OK && gst_buffer_list_length (outputs) > 0)
+    ret = gst_pad_push_list (trans->srcpad, outputs);
+  else
+    gst_buffer_list_unref (outputs);
+
+  return ret;
+}
+
 static void
 gst_base_transform_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
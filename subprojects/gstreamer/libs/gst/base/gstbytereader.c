@@ -871,7 +871,15 @@ _scan_for_start_code (const guint8 * data, guint size)
 
   while (pdata <= pend) {
     if (pdata[2] > 1) {
-      pdata += 3;
+      /* No start code overlaps these three bytes and the next candidate
+       * has to begin with a zero byte. Zero bytes are rare in
+       * entropy-coded payload, so let memchr (which compares a word or
+       * vector register per iteration) jump ahead to the next one. */
+      if (pdata + 3 > pend)
+        break;
+      pdata = memchr (pdata + 3, 0, pend - pdata - 2);
+      if (pdata == NULL)
+        break;
     } else if (pdata[1]) {
       pdata += 2;
     } else if (pdata[0] || pdata[2] != 1) {
@@ -79,6 +79,90 @@ typedef struct
  * Returns: (nullable): address of the data or %NULL if buffer does not cover
  * the requested range.
  */
+/* process-wide cache of typefind verdicts, keyed on the extension plus a
+ * hash of the first few KB of the stream. Playlist skips and directory
+ * scans hit the same files over and over; re-running every typefinder for
+ * them is pure waste. Only confident verdicts are cached. */
+
+#define TYPE_FIND_CACHE_PREFIX_LEN 4096
+/* arbitrary bound so a pathological workload can't grow it forever */
+#define TYPE_FIND_CACHE_MAX_ENTRIES 256
+
+typedef struct
+{
+  GstCaps *caps;
+  GstTypeFindProbability probability;
+} TypeFindCacheEntry;
+
+static GHashTable *type_find_cache;     /* key string -> TypeFindCacheEntry */
+G_LOCK_DEFINE_STATIC (type_find_cache);
+
+static void
+type_find_cache_entry_free (gpointer data)
+{
+  TypeFindCacheEntry *entry = data;
+
+  gst_caps_unref (entry->caps);
+  g_free (entry);
+}
+
+static gchar *
+type_find_cache_key (const guint8 * data, gsize len, const gchar * extension)
+{
+  /* FNV-1a, cheap and good enough for a prefix fingerprint */
+  guint64 hash = G_GUINT64_CONSTANT (0xcbf29ce484222325);
+  gsize i;
+
+  for (i = 0; i < len; i++)
+    hash = (hash ^ data[i]) * G_GUINT64_CONSTANT (0x100000001b3);
+
+  return g_strdup_printf ("%s:%" G_GSIZE_FORMAT ":%016" G_GINT64_MODIFIER "x",
+      extension ? extension : "", len, hash);
+}
+
+static gboolean
+type_find_cache_lookup (const gchar * key, GstCaps ** caps,
+    GstTypeFindProbability * probability)
+{
+  TypeFindCacheEntry *entry;
+  gboolean res = FALSE;
+
+  G_LOCK (type_find_cache);
+  if (type_find_cache != NULL &&
+      (entry = g_hash_table_lookup (type_find_cache, key))) {
+    *caps = gst_caps_ref (entry->caps);
+    *probability = entry->probability;
+    res = TRUE;
+  }
+  G_UNLOCK (type_find_cache);
+
+  return res;
+}
+
+static void
+type_find_cache_store (const gchar * key, GstCaps * caps,
+    GstTypeFindProbability probability)
+{
+  TypeFindCacheEntry *entry;
+
+  entry = g_new (TypeFindCacheEntry, 1);
+  entry->caps = gst_caps_ref (caps);
+  entry->probability = probability;
+  /* the cache deliberately lives for the whole process */
+  GST_MINI_OBJECT_FLAG_SET (entry->caps, GST_MINI_OBJECT_FLAG_MAY_BE_LEAKED);
+
+  G_LOCK (type_find_cache);
+  if (type_find_cache == NULL) {
+    type_find_cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+        type_find_cache_entry_free);
+  } else if (g_hash_table_size (type_find_cache) >=
+      TYPE_FIND_CACHE_MAX_ENTRIES) {
+    g_hash_table_remove_all (type_find_cache);
+  }
+  g_hash_table_insert (type_find_cache, g_strdup (key), entry);
+  G_UNLOCK (type_find_cache);
+}
+
 static const guint8 *
 helper_find_peek (gpointer data, gint64 offset, guint size)
 {
@@ -382,6 +466,8 @@ gst_type_find_helper_get_range_full (GstObject * obj, GstObject * parent,
   GSList *walk;
   GList *l, *type_list;
   GstCaps *result = NULL;
+  gchar *cache_key = NULL;
+  gboolean cached = FALSE;
 
   g_return_val_if_fail (GST_IS_OBJECT (obj), GST_FLOW_ERROR);
   g_return_val_if_fail (func != NULL, GST_FLOW_ERROR);
@@ -409,27 +495,57 @@ gst_type_find_helper_get_range_full (GstObject * obj, GstObject * parent,
     find.get_length = helper_find_get_length;
   }
 
-  type_list = gst_type_find_factory_get_list ();
-  type_list = prioritize_extension (obj, type_list, extension);
+  /* fingerprint the start of the stream and check for a cached verdict;
+   * the pulled prefix stays in helper.buffers, so this pre-pull is work
+   * the first typefinder would have caused anyway */
+  {
+    gsize prefix_len = TYPE_FIND_CACHE_PREFIX_LEN;
+    const guint8 *data;
 
-  for (l = type_list; l; l = l->next) {
-    helper.factory = GST_TYPE_FIND_FACTORY (l->data);
-    gst_type_find_factory_call_function (helper.factory, &find);
-    if (helper.best_probability >= GST_TYPE_FIND_MAXIMUM) {
-      /* Any other flow return can be ignored here, we found
-       * something before any error with highest probability */
-      helper.flow_ret = GST_FLOW_OK;
-      break;
-    } else if (helper.flow_ret != GST_FLOW_OK
-        && helper.flow_ret != GST_FLOW_EOS) {
-      /* We had less than maximum probability and an error, don't return
-       * any caps as they might be with a lower probability than what
-       * we would've gotten when continuing if there was no error */
-      gst_caps_replace (&helper.caps, NULL);
-      break;
+    if (size != 0 && size != (guint64) - 1)
+      prefix_len = MIN (size, prefix_len);
+
+    if ((data = helper_find_peek (&helper, 0, prefix_len))) {
+      cache_key = type_find_cache_key (data, prefix_len, extension);
+
+      if (type_find_cache_lookup (cache_key, &helper.caps,
+              &helper.best_probability)) {
+        GST_LOG_OBJECT (obj, "typefind cache hit for %s", cache_key);
+        helper.flow_ret = GST_FLOW_OK;
+        cached = TRUE;
+      }
     }
   }
-  gst_plugin_feature_list_free (type_list);
+
+  if (!cached) {
+    type_list = gst_type_find_factory_get_list ();
+    type_list = prioritize_extension (obj, type_list, extension);
+
+    for (l = type_list; l; l = l->next) {
+      helper.factory = GST_TYPE_FIND_FACTORY (l->data);
+      gst_type_find_factory_call_function (helper.factory, &find);
+      if (helper.best_probability >= GST_TYPE_FIND_MAXIMUM) {
+        /* Any other flow return can be ignored here, we found
+         * something before any error with highest probability */
+        helper.flow_ret = GST_FLOW_OK;
+        break;
+      } else if (helper.flow_ret != GST_FLOW_OK
+          && helper.flow_ret != GST_FLOW_EOS) {
+        /* We had less than maximum probability and an error, don't return
+         * any caps as they might be with a lower probability than what
+         * we would've gotten when continuing if there was no error */
+        gst_caps_replace (&helper.caps, NULL);
+        break;
+      }
+    }
+    gst_plugin_feature_list_free (type_list);
+
+    if (cache_key != NULL && helper.caps != NULL &&
+        helper.best_probability >= GST_TYPE_FIND_LIKELY &&
+        (helper.flow_ret == GST_FLOW_OK || helper.flow_ret == GST_FLOW_EOS))
+      type_find_cache_store (cache_key, helper.caps, helper.best_probability);
+  }
+  g_free (cache_key);
 
   for (walk = helper.buffers; walk; walk = walk->next) {
     GstMappedBuffer *bmap = (GstMappedBuffer *) walk->data;
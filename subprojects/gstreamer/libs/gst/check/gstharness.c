@@ -206,6 +206,13 @@ struct _GstHarnessPrivate
   gboolean eos_received;
 
   GPtrArray *stress;
+
+  /* deterministic stress scheduling */
+  gboolean stress_deterministic;
+  GRand *stress_rand;
+  GMutex stress_lock;
+  GCond stress_cond;
+  GstHarnessThread *stress_current;
 };
 
 static GstFlowReturn
@@ -713,6 +720,9 @@ gst_harness_new_empty (void)
   priv->stress = g_ptr_array_new_with_free_func (
       (GDestroyNotify) gst_harness_stress_free);
 
+  g_mutex_init (&priv->stress_lock);
+  g_cond_init (&priv->stress_cond);
+
   /* we have forwarding on as a default */
   gst_harness_set_forwarding (h, TRUE);
 
@@ -1163,6 +1173,13 @@ gst_harness_teardown (GstHarness * h)
   g_ptr_array_unref (priv->stress);
   priv->stress = NULL;
 
+  g_mutex_clear (&priv->stress_lock);
+  g_cond_clear (&priv->stress_cond);
+  if (priv->stress_rand) {
+    g_rand_free (priv->stress_rand);
+    priv->stress_rand = NULL;
+  }
+
   if (h->element) {
     gst_object_unref (h->element);
     h->element = NULL;
@@ -2892,7 +2909,9 @@ gst_harness_thread_init (GstHarnessThread * t, GDestroyNotify freefunc,
   t->h = h;
   t->sleep = sleep;
 
+  g_mutex_lock (&h->priv->stress_lock);
   g_ptr_array_add (h->priv->stress, t);
+  g_mutex_unlock (&h->priv->stress_lock);
 }
 
 static void
@@ -2972,9 +2991,6 @@ gst_harness_requestpad_thread_free (GstHarnessReqPadThread * t)
   ((GstHarnessThread *)t)->thread = g_thread_new (                             \
       "gst-harness-stress-"G_STRINGIFY(ID),                                    \
       (GThreadFunc)gst_harness_stress_##ID##_func, t))
-#define GST_HARNESS_THREAD_END(t)                                              \
-   (t->running = FALSE,                                                        \
-   GPOINTER_TO_UINT (g_thread_join (t->thread)))
 
 static void
 gst_harness_stress_free (GstHarnessThread * t)
@@ -2983,6 +2999,109 @@ gst_harness_stress_free (GstHarnessThread * t)
     t->freefunc (t);
 }
 
+/* must be called with the stress_lock held. Picks the stress-thread that may
+ * run the next step, drawn from the seeded generator so a given seed always
+ * produces the same schedule. */
+static void
+gst_harness_stress_pick_next (GstHarnessPrivate * priv)
+{
+  guint i, idx, n = priv->stress->len;
+
+  if (n == 0)
+    return;
+
+  idx = g_rand_int_range (priv->stress_rand, 0, n);
+  for (i = 0; i < n; i++) {
+    GstHarnessThread *c = g_ptr_array_index (priv->stress, idx);
+
+    if (c->running) {
+      priv->stress_current = c;
+      return;
+    }
+    idx = (idx + 1) % n;
+  }
+}
+
+/* Wait until the scheduler hands @t the step token. Returns FALSE when the
+ * thread was stopped and its loop should exit. In free-running mode this is
+ * just the running check. */
+static gboolean
+gst_harness_stress_step_begin (GstHarnessThread * t)
+{
+  GstHarnessPrivate *priv = t->h->priv;
+
+  if (!priv->stress_deterministic)
+    return t->running;
+
+  g_mutex_lock (&priv->stress_lock);
+  while (t->running && priv->stress_current != t) {
+    if (priv->stress_current == NULL)
+      gst_harness_stress_pick_next (priv);
+    if (priv->stress_current != t && priv->stress_current != NULL)
+      g_cond_wait (&priv->stress_cond, &priv->stress_lock);
+  }
+  if (!t->running) {
+    /* pass the token on so the other threads can make progress */
+    if (priv->stress_current == t)
+      priv->stress_current = NULL;
+    g_cond_broadcast (&priv->stress_cond);
+    g_mutex_unlock (&priv->stress_lock);
+    return FALSE;
+  }
+  g_mutex_unlock (&priv->stress_lock);
+  return TRUE;
+}
+
+static void
+gst_harness_stress_step_end (GstHarnessThread * t)
+{
+  GstHarnessPrivate *priv = t->h->priv;
+
+  if (!priv->stress_deterministic)
+    return;
+
+  g_mutex_lock (&priv->stress_lock);
+  priv->stress_current = NULL;
+  g_cond_broadcast (&priv->stress_cond);
+  g_mutex_unlock (&priv->stress_lock);
+}
+
+/**
+ * gst_harness_stress_set_deterministic:
+ * @h: a #GstHarness
+ * @seed: seed for the schedule
+ *
+ * Makes the stress-threads of @h run their iterations serialized, one full
+ * iteration at a time, in an order drawn from @seed instead of free-running.
+ * The same seed always produces the same interleaving of the injected
+ * operations, so a race found by sweeping seeds can be replayed and bisected
+ * instead of reappearing once a week. Different seeds explore different
+ * interleavings.
+ *
+ * Must be called before the stress-threads are started. Note that only the
+ * operations injected by the stress-threads are scheduled; threads the
+ * element spawns internally still run freely, so full determinism requires
+ * the element to do its work on the calling threads.
+ *
+ * MT safe.
+ *
+ * Since: 1.24
+ */
+void
+gst_harness_stress_set_deterministic (GstHarness * h, guint32 seed)
+{
+  GstHarnessPrivate *priv = h->priv;
+
+  g_mutex_lock (&priv->stress_lock);
+  priv->stress_deterministic = TRUE;
+  if (priv->stress_rand)
+    g_rand_set_seed (priv->stress_rand, seed);
+  else
+    priv->stress_rand = g_rand_new_with_seed (seed);
+  priv->stress_current = NULL;
+  g_mutex_unlock (&priv->stress_lock);
+}
+
 static gpointer
 gst_harness_stress_custom_func (GstHarnessThread * t)
 {
@@ -2992,10 +3111,11 @@ gst_harness_stress_custom_func (GstHarnessThread * t)
   if (ct->init != NULL)
     ct->init (ct, ct->data);
 
-  while (t->running) {
+  while (gst_harness_stress_step_begin (t)) {
     ct->callback (ct, ct->data);
 
     count++;
+    gst_harness_stress_step_end (t);
     g_usleep (t->sleep);
   }
   return GUINT_TO_POINTER (count);
@@ -3007,7 +3127,7 @@ gst_harness_stress_statechange_func (GstHarnessThread * t)
 {
   guint count = 0;
 
-  while (t->running) {
+  while (gst_harness_stress_step_begin (t)) {
     GstClock *clock = gst_element_get_clock (t->h->element);
     GstIterator *it;
     gboolean done = FALSE;
@@ -3054,6 +3174,7 @@ gst_harness_stress_statechange_func (GstHarnessThread * t)
     g_assert (change == GST_STATE_CHANGE_SUCCESS);
 
     count++;
+    gst_harness_stress_step_end (t);
     g_usleep (t->sleep);
   }
   return GUINT_TO_POINTER (count);
@@ -3078,10 +3199,11 @@ gst_harness_stress_buffer_func (GstHarnessThread * t)
       gst_event_new_segment (&pt->segment));
   g_assert (handled);
 
-  while (t->running) {
+  while (gst_harness_stress_step_begin (t)) {
     gst_harness_push (t->h, pt->func (t->h, pt->data));
 
     count++;
+    gst_harness_stress_step_end (t);
     g_usleep (t->sleep);
   }
   return GUINT_TO_POINTER (count);
@@ -3093,10 +3215,11 @@ gst_harness_stress_event_func (GstHarnessThread * t)
   GstHarnessPushEventThread *pet = (GstHarnessPushEventThread *) t;
   guint count = 0;
 
-  while (t->running) {
+  while (gst_harness_stress_step_begin (t)) {
     gst_harness_push_event (t->h, pet->func (t->h, pet->data));
 
     count++;
+    gst_harness_stress_step_end (t);
     g_usleep (t->sleep);
   }
   return GUINT_TO_POINTER (count);
@@ -3108,10 +3231,11 @@ gst_harness_stress_upstream_event_func (GstHarnessThread * t)
   GstHarnessPushEventThread *pet = (GstHarnessPushEventThread *) t;
   guint count = 0;
 
-  while (t->running) {
+  while (gst_harness_stress_step_begin (t)) {
     gst_harness_push_upstream_event (t->h, pet->func (t->h, pet->data));
 
     count++;
+    gst_harness_stress_step_end (t);
     g_usleep (t->sleep);
   }
   return GUINT_TO_POINTER (count);
@@ -3123,7 +3247,7 @@ gst_harness_stress_property_func (GstHarnessThread * t)
   GstHarnessPropThread *pt = (GstHarnessPropThread *) t;
   guint count = 0;
 
-  while (t->running) {
+  while (gst_harness_stress_step_begin (t)) {
     GValue value = G_VALUE_INIT;
 
     g_object_set_property (G_OBJECT (t->h->element), pt->name, &pt->value);
@@ -3133,6 +3257,7 @@ gst_harness_stress_property_func (GstHarnessThread * t)
     g_value_reset (&value);
 
     count++;
+    gst_harness_stress_step_end (t);
     g_usleep (t->sleep);
   }
   return GUINT_TO_POINTER (count);
@@ -3144,7 +3269,7 @@ gst_harness_stress_requestpad_func (GstHarnessThread * t)
   GstHarnessReqPadThread *rpt = (GstHarnessReqPadThread *) t;
   guint count = 0;
 
-  while (t->running) {
+  while (gst_harness_stress_step_begin (t)) {
     GstPad *reqpad;
 
     if (rpt->release)
@@ -3160,6 +3285,7 @@ gst_harness_stress_requestpad_func (GstHarnessThread * t)
     rpt->pads = g_slist_prepend (rpt->pads, reqpad);
 
     count++;
+    gst_harness_stress_step_end (t);
     g_usleep (t->sleep);
   }
   return GUINT_TO_POINTER (count);
@@ -3178,12 +3304,24 @@ gst_harness_stress_requestpad_func (GstHarnessThread * t)
 guint
 gst_harness_stress_thread_stop (GstHarnessThread * t)
 {
+  GstHarnessPrivate *priv;
   guint ret;
 
   g_return_val_if_fail (t != NULL, 0);
 
-  ret = GST_HARNESS_THREAD_END (t);
-  g_ptr_array_remove (t->h->priv->stress, t);
+  priv = t->h->priv;
+
+  t->running = FALSE;
+  if (priv->stress_deterministic) {
+    /* wake the thread in case it is parked waiting for the step token */
+    g_mutex_lock (&priv->stress_lock);
+    g_cond_broadcast (&priv->stress_cond);
+    g_mutex_unlock (&priv->stress_lock);
+  }
+  ret = GPOINTER_TO_UINT (g_thread_join (t->thread));
+  g_mutex_lock (&priv->stress_lock);
+  g_ptr_array_remove (priv->stress, t);
+  g_mutex_unlock (&priv->stress_lock);
   return ret;
 }
 
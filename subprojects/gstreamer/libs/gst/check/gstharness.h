@@ -355,6 +355,10 @@ void          gst_harness_add_probe (GstHarness        * h,
 
 /* Stress */
 
+GST_CHECK_API
+void               gst_harness_stress_set_deterministic (GstHarness * h,
+                                                         guint32      seed);
+
 GST_CHECK_API
 guint              gst_harness_stress_thread_stop  (GstHarnessThread * t);
 
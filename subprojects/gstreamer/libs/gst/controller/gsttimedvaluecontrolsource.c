@@ -52,9 +52,23 @@ GST_DEBUG_CATEGORY_STATIC (GST_CAT_DEFAULT);
   GST_DEBUG_CATEGORY_INIT (GST_CAT_DEFAULT, "timed value control source", 0, \
     "timed value control source base class")
 
+struct _GstTimedValueControlSourcePrivate
+{
+  /* Segment cache for sequential lookups, protected by the lock. Streaming
+   * threads evaluate monotonically increasing timestamps, so the vast
+   * majority of lookups fall into the same control point segment as the
+   * previous one and can skip the O(log n) sequence search. Invalidated
+   * whenever the sequence structure changes. */
+  GSequenceIter *cache_iter;    /* iter of the segment start, or NULL */
+  GstClockTime cache_end;       /* timestamp of the next control point or
+                                 * GST_CLOCK_TIME_NONE for the last segment */
+};
+
 #define gst_timed_value_control_source_parent_class parent_class
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (GstTimedValueControlSource,
-    gst_timed_value_control_source, GST_TYPE_CONTROL_SOURCE, _do_init);
+    gst_timed_value_control_source, GST_TYPE_CONTROL_SOURCE,
+    G_ADD_PRIVATE (GstTimedValueControlSource)
+    _do_init);
 
 
 enum
@@ -112,6 +126,14 @@ gst_control_point_get_type (void)
   return type_id;
 }
 
+/* must be called with the lock held */
+static void
+gst_timed_value_control_source_invalidate_segment_cache (GstTimedValueControlSource * self)
+{
+  self->priv->cache_iter = NULL;
+  self->priv->cache_end = GST_CLOCK_TIME_NONE;
+}
+
 static void
 gst_timed_value_control_source_reset (GstTimedValueControlSource * self)
 {
@@ -127,6 +149,7 @@ gst_timed_value_control_source_reset (GstTimedValueControlSource * self)
 
   self->nvalues = 0;
   self->valid_cache = FALSE;
+  gst_timed_value_control_source_invalidate_segment_cache (self);
 }
 
 /*
@@ -212,6 +235,7 @@ gst_timed_value_control_source_set_internal (GstTimedValueControlSource *
   g_sequence_insert_sorted (self->values, cp,
       (GCompareDataFunc) gst_control_point_compare, NULL);
   self->nvalues++;
+  gst_timed_value_control_source_invalidate_segment_cache (self);
   g_mutex_unlock (&self->lock);
 
   g_signal_emit (self,
@@ -230,18 +254,32 @@ done:
  * If all values in the control point list come after the given
  * timestamp or no values exist, %NULL is returned.
  *
- * For use in control source implementations.
+ * For use in control source implementations. Must be called with the lock
+ * of @self held.
  *
  * Returns: (transfer none) (nullable): the found #GSequenceIter or %NULL
  */
 GSequenceIter *gst_timed_value_control_source_find_control_point_iter
     (GstTimedValueControlSource * self, GstClockTime timestamp)
 {
-  GSequenceIter *iter;
+  GstTimedValueControlSourcePrivate *priv = self->priv;
+  GSequenceIter *iter, *next;
 
   if (!self->values)
     return NULL;
 
+  /* fast path: check the segment the last lookup landed in first, a
+   * streaming thread evaluating sample after sample almost always stays
+   * within the same pair of control points */
+  if (priv->cache_iter) {
+    GstControlPoint *cp = g_sequence_get (priv->cache_iter);
+
+    if (timestamp >= cp->timestamp &&
+        (priv->cache_end == GST_CLOCK_TIME_NONE
+            || timestamp < priv->cache_end))
+      return priv->cache_iter;
+  }
+
   iter =
       g_sequence_search (self->values, &timestamp,
       (GCompareDataFunc) gst_control_point_find, NULL);
@@ -253,7 +291,17 @@ GSequenceIter *gst_timed_value_control_source_find_control_point_iter
   if (g_sequence_iter_is_begin (iter))
     return NULL;
 
-  return g_sequence_iter_prev (iter);
+  iter = g_sequence_iter_prev (iter);
+
+  /* remember the segment for the next lookup */
+  next = g_sequence_iter_next (iter);
+  priv->cache_iter = iter;
+  if (!g_sequence_iter_is_end (next))
+    priv->cache_end = ((GstControlPoint *) g_sequence_get (next))->timestamp;
+  else
+    priv->cache_end = GST_CLOCK_TIME_NONE;
+
+  return iter;
 }
 
 
@@ -347,6 +395,7 @@ gst_timed_value_control_source_unset (GstTimedValueControlSource * self,
     g_sequence_remove (iter);
     self->nvalues--;
     self->valid_cache = FALSE;
+    gst_timed_value_control_source_invalidate_segment_cache (self);
     res = TRUE;
   }
   g_mutex_unlock (&self->lock);
@@ -380,6 +429,7 @@ gst_timed_value_control_source_unset_all (GstTimedValueControlSource * self)
   }
   self->nvalues = 0;
   self->valid_cache = FALSE;
+  gst_timed_value_control_source_invalidate_segment_cache (self);
 
   g_mutex_unlock (&self->lock);
 }
@@ -446,7 +496,10 @@ gst_timed_value_control_invalidate_cache (GstTimedValueControlSource * self)
 static void
 gst_timed_value_control_source_init (GstTimedValueControlSource * self)
 {
+  self->priv = gst_timed_value_control_source_get_instance_private (self);
+
   g_mutex_init (&self->lock);
+  gst_timed_value_control_source_invalidate_segment_cache (self);
 }
 
 static void
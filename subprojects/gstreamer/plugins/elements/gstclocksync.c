@@ -57,6 +57,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_clock_sync_debug);
 #define DEFAULT_SYNC                    TRUE
 #define DEFAULT_TS_OFFSET               0
 #define DEFAULT_SYNC_TO_FIRST           FALSE
+#define DEFAULT_PUSH_STATS              FALSE
 
 enum
 {
@@ -64,6 +65,8 @@ enum
   PROP_SYNC,
   PROP_TS_OFFSET,
   PROP_SYNC_TO_FIRST,
+  PROP_PUSH_STATS,
+  PROP_STATS,
   PROP_LAST
 };
 
@@ -156,6 +159,44 @@ gst_clock_sync_class_init (GstClockSyncClass * klass)
       "Note that mixed use of ts-offset and this property would be racy "
       "if clocksync element is running already.",
       DEFAULT_SYNC_TO_FIRST, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+  /**
+   * GstClockSync:push-stats:
+   *
+   * When enabled, measure the wall-clock time each downstream push takes
+   * and accumulate it into #GstClockSync:stats. This makes it possible to
+   * quantify the per-buffer cost of the elements downstream of clocksync
+   * (up to the next decoupling element such as a queue) in a running
+   * pipeline, without the global overhead of a tracer. Enabling this
+   * property resets the accumulated statistics.
+   *
+   * Since: 1.24
+   */
+  properties[PROP_PUSH_STATS] =
+      g_param_spec_boolean ("push-stats", "Push stats",
+      "Measure the time spent in each downstream push",
+      DEFAULT_PUSH_STATS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+  /**
+   * GstClockSync:stats:
+   *
+   * Downstream push timing statistics, collected while
+   * #GstClockSync:push-stats is enabled. This property returns a
+   * #GstStructure with name `application/x-gst-clocksync-stats` with the
+   * following fields:
+   *
+   * - "num-pushes" G_TYPE_UINT64 Number of timed pushes
+   * - "push-time-min" G_TYPE_UINT64 Shortest push in nanoseconds
+   * - "push-time-max" G_TYPE_UINT64 Longest push in nanoseconds
+   * - "push-time-average" G_TYPE_UINT64 Average push in nanoseconds
+   *
+   * Since: 1.24
+   */
+  properties[PROP_STATS] =
+      g_param_spec_boxed ("stats", "Statistics",
+      "Downstream push timing statistics", GST_TYPE_STRUCTURE,
+      G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
   g_object_class_install_properties (gobject_class, PROP_LAST, properties);
 
   gstelement_class->change_state =
@@ -205,6 +246,8 @@ gst_clock_sync_init (GstClockSync * clocksync)
   clocksync->ts_offset = DEFAULT_TS_OFFSET;
   clocksync->sync = DEFAULT_SYNC;
   clocksync->sync_to_first = DEFAULT_SYNC_TO_FIRST;
+  clocksync->push_stats = DEFAULT_PUSH_STATS;
+  clocksync->push_min = GST_CLOCK_TIME_NONE;
   g_cond_init (&clocksync->blocked_cond);
 
   GST_OBJECT_FLAG_SET (clocksync, GST_ELEMENT_FLAG_PROVIDE_CLOCK);
@@ -248,6 +291,17 @@ gst_clock_sync_set_property (GObject * object, guint prop_id,
     case PROP_SYNC_TO_FIRST:
       clocksync->sync_to_first = g_value_get_boolean (value);
       break;
+    case PROP_PUSH_STATS:
+      GST_OBJECT_LOCK (clocksync);
+      clocksync->push_stats = g_value_get_boolean (value);
+      if (clocksync->push_stats) {
+        clocksync->push_count = 0;
+        clocksync->push_total = 0;
+        clocksync->push_min = GST_CLOCK_TIME_NONE;
+        clocksync->push_max = 0;
+      }
+      GST_OBJECT_UNLOCK (clocksync);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -270,6 +324,27 @@ gst_clock_sync_get_property (GObject * object, guint prop_id,
     case PROP_SYNC_TO_FIRST:
       g_value_set_boolean (value, clocksync->sync_to_first);
       break;
+    case PROP_PUSH_STATS:
+      GST_OBJECT_LOCK (clocksync);
+      g_value_set_boolean (value, clocksync->push_stats);
+      GST_OBJECT_UNLOCK (clocksync);
+      break;
+    case PROP_STATS:{
+      GstStructure *s;
+
+      GST_OBJECT_LOCK (clocksync);
+      s = gst_structure_new ("application/x-gst-clocksync-stats",
+          "num-pushes", G_TYPE_UINT64, clocksync->push_count,
+          "push-time-min", G_TYPE_UINT64,
+          clocksync->push_count ? clocksync->push_min : 0,
+          "push-time-max", G_TYPE_UINT64, clocksync->push_max,
+          "push-time-average", G_TYPE_UINT64,
+          clocksync->push_count ?
+          clocksync->push_total / clocksync->push_count : 0, NULL);
+      GST_OBJECT_UNLOCK (clocksync);
+      g_value_take_boxed (value, s);
+      break;
+    }
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -453,6 +528,21 @@ gst_clock_sync_update_ts_offset (GstClockSync * clocksync,
   }
 }
 
+static void
+gst_clock_sync_update_push_stats (GstClockSync * clocksync,
+    GstClockTime elapsed)
+{
+  GST_OBJECT_LOCK (clocksync);
+  clocksync->push_count++;
+  clocksync->push_total += elapsed;
+  if (!GST_CLOCK_TIME_IS_VALID (clocksync->push_min)
+      || elapsed < clocksync->push_min)
+    clocksync->push_min = elapsed;
+  if (elapsed > clocksync->push_max)
+    clocksync->push_max = elapsed;
+  GST_OBJECT_UNLOCK (clocksync);
+}
+
 static GstFlowReturn
 gst_clock_sync_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 {
@@ -498,6 +588,15 @@ gst_clock_sync_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   }
 
   /* Forward the buffer */
+  if (G_UNLIKELY (clocksync->push_stats)) {
+    GstClockTime start = gst_util_get_timestamp ();
+
+    ret = gst_pad_push (clocksync->srcpad, buf);
+    gst_clock_sync_update_push_stats (clocksync,
+        gst_util_get_timestamp () - start);
+    return ret;
+  }
+
   return gst_pad_push (clocksync->srcpad, buf);
 }
 
@@ -542,6 +641,15 @@ gst_clock_sync_chain_list (GstPad * pad, GstObject * parent,
 
   /* Forward the buffer list */
 done:
+  if (G_UNLIKELY (clocksync->push_stats)) {
+    GstClockTime start = gst_util_get_timestamp ();
+
+    ret = gst_pad_push_list (clocksync->srcpad, buffer_list);
+    gst_clock_sync_update_push_stats (clocksync,
+        gst_util_get_timestamp () - start);
+    return ret;
+  }
+
   return gst_pad_push_list (clocksync->srcpad, buffer_list);
 }
 
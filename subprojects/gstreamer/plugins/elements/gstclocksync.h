@@ -63,6 +63,13 @@ struct _GstClockSync
   gboolean is_first;
 
   GstClockTime   upstream_latency;
+
+  /* downstream push timing stats, protected by the object lock */
+  gboolean       push_stats;
+  guint64        push_count;
+  GstClockTime   push_total;
+  GstClockTime   push_min;
+  GstClockTime   push_max;
 };
 
 struct _GstClockSyncClass
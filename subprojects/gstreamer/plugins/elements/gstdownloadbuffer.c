@@ -101,6 +101,12 @@ enum
 #define DEFAULT_LOW_PERCENT        10
 #define DEFAULT_HIGH_PERCENT       99
 #define DEFAULT_TEMP_REMOVE        TRUE
+#define DEFAULT_CACHE_CLEANUP      GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_NONE
+#define DEFAULT_CACHE_KEEP         (16 * 1024 * 1024)   /* 16 MB */
+
+/* clean up consumed data in batches of at least this much, doing it per
+ * buffer would be mostly syscall overhead */
+#define CACHE_CLEANUP_GRANULARITY  (1024 * 1024)
 
 enum
 {
@@ -112,9 +118,40 @@ enum
   PROP_TEMP_TEMPLATE,
   PROP_TEMP_LOCATION,
   PROP_TEMP_REMOVE,
+  PROP_CACHE_CLEANUP,
+  PROP_CACHE_KEEP,
   PROP_LAST
 };
 
+typedef enum
+{
+  GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_NONE,
+  GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_FADVISE,
+  GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_PUNCH
+} GstDownloadBufferCacheCleanup;
+
+#define GST_TYPE_DOWNLOAD_BUFFER_CACHE_CLEANUP \
+    (gst_download_buffer_cache_cleanup_get_type ())
+static GType
+gst_download_buffer_cache_cleanup_get_type (void)
+{
+  static GType cache_cleanup_type = 0;
+  static const GEnumValue cache_cleanup[] = {
+    {GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_NONE, "No cleanup", "none"},
+    {GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_FADVISE,
+        "Drop consumed data from the page cache", "fadvise"},
+    {GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_PUNCH,
+        "Also release the disk space of consumed data", "punch"},
+    {0, NULL, NULL},
+  };
+
+  if (!cache_cleanup_type) {
+    cache_cleanup_type =
+        g_enum_register_static ("GstDownloadBufferCacheCleanup", cache_cleanup);
+  }
+  return cache_cleanup_type;
+}
+
 #define GST_DOWNLOAD_BUFFER_CLEAR_LEVEL(l) G_STMT_START {         \
   l.bytes = 0;                                          \
   l.time = 0;                                           \
@@ -268,6 +305,40 @@ gst_download_buffer_class_init (GstDownloadBufferClass * klass)
           "Remove the temp-location after use",
           DEFAULT_TEMP_REMOVE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstDownloadBuffer:cache-cleanup:
+   *
+   * How to clean up already consumed parts of the download. With "fadvise",
+   * consumed data is dropped from the page cache with
+   * posix_fadvise(DONTNEED) so it doesn't evict more useful pages; the data
+   * stays on disk. With "punch", the disk space is additionally released by
+   * punching holes into the temp file; data behind a punched hole is
+   * downloaded again when seeking back into it. This keeps memory and disk
+   * usage bounded regardless of the size of the download.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_CACHE_CLEANUP,
+      g_param_spec_enum ("cache-cleanup", "Cache cleanup",
+          "How to clean up consumed parts of the download",
+          GST_TYPE_DOWNLOAD_BUFFER_CACHE_CLEANUP, DEFAULT_CACHE_CLEANUP,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstDownloadBuffer:cache-keep:
+   *
+   * Amount of consumed data behind the read position to leave untouched by
+   * #GstDownloadBuffer:cache-cleanup, so that small seeks back don't hit
+   * the disk or the network.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_CACHE_KEEP,
+      g_param_spec_uint64 ("cache-keep", "Cache keep",
+          "Amount of consumed data to keep behind the read position (bytes)",
+          0, G_MAXUINT64, DEFAULT_CACHE_KEEP,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /* set several parent class virtual functions */
   gobject_class->finalize = gst_download_buffer_finalize;
 
@@ -282,6 +353,8 @@ gst_download_buffer_class_init (GstDownloadBufferClass * klass)
       GST_DEBUG_FUNCPTR (gst_download_buffer_change_state);
   gstelement_class->query =
       GST_DEBUG_FUNCPTR (gst_download_buffer_handle_query);
+
+  gst_type_mark_as_plugin_api (GST_TYPE_DOWNLOAD_BUFFER_CACHE_CLEANUP, 0);
 }
 
 static void
@@ -333,6 +406,9 @@ gst_download_buffer_init (GstDownloadBuffer * dlbuf)
   dlbuf->temp_template = NULL;
   dlbuf->temp_location = NULL;
   dlbuf->temp_remove = DEFAULT_TEMP_REMOVE;
+
+  dlbuf->cache_cleanup = DEFAULT_CACHE_CLEANUP;
+  dlbuf->cache_keep = DEFAULT_CACHE_KEEP;
 }
 
 /* called only once, as opposed to dispose */
@@ -358,6 +434,7 @@ reset_positions (GstDownloadBuffer * dlbuf)
 {
   dlbuf->write_pos = 0;
   dlbuf->read_pos = 0;
+  dlbuf->cleaned_pos = 0;
   dlbuf->filling = TRUE;
   dlbuf->buffering_percent = 0;
   dlbuf->is_buffering = TRUE;
@@ -765,6 +842,39 @@ check_upstream_size (GstDownloadBuffer * dlbuf, gsize offset, guint * length)
   return TRUE;
 }
 
+/* clean up consumed data well behind the read position, called with
+ * DOWNLOAD_BUFFER_MUTEX */
+static void
+gst_download_buffer_cleanup_behind (GstDownloadBuffer * dlbuf)
+{
+  guint64 target;
+
+  if (dlbuf->cache_cleanup_active == GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_NONE)
+    return;
+
+  if (dlbuf->read_pos <= dlbuf->cache_keep)
+    return;
+
+  target = dlbuf->read_pos - dlbuf->cache_keep;
+  if (target < dlbuf->cleaned_pos + CACHE_CLEANUP_GRANULARITY)
+    return;
+
+  GST_LOG_OBJECT (dlbuf, "cleaning up consumed region %" G_GUINT64_FORMAT
+      "-%" G_GUINT64_FORMAT, dlbuf->cleaned_pos, target);
+
+  if (dlbuf->cache_cleanup_active == GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_PUNCH) {
+    if (!gst_sparse_file_punch_hole (dlbuf->file, dlbuf->cleaned_pos, target)) {
+      GST_WARNING_OBJECT (dlbuf, "hole punching not supported, falling back "
+          "to page cache eviction");
+      dlbuf->cache_cleanup_active = GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_FADVISE;
+    }
+  }
+  if (dlbuf->cache_cleanup_active == GST_DOWNLOAD_BUFFER_CACHE_CLEANUP_FADVISE)
+    gst_sparse_file_advise_done (dlbuf->file, dlbuf->cleaned_pos, target);
+
+  dlbuf->cleaned_pos = target;
+}
+
 /* called with DOWNLOAD_BUFFER_MUTEX */
 static GstFlowReturn
 gst_download_buffer_read_buffer (GstDownloadBuffer * dlbuf, guint64 offset,
@@ -822,6 +932,8 @@ gst_download_buffer_read_buffer (GstDownloadBuffer * dlbuf, guint64 offset,
   dlbuf->bytes_out += res;
   dlbuf->read_pos += res;
 
+  gst_download_buffer_cleanup_behind (dlbuf);
+
   GST_DEBUG_OBJECT (dlbuf,
       "Read %" G_GSIZE_FORMAT " bytes, remaining %" G_GSIZE_FORMAT, res,
       remaining);
@@ -910,6 +1022,7 @@ gst_download_buffer_open_temp_location_file (GstDownloadBuffer * dlbuf)
   g_free (dlbuf->temp_location);
   dlbuf->temp_location = name;
   dlbuf->temp_fd = fd;
+  dlbuf->cache_cleanup_active = dlbuf->cache_cleanup;
   reset_positions (dlbuf);
 
   GST_DOWNLOAD_BUFFER_MUTEX_UNLOCK (dlbuf);
@@ -1922,6 +2035,12 @@ gst_download_buffer_set_property (GObject * object,
     case PROP_TEMP_REMOVE:
       dlbuf->temp_remove = g_value_get_boolean (value);
       break;
+    case PROP_CACHE_CLEANUP:
+      dlbuf->cache_cleanup = g_value_get_enum (value);
+      break;
+    case PROP_CACHE_KEEP:
+      dlbuf->cache_keep = g_value_get_uint64 (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1964,6 +2083,12 @@ gst_download_buffer_get_property (GObject * object,
     case PROP_TEMP_REMOVE:
       g_value_set_boolean (value, dlbuf->temp_remove);
       break;
+    case PROP_CACHE_CLEANUP:
+      g_value_set_enum (value, dlbuf->cache_cleanup);
+      break;
+    case PROP_CACHE_KEEP:
+      g_value_set_uint64 (value, dlbuf->cache_keep);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -110,6 +110,12 @@ struct _GstDownloadBuffer
   gint temp_fd;
   gboolean seeking;
 
+  /* cleanup of consumed data */
+  gint cache_cleanup;          /* configured cleanup mode */
+  gint cache_cleanup_active;   /* mode in use, may be downgraded at runtime */
+  guint64 cache_keep;          /* bytes to keep behind the read position */
+  guint64 cleaned_pos;         /* everything before this was cleaned up */
+
   GstEvent *stream_start_event;
   GstEvent *segment_event;
 };
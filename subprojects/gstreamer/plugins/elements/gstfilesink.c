@@ -34,6 +34,11 @@
  *
  */
 
+/* must come before any system header for O_DIRECT to be visible on glibc */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE 1
+#endif
+
 #ifdef HAVE_CONFIG_H
 #  include "config.h"
 #endif
@@ -110,8 +115,14 @@ GST_DEBUG_CATEGORY_STATIC (gst_file_sink_debug);
 #define DEFAULT_BUFFER_SIZE 	64 * 1024
 #define DEFAULT_APPEND		FALSE
 #define DEFAULT_O_SYNC		FALSE
+#define DEFAULT_O_DIRECT	FALSE
 #define DEFAULT_MAX_TRANSIENT_ERROR_TIMEOUT	0
 
+/* O_DIRECT needs the file offset, the transfer size and the user memory all
+ * aligned; the logical block size of basically every file system in use is
+ * at most this */
+#define O_DIRECT_ALIGNMENT	4096
+
 enum
 {
   PROP_0,
@@ -120,6 +131,7 @@ enum
   PROP_BUFFER_SIZE,
   PROP_APPEND,
   PROP_O_SYNC,
+  PROP_O_DIRECT,
   PROP_MAX_TRANSIENT_ERROR_TIMEOUT,
   PROP_LAST
 };
@@ -128,7 +140,8 @@ enum
  * use the 'file pointer' opened in glib (and returned from this function)
  * in this library, as they may have unrelated C runtimes. */
 static FILE *
-gst_fopen (const gchar * filename, const gchar * mode, gboolean o_sync)
+gst_fopen (const gchar * filename, const gchar * mode, gboolean o_sync,
+    gboolean o_direct)
 {
   FILE *retval;
 #ifdef G_OS_WIN32
@@ -151,6 +164,11 @@ gst_fopen (const gchar * filename, const gchar * mode, gboolean o_sync)
   if (o_sync)
     flags |= O_SYNC;
 
+#ifdef O_DIRECT
+  if (o_direct)
+    flags |= O_DIRECT;
+#endif
+
   fd = open (filename, flags, 0666);
 
   if (fd < 0)
@@ -245,6 +263,23 @@ gst_file_sink_class_init (GstFileSinkClass * klass)
           "Open the file with O_SYNC for enabling synchronous IO",
           DEFAULT_O_SYNC, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstFileSink:o-direct:
+   *
+   * Open the file with O_DIRECT and coalesce incoming buffers into an
+   * aligned write buffer, bypassing the page cache. This avoids evicting
+   * useful pages when recording large files, at the cost of an extra copy.
+   * Forces full buffering, is ignored on platforms without O_DIRECT or
+   * together with #GstFileSink:append, and is dropped at runtime as soon
+   * as an unaligned write (e.g. after a seek) is required.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_O_DIRECT,
+      g_param_spec_boolean ("o-direct", "Direct IO",
+          "Bypass the page cache using O_DIRECT", DEFAULT_O_DIRECT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   g_object_class_install_property (gobject_class,
       PROP_MAX_TRANSIENT_ERROR_TIMEOUT,
       g_param_spec_int ("max-transient-error-timeout",
@@ -287,6 +322,7 @@ gst_file_sink_init (GstFileSink * filesink)
   filesink->buffer_mode = DEFAULT_BUFFER_MODE;
   filesink->buffer_size = DEFAULT_BUFFER_SIZE;
   filesink->append = FALSE;
+  filesink->o_direct = DEFAULT_O_DIRECT;
 
   gst_base_sink_set_sync (GST_BASE_SINK (filesink), FALSE);
 }
@@ -361,6 +397,9 @@ gst_file_sink_set_property (GObject * object, guint prop_id,
     case PROP_O_SYNC:
       sink->o_sync = g_value_get_boolean (value);
       break;
+    case PROP_O_DIRECT:
+      sink->o_direct = g_value_get_boolean (value);
+      break;
     case PROP_MAX_TRANSIENT_ERROR_TIMEOUT:
       sink->max_transient_error_timeout = g_value_get_int (value);
       break;
@@ -392,6 +431,9 @@ gst_file_sink_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_O_SYNC:
       g_value_set_boolean (value, sink->o_sync);
       break;
+    case PROP_O_DIRECT:
+      g_value_set_boolean (value, sink->o_direct);
+      break;
     case PROP_MAX_TRANSIENT_ERROR_TIMEOUT:
       g_value_set_int (value, sink->max_transient_error_timeout);
       break;
@@ -404,14 +446,41 @@ gst_file_sink_get_property (GObject * object, guint prop_id, GValue * value,
 static gboolean
 gst_file_sink_open_file (GstFileSink * sink)
 {
+  gboolean o_direct = sink->o_direct;
+
   /* open the file */
   if (sink->filename == NULL || sink->filename[0] == '\0')
     goto no_filename;
 
+  sink->o_direct_active = FALSE;
+#ifndef O_DIRECT
+  if (o_direct) {
+    GST_WARNING_OBJECT (sink, "O_DIRECT is not supported on this platform");
+    o_direct = FALSE;
+  }
+#endif
+  if (o_direct && sink->append) {
+    /* appending starts writing at an arbitrary (likely unaligned) offset */
+    GST_WARNING_OBJECT (sink, "O_DIRECT cannot be used together with append");
+    o_direct = FALSE;
+  }
+
   if (sink->append)
-    sink->file = gst_fopen (sink->filename, "ab", sink->o_sync);
+    sink->file = gst_fopen (sink->filename, "ab", sink->o_sync, FALSE);
   else
-    sink->file = gst_fopen (sink->filename, "wb", sink->o_sync);
+    sink->file = gst_fopen (sink->filename, "wb", sink->o_sync, o_direct);
+
+  if (o_direct) {
+    if (sink->file == NULL && errno == EINVAL) {
+      /* the file system doesn't support direct I/O, fall back gracefully */
+      GST_WARNING_OBJECT (sink, "O_DIRECT not supported for \"%s\", "
+          "falling back to buffered writes", sink->filename);
+      sink->file = gst_fopen (sink->filename, "wb", sink->o_sync, FALSE);
+    } else if (sink->file != NULL) {
+      sink->o_direct_active = TRUE;
+    }
+  }
+
   if (sink->file == NULL)
     goto open_failed;
 
@@ -419,21 +488,36 @@ gst_file_sink_open_file (GstFileSink * sink)
   /* try to seek in the file to figure out if it is seekable */
   sink->seekable = gst_file_sink_do_seek (sink, 0);
 
-  if (sink->buffer)
-    g_free (sink->buffer);
+  if (sink->buffer_base)
+    g_free (sink->buffer_base);
+  sink->buffer_base = NULL;
   sink->buffer = NULL;
   if (sink->buffer_list)
     gst_buffer_list_unref (sink->buffer_list);
   sink->buffer_list = NULL;
 
-  if (sink->buffer_mode != GST_FILE_SINK_BUFFER_MODE_UNBUFFERED) {
+  if (sink->buffer_mode != GST_FILE_SINK_BUFFER_MODE_UNBUFFERED
+      || sink->o_direct_active) {
     if (sink->buffer_size == 0) {
       sink->buffer_size = DEFAULT_BUFFER_SIZE;
       g_object_notify (G_OBJECT (sink), "buffer-size");
     }
 
-    if (sink->buffer_mode == GST_FILE_SINK_BUFFER_MODE_FULL) {
+    if (sink->o_direct_active) {
+      /* O_DIRECT only writes whole logical blocks from block-aligned memory,
+       * so force full buffering into an aligned coalescing buffer.
+       * Over-allocate and round up the pointer ourselves, g_malloc() makes
+       * no alignment promises beyond what malloc() gives us */
+      gsize size = (sink->buffer_size + O_DIRECT_ALIGNMENT - 1) &
+          ~(gsize) (O_DIRECT_ALIGNMENT - 1);
+
+      sink->buffer_base = g_malloc (size + O_DIRECT_ALIGNMENT - 1);
+      sink->buffer = (guint8 *) (((guintptr) sink->buffer_base +
+              O_DIRECT_ALIGNMENT - 1) & ~(guintptr) (O_DIRECT_ALIGNMENT - 1));
+      sink->allocated_buffer_size = size;
+    } else if (sink->buffer_mode == GST_FILE_SINK_BUFFER_MODE_FULL) {
       sink->buffer = g_malloc (sink->buffer_size);
+      sink->buffer_base = sink->buffer;
       sink->allocated_buffer_size = sink->buffer_size;
     } else {
       sink->buffer_list = gst_buffer_list_new ();
@@ -478,11 +562,13 @@ gst_file_sink_close_file (GstFileSink * sink)
     sink->file = NULL;
   }
 
-  if (sink->buffer) {
-    g_free (sink->buffer);
+  if (sink->buffer_base) {
+    g_free (sink->buffer_base);
+    sink->buffer_base = NULL;
     sink->buffer = NULL;
   }
   sink->allocated_buffer_size = 0;
+  sink->o_direct_active = FALSE;
 
   if (sink->buffer_list) {
     gst_buffer_list_unref (sink->buffer_list);
@@ -544,6 +630,28 @@ gst_file_sink_query (GstBaseSink * bsink, GstQuery * query)
   return res;
 }
 
+/* give up on direct I/O for the rest of the file, needed whenever something
+ * unaligned has to be written */
+static void
+gst_file_sink_o_direct_off (GstFileSink * filesink)
+{
+#ifdef O_DIRECT
+  if (!filesink->o_direct_active)
+    return;
+
+  GST_DEBUG_OBJECT (filesink, "disabling O_DIRECT for unaligned writing");
+
+  if (filesink->file) {
+    int fd = fileno (filesink->file);
+    int flags = fcntl (fd, F_GETFL);
+
+    if (flags >= 0)
+      fcntl (fd, F_SETFL, flags & ~O_DIRECT);
+  }
+  filesink->o_direct_active = FALSE;
+#endif
+}
+
 #ifdef HAVE_FSEEKO
 # define __GST_STDIO_SEEK_FUNCTION "fseeko"
 #elif defined (G_OS_UNIX) || defined (G_OS_WIN32)
@@ -561,6 +669,11 @@ gst_file_sink_do_seek (GstFileSink * filesink, guint64 new_offset)
   if (gst_file_sink_flush_buffer (filesink) != GST_FLOW_OK)
     goto flush_buffer_failed;
 
+  /* direct I/O can't continue from an unaligned file position */
+  if (filesink->o_direct_active
+      && (new_offset & (O_DIRECT_ALIGNMENT - 1)) != 0)
+    gst_file_sink_o_direct_off (filesink);
+
 #ifdef HAVE_FSEEKO
   if (fseeko (filesink->file, (off_t) new_offset, SEEK_SET) != 0)
     goto seek_failed;
@@ -749,7 +862,7 @@ no_data:
 }
 
 static GstFlowReturn
-gst_file_sink_flush_buffer (GstFileSink * filesink)
+gst_file_sink_flush_buffer_internal (GstFileSink * filesink, gboolean drain)
 {
   GstFlowReturn flow_ret = GST_FLOW_OK;
 
@@ -757,14 +870,28 @@ gst_file_sink_flush_buffer (GstFileSink * filesink)
       filesink->current_buffer_size);
 
   if (filesink->buffer && filesink->current_buffer_size) {
+    gsize flush_size = filesink->current_buffer_size;
     guint64 skip = 0;
 
+    if (filesink->o_direct_active) {
+      if (!drain) {
+        /* O_DIRECT only writes whole blocks, keep the unaligned tail around
+         * for the next flush */
+        flush_size &= ~(gsize) (O_DIRECT_ALIGNMENT - 1);
+        if (flush_size == 0)
+          return GST_FLOW_OK;
+      } else if ((flush_size & (O_DIRECT_ALIGNMENT - 1)) != 0) {
+        /* the unaligned tail has to go to the file now */
+        gst_file_sink_o_direct_off (filesink);
+      }
+    }
+
     for (;;) {
       guint64 bytes_written = 0;
 
       flow_ret =
           gst_writev_mem (GST_OBJECT_CAST (filesink), fileno (filesink->file),
-          NULL, filesink->buffer, filesink->current_buffer_size, &bytes_written,
+          NULL, filesink->buffer, flush_size, &bytes_written,
           skip, filesink->max_transient_error_timeout, filesink->current_pos,
           &filesink->flushing);
 
@@ -778,6 +905,14 @@ gst_file_sink_flush_buffer (GstFileSink * filesink)
       if (flow_ret != GST_FLOW_OK)
         break;
     }
+
+    if (flow_ret == GST_FLOW_OK && flush_size < filesink->current_buffer_size) {
+      /* move the retained tail to the front of the buffer */
+      memmove (filesink->buffer, filesink->buffer + flush_size,
+          filesink->current_buffer_size - flush_size);
+      filesink->current_buffer_size -= flush_size;
+      return flow_ret;
+    }
   } else if (filesink->buffer_list && filesink->current_buffer_size) {
     guint length;
 
@@ -797,6 +932,12 @@ gst_file_sink_flush_buffer (GstFileSink * filesink)
   return flow_ret;
 }
 
+static GstFlowReturn
+gst_file_sink_flush_buffer (GstFileSink * filesink)
+{
+  return gst_file_sink_flush_buffer_internal (filesink, TRUE);
+}
+
 static gboolean
 has_sync_after_buffer (GstBuffer ** buffer, guint idx, gpointer user_data)
 {
@@ -827,6 +968,9 @@ render_buffer (GstFileSink * filesink, GstBuffer * buffer)
   guint64 bytes_written = 0;
   guint64 skip = 0;
 
+  /* arbitrary buffer memories are not going to be block aligned */
+  gst_file_sink_o_direct_off (filesink);
+
   for (;;) {
     flow =
         gst_writev_buffer (GST_OBJECT_CAST (filesink),
@@ -887,18 +1031,23 @@ gst_file_sink_render_list (GstBaseSink * bsink, GstBufferList * buffer_list)
 
         if (sink->current_buffer_size + buffer_size >
             sink->allocated_buffer_size) {
-          flow = gst_file_sink_flush_buffer (sink);
+          flow = gst_file_sink_flush_buffer_internal (sink, FALSE);
           if (flow != GST_FLOW_OK)
             return flow;
         }
 
-        if (buffer_size > sink->allocated_buffer_size) {
+        if (sink->current_buffer_size + buffer_size >
+            sink->allocated_buffer_size) {
           GST_DEBUG_OBJECT (sink,
               "writing buffer ( %" G_GSIZE_FORMAT
               " bytes) at position %" G_GUINT64_FORMAT,
               buffer_size, sink->current_pos);
 
-          flow = render_buffer (sink, buffer);
+          /* doesn't fit behind the retained tail either, drain and write it
+           * out directly to keep the bytes in order */
+          flow = gst_file_sink_flush_buffer (sink);
+          if (flow == GST_FLOW_OK)
+            flow = render_buffer (sink, buffer);
         } else {
           sink->current_buffer_size +=
               gst_buffer_extract (buffer, 0,
@@ -972,18 +1121,23 @@ gst_file_sink_render (GstBaseSink * sink, GstBuffer * buffer)
     if (filesink->buffer) {
       if (filesink->current_buffer_size + size >
           filesink->allocated_buffer_size) {
-        flow = gst_file_sink_flush_buffer (filesink);
+        flow = gst_file_sink_flush_buffer_internal (filesink, FALSE);
         if (flow != GST_FLOW_OK)
           return flow;
       }
 
-      if (size > filesink->allocated_buffer_size) {
+      if (filesink->current_buffer_size + size >
+          filesink->allocated_buffer_size) {
         GST_DEBUG_OBJECT (sink,
             "writing buffer ( %" G_GSIZE_FORMAT
             " bytes) at position %" G_GUINT64_FORMAT,
             size, filesink->current_pos);
 
-        flow = render_buffer (filesink, buffer);
+        /* doesn't fit behind the retained tail either, drain and write it
+         * out directly to keep the bytes in order */
+        flow = gst_file_sink_flush_buffer (filesink);
+        if (flow == GST_FLOW_OK)
+          flow = render_buffer (filesink, buffer);
       } else {
         filesink->current_buffer_size +=
             gst_buffer_extract (buffer, 0,
@@ -86,6 +86,8 @@ struct _GstFileSink {
 
   /* For full buffer mode */
   guint8 *buffer;
+  guint8 *buffer_base;        /* allocation backing buffer, which may be
+                               * rounded up for O_DIRECT alignment */
   gsize   allocated_buffer_size;
 
   /* For default/full buffer mode */
@@ -93,6 +95,8 @@ struct _GstFileSink {
 
   gboolean append;
   gboolean o_sync;
+  gboolean o_direct;          /* whether to request O_DIRECT writes */
+  gboolean o_direct_active;   /* whether the file is open with O_DIRECT */
   gint max_transient_error_timeout;
 
   gboolean flushing;
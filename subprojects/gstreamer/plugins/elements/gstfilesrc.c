@@ -33,6 +33,11 @@
  *
  */
 
+/* must come before any system header for O_DIRECT to be visible on glibc */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE 1
+#endif
+
 #ifdef HAVE_CONFIG_H
 #  include "config.h"
 #endif
@@ -110,11 +115,20 @@ enum
 };
 
 #define DEFAULT_BLOCKSIZE       4*1024
+#define DEFAULT_O_DIRECT        FALSE
+#define DEFAULT_READAHEAD       0
+
+/* O_DIRECT needs the file offset, the transfer size and the user memory all
+ * aligned; the logical block size of basically every file system in use is
+ * at most this */
+#define O_DIRECT_ALIGNMENT      4096
 
 enum
 {
   PROP_0,
-  PROP_LOCATION
+  PROP_LOCATION,
+  PROP_O_DIRECT,
+  PROP_READAHEAD
 };
 
 static void gst_file_src_finalize (GObject * object);
@@ -163,6 +177,41 @@ gst_file_src_class_init (GstFileSrcClass * klass)
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
           GST_PARAM_MUTABLE_READY));
 
+  /**
+   * GstFileSrc:o-direct:
+   *
+   * Open the file with O_DIRECT and read through an aligned bounce buffer,
+   * bypassing the page cache. This avoids polluting the page cache when
+   * streaming files much larger than memory, at the cost of an extra copy.
+   * Ignored on platforms without O_DIRECT, and disabled with a warning when
+   * the file system does not support it.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_O_DIRECT,
+      g_param_spec_boolean ("o-direct", "O_DIRECT",
+          "Bypass the page cache using O_DIRECT", DEFAULT_O_DIRECT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
+  /**
+   * GstFileSrc:readahead:
+   *
+   * Number of bytes to ask the kernel to read ahead of the current position
+   * with posix_fadvise(), so that disk reads overlap with downstream
+   * processing. 0 leaves the kernel's own readahead heuristics in place.
+   * Has no effect together with #GstFileSrc:o-direct, which bypasses the
+   * page cache entirely.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_READAHEAD,
+      g_param_spec_uint ("readahead", "Readahead",
+          "Bytes to read ahead of the current position (0 = kernel default)",
+          0, G_MAXUINT, DEFAULT_READAHEAD,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
   gobject_class->finalize = gst_file_src_finalize;
 
   gst_element_class_set_static_metadata (gstelement_class,
@@ -193,6 +242,9 @@ gst_file_src_init (GstFileSrc * src)
 
   src->is_regular = FALSE;
 
+  src->o_direct = DEFAULT_O_DIRECT;
+  src->readahead = DEFAULT_READAHEAD;
+
   gst_base_src_set_blocksize (GST_BASE_SRC (src), DEFAULT_BLOCKSIZE);
 }
 
@@ -270,6 +322,12 @@ gst_file_src_set_property (GObject * object, guint prop_id,
     case PROP_LOCATION:
       gst_file_src_set_location (src, g_value_get_string (value), NULL);
       break;
+    case PROP_O_DIRECT:
+      src->o_direct = g_value_get_boolean (value);
+      break;
+    case PROP_READAHEAD:
+      src->readahead = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -290,6 +348,12 @@ gst_file_src_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_LOCATION:
       g_value_set_string (value, src->filename);
       break;
+    case PROP_O_DIRECT:
+      g_value_set_boolean (value, src->o_direct);
+      break;
+    case PROP_READAHEAD:
+      g_value_set_uint (value, src->readahead);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -306,6 +370,112 @@ gst_file_src_get_property (GObject * object, guint prop_id, GValue * value,
  * the sort of attitude we want to be advertising.  No sir.
  *
  */
+
+#ifdef O_DIRECT
+/* O_DIRECT only reads whole logical blocks at block-aligned offsets into
+ * block-aligned memory, so read a block-aligned window around the requested
+ * range into the bounce buffer and copy the interesting part out */
+static GstFlowReturn
+gst_file_src_fill_o_direct (GstFileSrc * src, guint64 offset, guint length,
+    GstBuffer * buf)
+{
+  guint64 aligned_offset, avail;
+  gsize need, total;
+  guint copy_len;
+  gssize ret;
+  GstMapInfo info;
+
+  if (G_UNLIKELY (offset == (guint64) - 1))
+    offset = src->read_position;
+
+  aligned_offset = offset & ~(guint64) (O_DIRECT_ALIGNMENT - 1);
+  need = offset - aligned_offset + length;
+  need = (need + O_DIRECT_ALIGNMENT - 1) & ~(gsize) (O_DIRECT_ALIGNMENT - 1);
+
+  if (src->bounce_size < need) {
+    /* over-allocate and round up the pointer ourselves, g_malloc() makes no
+     * alignment promises beyond what malloc() gives us */
+    g_free (src->bounce_base);
+    src->bounce_base = g_malloc (need + O_DIRECT_ALIGNMENT - 1);
+    src->bounce = (guint8 *) (((guintptr) src->bounce_base +
+            O_DIRECT_ALIGNMENT - 1) & ~(guintptr) (O_DIRECT_ALIGNMENT - 1));
+    src->bounce_size = need;
+  }
+
+  if (G_UNLIKELY (src->read_position != aligned_offset)) {
+    off_t res;
+
+    res = lseek (src->fd, aligned_offset, SEEK_SET);
+    if (G_UNLIKELY (res < 0 || res != aligned_offset))
+      goto seek_failed;
+
+    src->read_position = aligned_offset;
+  }
+
+  total = 0;
+  while (total < need) {
+    GST_LOG_OBJECT (src, "Reading %" G_GSIZE_FORMAT " bytes at offset 0x%"
+        G_GINT64_MODIFIER "x", need - total, aligned_offset + total);
+    errno = 0;
+    ret = read (src->fd, src->bounce + total, need - total);
+    if (G_UNLIKELY (ret < 0)) {
+      if (errno == EAGAIN || errno == EINTR)
+        continue;
+      goto could_not_read;
+    }
+
+    /* a short read can only mean end of file here */
+    if (G_UNLIKELY (ret == 0))
+      break;
+
+    total += ret;
+    src->read_position += ret;
+  }
+
+  /* how much of the requested range the window actually covers */
+  if (total <= offset - aligned_offset)
+    goto eos;
+  avail = total - (offset - aligned_offset);
+  copy_len = MIN (avail, (guint64) length);
+
+  if (!gst_buffer_map (buf, &info, GST_MAP_WRITE))
+    goto buffer_write_fail;
+  memcpy (info.data, src->bounce + (offset - aligned_offset), copy_len);
+  gst_buffer_unmap (buf, &info);
+  if (copy_len != length)
+    gst_buffer_resize (buf, 0, copy_len);
+
+  GST_BUFFER_OFFSET (buf) = offset;
+  GST_BUFFER_OFFSET_END (buf) = offset + copy_len;
+
+  return GST_FLOW_OK;
+
+  /* ERROR */
+seek_failed:
+  {
+    GST_ELEMENT_ERROR (src, RESOURCE, READ, (NULL), GST_ERROR_SYSTEM);
+    return GST_FLOW_ERROR;
+  }
+could_not_read:
+  {
+    GST_ELEMENT_ERROR (src, RESOURCE, READ, (NULL), GST_ERROR_SYSTEM);
+    gst_buffer_resize (buf, 0, 0);
+    return GST_FLOW_ERROR;
+  }
+eos:
+  {
+    GST_DEBUG ("EOS");
+    gst_buffer_resize (buf, 0, 0);
+    return GST_FLOW_EOS;
+  }
+buffer_write_fail:
+  {
+    GST_ELEMENT_ERROR (src, RESOURCE, WRITE, (NULL), ("Can't write to buffer"));
+    return GST_FLOW_ERROR;
+  }
+}
+#endif /* O_DIRECT */
+
 static GstFlowReturn
 gst_file_src_fill (GstBaseSrc * basesrc, guint64 offset, guint length,
     GstBuffer * buf)
@@ -318,6 +488,11 @@ gst_file_src_fill (GstBaseSrc * basesrc, guint64 offset, guint length,
 
   src = GST_FILE_SRC_CAST (basesrc);
 
+#ifdef O_DIRECT
+  if (src->o_direct_active)
+    return gst_file_src_fill_o_direct (src, offset, length, buf);
+#endif
+
   if (G_UNLIKELY (offset != -1 && src->read_position != offset)) {
     off_t res;
 
@@ -328,6 +503,19 @@ gst_file_src_fill (GstBaseSrc * basesrc, guint64 offset, guint length,
     src->read_position = offset;
   }
 
+#ifdef POSIX_FADV_WILLNEED
+  /* keep the kernel reading ahead of us so that disk latency overlaps with
+   * downstream processing; re-advise once we get halfway into the window */
+  if (src->readahead > 0 && src->is_regular) {
+    guint64 pos = src->read_position + length;
+
+    if (pos + src->readahead / 2 > src->advised_end) {
+      posix_fadvise (src->fd, pos, src->readahead, POSIX_FADV_WILLNEED);
+      src->advised_end = pos + src->readahead;
+    }
+  }
+#endif
+
   if (!gst_buffer_map (buf, &info, GST_MAP_WRITE))
     goto buffer_write_fail;
   data = info.data;
@@ -464,9 +652,32 @@ gst_file_src_start (GstBaseSrc * basesrc)
 
   GST_INFO_OBJECT (src, "opening file %s", src->filename);
 
+  src->o_direct_active = FALSE;
+#ifdef O_DIRECT
+  if (src->o_direct)
+    flags |= O_DIRECT;
+#else
+  if (src->o_direct)
+    GST_WARNING_OBJECT (src, "O_DIRECT is not supported on this platform");
+#endif
+
   /* open the file */
   src->fd = g_open (src->filename, flags, 0);
 
+#ifdef O_DIRECT
+  if (src->o_direct) {
+    if (src->fd < 0 && errno == EINVAL) {
+      /* the file system doesn't support direct I/O, fall back gracefully */
+      GST_WARNING_OBJECT (src, "O_DIRECT not supported for \"%s\", "
+          "falling back to buffered reads", src->filename);
+      flags &= ~O_DIRECT;
+      src->fd = g_open (src->filename, flags, 0);
+    } else if (src->fd >= 0) {
+      src->o_direct_active = TRUE;
+    }
+  }
+#endif
+
   if (src->fd < 0)
     goto open_failed;
 
@@ -537,6 +748,14 @@ gst_file_src_start (GstBaseSrc * basesrc)
 
   gst_base_src_set_dynamic_size (basesrc, src->seekable);
 
+#ifdef POSIX_FADV_SEQUENTIAL
+  /* double the kernel's readahead window right away instead of waiting for
+   * its heuristics to catch on; useless with O_DIRECT */
+  if (src->readahead > 0 && src->is_regular && !src->o_direct_active)
+    posix_fadvise (src->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+  src->advised_end = 0;
+
   return TRUE;
 
   /* ERROR */
@@ -606,6 +825,13 @@ gst_file_src_stop (GstBaseSrc * basesrc)
   /* zero out a lot of our state */
   src->fd = 0;
   src->is_regular = FALSE;
+  src->o_direct_active = FALSE;
+  src->advised_end = 0;
+
+  g_free (src->bounce_base);
+  src->bounce_base = NULL;
+  src->bounce = NULL;
+  src->bounce_size = 0;
 
   return TRUE;
 }
@@ -63,6 +63,15 @@ struct _GstFileSrc {
   gboolean seekable;                    /* whether the file is seekable */
   gboolean is_regular;                  /* whether it's a (symlink to a)
                                            regular file */
+
+  gboolean o_direct;			/* whether to request O_DIRECT reads */
+  gboolean o_direct_active;		/* whether fd is open with O_DIRECT */
+  guint8 *bounce;			/* aligned bounce buffer for O_DIRECT */
+  guint8 *bounce_base;			/* allocation backing the bounce buffer */
+  gsize bounce_size;			/* usable size of the bounce buffer */
+
+  guint readahead;			/* readahead hint in bytes, 0 disables */
+  guint64 advised_end;			/* end of the range advised so far */
 };
 
 struct _GstFileSrcClass {
@@ -305,9 +305,43 @@ static gboolean
 forward_events (GstPad * pad, GstEvent ** event, gpointer user_data)
 {
   GstPad *srcpad = user_data;
+  GstEventType type = GST_EVENT_TYPE (*event);
+  GstEvent *cur = NULL;
+
+  if (type == GST_EVENT_EOS)
+    return TRUE;
+
+  /* Don't re-push an event that is equal to the one the srcpad already
+   * carries. With many inputs sharing the same caps and segment this avoids
+   * pushing a fresh caps/segment event downstream on every input switch.
+   * Only done for the single-instance sticky types, others (tags, ...) can
+   * have multiple instances per pad. */
+  switch (type) {
+    case GST_EVENT_STREAM_START:
+    case GST_EVENT_CAPS:
+    case GST_EVENT_SEGMENT:
+      cur = gst_pad_get_sticky_event (srcpad, type, 0);
+      break;
+    default:
+      break;
+  }
+
+  if (cur) {
+    const GstStructure *s1 = gst_event_get_structure (*event);
+    const GstStructure *s2 = gst_event_get_structure (cur);
+    gboolean equal = (s1 == s2) ||
+        (s1 != NULL && s2 != NULL && gst_structure_is_equal (s1, s2));
+
+    gst_event_unref (cur);
+
+    if (equal) {
+      GST_LOG_OBJECT (pad, "not re-pushing unchanged %s event",
+          GST_EVENT_TYPE_NAME (*event));
+      return TRUE;
+    }
+  }
 
-  if (GST_EVENT_TYPE (*event) != GST_EVENT_EOS)
-    gst_pad_push_event (srcpad, gst_event_ref (*event));
+  gst_pad_push_event (srcpad, gst_event_ref (*event));
 
   return TRUE;
 }
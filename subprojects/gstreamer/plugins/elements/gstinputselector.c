@@ -102,7 +102,9 @@ enum
   PROP_SYNC_STREAMS,
   PROP_SYNC_MODE,
   PROP_CACHE_BUFFERS,
-  PROP_DROP_BACKWARDS
+  PROP_DROP_BACKWARDS,
+  PROP_HOT_STANDBY,
+  PROP_STANDBY_TIME
 };
 
 #define DEFAULT_SYNC_STREAMS TRUE
@@ -110,6 +112,8 @@ enum
 #define DEFAULT_CACHE_BUFFERS FALSE
 #define DEFAULT_PAD_ALWAYS_OK TRUE
 #define DEFAULT_DROP_BACKWARDS FALSE
+#define DEFAULT_HOT_STANDBY FALSE
+#define DEFAULT_STANDBY_TIME (500 * GST_MSECOND)
 
 enum
 {
@@ -741,6 +745,38 @@ gst_input_selector_get_clipped_running_time (GstSegment * seg, GstBuffer * buf)
   return gst_segment_to_running_time (seg, GST_FORMAT_TIME, running_time);
 }
 
+/* must be called with the SELECTOR_LOCK. Trim the standby ring of @selpad so
+ * that it keeps no more than standby-time of data before its newest buffer */
+static void
+gst_selector_pad_trim_standby (GstInputSelector * sel, GstSelectorPad * selpad)
+{
+  GstSelectorPadCachedBuffer *head, *tail;
+  GstClockTime tail_time;
+
+  if (!selpad->cached_buffers)
+    return;
+
+  tail = g_queue_peek_tail (selpad->cached_buffers);
+  tail_time = gst_input_selector_get_clipped_running_time (&tail->segment,
+      tail->buffer);
+  if (!GST_CLOCK_TIME_IS_VALID (tail_time) || tail_time <= sel->standby_time)
+    return;
+
+  while ((head = g_queue_peek_head (selpad->cached_buffers)) && head != tail) {
+    GstClockTime running_time;
+
+    running_time = gst_input_selector_get_clipped_running_time (&head->segment,
+        head->buffer);
+    if (GST_CLOCK_TIME_IS_VALID (running_time)
+        && running_time >= tail_time - sel->standby_time)
+      break;
+
+    GST_DEBUG_OBJECT (selpad, "Trimming standby buffer %p", head->buffer);
+    g_queue_pop_head (selpad->cached_buffers);
+    gst_selector_pad_free_cached_buffer (head);
+  }
+}
+
 /* must be called without the SELECTOR_LOCK, will wait until the running time
  * of the active pad is after this pad or return TRUE when flushing */
 static gboolean
@@ -1078,11 +1114,20 @@ gst_selector_pad_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   /* In sync mode wait until the active pad has advanced
    * after the running time of the current buffer */
   if (sel->sync_streams) {
+    gboolean replay;
+
     /* call chain for each cached buffer if we are not the active pad
-     * or if we are the active pad but didn't push anything yet. */
-    if (active_sinkpad != pad || !selpad->pushed) {
-      /* no need to check for sel->cache_buffers as selpad->cached_buffers
-       * will only be valid if cache_buffers is TRUE */
+     * or if we are the active pad but didn't push anything yet. In
+     * hot-standby mode the standby ring must stay put until this pad
+     * becomes active. */
+    if (sel->hot_standby)
+      replay = (active_sinkpad == pad && !selpad->pushed);
+    else
+      replay = (active_sinkpad != pad || !selpad->pushed);
+
+    if (replay) {
+      /* no need to check for sel->cache_buffers or sel->hot_standby as
+       * selpad->cached_buffers will only be valid if one of them is TRUE */
       if (selpad->cached_buffers && !selpad->sending_cached_buffers) {
         GstSelectorPadCachedBuffer *cached_buffer;
         GstSegment saved_segment;
@@ -1122,7 +1167,9 @@ gst_selector_pad_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       }
     }
 
-    if (active_sinkpad != pad) {
+    /* in hot-standby mode inactive pads don't block on the active running
+     * time, they keep consuming so their standby ring stays current */
+    if (active_sinkpad != pad && !sel->hot_standby) {
       GST_INPUT_SELECTOR_UNLOCK (sel);
       if (gst_input_selector_wait_running_time (sel, selpad, buf))
         goto flushing;
@@ -1148,9 +1195,14 @@ gst_selector_pad_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
     GST_OBJECT_UNLOCK (pad);
   }
 
-  /* Ignore buffers from pads except the selected one */
-  if (pad != active_sinkpad)
+  /* Ignore buffers from pads except the selected one. In hot-standby mode
+   * keep them in the standby ring so the next switch can splice from the
+   * current position instead of waiting for new data */
+  if (pad != active_sinkpad) {
+    if (sel->sync_streams && sel->hot_standby)
+      goto standby;
     goto ignore;
+  }
 
   /* Tell all non-active pads that we advanced the running time */
   if (sel->sync_streams)
@@ -1186,9 +1238,11 @@ gst_selector_pad_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
   if (selpad->discont) {
     GST_INPUT_SELECTOR_LOCK (sel);
-    if (sel->sync_streams && sel->drop_backwards
+    if (sel->sync_streams && (sel->drop_backwards || sel->hot_standby)
         && GST_CLOCK_TIME_IS_VALID (running_time)) {
-      /* Just switched. Make sure timestamps don't go backwards */
+      /* Just switched. Make sure timestamps don't go backwards, in
+       * hot-standby mode this is what splices the replayed standby ring
+       * at the position the previous pad stopped */
       if (running_time < sel->last_output_ts
           && GST_CLOCK_TIME_IS_VALID (sel->last_output_ts)) {
         GST_DEBUG_OBJECT (pad, "Discarding buffer %p with backwards timestamp",
@@ -1240,6 +1294,29 @@ done:
 
   return res;
 
+  /* buffers kept on an inactive pad in hot-standby mode */
+standby:
+  {
+    gboolean active_pad_pushed = GST_SELECTOR_PAD_CAST (active_sinkpad)->pushed;
+
+    GST_DEBUG_OBJECT (pad, "Pad on standby, keeping buffer %p", buf);
+    /* when this pad is activated the replayed buffers get a discont */
+    selpad->discont = TRUE;
+    gst_selector_pad_cache_buffer (selpad, buf);
+    gst_selector_pad_trim_standby (sel, selpad);
+    GST_INPUT_SELECTOR_UNLOCK (sel);
+
+    /* figure out what to return upstream */
+    GST_OBJECT_LOCK (selpad);
+    if (selpad->always_ok || !active_pad_pushed)
+      res = GST_FLOW_OK;
+    else
+      res = GST_FLOW_NOT_LINKED;
+    GST_OBJECT_UNLOCK (selpad);
+
+    goto done;
+  }
+
   /* dropped buffers */
 ignore:
   {
@@ -1392,6 +1469,45 @@ gst_input_selector_class_init (GstInputSelectorClass * klass)
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
           GST_PARAM_MUTABLE_READY));
 
+  /**
+   * GstInputSelector:hot-standby
+   *
+   * If set to %TRUE and GstInputSelector:sync-streams is also set to %TRUE,
+   * inactive pads keep the last GstInputSelector:standby-time of buffers in
+   * a standby ring instead of dropping them. When the active pad is switched
+   * the new pad immediately replays its ring from the running time where the
+   * previous pad stopped, so a failover between redundant inputs splices at
+   * the next frame boundary without waiting for new data, renegotiation or
+   * a flush.
+   *
+   * Buffers of the replayed ring that lie before the last output running
+   * time are discarded, like with GstInputSelector:drop-backwards.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_HOT_STANDBY,
+      g_param_spec_boolean ("hot-standby", "Hot Standby",
+          "Keep a pre-roll ring of buffers on inactive pads and splice "
+          "from it on switch",
+          DEFAULT_HOT_STANDBY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
+  /**
+   * GstInputSelector:standby-time
+   *
+   * How much data each inactive pad keeps in its standby ring in
+   * hot-standby mode, measured back from its most recent buffer.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_STANDBY_TIME,
+      g_param_spec_uint64 ("standby-time", "Standby Time",
+          "Amount of data to keep on inactive pads in hot-standby mode "
+          "(in ns)", 0, G_MAXUINT64, DEFAULT_STANDBY_TIME,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
   gst_element_class_set_static_metadata (gstelement_class, "Input selector",
       "Generic", "N-to-1 input stream selector",
       "Julien Moutte <julien@moutte.net>, "
@@ -1427,6 +1543,8 @@ gst_input_selector_init (GstInputSelector * sel)
   sel->padcount = 0;
   sel->sync_streams = DEFAULT_SYNC_STREAMS;
   sel->sync_mode = DEFAULT_SYNC_MODE;
+  sel->hot_standby = DEFAULT_HOT_STANDBY;
+  sel->standby_time = DEFAULT_STANDBY_TIME;
   sel->have_group_id = TRUE;
 
   g_mutex_init (&sel->lock);
@@ -1568,6 +1686,16 @@ gst_input_selector_set_property (GObject * object, guint prop_id,
       sel->drop_backwards = g_value_get_boolean (value);
       GST_INPUT_SELECTOR_UNLOCK (object);
       break;
+    case PROP_HOT_STANDBY:
+      GST_INPUT_SELECTOR_LOCK (object);
+      sel->hot_standby = g_value_get_boolean (value);
+      GST_INPUT_SELECTOR_UNLOCK (object);
+      break;
+    case PROP_STANDBY_TIME:
+      GST_INPUT_SELECTOR_LOCK (object);
+      sel->standby_time = g_value_get_uint64 (value);
+      GST_INPUT_SELECTOR_UNLOCK (object);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1621,6 +1749,16 @@ gst_input_selector_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value, sel->drop_backwards);
       GST_INPUT_SELECTOR_UNLOCK (object);
       break;
+    case PROP_HOT_STANDBY:
+      GST_INPUT_SELECTOR_LOCK (object);
+      g_value_set_boolean (value, sel->hot_standby);
+      GST_INPUT_SELECTOR_UNLOCK (object);
+      break;
+    case PROP_STANDBY_TIME:
+      GST_INPUT_SELECTOR_LOCK (object);
+      g_value_set_uint64 (value, sel->standby_time);
+      GST_INPUT_SELECTOR_UNLOCK (object);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
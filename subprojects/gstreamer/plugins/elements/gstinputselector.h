@@ -73,6 +73,8 @@ struct _GstInputSelector {
   GstInputSelectorSyncMode sync_mode;
   gboolean cache_buffers;
   gboolean drop_backwards;
+  gboolean hot_standby;
+  guint64 standby_time;
 
   gboolean have_group_id;
 
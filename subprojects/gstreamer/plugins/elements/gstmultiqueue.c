@@ -164,6 +164,10 @@ struct _GstSingleQueue
   /* queue of data */
   GstDataQueue *queue;
   GstDataQueueSize max_size, extra_size;
+  /* bytes that left the queue, and the value at the last budget rebalance;
+   * both protected by the global lock */
+  guint64 bytes_out;
+  guint64 last_bytes_out;
   GstClockTime cur_time;
   gboolean is_eos;
   gboolean is_segment_done;
@@ -222,6 +226,7 @@ static void recheck_buffering_status (GstMultiQueue * mq);
 static void gst_single_queue_flush_queue (GstSingleQueue * sq, gboolean full);
 
 static void calculate_interleave (GstMultiQueue * mq, GstSingleQueue * sq);
+static void gst_multi_queue_rebalance_byte_limits (GstMultiQueue * mq);
 
 static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink_%u",
     GST_PAD_SINK,
@@ -271,6 +276,8 @@ enum
 
 #define DEFAULT_MINIMUM_INTERLEAVE (250 * GST_MSECOND)
 
+#define DEFAULT_SHARED_SIZE_BYTES 0
+
 enum
 {
   PROP_0,
@@ -287,8 +294,10 @@ enum
   PROP_HIGH_WATERMARK,
   PROP_SYNC_BY_RUNNING_TIME,
   PROP_USE_INTERLEAVE,
+  PROP_LOW_LATENCY_SPIN,
   PROP_UNLINKED_CACHE_TIME,
   PROP_MINIMUM_INTERLEAVE,
+  PROP_SHARED_SIZE_BYTES,
   PROP_STATS,
   PROP_LAST
 };
@@ -711,6 +720,25 @@ gst_multi_queue_class_init (GstMultiQueueClass * klass)
           DEFAULT_MAX_SIZE_TIME, G_PARAM_READWRITE | GST_PARAM_MUTABLE_PLAYING |
           G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstMultiQueue:shared-size-bytes:
+   *
+   * Total byte budget shared by all the queues. When non-zero it replaces
+   * the per-queue #GstMultiQueue:max-size-bytes watermark: the budget is
+   * split across the queues and redistributed by observed drain rate
+   * whenever one of them runs into its share, so a fast-draining stream
+   * can take over budget that a slow one doesn't use. Memory use is then
+   * bounded by this value instead of queue count times max-size-bytes.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_SHARED_SIZE_BYTES,
+      g_param_spec_uint ("shared-size-bytes", "Shared size (bytes)",
+          "Total byte budget redistributed across all queues by drain rate "
+          "(bytes, 0=disable)", 0, G_MAXUINT, DEFAULT_SHARED_SIZE_BYTES,
+          G_PARAM_READWRITE | GST_PARAM_MUTABLE_PLAYING |
+          G_PARAM_STATIC_STRINGS));
+
   g_object_class_install_property (gobject_class, PROP_EXTRA_SIZE_BYTES,
       g_param_spec_uint ("extra-size-bytes", "Extra Size (kB)",
           "Amount of data the queues can grow if one of them is empty (bytes, 0=disable)"
@@ -809,6 +837,21 @@ gst_multi_queue_class_init (GstMultiQueueClass * klass)
           "Adjust time limits based on input interleave",
           DEFAULT_USE_INTERLEAVE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstMultiQueue:low-latency-spin:
+   *
+   * Number of spin iterations each streaming thread performs on its
+   * empty queue before blocking. See GstQueue:low-latency-spin.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_LOW_LATENCY_SPIN,
+      g_param_spec_uint ("low-latency-spin", "Low latency spin count",
+          "Spin iterations on empty queue before blocking (0 = disable)",
+          0, G_MAXUINT, 0,
+          G_PARAM_READWRITE | GST_PARAM_MUTABLE_PLAYING |
+          G_PARAM_STATIC_STRINGS));
+
   g_object_class_install_property (gobject_class, PROP_UNLINKED_CACHE_TIME,
       g_param_spec_uint64 ("unlinked-cache-time", "Unlinked cache time (ns)",
           "Extra buffering in time for unlinked streams (if 'sync-by-running-time')",
@@ -876,6 +919,8 @@ gst_multi_queue_init (GstMultiQueue * mqueue)
   mqueue->extra_size.visible = DEFAULT_EXTRA_SIZE_BUFFERS;
   mqueue->extra_size.time = DEFAULT_EXTRA_SIZE_TIME;
 
+  mqueue->shared_size_bytes = DEFAULT_SHARED_SIZE_BYTES;
+
   mqueue->use_buffering = DEFAULT_USE_BUFFERING;
   mqueue->low_watermark = DEFAULT_LOW_WATERMARK * MAX_BUFFERING_LEVEL;
   mqueue->high_watermark = DEFAULT_HIGH_WATERMARK * MAX_BUFFERING_LEVEL;
@@ -932,7 +977,9 @@ gst_multi_queue_set_property (GObject * object, guint prop_id,
     case PROP_MAX_SIZE_BYTES:
       GST_MULTI_QUEUE_MUTEX_LOCK (mq);
       mq->max_size.bytes = g_value_get_uint (value);
-      SET_CHILD_PROPERTY (mq, bytes);
+      /* the shared budget, when enabled, owns the per-queue byte limits */
+      if (mq->shared_size_bytes == 0)
+        SET_CHILD_PROPERTY (mq, bytes);
       GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
       gst_multi_queue_post_buffering (mq);
       break;
@@ -981,6 +1028,16 @@ gst_multi_queue_set_property (GObject * object, guint prop_id,
       GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
       gst_multi_queue_post_buffering (mq);
       break;
+    case PROP_SHARED_SIZE_BYTES:
+      GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+      mq->shared_size_bytes = g_value_get_uint (value);
+      if (mq->shared_size_bytes != 0)
+        gst_multi_queue_rebalance_byte_limits (mq);
+      else
+        SET_CHILD_PROPERTY (mq, bytes);
+      GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
+      gst_multi_queue_post_buffering (mq);
+      break;
     case PROP_EXTRA_SIZE_BYTES:
       mq->extra_size.bytes = g_value_get_uint (value);
       break;
@@ -1020,6 +1077,9 @@ gst_multi_queue_set_property (GObject * object, guint prop_id,
     case PROP_USE_INTERLEAVE:
       mq->use_interleave = g_value_get_boolean (value);
       break;
+    case PROP_LOW_LATENCY_SPIN:
+      g_atomic_int_set (&mq->low_latency_spin, g_value_get_uint (value));
+      break;
     case PROP_UNLINKED_CACHE_TIME:
       GST_MULTI_QUEUE_MUTEX_LOCK (mq);
       mq->unlinked_cache_time = g_value_get_uint64 (value);
@@ -1098,6 +1158,9 @@ gst_multi_queue_get_property (GObject * object, guint prop_id,
     case PROP_MAX_SIZE_BYTES:
       g_value_set_uint (value, mq->max_size.bytes);
       break;
+    case PROP_SHARED_SIZE_BYTES:
+      g_value_set_uint (value, mq->shared_size_bytes);
+      break;
     case PROP_MAX_SIZE_BUFFERS:
       g_value_set_uint (value, mq->max_size.visible);
       break;
@@ -1127,6 +1190,9 @@ gst_multi_queue_get_property (GObject * object, guint prop_id,
     case PROP_USE_INTERLEAVE:
       g_value_set_boolean (value, mq->use_interleave);
       break;
+    case PROP_LOW_LATENCY_SPIN:
+      g_value_set_uint (value, g_atomic_int_get (&mq->low_latency_spin));
+      break;
     case PROP_UNLINKED_CACHE_TIME:
       g_value_set_uint64 (value, mq->unlinked_cache_time);
       break;
@@ -1267,6 +1333,10 @@ gst_multi_queue_release_pad (GstElement * element, GstPad * pad)
   mqueue->queues = g_list_delete_link (mqueue->queues, tmp);
   mqueue->queues_cookie++;
 
+  /* hand the freed byte share back to the remaining queues */
+  if (mqueue->shared_size_bytes != 0)
+    gst_multi_queue_rebalance_byte_limits (mqueue);
+
   /* FIXME : recompute next-non-linked */
   GST_MULTI_QUEUE_MUTEX_UNLOCK (mqueue);
 
@@ -2177,6 +2247,7 @@ gst_multi_queue_loop (GstPad * pad)
   GstMultiQueue *mq;
   GstMiniObject *object = NULL;
   guint32 newid;
+  guint item_size;
   GstFlowReturn result;
   GstClockTimeDiff next_time;
   gboolean is_buffer;
@@ -2184,6 +2255,7 @@ gst_multi_queue_loop (GstPad * pad)
   gboolean do_update_buffering = FALSE;
   gboolean dropping = FALSE;
   GstPad *srcpad = NULL;
+  guint spins;
 
   sq = GST_MULTIQUEUE_PAD (pad)->sq;
   mq = g_weak_ref_get (&sq->mqueue);
@@ -2195,6 +2267,17 @@ gst_multi_queue_loop (GstPad * pad)
 next:
   GST_DEBUG_ID (sq->debug_id, "trying to pop an object");
 
+  if (sq->flushing)
+    goto out_flushing;
+
+  /* adaptive wait: spin on the empty check before letting the pop below
+   * block on its condition variable, saving the futex round-trip at high
+   * buffer rates */
+  if ((spins = g_atomic_int_get (&mq->low_latency_spin)) > 0) {
+    while (spins-- > 0 && gst_data_queue_is_empty (sq->queue) && !sq->flushing)
+      continue;
+  }
+
   if (sq->flushing)
     goto out_flushing;
 
@@ -2207,6 +2290,7 @@ next:
   newid = item->posid;
 
   is_query = item->is_query;
+  item_size = item->size;
 
   /* steal the object and destroy the item */
   object = gst_multi_queue_item_steal_object (item);
@@ -2225,6 +2309,8 @@ next:
    * we might need to wake some sleeping pad up, so there's extra work
    * there too */
   GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+  /* drained bytes feed the shared-budget rebalancing */
+  sq->bytes_out += item_size;
   if (sq->srcresult == GST_FLOW_NOT_LINKED
       || (sq->last_oldid == G_MAXUINT32) || (newid != (sq->last_oldid + 1))
       || sq->last_oldid > mq->highid) {
@@ -3234,6 +3320,58 @@ compute_high_time (GstMultiQueue * mq, guint groupid)
 #define IS_FILLED(q, format, value) (((q)->max_size.format) != 0 && \
      ((q)->max_size.format) <= (value))
 
+/* Redistribute the shared byte budget across the single queues, weighting
+ * by how much each of them drained since the last rebalance. Half of the
+ * budget is always split evenly so that an idle or slow queue never loses
+ * its watermark completely; the other half follows the drain rates, which
+ * lets a high-bitrate video queue take over bytes an audio queue doesn't
+ * need. Called with the multiqueue lock held. */
+static void
+gst_multi_queue_rebalance_byte_limits (GstMultiQueue * mq)
+{
+  GList *tmp;
+  guint64 total_drained = 0;
+  guint even_share, weighted;
+  guint n = 0;
+
+  if (mq->shared_size_bytes == 0 || mq->queues == NULL)
+    return;
+
+  for (tmp = mq->queues; tmp; tmp = g_list_next (tmp)) {
+    GstSingleQueue *sq = (GstSingleQueue *) tmp->data;
+
+    total_drained += sq->bytes_out - sq->last_bytes_out;
+    n++;
+  }
+
+  even_share = mq->shared_size_bytes / (2 * n);
+  weighted = mq->shared_size_bytes - even_share * n;
+
+  for (tmp = mq->queues; tmp; tmp = g_list_next (tmp)) {
+    GstSingleQueue *sq = (GstSingleQueue *) tmp->data;
+    guint64 drained = sq->bytes_out - sq->last_bytes_out;
+    guint new_max;
+
+    if (total_drained > 0)
+      new_max =
+          even_share + gst_util_uint64_scale (weighted, drained,
+          total_drained);
+    else
+      new_max = mq->shared_size_bytes / n;
+
+    if (new_max != sq->max_size.bytes) {
+      GST_DEBUG_ID (sq->debug_id,
+          "byte limit %u -> %u (drained %" G_GUINT64_FORMAT " of %"
+          G_GUINT64_FORMAT ")", sq->max_size.bytes, new_max, drained,
+          total_drained);
+      sq->max_size.bytes = new_max;
+      update_buffering (mq, sq);
+      gst_data_queue_limits_changed (sq->queue);
+    }
+    sq->last_bytes_out = sq->bytes_out;
+  }
+}
+
 /*
  * GstSingleQueue functions
  */
@@ -3262,6 +3400,17 @@ single_queue_overrun_cb (GstDataQueue * dq, GstSingleQueue * sq)
 
   GST_MULTI_QUEUE_MUTEX_LOCK (mq);
 
+  /* with a shared byte budget, a queue running into its byte watermark is
+   * the cue to re-split the budget by drain rate; a fast-draining queue may
+   * come out of this with more headroom and unblock right away */
+  if (mq->shared_size_bytes != 0 && IS_FILLED (sq, bytes, size.bytes)) {
+    gst_multi_queue_rebalance_byte_limits (mq);
+    if (!IS_FILLED (sq, bytes, size.bytes)) {
+      filled = FALSE;
+      goto done;
+    }
+  }
+
   /* check if we reached the hard time/bytes limits;
      time limit is only taken into account for non-sparse streams */
   if (sq->is_eos || IS_FILLED (sq, bytes, size.bytes) ||
@@ -3544,6 +3693,10 @@ gst_single_queue_new (GstMultiQueue * mqueue, guint id)
   sq->extra_size.bytes = mqueue->extra_size.bytes;
   sq->extra_size.time = mqueue->extra_size.time;
 
+  /* the new queue takes its byte share out of the common budget */
+  if (mqueue->shared_size_bytes != 0)
+    sq->max_size.bytes = mqueue->shared_size_bytes / mqueue->nbqueues;
+
   GST_DEBUG_OBJECT (mqueue, "Creating GstSingleQueue id:%d", sq->id);
 
   g_weak_ref_init (&sq->mqueue, mqueue);
@@ -3618,6 +3771,10 @@ gst_single_queue_new (GstMultiQueue * mqueue, guint id)
       GST_DEBUG_FUNCPTR (gst_multi_queue_iterate_internal_links));
   GST_OBJECT_FLAG_SET (srcpad, GST_PAD_FLAG_PROXY_CAPS);
 
+  /* make room for the new queue in the shared budget */
+  if (mqueue->shared_size_bytes != 0)
+    gst_multi_queue_rebalance_byte_limits (mqueue);
+
   GST_MULTI_QUEUE_MUTEX_UNLOCK (mqueue);
 
   /* only activate the pads when we are not in the NULL state
@@ -55,6 +55,7 @@ struct _GstMultiQueue {
 
   gboolean sync_by_running_time;
   gboolean use_interleave;
+  gint low_latency_spin;  /* atomic, spin iterations before blocking */
   GstClockTime min_interleave_time;
 
   /* number of queues */
@@ -65,6 +66,7 @@ struct _GstMultiQueue {
   guint32 queues_cookie;
 
   GstDataQueueSize  max_size, extra_size;
+  guint shared_size_bytes;      /* shared byte budget, 0 = disabled */
   gboolean use_buffering;
   gint low_watermark, high_watermark;
   gboolean buffering;
@@ -116,10 +116,18 @@ struct _GstQueue {
     min_threshold,      /* min. amount of data required to wake reader */
     orig_min_threshold; /* Original min.threshold, for reset in EOS */
 
+  /* seqlock-protected snapshot of cur_level so the current-level properties
+   * can be read without taking the queue lock */
+  gint level_seq;       /* odd while a writer is updating the snapshot */
+  GstQueueSize level_snapshot;
+
   /* whether we leak data, and at which end */
   gint leaky;
 
   GMutex qlock;        /* lock for queue (vs object lock) */
+  gint level;          /* atomic count of queued items, for lock-free
+                        * empty checks while spinning */
+  guint low_latency_spin; /* spin iterations before blocking, 0 = off */
   gboolean waiting_add;
   GCond item_add;      /* signals buffers now available for reading */
   gboolean waiting_del;
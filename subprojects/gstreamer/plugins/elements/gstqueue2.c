@@ -81,8 +81,8 @@
 #include <unistd.h>
 #endif
 
-#ifdef __BIONIC__               /* Android */
-#include <fcntl.h>
+#ifndef G_OS_WIN32
+#include <fcntl.h>              /* posix_fadvise */
 #endif
 
 static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
@@ -124,6 +124,7 @@ enum
 #define DEFAULT_LOW_WATERMARK      0.01
 #define DEFAULT_HIGH_WATERMARK     0.99
 #define DEFAULT_TEMP_REMOVE        TRUE
+#define DEFAULT_TEMP_DROP_CACHE    FALSE
 #define DEFAULT_RING_BUFFER_MAX_SIZE 0
 #define DEFAULT_USE_BITRATE_QUERY  TRUE
 
@@ -146,6 +147,7 @@ enum
   PROP_TEMP_TEMPLATE,
   PROP_TEMP_LOCATION,
   PROP_TEMP_REMOVE,
+  PROP_TEMP_DROP_CACHE,
   PROP_RING_BUFFER_MAX_SIZE,
   PROP_AVG_IN_RATE,
   PROP_USE_BITRATE_QUERY,
@@ -440,6 +442,21 @@ gst_queue2_class_init (GstQueue2Class * klass)
       "Remove the Temporary File", "Remove the temp-location after use",
       DEFAULT_TEMP_REMOVE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
 
+  /**
+   * GstQueue2:temp-drop-cache
+   *
+   * Drop data that has been read back from the temporary file from the
+   * page cache with posix_fadvise(DONTNEED), so that buffering many
+   * streams to disk does not evict more useful pages. The data stays on
+   * disk and is read again from there when a seek goes back into it.
+   *
+   * Since: 1.24
+   */
+  obj_props[PROP_TEMP_DROP_CACHE] = g_param_spec_boolean ("temp-drop-cache",
+      "Drop page cache of the Temporary File",
+      "Drop already read temp-file data from the page cache",
+      DEFAULT_TEMP_DROP_CACHE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
   /**
    * GstQueue2:ring-buffer-max-size
    *
@@ -565,6 +582,7 @@ gst_queue2_init (GstQueue2 * queue)
   queue->temp_template = NULL;
   queue->temp_location = NULL;
   queue->temp_remove = DEFAULT_TEMP_REMOVE;
+  queue->temp_drop_cache = DEFAULT_TEMP_DROP_CACHE;
 
   queue->ring_buffer = NULL;
   queue->ring_buffer_max_size = DEFAULT_RING_BUFFER_MAX_SIZE;
@@ -1480,6 +1498,54 @@ gst_queue2_have_data (GstQueue2 * queue, guint64 offset, guint length)
 #define FSEEK_FILE(file,offset)  (fseek (file, offset, SEEK_SET) != 0)
 #endif
 
+/* wrap an absolute position into the ring buffer. When the configured ring
+ * buffer size is a power of two the 64-bit division behind the modulo turns
+ * into a simple mask. */
+static inline guint64
+gst_queue2_ring_buffer_wrap (guint64 pos, guint64 rb_size)
+{
+  if ((rb_size & (rb_size - 1)) == 0)
+    return pos & (rb_size - 1);
+
+  return pos % rb_size;
+}
+
+/* drop temp file data that we read back already from the page cache so that
+ * many queue2 instances spilling to disk don't evict pages that are more
+ * useful elsewhere. We accumulate reads into a range and only advise once it
+ * grows big enough, to keep the syscall overhead down. */
+#define TEMP_DROP_CACHE_THRESHOLD (8 * 1024 * 1024)
+
+static void
+gst_queue2_advise_temp_file_read (GstQueue2 * queue, guint64 offset,
+    guint64 length)
+{
+#ifdef POSIX_FADV_DONTNEED
+  if (!queue->temp_drop_cache)
+    return;
+
+  /* a seek breaks the range, start collecting again from here */
+  if (offset != queue->temp_drop_stop)
+    queue->temp_drop_start = offset;
+  queue->temp_drop_stop = offset + length;
+
+  if (queue->temp_drop_stop - queue->temp_drop_start <
+      TEMP_DROP_CACHE_THRESHOLD)
+    return;
+
+  GST_LOG_OBJECT (queue, "dropping %" G_GUINT64_FORMAT "-%" G_GUINT64_FORMAT
+      " from the page cache", queue->temp_drop_start, queue->temp_drop_stop);
+
+  /* dirty pages are not dropped by the advice, sync them first */
+  fflush (queue->temp_file);
+  fsync (fileno (queue->temp_file));
+  posix_fadvise (fileno (queue->temp_file), queue->temp_drop_start,
+      queue->temp_drop_stop - queue->temp_drop_start, POSIX_FADV_DONTNEED);
+
+  queue->temp_drop_start = queue->temp_drop_stop;
+#endif
+}
+
 static GstFlowReturn
 gst_queue2_read_data_at_offset (GstQueue2 * queue, guint64 offset, guint length,
     guint8 * dst, gint64 * read_return)
@@ -1497,6 +1563,8 @@ gst_queue2_read_data_at_offset (GstQueue2 * queue, guint64 offset, guint length,
       length, offset);
   if (QUEUE_IS_USING_TEMP_FILE (queue)) {
     res = fread (dst, 1, length, queue->temp_file);
+    if (res > 0)
+      gst_queue2_advise_temp_file_read (queue, offset, res);
   } else {
     memcpy (dst, ring_buffer + offset, length);
     res = length;
@@ -1634,8 +1702,8 @@ gst_queue2_create_read (GstQueue2 * queue, guint64 offset, guint length,
     /* configure how much and from where to read */
     if (QUEUE_IS_USING_RING_BUFFER (queue)) {
       file_offset =
-          (queue->current->rb_offset + (rpos -
-              queue->current->offset)) % rb_size;
+          gst_queue2_ring_buffer_wrap (queue->current->rb_offset + (rpos -
+              queue->current->offset), rb_size);
       if (file_offset + read_length > rb_size) {
         block_length = rb_size - file_offset;
       } else {
@@ -1658,7 +1726,7 @@ gst_queue2_create_read (GstQueue2 * queue, guint64 offset, guint length,
 
       file_offset += read_return;
       if (QUEUE_IS_USING_RING_BUFFER (queue))
-        file_offset %= rb_size;
+        file_offset = gst_queue2_ring_buffer_wrap (file_offset, rb_size);
 
       data += read_return;
       read_length -= read_return;
@@ -1792,6 +1860,13 @@ gst_queue2_open_temp_location_file (GstQueue2 * queue)
   if (queue->temp_file == NULL)
     goto open_failed;
 
+  /* spill in bigger batches than the default stdio buffer so that many
+   * instances writing to disk at once don't degrade into lots of small
+   * writes */
+  setvbuf (queue->temp_file, NULL, _IOFBF, 512 * 1024);
+
+  queue->temp_drop_start = queue->temp_drop_stop = 0;
+
   g_free (queue->temp_location);
   queue->temp_location = name;
 
@@ -1857,6 +1932,7 @@ gst_queue2_close_temp_location_file (GstQueue2 * queue)
   }
 
   queue->temp_file = NULL;
+  queue->temp_drop_start = queue->temp_drop_stop = 0;
   clean_ranges (queue);
 }
 
@@ -1869,6 +1945,7 @@ gst_queue2_flush_temp_file (GstQueue2 * queue)
   GST_DEBUG_OBJECT (queue, "flushing temp file");
 
   queue->temp_file = g_freopen (queue->temp_location, "wb+", queue->temp_file);
+  queue->temp_drop_start = queue->temp_drop_stop = 0;
 }
 
 static void
@@ -2003,7 +2080,8 @@ gst_queue2_create_write (GstQueue2 * queue, GstBuffer * buffer)
 
       /* the writing position in the ring buffer after writing (part
        * or all of) the buffer */
-      new_writing_pos = (writing_pos + to_write) % rb_size;
+      new_writing_pos =
+          gst_queue2_ring_buffer_wrap (writing_pos + to_write, rb_size);
 
       prev = NULL;
       range = queue->ranges;
@@ -3984,6 +4062,9 @@ gst_queue2_set_property (GObject * object,
     case PROP_TEMP_REMOVE:
       queue->temp_remove = g_value_get_boolean (value);
       break;
+    case PROP_TEMP_DROP_CACHE:
+      queue->temp_drop_cache = g_value_get_boolean (value);
+      break;
     case PROP_RING_BUFFER_MAX_SIZE:
       queue->ring_buffer_max_size = g_value_get_uint64 (value);
       break;
@@ -4058,6 +4139,9 @@ gst_queue2_get_property (GObject * object,
     case PROP_TEMP_REMOVE:
       g_value_set_boolean (value, queue->temp_remove);
       break;
+    case PROP_TEMP_DROP_CACHE:
+      g_value_set_boolean (value, queue->temp_drop_cache);
+      break;
     case PROP_RING_BUFFER_MAX_SIZE:
       g_value_set_uint64 (value, queue->ring_buffer_max_size);
       break;
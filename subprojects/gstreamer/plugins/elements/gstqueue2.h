@@ -149,7 +149,11 @@ struct _GstQueue2
   gboolean temp_location_set;
   gchar *temp_location;
   gboolean temp_remove;
+  gboolean temp_drop_cache;
   FILE *temp_file;
+  /* range of read-back temp file data not yet dropped from the page cache */
+  guint64 temp_drop_start;
+  guint64 temp_drop_stop;
   /* list of downloaded areas and the current area */
   GstQueue2Range *ranges;
   GstQueue2Range *current;
@@ -17,6 +17,11 @@
  * Boston, MA 02110-1301, USA.
  */
 
+/* must come before any system header for fallocate() to be visible on glibc */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE 1
+#endif
+
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
@@ -34,6 +39,7 @@
 #define off_t guint64
 #else
 #include <unistd.h>
+#include <fcntl.h>
 #endif
 
 #ifdef HAVE_FSEEKO
@@ -378,6 +384,117 @@ error:
   }
 }
 
+/**
+ * gst_sparse_file_advise_done:
+ * @file: a #GstSparseFile
+ * @start: the start offset
+ * @stop: the stop offset
+ *
+ * Hint that the bytes between @start and @stop were consumed and are not
+ * going to be needed soon, so the kernel can drop them from the page
+ * cache. The data itself stays on disk and remains readable.
+ */
+void
+gst_sparse_file_advise_done (GstSparseFile * file, gsize start, gsize stop)
+{
+#ifdef POSIX_FADV_DONTNEED
+  g_return_if_fail (file != NULL);
+
+  if (stop <= start || file->file == NULL)
+    return;
+
+  /* dirty pages are not dropped by the advice, write them out first */
+  fflush (file->file);
+  fsync (file->fd);
+
+  posix_fadvise (file->fd, (off_t) start, (off_t) (stop - start),
+      POSIX_FADV_DONTNEED);
+#endif
+}
+
+/**
+ * gst_sparse_file_punch_hole:
+ * @file: a #GstSparseFile
+ * @start: the start offset
+ * @stop: the stop offset
+ *
+ * Release the disk space and page cache used by the bytes between @start
+ * and @stop and forget the ranges covering them, as if they had never been
+ * written. Reading from the region again will report
+ * %GST_SPARSE_FILE_IO_ERROR_WOULD_BLOCK.
+ *
+ * Returns: %TRUE when the hole could be punched, %FALSE when the platform
+ * or the file system doesn't support it.
+ */
+gboolean
+gst_sparse_file_punch_hole (GstSparseFile * file, gsize start, gsize stop)
+{
+#if defined (__linux__) && defined (FALLOC_FL_PUNCH_HOLE)
+  GstSparseRange *range, *prev, *next;
+
+  g_return_val_if_fail (file != NULL, FALSE);
+
+  if (stop <= start)
+    return TRUE;
+
+  if (file->file == NULL)
+    return FALSE;
+
+  /* make sure buffered writes can't repopulate the hole afterwards */
+  fflush (file->file);
+
+  if (fallocate (file->fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+          (off_t) start, (off_t) (stop - start)) != 0)
+    return FALSE;
+
+  /* the data is gone, remove it from the tracked ranges */
+  file->write_range = NULL;
+  file->read_range = NULL;
+
+  prev = NULL;
+  range = file->ranges;
+  while (range) {
+    next = range->next;
+
+    if (range->start >= stop || range->stop <= start) {
+      /* no overlap */
+      prev = range;
+    } else if (range->start < start && range->stop > stop) {
+      /* the hole is in the middle, split the range */
+      GstSparseRange *tail = g_slice_new0 (GstSparseRange);
+
+      tail->start = stop;
+      tail->stop = range->stop;
+      tail->next = next;
+      range->stop = start;
+      range->next = tail;
+      file->n_ranges++;
+      prev = tail;
+    } else if (range->start < start) {
+      /* the hole overlaps the end of the range */
+      range->stop = start;
+      prev = range;
+    } else if (range->stop > stop) {
+      /* the hole overlaps the start of the range */
+      range->start = stop;
+      prev = range;
+    } else {
+      /* the range is fully inside the hole */
+      if (prev)
+        prev->next = next;
+      else
+        file->ranges = next;
+      g_slice_free (GstSparseRange, range);
+      file->n_ranges--;
+    }
+    range = next;
+  }
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
 /**
  * gst_sparse_file_n_ranges:
  * @file: a #GstSparseFile
@@ -95,6 +95,14 @@ gsize           gst_sparse_file_read         (GstSparseFile *file,
                                               gsize *remaining,
                                               GError **error);
 
+void            gst_sparse_file_advise_done  (GstSparseFile *file,
+                                              gsize start,
+                                              gsize stop);
+
+gboolean        gst_sparse_file_punch_hole   (GstSparseFile *file,
+                                              gsize start,
+                                              gsize stop);
+
 guint           gst_sparse_file_n_ranges         (GstSparseFile *file);
 
 gboolean        gst_sparse_file_get_range_before (GstSparseFile *file, gsize offset,
@@ -141,6 +141,9 @@ struct _GstTeePad
   gboolean pushed;
   GstFlowReturn result;
   gboolean removed;
+
+  gboolean independent;
+  gboolean private_metas;
 };
 
 struct _GstTeePadClass
@@ -148,11 +151,103 @@ struct _GstTeePadClass
   GstPadClass parent;
 };
 
+#define DEFAULT_PAD_INDEPENDENT		FALSE
+#define DEFAULT_PAD_PRIVATE_METAS	FALSE
+
+enum
+{
+  PROP_PAD_0,
+  PROP_PAD_INDEPENDENT,
+  PROP_PAD_PRIVATE_METAS,
+};
+
 G_DEFINE_TYPE (GstTeePad, gst_tee_pad, GST_TYPE_PAD);
 
+static void
+gst_tee_pad_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstTeePad *pad = GST_TEE_PAD (object);
+
+  GST_OBJECT_LOCK (pad);
+  switch (prop_id) {
+    case PROP_PAD_INDEPENDENT:
+      pad->independent = g_value_get_boolean (value);
+      break;
+    case PROP_PAD_PRIVATE_METAS:
+      pad->private_metas = g_value_get_boolean (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  GST_OBJECT_UNLOCK (pad);
+}
+
+static void
+gst_tee_pad_get_property (GObject * object, guint prop_id, GValue * value,
+    GParamSpec * pspec)
+{
+  GstTeePad *pad = GST_TEE_PAD (object);
+
+  GST_OBJECT_LOCK (pad);
+  switch (prop_id) {
+    case PROP_PAD_INDEPENDENT:
+      g_value_set_boolean (value, pad->independent);
+      break;
+    case PROP_PAD_PRIVATE_METAS:
+      g_value_set_boolean (value, pad->private_metas);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  GST_OBJECT_UNLOCK (pad);
+}
+
 static void
 gst_tee_pad_class_init (GstTeePadClass * klass)
 {
+  GObjectClass *gobject_class = (GObjectClass *) klass;
+
+  gobject_class->set_property = gst_tee_pad_set_property;
+  gobject_class->get_property = gst_tee_pad_get_property;
+
+  /**
+   * GstTeePad:independent:
+   *
+   * Push buffers to this pad from a shared task pool instead of from the
+   * streaming thread. All pads marked independent are pushed to in parallel,
+   * both with each other and with the remaining pads, so a slow branch does
+   * not delay delivery to the other branches.
+   *
+   * The order in which the branches receive a buffer becomes arbitrary, so
+   * only mark a pad independent when its branch does not depend on delivery
+   * order relative to the other branches.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_PAD_INDEPENDENT,
+      g_param_spec_boolean ("independent", "Independent",
+          "Push to this pad from a shared task pool, in parallel with the "
+          "other pads", DEFAULT_PAD_INDEPENDENT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTeePad:private-metas:
+   *
+   * Push a copy of the buffer that shares the payload memory with the
+   * original but has its own metadata and buffer fields. Downstream elements
+   * in this branch that only change metadata, timestamps or flags can then
+   * make the buffer writable without copying the payload.
+   *
+   * Since: 1.24
+   */
+  g_object_class_install_property (gobject_class, PROP_PAD_PRIVATE_METAS,
+      g_param_spec_boolean ("private-metas", "Private metas",
+          "Push a shallow copy with private metadata so this branch can "
+          "change metas without copying the payload", DEFAULT_PAD_PRIVATE_METAS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
@@ -225,6 +320,11 @@ gst_tee_finalize (GObject * object)
 
   g_free (tee->last_message);
 
+  if (tee->task_pool) {
+    gst_task_pool_cleanup (tee->task_pool);
+    gst_object_unref (tee->task_pool);
+  }
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -301,6 +401,7 @@ gst_tee_class_init (GstTeeClass * klass)
   gstelement_class->release_pad = GST_DEBUG_FUNCPTR (gst_tee_release_pad);
 
   gst_type_mark_as_plugin_api (GST_TYPE_TEE_PULL_MODE, 0);
+  gst_type_mark_as_plugin_api (GST_TYPE_TEE_PAD, 0);
 }
 
 static void
@@ -839,6 +940,22 @@ gst_tee_do_message (GstTee * tee, GstPad * pad, gpointer data, gboolean is_list)
   g_object_notify_by_pspec ((GObject *) tee, pspec_last_message);
 }
 
+/* copy a buffer list so that the buffers share the payload memory with the
+ * originals but have private metadata and buffer fields */
+static GstBufferList *
+gst_tee_buffer_list_make_private (GstBufferList * list)
+{
+  GstBufferList *copy;
+  guint i, len;
+
+  len = gst_buffer_list_length (list);
+  copy = gst_buffer_list_new_sized (len);
+  for (i = 0; i < len; i++)
+    gst_buffer_list_add (copy, gst_buffer_copy (gst_buffer_list_get (list, i)));
+
+  return copy;
+}
+
 static GstFlowReturn
 gst_tee_do_push (GstTee * tee, GstPad * pad, gpointer data, gboolean is_list)
 {
@@ -849,15 +966,107 @@ gst_tee_do_push (GstTee * tee, GstPad * pad, gpointer data, gboolean is_list)
     /* don't push on the pad we're pulling from */
     res = GST_FLOW_OK;
   } else if (is_list) {
-    res =
-        gst_pad_push_list (pad,
-        gst_buffer_list_ref (GST_BUFFER_LIST_CAST (data)));
+    GstBufferList *list = GST_BUFFER_LIST_CAST (data);
+
+    if (GST_TEE_PAD_CAST (pad)->private_metas)
+      res = gst_pad_push_list (pad, gst_tee_buffer_list_make_private (list));
+    else
+      res = gst_pad_push_list (pad, gst_buffer_list_ref (list));
   } else {
-    res = gst_pad_push (pad, gst_buffer_ref (GST_BUFFER_CAST (data)));
+    GstBuffer *buffer = GST_BUFFER_CAST (data);
+
+    if (GST_TEE_PAD_CAST (pad)->private_metas) {
+      /* the copy shares the memory of @buffer but has its own metadata and
+       * buffer fields, so this branch can change those without copying the
+       * payload */
+      res = gst_pad_push (pad, gst_buffer_copy (buffer));
+    } else {
+      res = gst_pad_push (pad, gst_buffer_ref (buffer));
+    }
   }
   return res;
 }
 
+typedef struct
+{
+  GstTee *tee;
+  GstPad *pad;
+  gpointer data;
+  gboolean is_list;
+  GstFlowReturn ret;
+  gpointer handle;
+} TeePushData;
+
+static void
+gst_tee_parallel_push (TeePushData * push)
+{
+  push->ret = gst_tee_do_push (push->tee, push->pad, push->data, push->is_list);
+}
+
+/* get the pool used to push to independent pads, creating it on first use */
+static GstTaskPool *
+gst_tee_get_task_pool (GstTee * tee)
+{
+  GstTaskPool *pool;
+
+  GST_OBJECT_LOCK (tee);
+  if (tee->task_pool == NULL) {
+    pool = gst_shared_task_pool_new ();
+    gst_shared_task_pool_set_max_threads (GST_SHARED_TASK_POOL (pool),
+        g_get_num_processors ());
+    gst_task_pool_prepare (pool, NULL);
+    tee->task_pool = pool;
+  }
+  pool = gst_object_ref (tee->task_pool);
+  GST_OBJECT_UNLOCK (tee);
+
+  return pool;
+}
+
+/* wait for the pushes handed to the task pool and merge their results into
+ * the combined return value. Fatal errors take precedence, otherwise any
+ * result other than NOT_LINKED replaces a NOT_LINKED @cret. */
+static GstFlowReturn
+gst_tee_collect_parallel (GstTee * tee, GstTaskPool * pool,
+    GPtrArray * launched, GstFlowReturn cret)
+{
+  guint i;
+
+  for (i = 0; i < launched->len; i++) {
+    TeePushData *push = g_ptr_array_index (launched, i);
+    GstFlowReturn ret;
+
+    if (push->handle)
+      gst_task_pool_join (pool, push->handle);
+
+    ret = push->ret;
+
+    GST_OBJECT_LOCK (tee);
+    if (GST_TEE_PAD_CAST (push->pad)->removed)
+      ret = GST_FLOW_NOT_LINKED;
+    GST_TEE_PAD_CAST (push->pad)->result = ret;
+    GST_OBJECT_UNLOCK (tee);
+
+    GST_LOG_OBJECT (push->pad, "Parallel push of item %p yielded result %s",
+        push->data, gst_flow_get_name (ret));
+
+    if (G_UNLIKELY (ret != GST_FLOW_OK && ret != GST_FLOW_NOT_LINKED)) {
+      if (cret == GST_FLOW_OK || cret == GST_FLOW_NOT_LINKED)
+        cret = ret;
+    } else if (ret != GST_FLOW_NOT_LINKED &&
+        (cret == GST_FLOW_OK || cret == GST_FLOW_NOT_LINKED)) {
+      cret = ret;
+    }
+
+    gst_object_unref (push->pad);
+    g_free (push);
+  }
+  g_ptr_array_free (launched, TRUE);
+  gst_object_unref (pool);
+
+  return cret;
+}
+
 static void
 clear_pads (GstPad * pad, GstTee * tee)
 {
@@ -871,6 +1080,8 @@ gst_tee_handle_data (GstTee * tee, gpointer data, gboolean is_list)
   GList *pads;
   guint32 cookie;
   GstFlowReturn ret, cret;
+  GPtrArray *launched = NULL;
+  GstTaskPool *pool = NULL;
 
   if (G_UNLIKELY (!tee->silent))
     gst_tee_do_message (tee, tee->sinkpad, data, is_list);
@@ -894,9 +1105,23 @@ gst_tee_handle_data (GstTee * tee, gpointer data, gboolean is_list)
     if (pad == tee->pull_pad) {
       ret = GST_FLOW_OK;
     } else if (is_list) {
-      ret = gst_pad_push_list (pad, GST_BUFFER_LIST_CAST (data));
+      GstBufferList *list = GST_BUFFER_LIST_CAST (data);
+
+      if (GST_TEE_PAD_CAST (pad)->private_metas) {
+        ret = gst_pad_push_list (pad, gst_tee_buffer_list_make_private (list));
+        gst_buffer_list_unref (list);
+      } else {
+        ret = gst_pad_push_list (pad, list);
+      }
     } else {
-      ret = gst_pad_push (pad, GST_BUFFER_CAST (data));
+      GstBuffer *buffer = GST_BUFFER_CAST (data);
+
+      if (GST_TEE_PAD_CAST (pad)->private_metas) {
+        ret = gst_pad_push (pad, gst_buffer_copy (buffer));
+        gst_buffer_unref (buffer);
+      } else {
+        ret = gst_pad_push (pad, buffer);
+      }
     }
 
     GST_OBJECT_LOCK (tee);
@@ -931,26 +1156,70 @@ restart:
     pad = GST_PAD_CAST (pads->data);
 
     if (G_LIKELY (!GST_TEE_PAD_CAST (pad)->pushed)) {
-      /* not yet pushed, release lock and start pushing */
-      gst_object_ref (pad);
-      GST_OBJECT_UNLOCK (tee);
-
-      GST_LOG_OBJECT (pad, "Starting to push %s %p",
-          is_list ? "list" : "buffer", data);
-
-      ret = gst_tee_do_push (tee, pad, data, is_list);
+      if (G_UNLIKELY (GST_TEE_PAD_CAST (pad)->independent
+              && pad != tee->pull_pad)) {
+        TeePushData *push;
+        GError *error = NULL;
+
+        /* let the task pool push to this pad while we continue with the
+         * other pads, the result is merged after all pads were handled */
+        gst_object_ref (pad);
+        GST_TEE_PAD_CAST (pad)->pushed = TRUE;
+        GST_OBJECT_UNLOCK (tee);
+
+        if (pool == NULL)
+          pool = gst_tee_get_task_pool (tee);
+
+        push = g_new (TeePushData, 1);
+        push->tee = tee;
+        push->pad = pad;
+        push->data = data;
+        push->is_list = is_list;
+        push->ret = GST_FLOW_ERROR;
+
+        GST_LOG_OBJECT (pad, "Pushing %s %p from the task pool",
+            is_list ? "list" : "buffer", data);
+
+        push->handle = gst_task_pool_push (pool,
+            (GstTaskPoolFunction) gst_tee_parallel_push, push, &error);
+        if (G_UNLIKELY (error != NULL)) {
+          GST_WARNING_OBJECT (pad, "failed to use the task pool (%s), "
+              "pushing from the streaming thread", error->message);
+          g_clear_error (&error);
+          gst_tee_parallel_push (push);
+        }
 
-      GST_LOG_OBJECT (pad, "Pushing item %p yielded result %s", data,
-          gst_flow_get_name (ret));
+        if (launched == NULL)
+          launched = g_ptr_array_new ();
+        g_ptr_array_add (launched, push);
 
-      GST_OBJECT_LOCK (tee);
-      /* keep track of which pad we pushed and the result value */
-      if (GST_TEE_PAD_CAST (pad)->removed)
+        GST_OBJECT_LOCK (tee);
+        /* the real result is merged after the join below, don't combine
+         * anything yet */
         ret = GST_FLOW_NOT_LINKED;
-      GST_TEE_PAD_CAST (pad)->pushed = TRUE;
-      GST_TEE_PAD_CAST (pad)->result = ret;
-      gst_object_unref (pad);
-      pad = NULL;
+        pad = NULL;
+      } else {
+        /* not yet pushed, release lock and start pushing */
+        gst_object_ref (pad);
+        GST_OBJECT_UNLOCK (tee);
+
+        GST_LOG_OBJECT (pad, "Starting to push %s %p",
+            is_list ? "list" : "buffer", data);
+
+        ret = gst_tee_do_push (tee, pad, data, is_list);
+
+        GST_LOG_OBJECT (pad, "Pushing item %p yielded result %s", data,
+            gst_flow_get_name (ret));
+
+        GST_OBJECT_LOCK (tee);
+        /* keep track of which pad we pushed and the result value */
+        if (GST_TEE_PAD_CAST (pad)->removed)
+          ret = GST_FLOW_NOT_LINKED;
+        GST_TEE_PAD_CAST (pad)->pushed = TRUE;
+        GST_TEE_PAD_CAST (pad)->result = ret;
+        gst_object_unref (pad);
+        pad = NULL;
+      }
     } else {
       /* already pushed, use previous return value */
       ret = GST_TEE_PAD_CAST (pad)->result;
@@ -982,6 +1251,9 @@ restart:
   }
   GST_OBJECT_UNLOCK (tee);
 
+  if (launched)
+    cret = gst_tee_collect_parallel (tee, pool, launched, cret);
+
   gst_mini_object_unref (GST_MINI_OBJECT_CAST (data));
 
   /* no need to unset gvalue */
@@ -1008,6 +1280,10 @@ error:
 end:
   {
     GST_OBJECT_UNLOCK (tee);
+    /* wait for the pushes that are still in flight. They keep the first
+     * fatal error, so the merged result stays @ret here */
+    if (launched)
+      ret = gst_tee_collect_parallel (tee, pool, launched, ret);
     gst_mini_object_unref (GST_MINI_OBJECT_CAST (data));
     return ret;
   }
@@ -81,6 +81,8 @@ struct _GstTee {
   GstPad         *pull_pad;
 
   gboolean        allow_not_linked;
+
+  GstTaskPool    *task_pool;    /* pool pushing to pads marked independent */
 };
 
 struct _GstTeeClass {
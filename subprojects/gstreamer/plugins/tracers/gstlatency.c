@@ -31,6 +31,17 @@
  * ```
  * GST_TRACERS="latency(flags=pipeline+element+reported)" GST_DEBUG=GST_TRACER:7 ./...
  * ```
+ *
+ * With the 'aggregate' flag, instead of logging one record per buffer, the
+ * tracer accumulates latencies in per-pair histograms and periodically emits
+ * a summary record with count/min/max/avg and bucketed p50/p90/p99, which
+ * keeps the log volume and the measurement overhead low on busy pipelines.
+ * The flush period can be set with the 'interval' parameter (milliseconds,
+ * default 1000):
+ *
+ * ```
+ * GST_TRACERS="latency(flags=pipeline+aggregate,interval=5000)" GST_DEBUG=GST_TRACER:7 ./...
+ * ```
  */
 /* TODO(ensonic): if there are two sources feeding into a mixer/muxer and later
  * we fan-out with tee and have two sinks, each sink would get all two events,
@@ -44,6 +55,8 @@
 #  include "config.h"
 #endif
 
+#include <string.h>
+
 #include "gstlatency.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_latency_debug);
@@ -68,6 +81,131 @@ static GQuark drop_sub_latency_quark;
 static GstTracerRecord *tr_latency;
 static GstTracerRecord *tr_element_latency;
 static GstTracerRecord *tr_element_reported_latency;
+static GstTracerRecord *tr_latency_aggregate;
+
+#define DEFAULT_AGGREGATE_INTERVAL (GST_SECOND)
+
+/* log2 bucket histogram plus running stats for one src/sink pair */
+#define LATENCY_STATS_N_BUCKETS 64
+
+typedef struct
+{
+  gchar *src;
+  gchar *sink;
+  guint64 count;
+  guint64 sum;
+  guint64 min;
+  guint64 max;
+  guint buckets[LATENCY_STATS_N_BUCKETS];
+} LatencyStats;
+
+static void
+latency_stats_free (gpointer data)
+{
+  LatencyStats *stats = data;
+
+  g_free (stats->src);
+  g_free (stats->sink);
+  g_free (stats);
+}
+
+static inline guint
+latency_stats_bucket (guint64 latency)
+{
+  guint idx = 0;
+
+  while ((latency >>= 1))
+    idx++;
+
+  return MIN (idx, LATENCY_STATS_N_BUCKETS - 1);
+}
+
+/* value at (or just above) quantile @q, reported as the upper bound of the
+ * bucket it falls into */
+static guint64
+latency_stats_quantile (const LatencyStats * stats, gdouble q)
+{
+  guint64 rank = (guint64) (q * stats->count);
+  guint64 seen = 0;
+  guint i;
+
+  for (i = 0; i < LATENCY_STATS_N_BUCKETS; i++) {
+    seen += stats->buckets[i];
+    if (seen > rank) {
+      if (G_UNLIKELY (i == LATENCY_STATS_N_BUCKETS - 1))
+        break;
+      return G_GUINT64_CONSTANT (1) << (i + 1);
+    }
+  }
+  return stats->max;
+}
+
+/* must be called with the stats lock held */
+static void
+flush_aggregates (GstLatencyTracer * self, guint64 ts)
+{
+  GHashTableIter iter;
+  gpointer value;
+
+  g_hash_table_iter_init (&iter, self->stats);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    LatencyStats *stats = value;
+
+    if (stats->count == 0)
+      continue;
+
+    gst_tracer_record_log (tr_latency_aggregate, stats->src, stats->sink,
+        stats->count, stats->min, stats->max, stats->sum / stats->count,
+        latency_stats_quantile (stats, 0.50),
+        latency_stats_quantile (stats, 0.90),
+        latency_stats_quantile (stats, 0.99), ts);
+
+    stats->count = 0;
+    stats->sum = 0;
+    stats->min = 0;
+    stats->max = 0;
+    memset (stats->buckets, 0, sizeof (stats->buckets));
+  }
+  self->last_flush_ts = ts;
+}
+
+static void
+aggregate_latency (GstLatencyTracer * self, const gchar * src,
+    const gchar * sink, guint64 latency, guint64 ts)
+{
+  LatencyStats *stats;
+  gchar *key;
+
+  key = g_strdup_printf ("%s|%s", src, sink);
+
+  g_mutex_lock (&self->stats_lock);
+
+  stats = g_hash_table_lookup (self->stats, key);
+  if (stats == NULL) {
+    stats = g_new0 (LatencyStats, 1);
+    stats->src = g_strdup (src);
+    stats->sink = g_strdup (sink);
+    g_hash_table_insert (self->stats, key, stats);
+    key = NULL;
+  }
+
+  if (stats->count == 0 || latency < stats->min)
+    stats->min = latency;
+  if (latency > stats->max)
+    stats->max = latency;
+  stats->sum += latency;
+  stats->count++;
+  stats->buckets[latency_stats_bucket (latency)]++;
+
+  if (self->last_flush_ts == 0)
+    self->last_flush_ts = ts;
+  else if (ts - self->last_flush_ts >= self->interval)
+    flush_aggregates (self, ts);
+
+  g_mutex_unlock (&self->stats_lock);
+
+  g_free (key);
+}
 
 /* The private stack for each thread */
 static GPrivate latency_query_stack =
@@ -171,8 +309,8 @@ local_latency_query_stack_push (struct LatencyQueryTableValue *value)
 /* hooks */
 
 static void
-log_latency (const GstStructure * data, GstElement * sink_parent,
-    GstPad * sink_pad, guint64 sink_ts)
+log_latency (GstLatencyTracer * self, const GstStructure * data,
+    GstElement * sink_parent, GstPad * sink_pad, guint64 sink_ts)
 {
   guint64 src_ts;
   const char *src, *element_src, *id_element_src;
@@ -197,17 +335,27 @@ log_latency (const GstStructure * data, GstElement * sink_parent,
   id_element_sink = g_strdup_printf ("%p", sink_parent);
   element_sink = gst_element_get_name (sink_parent);
   sink = gst_pad_get_name (sink_pad);
-  gst_tracer_record_log (tr_latency, id_element_src, element_src, src,
-      id_element_sink, element_sink, sink, GST_CLOCK_DIFF (src_ts, sink_ts),
-      sink_ts);
+  if (self->flags & GST_LATENCY_TRACER_FLAG_AGGREGATE) {
+    gchar *src_key = g_strdup_printf ("%s.%s", element_src, src);
+    gchar *sink_key = g_strdup_printf ("%s.%s", element_sink, sink);
+
+    aggregate_latency (self, src_key, sink_key,
+        GST_CLOCK_DIFF (src_ts, sink_ts), sink_ts);
+    g_free (sink_key);
+    g_free (src_key);
+  } else {
+    gst_tracer_record_log (tr_latency, id_element_src, element_src, src,
+        id_element_sink, element_sink, sink, GST_CLOCK_DIFF (src_ts, sink_ts),
+        sink_ts);
+  }
   g_free (sink);
   g_free (element_sink);
   g_free (id_element_sink);
 }
 
 static void
-log_element_latency (const GstStructure * data, GstElement * parent,
-    GstPad * pad, guint64 sink_ts)
+log_element_latency (GstLatencyTracer * self, const GstStructure * data,
+    GstElement * parent, GstPad * pad, guint64 sink_ts)
 {
   guint64 src_ts;
   gchar *pad_name, *element_name, *element_id;
@@ -225,8 +373,16 @@ log_element_latency (const GstStructure * data, GstElement * parent,
   value = gst_structure_id_get_value (data, latency_probe_ts);
   src_ts = g_value_get_uint64 (value);
 
-  gst_tracer_record_log (tr_element_latency, element_id, element_name, pad_name,
-      GST_CLOCK_DIFF (src_ts, sink_ts), sink_ts);
+  if (self->flags & GST_LATENCY_TRACER_FLAG_AGGREGATE) {
+    gchar *src_key = g_strdup_printf ("%s.%s", element_name, pad_name);
+
+    aggregate_latency (self, src_key, "",
+        GST_CLOCK_DIFF (src_ts, sink_ts), sink_ts);
+    g_free (src_key);
+  } else {
+    gst_tracer_record_log (tr_element_latency, element_id, element_name,
+        pad_name, GST_CLOCK_DIFF (src_ts, sink_ts), sink_ts);
+  }
 
   g_free (pad_name);
   g_free (element_name);
@@ -297,7 +453,8 @@ send_latency_probe (GstLatencyTracer * self, GstElement * parent, GstPad * pad,
 }
 
 static void
-calculate_latency (GstElement * parent, GstPad * pad, guint64 ts)
+calculate_latency (GstLatencyTracer * self, GstElement * parent, GstPad * pad,
+    guint64 ts)
 {
   if (parent && (!GST_IS_BIN (parent)) &&
       (!GST_OBJECT_FLAG_IS_SET (parent, GST_ELEMENT_FLAG_SOURCE))) {
@@ -312,7 +469,8 @@ calculate_latency (GstElement * parent, GstPad * pad, guint64 ts)
       GST_DEBUG ("%s_%s: Should log full latency now (event %p)",
           GST_DEBUG_PAD_NAME (pad), ev);
       if (ev) {
-        log_latency (gst_event_get_structure (ev), peer_parent, peer_pad, ts);
+        log_latency (self, gst_event_get_structure (ev), peer_parent, peer_pad,
+            ts);
         g_object_set_qdata ((GObject *) pad, latency_probe_id, NULL);
       }
     }
@@ -321,7 +479,8 @@ calculate_latency (GstElement * parent, GstPad * pad, guint64 ts)
     GST_DEBUG ("%s_%s: Should log sub latency now (event %p)",
         GST_DEBUG_PAD_NAME (pad), ev);
     if (ev) {
-      log_element_latency (gst_event_get_structure (ev), parent, pad, ts);
+      log_element_latency (self, gst_event_get_structure (ev), parent, pad,
+          ts);
       g_object_set_qdata ((GObject *) pad, sub_latency_probe_id, NULL);
     }
     if (peer_pad)
@@ -338,7 +497,7 @@ do_push_buffer_pre (GstTracer * tracer, guint64 ts, GstPad * pad)
   GstElement *parent = get_real_pad_parent (pad);
 
   send_latency_probe (self, parent, pad, ts);
-  calculate_latency (parent, pad, ts);
+  calculate_latency (self, parent, pad, ts);
 
   if (parent)
     gst_object_unref (parent);
@@ -362,7 +521,7 @@ do_pull_range_post (GstTracer * self, guint64 ts, GstPad * pad)
 {
   GstElement *parent = get_real_pad_parent (pad);
 
-  calculate_latency (parent, pad, ts);
+  calculate_latency ((GstLatencyTracer *) self, parent, pad, ts);
 
   if (parent)
     gst_object_unref (parent);
@@ -583,24 +742,52 @@ gst_latency_tracer_constructed (GObject * object)
           self->flags |= GST_LATENCY_TRACER_FLAG_ELEMENT;
         else if (g_str_equal (split[i], "reported"))
           self->flags |= GST_LATENCY_TRACER_FLAG_REPORTED_ELEMENT;
+        else if (g_str_equal (split[i], "aggregate"))
+          self->flags |= GST_LATENCY_TRACER_FLAG_AGGREGATE;
         else
           GST_WARNING ("Invalid latency tracer flags %s", split[i]);
       }
 
       g_strfreev (split);
     }
+
+    /* flush interval for aggregate mode, in milliseconds */
+    {
+      gint interval;
+
+      if (gst_structure_get_int (params_struct, "interval", &interval) &&
+          interval > 0)
+        self->interval = (guint64) interval *GST_MSECOND;
+    }
     gst_structure_free (params_struct);
   }
 
   g_free (params);
 }
 
+static void
+gst_latency_tracer_finalize (GObject * object)
+{
+  GstLatencyTracer *self = GST_LATENCY_TRACER (object);
+
+  /* push out whatever is still pending */
+  g_mutex_lock (&self->stats_lock);
+  flush_aggregates (self, gst_util_get_timestamp ());
+  g_mutex_unlock (&self->stats_lock);
+
+  g_hash_table_destroy (self->stats);
+  g_mutex_clear (&self->stats_lock);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
 static void
 gst_latency_tracer_class_init (GstLatencyTracerClass * klass)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
 
   gobject_class->constructed = gst_latency_tracer_constructed;
+  gobject_class->finalize = gst_latency_tracer_finalize;
 
   latency_probe_id = g_quark_from_static_string ("latency_probe.id");
   sub_latency_probe_id = g_quark_from_static_string ("sub_latency_probe.id");
@@ -726,12 +913,73 @@ gst_latency_tracer_class_init (GstLatencyTracerClass * klass)
           "max", G_TYPE_UINT64, G_MAXUINT64,
           NULL),
       NULL);
+
+  tr_latency_aggregate = gst_tracer_record_new ("latency-aggregate.class",
+      "src", GST_TYPE_STRUCTURE, gst_structure_new ("scope",
+          "type", G_TYPE_GTYPE, G_TYPE_STRING,
+          "related-to", GST_TYPE_TRACER_VALUE_SCOPE, GST_TRACER_VALUE_SCOPE_PAD,
+          NULL),
+      "sink", GST_TYPE_STRUCTURE, gst_structure_new ("scope",
+          "type", G_TYPE_GTYPE, G_TYPE_STRING,
+          "related-to", GST_TYPE_TRACER_VALUE_SCOPE, GST_TRACER_VALUE_SCOPE_PAD,
+          NULL),
+      "count", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING,
+              "number of latency samples in this interval",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "min", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "minimum latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "max", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "maximum latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "avg", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "average latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "p50", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "median latency in ns (bucketed)",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "p90", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "90th percentile latency in ns (bucketed)",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "p99", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "99th percentile latency in ns (bucketed)",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "ts", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "ts when the interval was flushed",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      NULL);
   /* *INDENT-ON* */
 
   GST_OBJECT_FLAG_SET (tr_latency, GST_OBJECT_FLAG_MAY_BE_LEAKED);
   GST_OBJECT_FLAG_SET (tr_element_latency, GST_OBJECT_FLAG_MAY_BE_LEAKED);
   GST_OBJECT_FLAG_SET (tr_element_reported_latency,
       GST_OBJECT_FLAG_MAY_BE_LEAKED);
+  GST_OBJECT_FLAG_SET (tr_latency_aggregate, GST_OBJECT_FLAG_MAY_BE_LEAKED);
 }
 
 static void
@@ -742,6 +990,11 @@ gst_latency_tracer_init (GstLatencyTracer * self)
   /* only trace pipeline latency by default */
   self->flags = GST_LATENCY_TRACER_FLAG_PIPELINE;
 
+  self->interval = DEFAULT_AGGREGATE_INTERVAL;
+  g_mutex_init (&self->stats_lock);
+  self->stats = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      latency_stats_free);
+
   /* in push mode, pre/post will be called before/after the peer chain
    * function has been called. For this reaosn, we only use -pre to avoid
    * accounting for the processing time of the peer element (the sink) */
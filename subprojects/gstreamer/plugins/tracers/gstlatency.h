@@ -47,6 +47,7 @@ typedef enum
   GST_LATENCY_TRACER_FLAG_PIPELINE = 1 << 0,
   GST_LATENCY_TRACER_FLAG_ELEMENT = 1 << 1,
   GST_LATENCY_TRACER_FLAG_REPORTED_ELEMENT = 1 << 2,
+  GST_LATENCY_TRACER_FLAG_AGGREGATE = 1 << 3,
 } GstLatencyTracerFlags;
 
 /**
@@ -59,6 +60,12 @@ struct _GstLatencyTracer {
 
   /*< private >*/
   GstLatencyTracerFlags flags;
+
+  /* aggregate mode */
+  guint64 interval;             /* flush interval in ns */
+  GMutex stats_lock;
+  GHashTable *stats;            /* key string -> LatencyStats */
+  guint64 last_flush_ts;
 };
 
 struct _GstLatencyTracerClass {
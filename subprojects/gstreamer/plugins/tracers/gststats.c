@@ -23,6 +23,16 @@
  * @short_description: log event stats
  *
  * A tracing module that builds usage statistic for elements and pads.
+ *
+ * At high buffer rates logging every record is too expensive. With the
+ * 'sample-rate' parameter only every Nth buffer/event gets a full record,
+ * while cumulative per-pad buffer/byte/event counters are still kept and
+ * flushed as pad-counters.class records every 'interval' milliseconds
+ * (default 1000):
+ *
+ * ```
+ * GST_TRACERS="stats(sample-rate=100,interval=5000)" GST_DEBUG=GST_TRACER:7 ./...
+ * ```
  */
 
 #ifdef HAVE_CONFIG_H
@@ -54,6 +64,9 @@ static GstTracerRecord *tr_element_query;
 static GstTracerRecord *tr_event;
 static GstTracerRecord *tr_message;
 static GstTracerRecord *tr_query;
+static GstTracerRecord *tr_pad_counters;
+
+#define DEFAULT_COUNTER_INTERVAL (GST_SECOND)
 
 typedef struct
 {
@@ -63,6 +76,12 @@ typedef struct
   GstClockTime last_ts;
   /* hierarchy */
   guint parent_ix;
+  /* sampled mode: cumulative counters, only touched from the streaming
+   * thread that drives this pad */
+  guint64 num_buffers;
+  guint64 num_bytes;
+  guint64 num_events;
+  guint64 last_counter_flush;
 } GstPadStats;
 
 typedef struct
@@ -242,6 +261,25 @@ get_pad_stats (GstStatsTracer * self, GstPad * pad)
   return stats;
 }
 
+/* emit the cumulative pad counters at most once per interval, driven from
+ * the data path so no extra thread is needed */
+static void
+flush_pad_counters (GstStatsTracer * self, GstPadStats * stats,
+    GstClockTime ts)
+{
+  if (stats->last_counter_flush == 0) {
+    stats->last_counter_flush = ts;
+    return;
+  }
+  if (ts - stats->last_counter_flush < self->interval)
+    return;
+
+  gst_tracer_record_log (tr_pad_counters,
+      (guint64) (guintptr) g_thread_self (), ts, stats->index,
+      stats->num_buffers, stats->num_bytes, stats->num_events);
+  stats->last_counter_flush = ts;
+}
+
 static void
 do_buffer_stats (GstStatsTracer * self, GstPad * this_pad,
     GstPadStats * this_pad_stats, GstPad * that_pad,
@@ -255,6 +293,15 @@ do_buffer_stats (GstStatsTracer * self, GstPad * this_pad,
   GstClockTime dts = GST_BUFFER_DTS (buf);
   GstClockTime dur = GST_BUFFER_DURATION (buf);
 
+  if (self->sample_rate > 0) {
+    this_pad_stats->num_buffers++;
+    this_pad_stats->num_bytes += gst_buffer_get_size (buf);
+    flush_pad_counters (self, this_pad_stats, elapsed);
+    /* only every sample-rate'th buffer gets a full record */
+    if (this_pad_stats->num_buffers % self->sample_rate != 0)
+      return;
+  }
+
   gst_tracer_record_log (tr_buffer, (guint64) (guintptr) g_thread_self (),
       elapsed, this_pad_stats->index, this_elem_stats->index,
       that_pad_stats->index, that_elem_stats->index, gst_buffer_get_size (buf),
@@ -452,6 +499,14 @@ do_push_event_pre (GstStatsTracer * self, guint64 ts, GstPad * pad,
   GstPadStats *pad_stats = get_pad_stats (self, pad);
 
   elem_stats->last_ts = ts;
+
+  if (self->sample_rate > 0) {
+    pad_stats->num_events++;
+    flush_pad_counters (self, pad_stats, ts);
+    if (pad_stats->num_events % self->sample_rate != 0)
+      return;
+  }
+
   gst_tracer_record_log (tr_event, (guint64) (guintptr) g_thread_self (), ts,
       pad_stats->index, elem_stats->index, GST_EVENT_TYPE_NAME (ev));
 }
@@ -543,6 +598,20 @@ gst_stats_tracer_constructed (GObject * object)
   name = gst_structure_get_string (params_struct, "name");
   if (name)
     gst_object_set_name (GST_OBJECT (self), name);
+
+  /* sampled mode: log only every sample-rate'th buffer/event record, and
+   * emit cumulative per-pad counters every interval milliseconds */
+  {
+    gint sample_rate, interval;
+
+    if (gst_structure_get_int (params_struct, "sample-rate", &sample_rate) &&
+        sample_rate > 0)
+      self->sample_rate = sample_rate;
+
+    if (gst_structure_get_int (params_struct, "interval", &interval) &&
+        interval > 0)
+      self->interval = (guint64) interval *GST_MSECOND;
+  }
   gst_structure_free (params_struct);
 }
 
@@ -773,6 +842,33 @@ gst_stats_tracer_class_init (GstStatsTracerClass * klass)
           "description", G_TYPE_STRING, "ipad direction",
           NULL),
       NULL);
+
+  tr_pad_counters = gst_tracer_record_new ("pad-counters.class",
+      "thread-id", GST_TYPE_STRUCTURE, gst_structure_new ("scope",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "related-to", GST_TYPE_TRACER_VALUE_SCOPE, GST_TRACER_VALUE_SCOPE_THREAD,
+          NULL),
+      "ts", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "ts when the counters were flushed",
+          NULL),
+      "pad-ix", GST_TYPE_STRUCTURE, gst_structure_new ("scope",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT,
+          "related-to", GST_TYPE_TRACER_VALUE_SCOPE, GST_TRACER_VALUE_SCOPE_PAD,
+          NULL),
+      "buffers", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "cumulative number of buffers pushed",
+          NULL),
+      "bytes", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "cumulative number of bytes pushed",
+          NULL),
+      "events", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "cumulative number of events pushed",
+          NULL),
+      NULL);
   /* *INDENT-ON* */
 
   GST_OBJECT_FLAG_SET (tr_buffer, GST_OBJECT_FLAG_MAY_BE_LEAKED);
@@ -782,11 +878,15 @@ gst_stats_tracer_class_init (GstStatsTracerClass * klass)
   GST_OBJECT_FLAG_SET (tr_query, GST_OBJECT_FLAG_MAY_BE_LEAKED);
   GST_OBJECT_FLAG_SET (tr_new_element, GST_OBJECT_FLAG_MAY_BE_LEAKED);
   GST_OBJECT_FLAG_SET (tr_new_pad, GST_OBJECT_FLAG_MAY_BE_LEAKED);
+  GST_OBJECT_FLAG_SET (tr_pad_counters, GST_OBJECT_FLAG_MAY_BE_LEAKED);
 }
 
 static void
 gst_stats_tracer_init (GstStatsTracer * self)
 {
+  self->sample_rate = 0;
+  self->interval = DEFAULT_COUNTER_INTERVAL;
+
   GstTracer *tracer = GST_TRACER (self);
 
   gst_tracing_register_hook (tracer, "pad-push-pre",
@@ -52,6 +52,12 @@ struct _GstStatsTracer {
 
   /*< private >*/
   guint num_elements, num_pads;
+
+  /* sampled mode: log one full record every sample-rate buffers/events,
+   * 0 logs everything (the default) */
+  guint sample_rate;
+  /* counter flush interval in ns for sampled mode */
+  guint64 interval;
 };
 
 struct _GstStatsTracerClass {
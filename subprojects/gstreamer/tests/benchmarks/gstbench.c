@@ -0,0 +1,285 @@
+/* GStreamer
+ * Copyright (C) 2026 GStreamer developers
+ *
+ * gstbench.c: micro-benchmarks for core hot paths, built on GstHarness
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Timed runs over a handful of hot paths (pad push, queue handoff, caps
+ * intersection, buffer pool acquire) with optional hardware counters on
+ * Linux and machine-readable output for tracking baselines:
+ *
+ *   gstbench [--json] [<iterations>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gst/gst.h>
+#include <gst/check/gstharness.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define USE_PERF_COUNTERS 1
+#endif
+
+#define DEFAULT_ITERATIONS 100000
+#define BUFFER_SIZE 1400
+
+typedef struct
+{
+  const gchar *name;
+  guint64 iterations;
+  GstClockTimeDiff elapsed;
+  gint64 instructions;          /* -1 when not available */
+  gint64 cache_misses;          /* -1 when not available */
+} BenchResult;
+
+typedef void (*BenchFunc) (guint64 iterations);
+
+#ifdef USE_PERF_COUNTERS
+
+static int
+perf_counter_open (guint64 config)
+{
+  struct perf_event_attr attr;
+
+  memset (&attr, 0, sizeof (attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof (attr);
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  /* may fail without perf permissions, counters are then skipped */
+  return syscall (SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static gint64
+perf_counter_read (int fd)
+{
+  guint64 value;
+
+  if (fd < 0)
+    return -1;
+  if (read (fd, &value, sizeof (value)) != sizeof (value))
+    return -1;
+
+  return (gint64) value;
+}
+
+#endif /* USE_PERF_COUNTERS */
+
+static void
+run_bench (const gchar * name, BenchFunc func, guint64 iterations,
+    BenchResult * result)
+{
+  GstClockTime start, end;
+#ifdef USE_PERF_COUNTERS
+  int instr_fd, cache_fd;
+
+  instr_fd = perf_counter_open (PERF_COUNT_HW_INSTRUCTIONS);
+  cache_fd = perf_counter_open (PERF_COUNT_HW_CACHE_MISSES);
+  if (instr_fd >= 0)
+    ioctl (instr_fd, PERF_EVENT_IOC_ENABLE, 0);
+  if (cache_fd >= 0)
+    ioctl (cache_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+
+  start = gst_util_get_timestamp ();
+  func (iterations);
+  end = gst_util_get_timestamp ();
+
+  result->name = name;
+  result->iterations = iterations;
+  result->elapsed = GST_CLOCK_DIFF (start, end);
+  result->instructions = -1;
+  result->cache_misses = -1;
+
+#ifdef USE_PERF_COUNTERS
+  if (instr_fd >= 0) {
+    ioctl (instr_fd, PERF_EVENT_IOC_DISABLE, 0);
+    result->instructions = perf_counter_read (instr_fd);
+    close (instr_fd);
+  }
+  if (cache_fd >= 0) {
+    ioctl (cache_fd, PERF_EVENT_IOC_DISABLE, 0);
+    result->cache_misses = perf_counter_read (cache_fd);
+    close (cache_fd);
+  }
+#endif
+}
+
+static void
+bench_pad_push (guint64 iterations)
+{
+  GstHarness *h;
+  GstBuffer *buf;
+  guint64 i;
+
+  h = gst_harness_new ("identity");
+  gst_harness_set_src_caps_str (h, "foo/x-bar");
+
+  for (i = 0; i < iterations; i++) {
+    buf = gst_buffer_new_allocate (NULL, BUFFER_SIZE, NULL);
+    gst_harness_push (h, buf);
+    gst_buffer_unref (gst_harness_pull (h));
+  }
+
+  gst_harness_teardown (h);
+}
+
+static void
+bench_queue_handoff (guint64 iterations)
+{
+  GstHarness *h;
+  GstBuffer *buf;
+  guint64 i;
+
+  h = gst_harness_new ("queue");
+  gst_harness_set_src_caps_str (h, "foo/x-bar");
+
+  for (i = 0; i < iterations; i++) {
+    buf = gst_buffer_new_allocate (NULL, BUFFER_SIZE, NULL);
+    gst_harness_push (h, buf);
+    gst_buffer_unref (gst_harness_pull (h));
+  }
+
+  gst_harness_teardown (h);
+}
+
+static void
+bench_caps_intersect (guint64 iterations)
+{
+  GstCaps *c1, *c2, *res;
+  guint64 i;
+
+  c1 = gst_caps_from_string ("video/x-raw, format=(string){ I420, NV12 }, "
+      "width=(int)[ 16, 4096 ], height=(int)[ 16, 4096 ], "
+      "framerate=(fraction)[ 0/1, 120/1 ]");
+  c2 = gst_caps_from_string ("video/x-raw, format=(string)NV12, "
+      "width=(int)1920, height=(int)1080, framerate=(fraction)30/1");
+
+  for (i = 0; i < iterations; i++) {
+    res = gst_caps_intersect (c1, c2);
+    gst_caps_unref (res);
+  }
+
+  gst_caps_unref (c1);
+  gst_caps_unref (c2);
+}
+
+static void
+bench_pool_acquire (guint64 iterations)
+{
+  GstBufferPool *pool;
+  GstStructure *conf;
+  GstBuffer *buf;
+  guint64 i;
+
+  pool = gst_buffer_pool_new ();
+  conf = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (conf, NULL, BUFFER_SIZE, 0, 0);
+  gst_buffer_pool_set_config (pool, conf);
+  gst_buffer_pool_set_active (pool, TRUE);
+
+  for (i = 0; i < iterations; i++) {
+    gst_buffer_pool_acquire_buffer (pool, &buf, NULL);
+    gst_buffer_unref (buf);
+  }
+
+  gst_buffer_pool_set_active (pool, FALSE);
+  gst_object_unref (pool);
+}
+
+static void
+print_result (const BenchResult * r, gboolean json, gboolean last)
+{
+  if (json) {
+    g_print ("  { \"name\": \"%s\", \"iterations\": %" G_GUINT64_FORMAT ", "
+        "\"total-ns\": %" G_GINT64_FORMAT ", \"ns-per-iter\": %"
+        G_GINT64_FORMAT, r->name, r->iterations, r->elapsed,
+        r->elapsed / (gint64) r->iterations);
+    if (r->instructions >= 0)
+      g_print (", \"instructions-per-iter\": %" G_GINT64_FORMAT,
+          r->instructions / (gint64) r->iterations);
+    if (r->cache_misses >= 0)
+      g_print (", \"cache-misses-per-iter\": %" G_GINT64_FORMAT,
+          r->cache_misses / (gint64) r->iterations);
+    g_print (" }%s\n", last ? "" : ",");
+  } else {
+    g_print ("*** %-16s total %" GST_TIME_FORMAT " - average %"
+        GST_TIME_FORMAT " over %" G_GUINT64_FORMAT " iterations\n",
+        r->name, GST_TIME_ARGS (r->elapsed),
+        GST_TIME_ARGS (r->elapsed / r->iterations), r->iterations);
+    if (r->instructions >= 0)
+      g_print ("    %" G_GINT64_FORMAT " instructions/iter\n",
+          r->instructions / (gint64) r->iterations);
+    if (r->cache_misses >= 0)
+      g_print ("    %" G_GINT64_FORMAT " cache misses/iter\n",
+          r->cache_misses / (gint64) r->iterations);
+  }
+}
+
+gint
+main (gint argc, gchar * argv[])
+{
+  struct
+  {
+    const gchar *name;
+    BenchFunc func;
+  } benches[] = {
+    {"pad-push", bench_pad_push},
+    {"queue-handoff", bench_queue_handoff},
+    {"caps-intersect", bench_caps_intersect},
+    {"pool-acquire", bench_pool_acquire},
+  };
+  BenchResult results[G_N_ELEMENTS (benches)];
+  guint64 iterations = DEFAULT_ITERATIONS;
+  gboolean json = FALSE;
+  guint i;
+
+  gst_init (&argc, &argv);
+
+  for (i = 1; i < (guint) argc; i++) {
+    if (strcmp (argv[i], "--json") == 0)
+      json = TRUE;
+    else
+      iterations = g_ascii_strtoull (argv[i], NULL, 10);
+  }
+
+  if (iterations == 0) {
+    g_print ("usage: %s [--json] [<iterations>]\n", argv[0]);
+    exit (-1);
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (benches); i++)
+    run_bench (benches[i].name, benches[i].func, iterations, &results[i]);
+
+  if (json)
+    g_print ("[\n");
+  for (i = 0; i < G_N_ELEMENTS (benches); i++)
+    print_result (&results[i], json, i == G_N_ELEMENTS (benches) - 1);
+  if (json)
+    g_print ("]\n");
+
+  return 0;
+}
@@ -1988,6 +1988,50 @@ GST_START_TEST (test_suppressed_flags_when_removing)
 
 GST_END_TEST;
 
+GST_START_TEST (test_topology_cookie)
+{
+  GstBin *bin, *sub_bin;
+  GstElement *identity;
+  guint32 cookie, new_cookie;
+  gchar *data;
+
+  bin = GST_BIN (gst_bin_new (NULL));
+  fail_unless (bin != NULL, "Could not create bin");
+
+  cookie = gst_bin_get_topology_cookie (bin);
+  fail_unless (cookie != 0);
+
+  /* adding a child changes the cookie */
+  sub_bin = GST_BIN (gst_bin_new (NULL));
+  gst_bin_add (bin, GST_ELEMENT (sub_bin));
+  new_cookie = gst_bin_get_topology_cookie (bin);
+  fail_unless (new_cookie != cookie);
+  cookie = new_cookie;
+
+  /* adding to a sub-bin changes the cookie of the parent too */
+  identity = gst_element_factory_make ("identity", NULL);
+  gst_bin_add (sub_bin, identity);
+  new_cookie = gst_bin_get_topology_cookie (bin);
+  fail_unless (new_cookie != cookie);
+  cookie = new_cookie;
+
+  /* no change, no new snapshot */
+  fail_unless (gst_debug_bin_to_dot_data_if_changed (bin,
+          GST_DEBUG_GRAPH_SHOW_ALL, &cookie) == NULL);
+
+  /* removing deep changes the cookie and a new snapshot is generated */
+  gst_bin_remove (sub_bin, identity);
+  data = gst_debug_bin_to_dot_data_if_changed (bin,
+      GST_DEBUG_GRAPH_SHOW_ALL, &cookie);
+  fail_unless (data != NULL);
+  g_free (data);
+  fail_unless_equals_int (cookie, gst_bin_get_topology_cookie (bin));
+
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
 static Suite *
 gst_bin_suite (void)
 {
@@ -2023,6 +2067,7 @@ gst_bin_suite (void)
   tcase_add_test (tc_chain, test_deep_added_removed);
   tcase_add_test (tc_chain, test_suppressed_flags);
   tcase_add_test (tc_chain, test_suppressed_flags_when_removing);
+  tcase_add_test (tc_chain, test_topology_cookie);
 
   /* fails on OSX build bot for some reason, and is a bit silly anyway */
   if (0)
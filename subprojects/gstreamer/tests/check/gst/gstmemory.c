@@ -738,6 +738,65 @@ GST_START_TEST (test_no_error_and_no_warning_on_map_failure)
 GST_END_TEST;
 #endif /* !GST_DISABLE_GST_DEBUG */
 
+GST_START_TEST (test_arena_allocator)
+{
+  GstAllocator *alloc;
+  GstMemory *mem, *copy, *sub;
+  GstMapInfo info, sinfo;
+  gint i;
+
+  alloc = gst_allocator_find (GST_ALLOCATOR_ARENA);
+  fail_unless (alloc != NULL);
+
+  /* allocate enough small memories to force a block refill */
+  for (i = 0; i < 1000; i++) {
+    mem = gst_allocator_alloc (alloc, 128, NULL);
+    fail_unless (mem != NULL);
+
+    fail_unless (gst_memory_map (mem, &info, GST_MAP_WRITE));
+    fail_unless (info.size == 128);
+    memset (info.data, i & 0xff, 128);
+    gst_memory_unmap (mem, &info);
+
+    gst_memory_unref (mem);
+  }
+
+  mem = gst_allocator_alloc (alloc, 100, NULL);
+  fail_unless (gst_memory_map (mem, &info, GST_MAP_WRITE));
+  for (i = 0; i < 100; i++)
+    info.data[i] = i;
+  gst_memory_unmap (mem, &info);
+
+  /* copy carves a new memory */
+  copy = gst_memory_copy (mem, 0, -1);
+  fail_unless (gst_memory_map (copy, &info, GST_MAP_READ));
+  fail_unless (info.size == 100);
+  for (i = 0; i < 100; i++)
+    fail_unless (info.data[i] == i);
+  gst_memory_unmap (copy, &info);
+  gst_memory_unref (copy);
+
+  /* share keeps the data in the parent block */
+  sub = gst_memory_share (mem, 20, 30);
+  fail_unless (gst_memory_map (sub, &sinfo, GST_MAP_READ));
+  fail_unless (sinfo.size == 30);
+  fail_unless (sinfo.data[0] == 20);
+  gst_memory_unmap (sub, &sinfo);
+  gst_memory_unref (sub);
+
+  /* large allocations get a dedicated block */
+  gst_memory_unref (mem);
+  mem = gst_allocator_alloc (alloc, 1024 * 1024, NULL);
+  fail_unless (gst_memory_map (mem, &info, GST_MAP_WRITE));
+  fail_unless (info.size == 1024 * 1024);
+  gst_memory_unmap (mem, &info);
+  gst_memory_unref (mem);
+
+  gst_object_unref (alloc);
+}
+
+GST_END_TEST;
+
 static Suite *
 gst_memory_suite (void)
 {
@@ -757,6 +816,7 @@ gst_memory_suite (void)
   tcase_add_test (tc_chain, test_map_resize);
   tcase_add_test (tc_chain, test_alloc_params);
   tcase_add_test (tc_chain, test_lock);
+  tcase_add_test (tc_chain, test_arena_allocator);
 #ifndef GST_DISABLE_GST_DEBUG
   tcase_add_test (tc_chain, test_no_error_and_no_warning_on_map_failure);
 #endif
@@ -1169,6 +1169,58 @@ GST_START_TEST (segment_negative_applied_rate)
 
 GST_END_TEST;
 
+GST_START_TEST (segment_to_running_time_batch)
+{
+  GstSegment segment;
+  guint64 positions[] = { 0, 10, 50, 100, 150, 200, 220, (guint64) - 1 };
+  guint64 running_times[G_N_ELEMENTS (positions)];
+  guint i;
+
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+
+  segment.start = 50;
+  segment.position = 150;
+  segment.stop = 200;
+  segment.time = 0;
+
+  /* batch conversion must agree with the one-by-one conversion */
+  gst_segment_to_running_time_batch (&segment, GST_FORMAT_TIME, positions,
+      running_times, G_N_ELEMENTS (positions));
+  for (i = 0; i < G_N_ELEMENTS (positions); i++)
+    fail_unless_equals_uint64 (running_times[i],
+        gst_segment_to_running_time (&segment, GST_FORMAT_TIME, positions[i]));
+
+  /* with a base and an offset */
+  segment.base = 100;
+  segment.offset = 30;
+  gst_segment_to_running_time_batch (&segment, GST_FORMAT_TIME, positions,
+      running_times, G_N_ELEMENTS (positions));
+  for (i = 0; i < G_N_ELEMENTS (positions); i++)
+    fail_unless_equals_uint64 (running_times[i],
+        gst_segment_to_running_time (&segment, GST_FORMAT_TIME, positions[i]));
+
+  /* offset bigger than the base, positions below start + offset are out */
+  segment.base = 10;
+  segment.offset = 40;
+  gst_segment_to_running_time_batch (&segment, GST_FORMAT_TIME, positions,
+      running_times, G_N_ELEMENTS (positions));
+  for (i = 0; i < G_N_ELEMENTS (positions); i++)
+    fail_unless_equals_uint64 (running_times[i],
+        gst_segment_to_running_time (&segment, GST_FORMAT_TIME, positions[i]));
+
+  /* non-1.0 rates take the generic path */
+  segment.base = 0;
+  segment.offset = 0;
+  segment.rate = 2.0;
+  gst_segment_to_running_time_batch (&segment, GST_FORMAT_TIME, positions,
+      running_times, G_N_ELEMENTS (positions));
+  for (i = 0; i < G_N_ELEMENTS (positions); i++)
+    fail_unless_equals_uint64 (running_times[i],
+        gst_segment_to_running_time (&segment, GST_FORMAT_TIME, positions[i]));
+}
+
+GST_END_TEST;
+
 static Suite *
 gst_segment_suite (void)
 {
@@ -1189,6 +1241,7 @@ gst_segment_suite (void)
   tcase_add_test (tc_chain, segment_negative_rate);
   tcase_add_test (tc_chain, segment_negative_applied_rate);
   tcase_add_test (tc_chain, segment_stream_time_full);
+  tcase_add_test (tc_chain, segment_to_running_time_batch);
 
   return s;
 }
@@ -40,6 +40,9 @@ static GPtrArray *pads = NULL;
 static GHashTable *latencies = NULL;
 static GHashTable *element_latencies = NULL;
 static GQueue *element_reported_latencies = NULL;
+/* last entry of element_reported_latencies per element, so repeated
+ * reports of an unchanged latency don't grow the queue */
+static GHashTable *last_reported_latencies = NULL;
 static guint64 num_buffers = 0, num_events = 0, num_messages = 0, num_queries =
     0;
 static guint num_elements = 0, num_bins = 0, num_pads = 0, num_ghostpads = 0;
@@ -53,6 +56,8 @@ static gboolean have_latency = FALSE;
 static gboolean have_element_latency = FALSE;
 static gboolean have_element_reported_latency = FALSE;
 
+#define LATENCY_BUCKETS 64
+
 typedef struct
 {
   /* display name of the element */
@@ -66,6 +71,9 @@ typedef struct
   /* the max of all latencies */
   guint64 max;
   GstClockTime first_latency_ts;
+  /* log2 histogram of the latencies, for percentile estimates with
+   * bounded memory regardless of the log size */
+  guint64 buckets[LATENCY_BUCKETS];
 } GstLatencyStats;
 
 typedef struct
@@ -150,14 +158,59 @@ sort_latency_stats_by_first_ts (gconstpointer a, gconstpointer b)
   return (GST_CLOCK_DIFF (ls2->first_latency_ts, ls1->first_latency_ts));
 }
 
+/* the bucket with index ix holds latencies in [2^ix, 2^(ix+1)), except
+ * bucket 0 which also holds 0 */
+static inline guint
+latency_bucket_index (guint64 time)
+{
+  guint ix = 0;
+
+  while (time > 1 && ix < LATENCY_BUCKETS - 1) {
+    time >>= 1;
+    ix++;
+  }
+  return ix;
+}
+
+/* Estimate a percentile from the log2 histogram, interpolating linearly
+ * inside the bucket the percentile falls into */
+static guint64
+estimate_latency_percentile (const GstLatencyStats * ls, gdouble percentile)
+{
+  guint64 target, cum = 0;
+  guint i;
+
+  target = (guint64) (percentile * ls->count + 0.5);
+  if (target < 1)
+    target = 1;
+
+  for (i = 0; i < LATENCY_BUCKETS; i++) {
+    if (cum + ls->buckets[i] >= target) {
+      guint64 lower = (i == 0) ? 0 : G_GUINT64_CONSTANT (1) << i;
+      guint64 width = (i == 0) ? 2 : lower;
+      gdouble frac = (gdouble) (target - cum) / (gdouble) ls->buckets[i];
+      guint64 estimate = lower + (guint64) (frac * width);
+
+      return CLAMP (estimate, ls->min, ls->max);
+    }
+    cum += ls->buckets[i];
+  }
+  return ls->max;
+}
+
 static void
 print_latency_stats (gpointer value, gpointer user_data)
 {
   GstLatencyStats *ls = value;
 
   printf ("\t%s: mean=%" GST_TIME_FORMAT " min=%" GST_TIME_FORMAT " max=%"
-      GST_TIME_FORMAT "\n", ls->name, GST_TIME_ARGS (ls->total / ls->count),
-      GST_TIME_ARGS (ls->min), GST_TIME_ARGS (ls->max));
+      GST_TIME_FORMAT " p50=%" GST_TIME_FORMAT " p95=%" GST_TIME_FORMAT
+      " p99=%" GST_TIME_FORMAT " count=%" G_GUINT64_FORMAT "\n", ls->name,
+      GST_TIME_ARGS (ls->total / ls->count),
+      GST_TIME_ARGS (ls->min), GST_TIME_ARGS (ls->max),
+      GST_TIME_ARGS (estimate_latency_percentile (ls, 0.50)),
+      GST_TIME_ARGS (estimate_latency_percentile (ls, 0.95)),
+      GST_TIME_ARGS (estimate_latency_percentile (ls, 0.99)), ls->count);
 }
 
 static void
@@ -563,6 +616,7 @@ update_latency_table (GHashTable * table, const gchar * key, guint64 time,
     if (ls->max < time)
       ls->max = time;
   }
+  ls->buckets[latency_bucket_index (time)]++;
 }
 
 static void
@@ -633,7 +687,8 @@ do_element_reported_latency (GstStructure * s)
 {
   const gchar *element = NULL, *element_id = NULL;
   guint64 ts = 0, min = 0, max = 0;
-  GstReportedLatency *rl = NULL;
+  gchar *element_name = NULL;
+  GstReportedLatency *rl = NULL, *prev;
 
   /* Get the values from the structure */
   element_id = gst_structure_get_string (s, "element-id");
@@ -645,13 +700,25 @@ do_element_reported_latency (GstStructure * s)
   /* Update last_ts */
   last_ts = MAX (last_ts, ts);
 
+  element_name = g_strdup_printf ("%s.%s", element_id, element);
+
+  /* Only keep records that actually change something, so that the list
+   * stays bounded when parsing very long logs */
+  prev = g_hash_table_lookup (last_reported_latencies, element_name);
+  if (prev && prev->min == min && prev->max == max) {
+    g_free (element_name);
+    return;
+  }
+
   /* Insert/Update the key in the table */
   rl = g_new0 (GstReportedLatency, 1);
-  rl->element = g_strdup_printf ("%s.%s", element_id, element);
+  rl->element = element_name;
   rl->ts = ts;
   rl->min = min;
   rl->max = max;
   g_queue_push_tail (element_reported_latencies, rl);
+  /* the key and value are owned by the queue */
+  g_hash_table_replace (last_reported_latencies, rl->element, rl);
 
   have_element_reported_latency = TRUE;
 }
@@ -963,6 +1030,7 @@ init (void)
   element_latencies = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
       free_latency_stats);
   element_reported_latencies = g_queue_new ();
+  last_reported_latencies = g_hash_table_new (g_str_hash, g_str_equal);
 
   plugin_stats = g_ptr_array_new_with_free_func (free_plugin_stats);
 
@@ -989,6 +1057,10 @@ done (void)
     g_hash_table_destroy (element_latencies);
     element_latencies = NULL;
   }
+  if (last_reported_latencies) {
+    g_hash_table_destroy (last_reported_latencies);
+    last_reported_latencies = NULL;
+  }
   if (element_reported_latencies) {
     g_queue_free_full (element_reported_latencies, free_reported_latency);
     element_reported_latencies = NULL;
@@ -1167,95 +1239,102 @@ static void
 collect_stats (const gchar * filename)
 {
   FILE *log;
+  gboolean is_stdin = (strcmp (filename, "-") == 0);
+
+  if (is_stdin)
+    log = stdin;
+  else
+    log = fopen (filename, "rt");
 
-  if ((log = fopen (filename, "rt"))) {
+  if (log) {
     gchar line[5001];
+    GMatchInfo *match_info;
+    GRegex *parser = NULL;
+    GstStructure *s;
+    guint lnr = 0;
+    gchar *level, *data;
+
+    /* parse the log */
+    while (!feof (log)) {
+      if (fgets (line, 5000, log)) {
+        /* probe the format on the first line, so the input does not need
+         * to be seekable and a log can be piped in while it is written */
+        if (parser == NULL) {
+          if (strchr (line, 27)) {
+            parser = ansi_log;
+            GST_INFO ("format is 'ansi'");
+          } else {
+            parser = raw_log;
+            GST_INFO ("format is 'raw'");
+          }
+        }
 
-    /* probe format */
-    if (fgets (line, 5000, log)) {
-      GMatchInfo *match_info;
-      GRegex *parser;
-      GstStructure *s;
-      guint lnr = 0;
-      gchar *level, *data;
-
-      if (strchr (line, 27)) {
-        parser = ansi_log;
-        GST_INFO ("format is 'ansi'");
-      } else {
-        parser = raw_log;
-        GST_INFO ("format is 'raw'");
-      }
-      rewind (log);
-
-      /* parse the log */
-      while (!feof (log)) {
-        if (fgets (line, 5000, log)) {
-          if (g_regex_match (parser, line, 0, &match_info)) {
-            /* filter by level */
-            level = g_match_info_fetch (match_info, 4);
-            if (!strcmp (level, "TRACE")) {
-              data = g_match_info_fetch (match_info, 7);
-              if ((s = gst_structure_from_string (data, NULL))) {
-                const gchar *name = gst_structure_get_name (s);
-
-                if (!strcmp (name, "new-pad")) {
-                  new_pad_stats (s);
-                } else if (!strcmp (name, "new-element")) {
-                  new_element_stats (s);
-                } else if (!strcmp (name, "buffer")) {
-                  do_buffer_stats (s);
-                } else if (!strcmp (name, "event")) {
-                  do_event_stats (s);
-                } else if (!strcmp (name, "message")) {
-                  do_message_stats (s);
-                } else if (!strcmp (name, "query")) {
-                  do_query_stats (s);
-                } else if (!strcmp (name, "thread-rusage")) {
-                  do_thread_rusage_stats (s);
-                } else if (!strcmp (name, "proc-rusage")) {
-                  do_proc_rusage_stats (s);
-                } else if (!strcmp (name, "latency")) {
-                  do_latency_stats (s);
-                } else if (!strcmp (name, "element-latency")) {
-                  do_element_latency_stats (s);
-                } else if (!strcmp (name, "element-reported-latency")) {
-                  do_element_reported_latency (s);
-                } else if (!strcmp (name, "factory-used")) {
-                  do_factory_used (s);
-                } else {
-                  // TODO(ensonic): parse the xxx.class log lines
-                  if (!g_str_has_suffix (data, ".class")) {
-                    GST_WARNING ("unknown log entry: '%s'", data);
-                  }
-                }
-                gst_structure_free (s);
+        if (g_regex_match (parser, line, 0, &match_info)) {
+          /* filter by level */
+          level = g_match_info_fetch (match_info, 4);
+          if (!strcmp (level, "TRACE")) {
+            data = g_match_info_fetch (match_info, 7);
+            if ((s = gst_structure_from_string (data, NULL))) {
+              const gchar *name = gst_structure_get_name (s);
+
+              if (!strcmp (name, "new-pad")) {
+                new_pad_stats (s);
+              } else if (!strcmp (name, "new-element")) {
+                new_element_stats (s);
+              } else if (!strcmp (name, "buffer")) {
+                do_buffer_stats (s);
+              } else if (!strcmp (name, "event")) {
+                do_event_stats (s);
+              } else if (!strcmp (name, "message")) {
+                do_message_stats (s);
+              } else if (!strcmp (name, "query")) {
+                do_query_stats (s);
+              } else if (!strcmp (name, "thread-rusage")) {
+                do_thread_rusage_stats (s);
+              } else if (!strcmp (name, "proc-rusage")) {
+                do_proc_rusage_stats (s);
+              } else if (!strcmp (name, "latency")) {
+                do_latency_stats (s);
+              } else if (!strcmp (name, "element-latency")) {
+                do_element_latency_stats (s);
+              } else if (!strcmp (name, "element-reported-latency")) {
+                do_element_reported_latency (s);
+              } else if (!strcmp (name, "factory-used")) {
+                do_factory_used (s);
               } else {
-                GST_WARNING ("unknown log entry: '%s'", data);
+                // TODO(ensonic): parse the xxx.class log lines
+                if (!g_str_has_suffix (data, ".class")) {
+                  GST_WARNING ("unknown log entry: '%s'", data);
+                }
               }
-              g_free (data);
-            }
-            g_free (level);
-          } else {
-            if (*line) {
-              GST_WARNING ("foreign log entry: %s:%d:'%s'", filename, lnr,
-                  g_strchomp (line));
+              gst_structure_free (s);
+            } else {
+              GST_WARNING ("unknown log entry: '%s'", data);
             }
+            g_free (data);
           }
-          g_match_info_free (match_info);
-          match_info = NULL;
-          lnr++;
+          g_free (level);
         } else {
-          if (!feof (log)) {
-            // TODO(ensonic): run wc -L on the log file
-            fprintf (stderr, "line too long");
+          if (*line) {
+            GST_WARNING ("foreign log entry: %s:%d:'%s'", filename, lnr,
+                g_strchomp (line));
           }
         }
+        g_match_info_free (match_info);
+        match_info = NULL;
+        lnr++;
+      } else {
+        if (!feof (log)) {
+          // TODO(ensonic): run wc -L on the log file
+          fprintf (stderr, "line too long");
+        }
       }
-    } else {
+    }
+    if (lnr == 0) {
       GST_WARNING ("empty log");
     }
-    fclose (log);
+    if (!is_stdin)
+      fclose (log);
   }
 }
 
@@ -1283,7 +1362,7 @@ main (gint argc, gchar * argv[])
 
   g_set_prgname ("gst-stats-" GST_API_VERSION);
 
-  ctx = g_option_context_new ("FILE");
+  ctx = g_option_context_new ("FILE (\"-\" = stdin)");
   g_option_context_add_main_entries (ctx, options, GETTEXT_PACKAGE);
   g_option_context_add_group (ctx, gst_init_get_option_group ());
   if (!g_option_context_parse (ctx, &argc, &argv, &err)) {